@@ -0,0 +1,841 @@
+/**
+ * @file utf8/benchmarks/bench_utf8_byte.c
+ * @brief Throughput benchmarks for the byte-oriented API.
+ *
+ * Usage: bench_utf8_byte [megabytes]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <omp.h>
+
+#include "simd.h"
+#include "validate.h"
+#include "case.h"
+#include "normal.h"
+#include "byte.h"
+#include "search.h"
+#include "parallel.h"
+#include "interner.h"
+#include "codepoint.h"
+#include "transcode.h"
+
+typedef int64_t (*BenchCountFn)(const uint8_t* start);
+
+// The original byte-at-a-time loop, kept as the reference point.
+__attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+static int64_t bench_count_loop(const uint8_t* start) {
+    int64_t count = 0;
+    while (start[count]) {
+        count++;
+    }
+    return count;
+}
+
+__attribute__((noinline)) static int64_t bench_count_strlen(const uint8_t* start) {
+    return (int64_t) strlen((const char*) start);
+}
+
+__attribute__((noinline)) static int64_t bench_count_utf8(const uint8_t* start) {
+    return utf8_byte_count(start);
+}
+
+static double bench_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double) ts.tv_sec + (double) ts.tv_nsec * 1e-9;
+}
+
+// Runs fn repeatedly over src and reports the best observed throughput in GB/s.
+static double bench_count(BenchCountFn fn, const uint8_t* src, size_t len) {
+    size_t rounds = len < (1 << 20) ? ((size_t) 64 << 20) / (len + 1) : 16;
+    double best = 0.0;
+
+    for (int trial = 0; trial < 5; trial++) {
+        volatile int64_t sink = 0;
+        double start = bench_now();
+        for (size_t i = 0; i < rounds; i++) {
+            sink += fn(src);
+        }
+        double elapsed = bench_now() - start;
+        if (sink != (int64_t) (len * rounds)) {
+            fprintf(stderr, "[bench] count mismatch\n");
+            exit(1);
+        }
+
+        double rate = (double) len * (double) rounds / elapsed / 1e9;
+        if (rate > best) {
+            best = rate;
+        }
+    }
+
+    return best;
+}
+
+// The original split_delim scan: memcmp at every byte position.
+__attribute__((noinline)) static int64_t bench_find_loop(UTF8View src, UTF8View delim) {
+    int64_t count = 0;
+    size_t scan = 0;
+    while (delim.len <= src.len - scan) {
+        if (memcmp(src.ptr + scan, delim.ptr, delim.len) == 0) {
+            count++;
+            scan += delim.len;
+        } else {
+            scan++;
+        }
+    }
+    return count;
+}
+
+// Counts delimiters in a CSV-like buffer; reports GB/s for the loop and each kernel level.
+static void bench_find(uint8_t* src, size_t len, const char* delim_str) {
+    UTF8View delim = utf8_view((const uint8_t*) delim_str);
+    const char* fields[] = {"2024-01-01T00:00:00Z", "INFO", "\xE6\x97\xA5\xE6\x9C\xAC", "ok", "42"};
+    size_t pos = 0;
+    for (size_t i = 0; pos < len; i++) {
+        const char* field = fields[i % 5];
+        for (size_t j = 0; field[j] && pos < len; j++) {
+            src[pos++] = (uint8_t) field[j];
+        }
+        for (size_t j = 0; j < delim.len && pos < len; j++) {
+            src[pos++] = delim.ptr[j];
+        }
+    }
+    UTF8View view = utf8_view_n(src, len);
+
+    UTF8SimdLevel detected = utf8_simd_detect();
+    printf("delimiter '%s' over %zu bytes (GB/s, best of 5)\n", delim_str, len);
+
+    double best = 0.0;
+    int64_t expected = 0;
+    for (int trial = 0; trial < 5; trial++) {
+        double start = bench_now();
+        expected = bench_find_loop(view, delim);
+        double rate = (double) len / (bench_now() - start) / 1e9;
+        best = rate > best ? rate : best;
+    }
+    printf("%10s %10.2f\n", "loop", best);
+
+    for (int level = UTF8_SIMD_NONE; level <= (int) detected; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+        best = 0.0;
+        for (int trial = 0; trial < 5; trial++) {
+            double start = bench_now();
+            int64_t count = utf8_byte_find_count(view, delim);
+            double rate = (double) len / (bench_now() - start) / 1e9;
+            best = rate > best ? rate : best;
+            if (count != expected) {
+                fprintf(stderr, "[bench] find mismatch\n");
+                exit(1);
+            }
+        }
+        printf("%10s %10.2f\n", utf8_simd_name((UTF8SimdLevel) level), best);
+    }
+    utf8_simd_set_level(detected);
+}
+
+// The original byte-at-a-time comparison, kept as the reference point.
+__attribute__((noinline)) static int bench_cmp_loop(const uint8_t* a, const uint8_t* b) {
+    while (*a && *b) {
+        if (*a != *b) {
+            return *a < *b ? -1 : 1;
+        }
+        a++;
+        b++;
+    }
+    return *a ? 1 : (*b ? -1 : 0);
+}
+
+__attribute__((noinline)) static int bench_cmp_strcmp(const uint8_t* a, const uint8_t* b) {
+    return strcmp((const char*) a, (const char*) b);
+}
+
+__attribute__((noinline)) static int bench_cmp_utf8(const uint8_t* a, const uint8_t* b) {
+    return utf8_byte_cmp(a, b);
+}
+
+typedef int (*BenchCmpFn)(const uint8_t* a, const uint8_t* b);
+
+// Compares two strings that differ only in their final byte; reports GB/s scanned.
+static double bench_cmp(BenchCmpFn fn, const uint8_t* a, const uint8_t* b, size_t len) {
+    size_t rounds = ((size_t) 256 << 20) / (len + 1);
+    double best = 0.0;
+
+    for (int trial = 0; trial < 5; trial++) {
+        volatile int sink = 0;
+        double start = bench_now();
+        for (size_t i = 0; i < rounds; i++) {
+            sink += fn(a, b);
+        }
+        double elapsed = bench_now() - start;
+        if (sink != -(int) rounds) {
+            fprintf(stderr, "[bench] cmp mismatch\n");
+            exit(1);
+        }
+
+        double rate = (double) len * (double) rounds / elapsed / 1e9;
+        best = rate > best ? rate : best;
+    }
+
+    return best;
+}
+
+static void bench_cmp_sizes(void) {
+    UTF8SimdLevel detected = utf8_simd_detect();
+    printf("utf8_byte_cmp (GB/s, best of 5)\n");
+    printf("%12s %10s %10s", "bytes", "loop", "strcmp");
+    for (int level = UTF8_SIMD_NONE; level <= (int) detected; level++) {
+        printf(" %10s", utf8_simd_name((UTF8SimdLevel) level));
+    }
+    printf("\n");
+
+    size_t sizes[] = {16, 64, 4096, 1 << 20};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(size_t); i++) {
+        size_t len = sizes[i];
+        // Offset b by one byte so the inputs never share an alignment
+        uint8_t* a = malloc(len + 1);
+        uint8_t* b = malloc(len + 2);
+        if (!a || !b) {
+            fprintf(stderr, "[bench] allocation failed\n");
+            exit(1);
+        }
+        memset(a, 'k', len);
+        memset(b + 1, 'k', len);
+        a[len - 1] = 'a';
+        b[len] = 'b';
+        a[len] = '\0';
+        b[len + 1] = '\0';
+
+        printf("%12zu", len);
+        printf(" %10.2f", bench_cmp(bench_cmp_loop, a, b + 1, len));
+        printf(" %10.2f", bench_cmp(bench_cmp_strcmp, a, b + 1, len));
+        for (int level = UTF8_SIMD_NONE; level <= (int) detected; level++) {
+            utf8_simd_set_level((UTF8SimdLevel) level);
+            printf(" %10.2f", bench_cmp(bench_cmp_utf8, a, b + 1, len));
+        }
+        utf8_simd_set_level(detected);
+        printf("\n");
+
+        free(a);
+        free(b);
+    }
+}
+
+// Joins count short parts sequentially and with each worker count; reports GB/s written.
+static void bench_join(size_t count) {
+    UTF8View* parts = malloc(count * sizeof(UTF8View));
+    if (!parts) {
+        fprintf(stderr, "[bench] allocation failed\n");
+        exit(1);
+    }
+    const char* words[] = {"alpha", "\xE6\x97\xA5\xE6\x9C\xAC", "b", "gamma-delta", ""};
+    for (size_t i = 0; i < count; i++) {
+        parts[i] = utf8_view((const uint8_t*) words[i % 5]);
+    }
+    UTF8View delim = utf8_view((const uint8_t*) ",");
+
+    int max_threads = omp_get_max_threads();
+    printf("utf8_byte_join over %zu parts (GB/s, best of 5)\n", count);
+    for (int threads = 1; threads <= max_threads * 2; threads *= 2) {
+        double best = 0.0;
+        for (int trial = 0; trial < 5; trial++) {
+            double start = bench_now();
+            uint8_t* out = utf8_byte_join_view_parallel(parts, count, delim, threads);
+            double elapsed = bench_now() - start;
+            size_t len = (size_t) utf8_byte_count(out);
+            free(out);
+
+            double rate = (double) len / elapsed / 1e9;
+            best = rate > best ? rate : best;
+        }
+        printf("%10d %10.2f\n", threads, best);
+    }
+
+    free(parts);
+}
+
+static void bench_validate(const uint8_t* src, size_t len) {
+    UTF8View view = utf8_view_n(src, len);
+    UTF8SimdLevel detected = utf8_simd_detect();
+    printf("utf8_validate over %zu bytes (GB/s, best of 5)\n", len);
+
+    double best = 0.0;
+    for (int trial = 0; trial < 5; trial++) {
+        double start = bench_now();
+        int64_t count = utf8_cp_count_view(view);
+        double rate = (double) len / (bench_now() - start) / 1e9;
+        best = rate > best ? rate : best;
+        if (count < 0) {
+            fprintf(stderr, "[bench] input is not valid UTF-8\n");
+            exit(1);
+        }
+    }
+    printf("%10s %10.2f\n", "cp_count", best);
+
+    for (int level = UTF8_SIMD_NONE; level <= (int) detected; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+        best = 0.0;
+        for (int trial = 0; trial < 5; trial++) {
+            double start = bench_now();
+            UTF8Validation result = utf8_validate(view);
+            double rate = (double) len / (bench_now() - start) / 1e9;
+            best = rate > best ? rate : best;
+            if (result.error != UTF8_ERROR_NONE) {
+                fprintf(stderr, "[bench] validate mismatch\n");
+                exit(1);
+            }
+        }
+        printf("%10s %10.2f\n", utf8_simd_name((UTF8SimdLevel) level), best);
+    }
+    utf8_simd_set_level(detected);
+}
+
+// The per-codepoint walk utf8_cp_count_view used before the fused kernel
+static int64_t bench_cp_count_loop(UTF8View view) {
+    int64_t count = 0;
+    const uint8_t* stream = view.ptr;
+    const uint8_t* end = view.ptr + view.len;
+    while (stream < end) {
+        int8_t width = utf8_cp_width(stream);
+        if (width < 1 || width > end - stream || !utf8_cp_is_valid(stream)) {
+            return -1;
+        }
+        count++;
+        stream += width;
+    }
+    return count;
+}
+
+static void bench_cp_count(const char* label, const char* pattern, uint8_t* src, size_t len) {
+    size_t pattern_len = strlen(pattern);
+    len -= len % pattern_len;  // Whole copies only, so the text stays valid
+    for (size_t i = 0; i < len; i++) {
+        src[i] = (uint8_t) pattern[i % pattern_len];
+    }
+    UTF8View view = utf8_view_n(src, len);
+
+    UTF8SimdLevel detected = utf8_simd_detect();
+    printf("codepoint count, %s, %zu bytes (GB/s, best of 5)\n", label, len);
+    printf("%10s %10s %10s\n", "", "fast", "validated");
+
+    double best = 0.0;
+    int64_t expected = 0;
+    for (int trial = 0; trial < 5; trial++) {
+        double start = bench_now();
+        expected = bench_cp_count_loop(view);
+        double rate = (double) len / (bench_now() - start) / 1e9;
+        best = rate > best ? rate : best;
+    }
+    printf("%10s %10s %10.2f\n", "loop", "-", best);
+
+    for (int level = UTF8_SIMD_NONE; level <= (int) detected; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+        double fast = 0.0;
+        double fused = 0.0;
+        for (int trial = 0; trial < 5; trial++) {
+            double start = bench_now();
+            int64_t count = utf8_cp_count_fast(view);
+            double rate = (double) len / (bench_now() - start) / 1e9;
+            fast = rate > fast ? rate : fast;
+
+            size_t validated = 0;
+            start = bench_now();
+            utf8_validate_count(view, &validated);
+            rate = (double) len / (bench_now() - start) / 1e9;
+            fused = rate > fused ? rate : fused;
+
+            if (count != expected || (int64_t) validated != expected) {
+                fprintf(stderr, "[bench] codepoint count mismatch\n");
+                exit(1);
+            }
+        }
+        printf("%10s %10.2f %10.2f\n", utf8_simd_name((UTF8SimdLevel) level), fast, fused);
+    }
+    utf8_simd_set_level(detected);
+}
+
+// Walk every codepoint with the copying iterator and with the cursor both ways, then
+// retreat over all of them in one call, as GB/s
+static void bench_cp_cursor(const char* label, const char* pattern, uint8_t* src, size_t len) {
+    size_t pattern_len = strlen(pattern);
+    len -= len % pattern_len;
+    for (size_t i = 0; i < len; i++) {
+        src[i] = (uint8_t) pattern[i % pattern_len];
+    }
+    UTF8View view = utf8_view_n(src, len);
+
+    printf("codepoint walk, %s, %zu bytes (GB/s, best of 5)\n", label, len);
+    printf("%10s %10s %10s %10s\n", "iter", "next", "prev", "retreat");
+    size_t codepoints = (size_t) utf8_cp_count_fast(view);
+    double best[4] = {0.0, 0.0, 0.0, 0.0};
+    int64_t sums[3] = {0, 0, 0};
+    for (int trial = 0; trial < 5; trial++) {
+        int64_t sum = 0;
+        double start = bench_now();
+        UTF8CpIter it = utf8_cp_iter_view(view);
+        const char* cp;
+        while ((cp = utf8_cp_iter_next(&it))) {
+            sum += utf8_cp_decode((const uint8_t*) cp);
+        }
+        double rate = (double) len / (bench_now() - start) / 1e9;
+        best[0] = rate > best[0] ? rate : best[0];
+        sums[0] = sum;
+
+        sum = 0;
+        start = bench_now();
+        UTF8CpCursor cursor = utf8_cp_cursor_view(view);
+        UTF8CpRef ref;
+        while ((ref = utf8_cp_cursor_next(&cursor)).width > 0) {
+            sum += ref.cp;
+        }
+        rate = (double) len / (bench_now() - start) / 1e9;
+        best[1] = rate > best[1] ? rate : best[1];
+        sums[1] = sum;
+
+        sum = 0;
+        start = bench_now();
+        while ((ref = utf8_cp_cursor_prev(&cursor)).width > 0) {
+            sum += ref.cp;
+        }
+        rate = (double) len / (bench_now() - start) / 1e9;
+        best[2] = rate > best[2] ? rate : best[2];
+        sums[2] = sum;
+
+        start = bench_now();
+        const uint8_t* first = utf8_cp_retreat(view.ptr, view.ptr + len, codepoints);
+        rate = (double) len / (bench_now() - start) / 1e9;
+        best[3] = rate > best[3] ? rate : best[3];
+        if (first != view.ptr) {
+            fprintf(stderr, "[bench] codepoint retreat mismatch\n");
+            exit(1);
+        }
+    }
+    if (sums[0] != sums[1] || sums[1] != sums[2]) {
+        fprintf(stderr, "[bench] codepoint walk mismatch\n");
+        exit(1);
+    }
+    printf("%10.2f %10.2f %10.2f %10.2f\n", best[0], best[1], best[2], best[3]);
+}
+
+// Random codepoint access: the index against the walk-from-start utf8_cp_index
+static void bench_cp_index(const char* label, const char* pattern, uint8_t* src, size_t len) {
+    size_t pattern_len = strlen(pattern);
+    len -= len % pattern_len;
+    for (size_t i = 0; i < len; i++) {
+        src[i] = (uint8_t) pattern[i % pattern_len];
+    }
+    src[len] = '\0';  // utf8_cp_index reads a null-terminated string
+    UTF8View view = utf8_view_n(src, len);
+    printf("codepoint index, %s, %zu bytes\n", label, len);
+
+    UTF8CpIndex index;
+    double start = bench_now();
+    if (!utf8_cp_index_init(&index, view, 0)) {
+        fprintf(stderr, "[bench] input is not valid UTF-8\n");
+        exit(1);
+    }
+    double build = bench_now() - start;
+    printf(
+        "%10s %10.2f GB/s, %.2f%% of text\n",
+        "build",
+        (double) len / build / 1e9,
+        100.0 * (double) (index.samples * sizeof(size_t)) / (double) len
+    );
+
+    size_t lookups = 1 << 20;
+    uint64_t seed = 88172645463325252ULL;
+    volatile int32_t sink = 0;
+    start = bench_now();
+    for (size_t i = 0; i < lookups; i++) {
+        seed ^= seed << 13, seed ^= seed >> 7, seed ^= seed << 17;
+        UTF8CpRef ref;
+        utf8_cp_index_at(&index, seed % index.length, &ref);
+        sink += ref.cp;
+    }
+    double elapsed = bench_now() - start;
+    printf("%10s %10.1f ns/lookup\n", "index", elapsed / (double) lookups * 1e9);
+
+    // The walk is O(n) per call, so only a few lookups into a short prefix
+    size_t walks = 256;
+    size_t prefix = index.length < 100000 ? index.length : 100000;
+    start = bench_now();
+    for (size_t i = 0; i < walks; i++) {
+        seed ^= seed << 13, seed ^= seed >> 7, seed ^= seed << 17;
+        uint8_t* cp = utf8_cp_index(src, (uint32_t) (seed % prefix));
+        sink += cp ? cp[0] : 0;
+        free(cp);
+    }
+    elapsed = bench_now() - start;
+    printf(
+        "%10s %10.1f ns/lookup (first %zu codepoints only)\n",
+        "walk",
+        elapsed / (double) walks * 1e9,
+        prefix
+    );
+
+    utf8_cp_index_free(&index);
+}
+
+// Classify every codepoint of the text; each predicate decodes and does one table lookup
+static void bench_cp_class(const char* label, const char* pattern, uint8_t* src, size_t len) {
+    size_t pattern_len = strlen(pattern);
+    len -= len % pattern_len;
+    for (size_t i = 0; i < len; i++) {
+        src[i] = (uint8_t) pattern[i % pattern_len];
+    }
+    src[len] = '\0';  // The classifiers read null-terminated input
+    printf("codepoint classify, %s, %zu bytes (Mcp/s, best of 5)\n", label, len);
+
+    double best = 0.0;
+    size_t hits = 0;
+    size_t count = 0;
+    for (int trial = 0; trial < 5; trial++) {
+        hits = count = 0;
+        double start = bench_now();
+        const uint8_t* stream = src;
+        int8_t width = 0;
+        while (*stream) {
+            hits += utf8_cp_is_alpha(stream) + utf8_cp_is_space(stream) + utf8_cp_is_punct(stream);
+            count++;
+            stream = utf8_cp_next_width(stream, &width);
+            if (!stream) {
+                break;
+            }
+        }
+        double rate = (double) count / (bench_now() - start) / 1e6;
+        best = rate > best ? rate : best;
+    }
+    printf("%10s %10.1f (%zu of %zu codepoints classified)\n", "is_*", best, hits, count);
+}
+
+// Lowercase, uppercase and fold the text at each SIMD level, as GB/s of input
+static void bench_case(const char* label, const char* pattern, uint8_t* src, size_t len) {
+    size_t pattern_len = strlen(pattern);
+    len -= len % pattern_len;
+    for (size_t i = 0; i < len; i++) {
+        src[i] = (uint8_t) pattern[i % pattern_len];
+    }
+    UTF8View view = utf8_view_n(src, len);
+    uint8_t* dst = malloc(len * UTF8_CASE_EXPANSION);
+    if (!dst) {
+        fprintf(stderr, "[bench] allocation failed\n");
+        exit(1);
+    }
+
+    UTF8SimdLevel detected = utf8_simd_detect();
+    printf("case conversion, %s, %zu bytes (GB/s, best of 5)\n", label, len);
+    printf("%10s %10s %10s %10s\n", "", "lower", "upper", "fold");
+    for (int level = UTF8_SIMD_NONE; level <= (int) detected; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+        printf("%10s", utf8_simd_name((UTF8SimdLevel) level));
+        for (int mode = UTF8_CASE_LOWER; mode <= UTF8_CASE_FOLD; mode++) {
+            double best = 0.0;
+            for (int trial = 0; trial < 5; trial++) {
+                size_t written = 0;
+                double start = bench_now();
+                UTF8Validation result = utf8_case_convert(view, (UTF8CaseMode) mode, dst, &written);
+                double rate = (double) len / (bench_now() - start) / 1e9;
+                best = rate > best ? rate : best;
+                if (result.error != UTF8_ERROR_NONE) {
+                    fprintf(stderr, "[bench] case conversion failed\n");
+                    exit(1);
+                }
+            }
+            printf(" %10.2f", best);
+        }
+        printf("\n");
+    }
+    utf8_simd_set_level(detected);
+    free(dst);
+}
+
+// Quick check, then NFC and NFD, at each SIMD level, as GB/s of input
+static void bench_normal(const char* label, const char* pattern, uint8_t* src, size_t len) {
+    size_t pattern_len = strlen(pattern);
+    len -= len % pattern_len;
+    for (size_t i = 0; i < len; i++) {
+        src[i] = (uint8_t) pattern[i % pattern_len];
+    }
+    UTF8View view = utf8_view_n(src, len);
+    uint8_t* dst = malloc(len * UTF8_NORMAL_CANONICAL_EXPANSION);
+    if (!dst) {
+        fprintf(stderr, "[bench] allocation failed\n");
+        exit(1);
+    }
+
+    UTF8SimdLevel detected = utf8_simd_detect();
+    printf("normalization, %s, %zu bytes (GB/s, best of 5)\n", label, len);
+    printf("%10s %10s %10s %10s\n", "", "nfc_check", "nfc", "nfd");
+    for (int level = UTF8_SIMD_NONE; level <= (int) detected; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+        printf("%10s", utf8_simd_name((UTF8SimdLevel) level));
+
+        double best = 0.0;
+        for (int trial = 0; trial < 5; trial++) {
+            double start = bench_now();
+            volatile UTF8NormalCheck check = utf8_nfc_quick_check(view);
+            (void) check;
+            double rate = (double) len / (bench_now() - start) / 1e9;
+            best = rate > best ? rate : best;
+        }
+        printf(" %10.2f", best);
+
+        UTF8NormalForm forms[] = {UTF8_NFC, UTF8_NFD};
+        for (size_t f = 0; f < 2; f++) {
+            best = 0.0;
+            for (int trial = 0; trial < 5; trial++) {
+                size_t written = 0;
+                double start = bench_now();
+                UTF8Validation result = utf8_normalize(view, forms[f], dst, &written);
+                double rate = (double) len / (bench_now() - start) / 1e9;
+                best = rate > best ? rate : best;
+                if (result.error != UTF8_ERROR_NONE) {
+                    fprintf(stderr, "[bench] normalization failed\n");
+                    exit(1);
+                }
+            }
+            printf(" %10.2f", best);
+        }
+        printf("\n");
+    }
+    utf8_simd_set_level(detected);
+    free(dst);
+}
+
+// Both directions for UTF-32 and UTF-16LE, as GB/s of UTF-8; each round trip
+// must reproduce the input
+static void bench_transcode(const char* label, const char* pattern, uint8_t* src, size_t len) {
+    size_t pattern_len = strlen(pattern);
+    len -= len % pattern_len;
+    for (size_t i = 0; i < len; i++) {
+        src[i] = (uint8_t) pattern[i % pattern_len];
+    }
+    UTF8View view = utf8_view_n(src, len);
+    size_t count = (size_t) utf8_to_utf32_length(view);
+    size_t units = (size_t) utf8_to_utf16_length(view);
+    uint32_t* cps = malloc(count * sizeof(uint32_t));
+    uint16_t* words = malloc(units * sizeof(uint16_t));
+    uint8_t* bytes = malloc(len);
+    if (!cps || !words || !bytes) {
+        fprintf(stderr, "[bench] allocation failed\n");
+        exit(1);
+    }
+
+    UTF8SimdLevel detected = utf8_simd_detect();
+    printf("transcode, %s, %zu bytes (GB/s, best of 5)\n", label, len);
+    printf("%10s %10s %10s %10s %10s\n", "", "to utf32", "from utf32", "to utf16", "from utf16");
+    for (int level = UTF8_SIMD_NONE; level <= (int) detected; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+        double best[4] = {0.0};
+        for (int trial = 0; trial < 5; trial++) {
+            double rate[4];
+            size_t decoded = 0;
+            double start = bench_now();
+            utf8_to_utf32(view, cps, &decoded);
+            rate[0] = (double) len / (bench_now() - start) / 1e9;
+
+            size_t encoded = 0;
+            start = bench_now();
+            utf32_to_utf8(cps, decoded, bytes, &encoded);
+            rate[1] = (double) len / (bench_now() - start) / 1e9;
+
+            if (decoded != count || encoded != len || memcmp(bytes, src, len) != 0) {
+                fprintf(stderr, "[bench] UTF-32 round trip mismatch\n");
+                exit(1);
+            }
+
+            start = bench_now();
+            utf8_to_utf16le(view, words, &decoded);
+            rate[2] = (double) len / (bench_now() - start) / 1e9;
+
+            start = bench_now();
+            utf16le_to_utf8(words, decoded, bytes, &encoded);
+            rate[3] = (double) len / (bench_now() - start) / 1e9;
+
+            if (decoded != units || encoded != len || memcmp(bytes, src, len) != 0) {
+                fprintf(stderr, "[bench] UTF-16 round trip mismatch\n");
+                exit(1);
+            }
+
+            for (int k = 0; k < 4; k++) {
+                best[k] = rate[k] > best[k] ? rate[k] : best[k];
+            }
+        }
+        printf(
+            "%10s %10.2f %10.2f %10.2f %10.2f\n",
+            utf8_simd_name((UTF8SimdLevel) level),
+            best[0],
+            best[1],
+            best[2],
+            best[3]
+        );
+    }
+    utf8_simd_set_level(detected);
+
+    free(cps);
+    free(words);
+    free(bytes);
+}
+
+// Log-like fields drawn from a small vocabulary, as in a typical token stream
+static void bench_intern(uint8_t* src, size_t len) {
+    const char* levels[] = {"INFO", "WARN", "DEBUG", "ERROR"};
+    size_t pos = 0;
+    for (size_t i = 0; pos + 32 < len; i++) {
+        pos += (size_t) snprintf(
+            (char*) src + pos, 32, "%s,user%zu,", levels[i % 4], (i * 7919) % 1000
+        );
+    }
+    UTF8View view = utf8_view_n(src, pos);
+    UTF8View delim = utf8_view((const uint8_t*) ",");
+    printf("split %zu bytes of repetitive fields (seconds, MB held)\n", pos);
+
+    double start = bench_now();
+    uint64_t count = 0;
+    uint8_t** parts = utf8_byte_split_delim_view(view, delim, &count);
+    double elapsed = bench_now() - start;
+    size_t held = count * sizeof(uint8_t*);
+    for (uint64_t i = 0; i < count; i++) {
+        // Typical malloc chunk: 8-byte header, 16-byte granularity, 32-byte minimum
+        size_t chunk = ((size_t) utf8_byte_count(parts[i]) + 1 + 8 + 15) & ~(size_t) 15;
+        held += chunk < 32 ? 32 : chunk;
+    }
+    utf8_byte_split_free(parts, count);
+    printf("%10s %10.3f %10.1f\n", "strings", elapsed, (double) held / 1e6);
+
+    UTF8Interner interner = {0};
+    start = bench_now();
+    uint32_t* ids = utf8_byte_split_delim_intern(view, delim, &interner, &count);
+    elapsed = bench_now() - start;
+    held = count * sizeof(uint32_t) + utf8_interner_size(&interner);
+    printf("%10s %10.3f %10.1f (%zu symbols)\n", "intern", elapsed, (double) held / 1e6, interner.count);
+    free(ids);
+    utf8_interner_free(&interner);
+}
+
+int main(int argc, char* argv[]) {
+    size_t max_mb = argc > 1 ? (size_t) strtoul(argv[1], NULL, 10) : 64;
+    size_t max_len = max_mb << 20;
+
+    uint8_t* src = malloc(max_len + 1);
+    if (!src) {
+        fprintf(stderr, "[bench] allocation failed\n");
+        return 1;
+    }
+    // Mixed ASCII and multi-byte text; the content is irrelevant to the scan.
+    const char* pattern = "The quick brown \xE2\x82\xAC fox jumps over \xF0\x9F\x98\x80 dog. ";
+    size_t pattern_len = strlen(pattern);
+    for (size_t i = 0; i < max_len; i++) {
+        src[i] = (uint8_t) pattern[i % pattern_len];
+    }
+
+    UTF8SimdLevel detected = utf8_simd_detect();
+    printf("utf8_byte_count (GB/s, best of 5), detected=%s\n", utf8_simd_name(detected));
+    printf("%12s %10s %10s", "bytes", "loop", "strlen");
+    for (int level = UTF8_SIMD_NONE; level <= (int) detected; level++) {
+        printf(" %10s", utf8_simd_name((UTF8SimdLevel) level));
+    }
+    printf("\n");
+
+    size_t sizes[] = {64, 4096, 1 << 20, 16 << 20, 64 << 20};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(size_t); i++) {
+        size_t len = sizes[i];
+        if (len > max_len) {
+            break;
+        }
+        uint8_t saved = src[len];
+        src[len] = '\0';
+
+        printf("%12zu", len);
+        printf(" %10.2f", bench_count(bench_count_loop, src, len));
+        printf(" %10.2f", bench_count(bench_count_strlen, src, len));
+        for (int level = UTF8_SIMD_NONE; level <= (int) detected; level++) {
+            utf8_simd_set_level((UTF8SimdLevel) level);
+            printf(" %10.2f", bench_count(bench_count_utf8, src, len));
+        }
+        utf8_simd_set_level(detected);
+        printf("\n");
+
+        src[len] = saved;
+    }
+
+    bench_validate(src, max_len);
+
+    bench_cmp_sizes();
+
+    size_t cp_len = max_len < ((size_t) 16 << 20) ? max_len : ((size_t) 16 << 20);
+    bench_cp_count("ASCII-heavy", "The quick brown fox jumps over the lazy dog, caf\xC3\xA9. ", src, cp_len);
+    bench_cp_count(
+        "CJK-heavy",
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0\xE3\x80\x82 ",
+        src,
+        cp_len
+    );
+
+    bench_transcode("ASCII-heavy", "The quick brown fox jumps over the lazy dog, caf\xC3\xA9. ", src, cp_len);
+    bench_transcode(
+        "Cyrillic",
+        "\xD0\xA1\xD1\x8A\xD0\xB5\xD1\x88\xD1\x8C \xD0\xB6\xD0\xB5 \xD0\xB5\xD1\x89\xD1\x91. ",
+        src,
+        cp_len
+    );
+    bench_transcode(
+        "CJK-heavy",
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0\xE3\x80\x82 ",
+        src,
+        cp_len
+    );
+
+    bench_cp_cursor("ASCII-heavy", "The quick brown fox jumps over the lazy dog, caf\xC3\xA9. ", src, cp_len);
+    bench_cp_cursor(
+        "CJK-heavy",
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0\xE3\x80\x82 ",
+        src,
+        cp_len
+    );
+
+    bench_cp_index("ASCII-heavy", "The quick brown fox jumps over the lazy dog, caf\xC3\xA9. ", src, cp_len);
+    bench_cp_index(
+        "CJK-heavy",
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0\xE3\x80\x82 ",
+        src,
+        cp_len
+    );
+
+    bench_case("ASCII-heavy", "The Quick Brown Fox Jumps Over The Lazy Dog, Caf\xC3\xA9. ", src, cp_len);
+    bench_case(
+        "Cyrillic",
+        "\xD0\xA1\xD1\x8A\xD0\xB5\xD1\x88\xD1\x8C \xD0\xB6\xD0\xB5 \xD0\xB5\xD1\x89\xD1\x91. ",
+        src,
+        cp_len
+    );
+
+    bench_normal("ASCII-heavy", "The quick brown fox jumps over the lazy dog, caf\xC3\xA9. ", src, cp_len);
+    bench_normal(
+        "Decomposed Latin",
+        "cafe\xCC\x81 na\xCC\x88ive pre\xCC\x81" "cis a\xCC\x81\xCC\xA3 ",
+        src,
+        cp_len
+    );
+
+    bench_cp_class("ASCII-heavy", "The quick brown fox jumps over the lazy dog, caf\xC3\xA9. ", src, cp_len);
+    bench_cp_class(
+        "CJK-heavy",
+        "\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E\xE3\x81\xAE\xE6\x96\x87\xE7\xAB\xA0\xE3\x80\x82 ",
+        src,
+        cp_len
+    );
+
+    bench_join(max_len / 8);
+
+    bench_find(src, max_len, "||");
+    bench_find(src, max_len, "\xE2\x90\x9E");  // U+241E SYMBOL FOR RECORD SEPARATOR
+
+    bench_intern(src, max_len / 4);
+
+    free(src);
+    return 0;
+}
@@ -0,0 +1,96 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/arena.h
+ * @brief Bump-pointer arena for short-lived strings and split results.
+ *
+ * An arena hands out memory from a chain of large blocks by advancing an offset.
+ * Individual allocations are never freed; instead the arena is rewound to a mark
+ * (or emptied) in one step, releasing everything allocated since.
+ *
+ * - A zero-initialized UTF8Arena is valid and uses the default block size.
+ * - Every `_arena` routine in the library allocates its result (and nothing else)
+ *   from the given arena. Never pass arena memory to free().
+ */
+
+#ifndef UTF8_ARENA_H
+#define UTF8_ARENA_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "view.h"
+
+#define UTF8_ARENA_BLOCK_SIZE ((size_t) 64 * 1024)
+
+typedef struct UTF8ArenaBlock {
+    struct UTF8ArenaBlock* next;  // Previously filled block (older)
+    size_t size;  // Usable bytes in data
+    size_t used;  // Bytes handed out from data
+    max_align_t data[];
+} UTF8ArenaBlock;
+
+typedef struct UTF8Arena {
+    UTF8ArenaBlock* head;  // Current block, newest first
+    size_t block_size;  // Minimum block size (0 selects UTF8_ARENA_BLOCK_SIZE)
+} UTF8Arena;
+
+typedef struct UTF8ArenaMark {
+    UTF8ArenaBlock* block;
+    size_t used;
+} UTF8ArenaMark;
+
+/**
+ * @brief Initializes an empty arena; no memory is reserved until first use.
+ *
+ * @param arena      Arena to initialize.
+ * @param block_size Minimum size of each block, or 0 for the default.
+ */
+void utf8_arena_init(UTF8Arena* arena, size_t block_size);
+
+/**
+ * @brief Releases every block owned by the arena and leaves it empty.
+ */
+void utf8_arena_free(UTF8Arena* arena);
+
+/**
+ * @brief Returns size bytes aligned for any object type.
+ *
+ * Requests larger than the block size get a dedicated block.
+ *
+ * @return Pointer into the arena, or NULL on allocation failure.
+ */
+void* utf8_arena_alloc(UTF8Arena* arena, size_t size);
+
+/**
+ * @brief Copies a view into the arena as a null-terminated string.
+ *
+ * @return Pointer into the arena, or NULL on error.
+ */
+uint8_t* utf8_arena_copy(UTF8Arena* arena, UTF8View view);
+
+/**
+ * @brief Captures the current allocation position.
+ */
+UTF8ArenaMark utf8_arena_mark(const UTF8Arena* arena);
+
+/**
+ * @brief Releases everything allocated after mark was taken.
+ *
+ * Blocks created after the mark are returned to the system; the oldest block
+ * is kept for reuse when rewinding to an empty mark.
+ */
+void utf8_arena_reset(UTF8Arena* arena, UTF8ArenaMark mark);
+
+/**
+ * @brief Releases every allocation while keeping one block for reuse.
+ */
+void utf8_arena_clear(UTF8Arena* arena);
+
+/**
+ * @brief Returns the number of bytes currently handed out (including padding).
+ */
+size_t utf8_arena_used(const UTF8Arena* arena);
+
+#endif  // UTF8_ARENA_H
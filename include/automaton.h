@@ -0,0 +1,74 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/automaton.h
+ * @brief Aho-Corasick automaton for matching many byte patterns in one pass.
+ *
+ * The patterns are compiled once into a dense transition table and can be reused
+ * for any number of scans. Scans report leftmost-longest, non-overlapping matches:
+ * the earliest starting match wins, and among those the longest. Matches must
+ * begin and end on codepoint boundaries, so a pattern never matches the tail
+ * bytes of a longer sequence.
+ */
+
+#ifndef UTF8_AUTOMATON_H
+#define UTF8_AUTOMATON_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "view.h"
+
+typedef struct UTF8Automaton {
+    int32_t* next;  // states x 256 transitions (complete DFA)
+    uint32_t* depth;  // Length of the trie prefix each state stands for
+    uint32_t* pattern;  // Index + 1 of the pattern ending exactly at each state (0 if none)
+    int32_t* output;  // Nearest proper suffix state that ends a pattern (-1 if none)
+    size_t states;
+    size_t count;  // Number of patterns
+    size_t longest;  // Length of the longest pattern
+    bool first[256];  // Bytes that begin at least one pattern
+} UTF8Automaton;
+
+/**
+ * @brief Receives a match found by utf8_automaton_scan.
+ *
+ * @param offset Byte offset of the match.
+ * @param len    Length of the match in bytes.
+ * @param index  Index of the matching pattern.
+ * @param ctx    User context.
+ * @return       true to continue scanning, false to stop.
+ */
+typedef bool (*UTF8MatchCallback)(size_t offset, size_t len, size_t index, void* ctx);
+
+/**
+ * @brief Compiles patterns into an automaton (patterns are not retained).
+ *
+ * @param automaton Automaton to initialize.
+ * @param patterns  Array of non-empty patterns.
+ * @param count     Number of patterns (at least one).
+ * @return          true on success, false on invalid input or allocation failure.
+ */
+bool utf8_automaton_init(UTF8Automaton* automaton, const UTF8View* patterns, size_t count);
+
+/**
+ * @brief Releases the automaton's tables.
+ */
+void utf8_automaton_free(UTF8Automaton* automaton);
+
+/**
+ * @brief Reports every leftmost-longest, non-overlapping match, left to right.
+ *
+ * The haystack is read once, left to right: a match is only final once no longer
+ * match could still start at or before it, and the matches found past it while
+ * waiting are kept rather than rescanned.
+ *
+ * @return true if the scan completed, false on invalid input, allocation failure or if
+ *         emit stopped it.
+ */
+bool utf8_automaton_scan(
+    const UTF8Automaton* automaton, UTF8View haystack, UTF8MatchCallback emit, void* ctx
+);
+
+#endif  // UTF8_AUTOMATON_H
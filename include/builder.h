@@ -0,0 +1,84 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/builder.h
+ * @brief Growable byte buffer for assembling UTF-8 output.
+ *
+ * UTF8Builder appends into a geometrically grown buffer, so assembling n bytes
+ * costs O(n) copying instead of the O(n^2) of repeated utf8_byte_cat calls.
+ * The buffer is always null-terminated and finish() hands it over without a copy.
+ *
+ * - A zero-initialized UTF8Builder is a valid empty builder.
+ * - On allocation failure an append returns false and leaves the contents intact.
+ */
+
+#ifndef UTF8_BUILDER_H
+#define UTF8_BUILDER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "view.h"
+
+typedef struct UTF8Builder {
+    uint8_t* data;  // Null-terminated contents (owned)
+    size_t len;  // Number of bytes written, excluding the terminator
+    size_t capacity;  // Bytes available for content, excluding the terminator
+} UTF8Builder;
+
+/**
+ * @brief Ensures the builder can hold at least capacity content bytes.
+ *
+ * @return true on success, false on allocation failure (builder is unchanged).
+ */
+bool utf8_builder_reserve(UTF8Builder* builder, size_t capacity);
+
+/**
+ * @brief Appends n raw bytes (which may include null bytes).
+ */
+bool utf8_builder_append_bytes(UTF8Builder* builder, const uint8_t* bytes, size_t n);
+
+/**
+ * @brief Appends the bytes of a view.
+ */
+bool utf8_builder_append_view(UTF8Builder* builder, UTF8View view);
+
+/**
+ * @brief Appends the UTF-8 encoding of a Unicode scalar value.
+ *
+ * @return false for surrogates, values above U+10FFFF, or allocation failure.
+ */
+bool utf8_builder_append_cp(UTF8Builder* builder, uint32_t cp);
+
+/**
+ * @brief Appends printf-style formatted text.
+ */
+bool utf8_builder_append_fmt(UTF8Builder* builder, const char* format, ...)
+    __attribute__((format(printf, 2, 3)));
+
+/**
+ * @brief Returns a view of the current contents (valid until the next append).
+ */
+UTF8View utf8_builder_view(const UTF8Builder* builder);
+
+/**
+ * @brief Discards the contents while keeping the buffer for reuse.
+ */
+void utf8_builder_clear(UTF8Builder* builder);
+
+/**
+ * @brief Releases the buffer and resets the builder to empty.
+ */
+void utf8_builder_free(UTF8Builder* builder);
+
+/**
+ * @brief Hands the null-terminated buffer to the caller and resets the builder.
+ *
+ * @param builder Builder to finish.
+ * @param len     Optional output: number of bytes before the terminator.
+ * @return        Buffer the caller must free (an empty builder yields ""), or NULL on error.
+ */
+uint8_t* utf8_builder_finish(UTF8Builder* builder, size_t* len);
+
+#endif  // UTF8_BUILDER_H
@@ -9,23 +9,51 @@
  *
  * All allocation routines return newly allocated buffers the caller must free.
  * All functions treat empty strings ("") as valid input.
+ *
+ * Functions suffixed with `_arena` take views and allocate their result from a
+ * UTF8Arena (see arena.h). Results are released with the arena, never with free().
+ *
+ * Functions suffixed with `_view` take length-carrying UTF8View slices instead of
+ * null-terminated pointers (see view.h). They never rescan for a terminator and
+ * accept embedded null bytes.
+ *
+ * Functions suffixed with `_intern` emit 32-bit symbol IDs from a UTF8Interner
+ * (see interner.h) instead of strings; the caller frees only the ID array.
  */
 
 #ifndef UTF8_BYTE_H
 #define UTF8_BYTE_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <stddef.h>
 
+#include "view.h"
+#include "span.h"
+#include "part.h"
+#include "arena.h"
+#include "automaton.h"
+#include "interner.h"
+
 /**
  * @brief Returns the number of bytes before the null terminator in a UTF-8 string.
  *        (Analogous to strlen, but returns -1 for NULL input.)
  *
  * @param start Pointer to a null-terminated UTF-8 string.
  * @return Number of bytes (>=0), or -1 if start is NULL.
+ *
+ * @note Scans with the widest SIMD kernel the CPU supports (see simd.h).
  */
 int64_t utf8_byte_count(const uint8_t* start);
 
+/**
+ * @brief Returns the number of bytes in a view.
+ *
+ * @param view Input view.
+ * @return     view.len, or -1 if the view is invalid.
+ */
+int64_t utf8_byte_count_view(UTF8View view);
+
 /**
  * @brief Returns the byte offset from start to end.
  *
@@ -43,6 +71,21 @@ ptrdiff_t utf8_byte_diff(const uint8_t* start, const uint8_t* end);
  */
 uint8_t* utf8_byte_copy(const uint8_t* start);
 
+/**
+ * @brief Allocates a new null-terminated copy of the bytes in a view.
+ *
+ * @param view Input view (may contain null bytes).
+ * @return     Newly allocated buffer, or NULL on error. Caller must free.
+ */
+uint8_t* utf8_byte_copy_view(UTF8View view);
+
+/**
+ * @brief Copies the bytes in a view into the arena as a null-terminated string.
+ *
+ * @return Pointer into the arena, or NULL on error.
+ */
+uint8_t* utf8_byte_copy_arena(UTF8View view, UTF8Arena* arena);
+
 /**
  * @brief Allocates a new null-terminated copy of up to n bytes from input.
  *
@@ -52,6 +95,8 @@ uint8_t* utf8_byte_copy(const uint8_t* start);
  * @param start Pointer to input string.
  * @param n     Number of bytes to copy (must be <= utf8_byte_count(start)).
  * @return      Newly allocated buffer, or NULL on error. Caller must free.
+ *
+ * @note Only the first n bytes are scanned, never the remainder of the input.
  */
 uint8_t* utf8_byte_copy_n(const uint8_t* start, uint64_t n);
 
@@ -80,6 +125,14 @@ uint8_t* utf8_byte_copy_slice(const uint8_t* start, const uint8_t* end);
  */
 uint8_t* utf8_byte_cat(const uint8_t* dst, const uint8_t* src);
 
+/**
+ * @brief Concatenates two views into the arena as a null-terminated string.
+ *
+ * @see utf8_byte_cat
+ * @return Pointer into the arena, or NULL on error.
+ */
+uint8_t* utf8_byte_cat_arena(UTF8View dst, UTF8View src, UTF8Arena* arena);
+
 // Useful for self documenting code
 typedef enum UTF8ByteCompare {
     UTF8_COMPARE_INVALID = -2,
@@ -103,9 +156,41 @@ typedef enum UTF8ByteCompare {
  *
  * @note This function compares raw bytes, not Unicode codepoints or grapheme clusters.
  * @note Comparison stops at the first differing byte or at the null terminator.
+ * @note Scans 16 to 64 bytes per step with the widest SIMD kernel available.
  */
 int8_t utf8_byte_cmp(const uint8_t* a, const uint8_t* b);
 
+/**
+ * @brief Compares two views lexicographically by their raw bytes.
+ *
+ * @return UTF8ByteCompare value; a view that is a prefix of the other sorts first.
+ *         UTF8_COMPARE_INVALID if either view is invalid.
+ */
+int8_t utf8_byte_cmp_view(UTF8View a, UTF8View b);
+
+/**
+ * @brief Compares two byte ranges of explicit length (null bytes are ordinary data).
+ *
+ * @see utf8_byte_cmp_view
+ */
+int8_t utf8_byte_cmp_n(const uint8_t* a, size_t a_len, const uint8_t* b, size_t b_len);
+
+/**
+ * @brief Compares two views and reports where they first differ.
+ *
+ * @param a      Left operand.
+ * @param b      Right operand.
+ * @param offset Optional output: index of the first differing byte, i.e. the length
+ *               of the common prefix (min(a.len, b.len) when one is a prefix of the other).
+ * @return       UTF8ByteCompare value, as utf8_byte_cmp_view.
+ */
+int8_t utf8_byte_cmp_mismatch(UTF8View a, UTF8View b, size_t* offset);
+
+/**
+ * @brief Returns the length of the common prefix of two views (0 if either is invalid).
+ */
+size_t utf8_byte_mismatch(UTF8View a, UTF8View b);
+
 /**
  * @brief Appends a pointer to a dynamic array of uint8_t* pointers, resizing as needed.
  *
@@ -116,7 +201,8 @@ int8_t utf8_byte_cmp(const uint8_t* a, const uint8_t* b);
  *
  * @note Caller must assign the return value back to the parts variable.
  *       (e.g., parts = utf8_byte_append(...))
- * @note The array is grown by one; previous contents are preserved.
+ * @note The array is grown by one; previous contents are preserved. To build many
+ *       parts, push them onto a UTF8PartList (see part.h) and release it instead.
  * @note On allocation failure, NULL is returned and *count is not incremented.
  */
 uint8_t** utf8_byte_append(const uint8_t* src, uint8_t** parts, uint64_t* count);
@@ -167,6 +253,30 @@ uint8_t** utf8_byte_append_slice(
  */
 uint8_t** utf8_byte_split(const uint8_t* src, uint64_t* count);
 
+/**
+ * @brief Splits a view into individual bytes as null-terminated strings.
+ *
+ * @see utf8_byte_split
+ */
+uint8_t** utf8_byte_split_view(UTF8View src, uint64_t* count);
+
+/**
+ * @brief Splits a view into individual bytes allocated from the arena.
+ *
+ * @see utf8_byte_split
+ * @note The pointer table and all parts live in the arena; do not free them.
+ */
+uint8_t** utf8_byte_split_arena(UTF8View src, uint64_t* count, UTF8Arena* arena);
+
+/**
+ * @brief Records one single-byte span per byte of src.
+ *
+ * @param src Input view.
+ * @param out Span list; cleared, then filled (capacity is reused).
+ * @return    true on success, false on invalid input or allocation failure.
+ */
+bool utf8_byte_split_spans(UTF8View src, UTF8SpanList* out);
+
 /**
  * @brief Free memory allocated by `utf8_byte_split`.
  *
@@ -192,6 +302,90 @@ void utf8_byte_split_free(uint8_t** parts, uint64_t count);
  */
 uint8_t** utf8_byte_split_delim(const uint8_t* src, const uint8_t* delim, uint64_t* count);
 
+/**
+ * @brief Splits a view by a delimiter view.
+ *
+ * @see utf8_byte_split_delim
+ * @note An invalid or empty delim splits into individual bytes.
+ */
+uint8_t** utf8_byte_split_delim_view(UTF8View src, UTF8View delim, uint64_t* count);
+
+/**
+ * @brief Splits a view by a delimiter view, allocating from the arena.
+ *
+ * @see utf8_byte_split_delim
+ * @note The pointer table and all parts live in the arena; do not free them.
+ */
+uint8_t** utf8_byte_split_delim_arena(
+    UTF8View src, UTF8View delim, uint64_t* count, UTF8Arena* arena
+);
+
+/**
+ * @brief Records the spans of src separated by delim, without copying.
+ *
+ * Produces exactly the parts utf8_byte_split_delim would, as offsets into src.
+ *
+ * @param src   Input view.
+ * @param delim Delimiter view (invalid or empty splits into bytes).
+ * @param out   Span list; cleared, then filled (capacity is reused).
+ * @return      true on success, false on invalid input or allocation failure.
+ */
+bool utf8_byte_split_delim_spans(UTF8View src, UTF8View delim, UTF8SpanList* out);
+
+/**
+ * @brief Splits a view by a delimiter view, interning each part.
+ *
+ * @see utf8_byte_split_delim
+ * @param interner Interner that receives the parts.
+ * @return         Array of count symbol IDs (caller frees), or NULL on error.
+ */
+uint32_t* utf8_byte_split_delim_intern(
+    UTF8View src, UTF8View delim, UTF8Interner* interner, uint64_t* count
+);
+
+/**
+ * @brief Splits a UTF-8 string on any of several delimiters in a single pass.
+ *
+ * Where delimiters overlap, the leftmost match wins, then the longest (so "\r\n"
+ * beats "\r" when both are given). Delimiters only match on codepoint boundaries.
+ *
+ * @param src    Null-terminated input string.
+ * @param delims Array of n null-terminated, non-empty delimiters.
+ * @param n      Number of delimiters (at least one).
+ * @param count  Output: set to the number of parts.
+ * @return       Array of pointers to null-terminated slices (each newly allocated).
+ *               NULL on error. Caller must free each part and the array.
+ *
+ * @note Empty substrings between consecutive delimiters are included.
+ */
+uint8_t** utf8_byte_split_any(
+    const uint8_t* src, const uint8_t** delims, size_t n, uint64_t* count
+);
+
+/**
+ * @brief Splits a view on any of several delimiter views.
+ *
+ * @see utf8_byte_split_any
+ */
+uint8_t** utf8_byte_split_any_view(
+    UTF8View src, const UTF8View* delims, size_t n, uint64_t* count
+);
+
+/**
+ * @brief Records the spans of src separated by an automaton's patterns, without copying.
+ *
+ * The automaton is only read, so one compiled delimiter set can split any number
+ * of inputs (concurrently, if desired).
+ *
+ * @param src       Input view.
+ * @param automaton Compiled delimiters (see utf8_automaton_init).
+ * @param out       Span list; cleared, then filled (capacity is reused).
+ * @return          true on success, false on invalid input or allocation failure.
+ */
+bool utf8_byte_split_any_spans(
+    UTF8View src, const UTF8Automaton* automaton, UTF8SpanList* out
+);
+
 /**
  * @brief Splits a UTF-8 byte string into parts matching a PCRE2 regex pattern.
  *
@@ -206,6 +400,48 @@ uint8_t** utf8_byte_split_delim(const uint8_t* src, const uint8_t* delim, uint64
  */
 uint8_t** utf8_byte_split_regex(const uint8_t* src, const uint8_t* pattern, uint64_t* count);
 
+/**
+ * @brief Splits a view into parts matching a PCRE2 regex pattern.
+ *
+ * @see utf8_byte_split_regex
+ */
+uint8_t** utf8_byte_split_regex_view(UTF8View src, const uint8_t* pattern, uint64_t* count);
+
+/**
+ * @brief Splits a view into regex matches allocated from the arena.
+ *
+ * @see utf8_byte_split_regex
+ * @note The pointer table and all parts live in the arena; do not free them.
+ */
+uint8_t** utf8_byte_split_regex_arena(
+    UTF8View src, const uint8_t* pattern, uint64_t* count, UTF8Arena* arena
+);
+
+/**
+ * @brief Splits a view into regex matches, interning each match.
+ *
+ * @see utf8_byte_split_regex
+ * @param interner Interner that receives the matches.
+ * @return         Array of count symbol IDs (caller frees), or NULL on error.
+ */
+uint32_t* utf8_byte_split_regex_intern(
+    UTF8View src, const uint8_t* pattern, UTF8Interner* interner, uint64_t* count
+);
+
+/**
+ * @brief Records the spans of src matching a PCRE2 regex pattern, without copying.
+ *
+ * @param src     Input view.
+ * @param pattern Null-terminated regex pattern (PCRE2).
+ * @param out     Span list; cleared, then filled (capacity is reused).
+ * @return        true on success, false on invalid input (including src that is not
+ *                valid UTF-8), bad pattern or allocation failure.
+ *
+ * @note Empty matches are skipped. To reuse a compiled pattern or stream matches
+ *       without recording them, use UTF8RegexIter (see regex.h).
+ */
+bool utf8_byte_split_regex_spans(UTF8View src, const uint8_t* pattern, UTF8SpanList* out);
+
 /**
  * @brief Joins an array of null-terminated byte strings into one string, with optional delimiter.
  *
@@ -219,4 +455,27 @@ uint8_t** utf8_byte_split_regex(const uint8_t* src, const uint8_t* pattern, uint
  */
 uint8_t* utf8_byte_join(uint8_t** parts, uint64_t count, const uint8_t* delim);
 
+/**
+ * @brief Joins an array of views into one null-terminated string.
+ *
+ * @param parts Array of views to join (each must be valid).
+ * @param count Number of elements in parts.
+ * @param delim Delimiter inserted between parts (an invalid view means none).
+ * @return      Newly allocated, null-terminated string; NULL on error.
+ *
+ * @note Caller must free the result.
+ * @note If count is 0, returns NULL.
+ */
+uint8_t* utf8_byte_join_view(const UTF8View* parts, uint64_t count, UTF8View delim);
+
+/**
+ * @brief Joins an array of views into a null-terminated string in the arena.
+ *
+ * @see utf8_byte_join_view
+ * @return Pointer into the arena, or NULL on error.
+ */
+uint8_t* utf8_byte_join_arena(
+    const UTF8View* parts, uint64_t count, UTF8View delim, UTF8Arena* arena
+);
+
 #endif  // UTF8_BYTE_H
@@ -0,0 +1,45 @@
+/**
+ * @warning This file is auto-generated. Do not edit directly.
+ * @brief Full case mapping and case folding data.
+ * @ref Unicode UCD - Generated by unicode.case.py
+ * @version 1
+ * @date 2026-10-17
+ */
+
+#ifndef UTF8_CASE_DATA_H
+#define UTF8_CASE_DATA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum UTF8CaseMode {
+    UTF8_CASE_LOWER = 0,
+    UTF8_CASE_UPPER = 1,
+    UTF8_CASE_FOLD = 2,
+} UTF8CaseMode;
+
+#define UTF8_CASE_CASED 0x01
+#define UTF8_CASE_IGNORABLE 0x02
+#define UTF8_CASE_FINAL_SIGMA 0x04
+#define UTF8_CASE_SHIFT 7
+#define UTF8_CASE_SPECIAL_MAX 6
+#define UTF8_CASE_EXPANSION 3
+
+// delta[mode] is added to the codepoint unless special[mode] names a string
+typedef struct UTF8CaseRecord {
+    int32_t delta[3];
+    uint8_t special[3];
+    uint8_t flags;
+} UTF8CaseRecord;
+
+typedef struct UTF8CaseSpecial {
+    uint8_t len;
+    uint8_t bytes[UTF8_CASE_SPECIAL_MAX];
+} UTF8CaseSpecial;
+
+extern const uint8_t utf8_case_stage1[8704];
+extern const uint16_t utf8_case_stage2[20352];
+extern const UTF8CaseRecord utf8_case_records[282];
+extern const UTF8CaseSpecial utf8_case_special[146];
+
+#endif // UTF8_CASE_DATA_H
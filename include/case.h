@@ -0,0 +1,68 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/case.h
+ * @brief Full Unicode case mapping and case folding.
+ *
+ * Mappings come from UnicodeData.txt, SpecialCasing.txt and CaseFolding.txt
+ * (see unicode/case.py) and include the one-to-many forms, so the output can be
+ * longer or shorter than the input (e.g., "ß" upper-cases to "SS").
+ *
+ * - Conversions write into caller-provided buffers and are never null-terminated.
+ *   Either size dst with utf8_case_length(), or use src.len * UTF8_CASE_EXPANSION
+ *   bytes and skip the length pass.
+ * - U+03A3 lower-cases to final sigma (U+03C2) at the end of a word, per the
+ *   Final_Sigma condition. Language-specific mappings (Turkish, Lithuanian) are
+ *   not applied.
+ * - Case folding is the full (C + F) folding, for caseless matching.
+ * - Errors are reported as UTF8Validation (see validate.h): the kind and the
+ *   input offset of the first error, after converting everything before it.
+ *
+ * Runs of ASCII are converted a vector at a time (8 bytes scalar, 16 for SSE2,
+ * 32 for AVX2 and up); other codepoints take one table lookup each.
+ */
+
+#ifndef UTF8_CASE_H
+#define UTF8_CASE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "case-data.h"
+#include "view.h"
+#include "validate.h"
+
+/**
+ * @brief Maps one codepoint.
+ *
+ * @return The mapping of cp when it is a single codepoint; cp itself when it has no
+ *         mapping or only a one-to-many one (e.g., U+00DF for UTF8_CASE_UPPER).
+ */
+uint32_t utf8_case_cp(uint32_t cp, UTF8CaseMode mode);
+
+/**
+ * @brief Returns the number of bytes src converts to under mode.
+ *
+ * @return Byte count, or -1 if src is not valid UTF-8.
+ */
+int64_t utf8_case_length(UTF8View src, UTF8CaseMode mode);
+
+/**
+ * @brief Converts src to lowercase, uppercase or its case folding.
+ *
+ * @param src     Input view.
+ * @param mode    UTF8_CASE_LOWER, UTF8_CASE_UPPER or UTF8_CASE_FOLD.
+ * @param dst     Output buffer of at least utf8_case_length(src, mode) bytes
+ *                (for invalid input, the conversion of the bytes before the error).
+ * @param written Output: number of bytes written.
+ * @return        UTF8_ERROR_NONE, or the first error and its byte offset in src.
+ */
+UTF8Validation utf8_case_convert(UTF8View src, UTF8CaseMode mode, uint8_t* dst, size_t* written);
+
+// Shorthands for utf8_case_convert with UTF8_CASE_LOWER, UTF8_CASE_UPPER and UTF8_CASE_FOLD
+UTF8Validation utf8_to_lower(UTF8View src, uint8_t* dst, size_t* written);
+UTF8Validation utf8_to_upper(UTF8View src, uint8_t* dst, size_t* written);
+UTF8Validation utf8_casefold(UTF8View src, uint8_t* dst, size_t* written);
+
+#endif  // UTF8_CASE_H
@@ -33,24 +33,44 @@
 #include <stddef.h>
 #include <stdlib.h>
 
+#include "view.h"
+#include "span.h"
+#include "arena.h"
+#include "property-data.h"
+
 // --- UTF-8 Codepoint Operations ---
 
 int8_t utf8_cp_width(const uint8_t* start);
 int32_t utf8_cp_decode(const uint8_t* start);
+// Validate and decode one codepoint in a single pass; end bounds the input (NULL for a
+// null-terminated string). Returns the width, or -1 if the sequence is invalid or truncated
+int8_t utf8_cp_decode_next(const uint8_t* start, const uint8_t* end, int32_t* cp);
+// Write cp as 1-4 bytes to dst (not null-terminated); -1 for surrogates and values above U+10FFFF
+int8_t utf8_cp_encode(int32_t cp, uint8_t* dst);
 bool utf8_cp_is_valid(const uint8_t* start);
 bool utf8_cp_is_equal(const uint8_t* a, const uint8_t* b);
 ptrdiff_t utf8_cp_range(const uint8_t* start, const uint8_t* end);
 int64_t utf8_cp_count(const uint8_t* start);
+int64_t utf8_cp_count_view(UTF8View view);
+// Count codepoints in a view already known to be valid (no validation)
+int64_t utf8_cp_count_fast(UTF8View view);
 uint8_t* utf8_cp_copy(const uint8_t* start);
+// Heap copy of the codepoint at index; O(index) per call, see UTF8CpIndex for repeated lookups
 uint8_t* utf8_cp_index(const uint8_t* start, uint32_t index);
 void utf8_cp_dump(const uint8_t* start);
 
 // --- UTF-8 Codepoint Types ---
 
+// General_Category of cp from the generated two-stage tables; UTF8_GC_CN above U+10FFFF
+UTF8GeneralCategory utf8_cp_category(uint32_t cp);
+// Classifiers cover all of Unicode and are false for invalid sequences:
+// char (assigned, not Cc), digit (Nd), alpha (L*), alnum (L* or Nd), upper (Lu, Lt),
+// lower (Ll), space (White_Space), punct (P* or S*)
 bool utf8_cp_is_char(const uint8_t* start);
 bool utf8_cp_is_digit(const uint8_t* start);
 bool utf8_cp_is_alpha(const uint8_t* start);
 bool utf8_cp_is_alnum(const uint8_t* start);
+bool utf8_cp_is_upper(const uint8_t* start);
 bool utf8_cp_is_lower(const uint8_t* start);
 bool utf8_cp_is_space(const uint8_t* start);
 bool utf8_cp_is_punct(const uint8_t* start);
@@ -64,22 +84,84 @@ const uint8_t* utf8_cp_prev_width(
     const uint8_t* start, const uint8_t* current, int8_t* out_width
 );
 const uint8_t* utf8_cp_peek(const uint8_t* current, const size_t ahead);
+// Step back n codepoints from current in text already known to be valid, counting lead
+// bytes a vector at a time; NULL if fewer than n codepoints lie in [start, current)
+const uint8_t* utf8_cp_retreat(const uint8_t* start, const uint8_t* current, size_t n);
+
+// --- UTF-8 Codepoint Cursor ---
+
+// A codepoint located in its text (ptr borrows from the source)
+typedef struct UTF8CpRef {
+    const uint8_t* ptr;  // First byte of the codepoint
+    int8_t width;  // Encoded width in bytes; 0 past either end, -1 if invalid
+    int32_t cp;  // Decoded value; -1 unless width > 0
+} UTF8CpRef;
+
+// Zero-copy, bidirectional walk over codepoints; the building block for higher layers
+typedef struct UTF8CpCursor {
+    const uint8_t* start;  // First byte of input (prev stops here)
+    const uint8_t* current;  // Boundary between the previous and the next codepoint
+    const uint8_t* end;  // End of input, or NULL if null-terminated
+} UTF8CpCursor;
+
+// Initialize cursor at the start of a null-terminated string
+UTF8CpCursor utf8_cp_cursor(const uint8_t* start);
+// Initialize cursor bounded by a view (null bytes are yielded as codepoints)
+UTF8CpCursor utf8_cp_cursor_view(UTF8View view);
+// Initialize cursor at the end of a view, for walking it backwards with prev
+UTF8CpCursor utf8_cp_cursor_view_end(UTF8View view);
+// Decode the codepoint after current and step over it. At the end, width is 0; on an
+// invalid or truncated sequence, width is -1 and the cursor does not move
+UTF8CpRef utf8_cp_cursor_next(UTF8CpCursor* cursor);
+// Step back over the codepoint before current and decode it. At start, width is 0; if no
+// valid sequence ends at current, width is -1 and the cursor does not move
+UTF8CpRef utf8_cp_cursor_prev(UTF8CpCursor* cursor);
 
 // --- UTF-8 Codepoint Iterator
 
 typedef struct UTF8CpIter {
     const uint8_t* current;  // Current position in string
+    const uint8_t* end;  // End of input, or NULL if null-terminated
     char buffer[5];  // UTF-8 codepoint (4 bytes max + null)
 } UTF8CpIter;
 
 // Initialize iterator from string start
 UTF8CpIter utf8_cp_iter(const uint8_t* start);
+// Initialize iterator bounded by a view (null bytes are yielded as codepoints)
+UTF8CpIter utf8_cp_iter_view(UTF8View view);
 // Get next codepoint (returns pointer to buffer, advances position)
 const char* utf8_cp_iter_next(UTF8CpIter* it);
 
+// --- UTF-8 Codepoint Index
+
+// Samples per UTF8CpIndex: one byte offset every 512 codepoints (under 2% of ASCII text)
+#define UTF8_CP_INDEX_STRIDE 512
+
+typedef struct UTF8CpIndex {
+    UTF8View text;  // Indexed text (borrowed; must outlive the index)
+    size_t* offsets;  // offsets[i]: byte offset of codepoint i * stride
+    size_t samples;  // Number of offsets
+    size_t stride;  // Codepoints between samples
+    size_t length;  // Codepoints in text
+} UTF8CpIndex;
+
+// Validate text and sample every stride codepoints (0 for UTF8_CP_INDEX_STRIDE); false on
+// invalid UTF-8 or allocation failure
+bool utf8_cp_index_init(UTF8CpIndex* index, UTF8View text, size_t stride);
+// Locate codepoint n without allocating; false if n is out of range
+bool utf8_cp_index_at(const UTF8CpIndex* index, size_t n, UTF8CpRef* out);
+// Byte offset of codepoint n (n == length gives the end of text); -1 if out of range
+int64_t utf8_cp_index_offset(const UTF8CpIndex* index, size_t n);
+void utf8_cp_index_free(UTF8CpIndex* index);
+
 // --- UTF-8 Codepoint Split ---
 
 uint8_t** utf8_cp_split(const uint8_t* start, size_t* capacity);
+uint8_t** utf8_cp_split_view(UTF8View view, size_t* capacity);
+// Table and parts are allocated from arena; never free them
+uint8_t** utf8_cp_split_arena(UTF8View view, size_t* capacity, UTF8Arena* arena);
+// Record one span per codepoint into out (cleared first); false on error
+bool utf8_cp_split_spans(UTF8View view, UTF8SpanList* out);
 void utf8_cp_split_free(uint8_t** parts, size_t capacity);
 void utf8_cp_split_dump(uint8_t** parts, size_t capacity);
 
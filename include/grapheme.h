@@ -20,6 +20,9 @@
 #include <stdio.h>
 
 #include "grapheme-data.h"
+#include "view.h"
+#include "span.h"
+#include "arena.h"
 
 #define UTF8_GCB_COUNT 8 // 32 bytes = 4 bytes * 8 bytes/codepoint
 #define UTF8_GCB_SIZE UTF8_GCB_COUNT * 4 + 1 // max 4 bytes/codepoint + NULL char
@@ -35,18 +38,25 @@ bool utf8_gcb_is_break(UTF8GraphemeBuffer* gb, int32_t cp);
 void utf8_gcb_buffer_push(UTF8GraphemeBuffer* gb, uint32_t cp);
 
 int64_t utf8_gcb_count(const char* src);
+int64_t utf8_gcb_count_view(UTF8View view);
 
 typedef struct UTF8GraphemeIter {
     const char* current;  // Current input pointer
+    const char* end; // End of input, or NULL if null-terminated
     UTF8GraphemeBuffer gb; // codepoint history
     char buffer[UTF8_GCB_SIZE]; // current cluster
     bool first; // init cluster sequence
 } UTF8GraphemeIter;
 
 UTF8GraphemeIter utf8_gcb_iter(const char* start);
+UTF8GraphemeIter utf8_gcb_iter_view(UTF8View view);
 const char* utf8_gcb_iter_next(UTF8GraphemeIter* it);
 
 char** utf8_gcb_split(const char* src, size_t* capacity);
+char** utf8_gcb_split_view(UTF8View view, size_t* capacity);
+// Table and parts are allocated from arena; never free them
+char** utf8_gcb_split_arena(UTF8View view, size_t* capacity, UTF8Arena* arena);
+bool utf8_gcb_split_spans(UTF8View view, UTF8SpanList* out);
 void utf8_gcb_split_free(char** parts, size_t capacity);
 void utf8_gcb_split_dump(char** parts, size_t capacity);
 
@@ -0,0 +1,93 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/interner.h
+ * @brief String interning: maps byte strings to small, stable symbol IDs.
+ *
+ * Each distinct string is stored once, null-terminated, in a single contiguous
+ * buffer and identified by a 32-bit symbol ID assigned in insertion order.
+ * Lookups go through an open-addressing (linear probing) hash table that holds
+ * only IDs, so a repetitive corpus costs one copy per distinct string plus a
+ * few bytes per occurrence.
+ *
+ * - A zero-initialized UTF8Interner is a valid empty interner.
+ * - IDs stay valid until the interner is cleared or freed. Views and pointers
+ *   returned for an ID are invalidated by the next insertion (the buffer may move).
+ */
+
+#ifndef UTF8_INTERNER_H
+#define UTF8_INTERNER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "view.h"
+#include "builder.h"
+
+#define UTF8_SYMBOL_NONE UINT32_MAX
+
+typedef struct UTF8Symbol {
+    uint64_t hash;
+    size_t offset;  // Start of the string in the interner's buffer
+    size_t len;  // Length in bytes, excluding the terminator
+} UTF8Symbol;
+
+typedef struct UTF8Interner {
+    UTF8Builder strings;  // Every distinct string, each followed by a null byte
+    UTF8Symbol* symbols;  // Indexed by symbol ID
+    size_t count;  // Number of symbols
+    size_t capacity;  // Allocated symbols
+    uint32_t* slots;  // Hash table of symbol ID + 1 (0 marks an empty slot)
+    size_t slot_count;  // Power of two, at least twice count
+} UTF8Interner;
+
+/**
+ * @brief Hashes a byte string (fast, non-cryptographic, 64-bit).
+ */
+uint64_t utf8_interner_hash(UTF8View view);
+
+/**
+ * @brief Returns the ID for view, storing a copy if it is new.
+ *
+ * @param interner Interner to update.
+ * @param view     String to intern (may contain null bytes; may be empty).
+ * @param id       Output: the symbol ID.
+ * @return         true on success, false on invalid input, allocation failure,
+ *                 or once the 32-bit ID space is exhausted.
+ */
+bool utf8_interner_intern(UTF8Interner* interner, UTF8View view, uint32_t* id);
+
+/**
+ * @brief Looks view up without inserting it.
+ *
+ * @return The symbol ID, or UTF8_SYMBOL_NONE if view was never interned.
+ */
+uint32_t utf8_interner_find(const UTF8Interner* interner, UTF8View view);
+
+/**
+ * @brief Returns the string for an ID, or an empty view ({0}) for an unknown ID.
+ */
+UTF8View utf8_interner_view(const UTF8Interner* interner, uint32_t id);
+
+/**
+ * @brief Returns the null-terminated string for an ID, or NULL for an unknown ID.
+ */
+const uint8_t* utf8_interner_str(const UTF8Interner* interner, uint32_t id);
+
+/**
+ * @brief Returns the bytes held by the interner (strings, symbols and table).
+ */
+size_t utf8_interner_size(const UTF8Interner* interner);
+
+/**
+ * @brief Forgets every symbol while keeping allocated memory for reuse.
+ */
+void utf8_interner_clear(UTF8Interner* interner);
+
+/**
+ * @brief Releases all memory and leaves the interner empty.
+ */
+void utf8_interner_free(UTF8Interner* interner);
+
+#endif  // UTF8_INTERNER_H
@@ -0,0 +1,50 @@
+/**
+ * @warning This file is auto-generated. Do not edit directly.
+ * @brief Normalization (NFC, NFD, NFKC, NFKD) property data.
+ * @ref Unicode UCD - Generated by unicode.normal.py
+ * @version 1
+ * @date 2026-10-17
+ */
+
+#ifndef UTF8_NORMAL_DATA_H
+#define UTF8_NORMAL_DATA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define UTF8_NORMAL_NFD_NO 0x01
+#define UTF8_NORMAL_NFKD_NO 0x02
+#define UTF8_NORMAL_NFC_NO 0x04
+#define UTF8_NORMAL_NFC_MAYBE 0x08
+#define UTF8_NORMAL_NFKC_NO 0x10
+#define UTF8_NORMAL_NFKC_MAYBE 0x20
+
+#define UTF8_NORMAL_NFC_MIN 0x0300
+#define UTF8_NORMAL_NFD_MIN 0x00C0
+#define UTF8_NORMAL_NFKC_MIN 0x00A0
+#define UTF8_NORMAL_NFKD_MIN 0x00A0
+#define UTF8_NORMAL_CANONICAL_EXPANSION 3
+#define UTF8_NORMAL_COMPAT_EXPANSION 11
+#define UTF8_NORMAL_SHIFT 7
+
+// Offsets and lengths of the full decompositions in utf8_normal_decomp; 0 if none
+typedef struct UTF8NormalRecord {
+    uint16_t canonical;
+    uint8_t canonical_len;
+    uint8_t ccc;
+    uint16_t compat;
+    uint8_t compat_len;
+    uint8_t flags;
+} UTF8NormalRecord;
+
+typedef struct UTF8NormalPair {
+    uint32_t first, second, composite;
+} UTF8NormalPair;
+
+extern const uint8_t utf8_normal_stage1[8704];
+extern const uint16_t utf8_normal_stage2[21504];
+extern const UTF8NormalRecord utf8_normal_records[3867];
+extern const uint32_t utf8_normal_decomp[6719];
+extern const UTF8NormalPair utf8_normal_pairs[941];
+
+#endif // UTF8_NORMAL_DATA_H
@@ -0,0 +1,149 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/normal.h
+ * @brief Unicode normalization forms (NFC, NFD, NFKC, NFKD).
+ *
+ * Decompositions, combining classes, quick-check values and composites come
+ * from UnicodeData.txt and DerivedNormalizationProps.txt (see unicode/normal.py);
+ * Hangul syllables are (de)composed algorithmically.
+ *
+ * - utf8_normal_quick_check() answers Yes for most real text without
+ *   normalizing it, so already-normalized input can be used as is.
+ * - utf8_normalize() copies the longest already-normalized prefix (and every
+ *   later normalized run) verbatim and only decomposes, reorders and
+ *   recomposes around the codepoints that need it.
+ * - Output goes to a caller-provided buffer and is never null-terminated. Either
+ *   size dst with utf8_normalize_length(), or use src.len times
+ *   UTF8_NORMAL_CANONICAL_EXPANSION (NFC, NFD) or UTF8_NORMAL_COMPAT_EXPANSION
+ *   (NFKC, NFKD) bytes.
+ * - UTF8Normalizer normalizes input that arrives in pieces; segments and
+ *   codepoints that straddle chunk boundaries are carried to the next chunk.
+ * - Errors are reported as UTF8Validation (see validate.h), after normalizing
+ *   everything before the first error.
+ */
+
+#ifndef UTF8_NORMAL_H
+#define UTF8_NORMAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "normal-data.h"
+#include "view.h"
+#include "validate.h"
+
+typedef enum UTF8NormalForm {
+    UTF8_NFC,
+    UTF8_NFD,
+    UTF8_NFKC,
+    UTF8_NFKD,
+} UTF8NormalForm;
+
+typedef enum UTF8NormalCheck {
+    UTF8_NORMAL_YES,
+    UTF8_NORMAL_NO,
+    UTF8_NORMAL_MAYBE,  // Only normalizing can tell (NFC and NFKC)
+} UTF8NormalCheck;
+
+/**
+ * @brief Returns the canonical combining class of cp (0 for starters).
+ */
+uint8_t utf8_normal_ccc(uint32_t cp);
+
+/**
+ * @brief Quick check (UAX #15, section 9) of src against form.
+ *
+ * Runs of bytes below the form's first non-trivial codepoint (U+0300 for NFC) are
+ * skipped a vector at a time.
+ *
+ * @return UTF8_NORMAL_YES if src is in form, UTF8_NORMAL_NO if it is not (or is not
+ *         valid UTF-8), UTF8_NORMAL_MAYBE if only normalizing can tell.
+ */
+UTF8NormalCheck utf8_normal_quick_check(UTF8View src, UTF8NormalForm form);
+UTF8NormalCheck utf8_nfc_quick_check(UTF8View src);
+
+/**
+ * @brief Returns the number of bytes src normalizes to.
+ *
+ * @return Byte count, or -1 if src is not valid UTF-8.
+ */
+int64_t utf8_normalize_length(UTF8View src, UTF8NormalForm form);
+
+/**
+ * @brief Normalizes src to form.
+ *
+ * @param src     Input view.
+ * @param form    Target normalization form.
+ * @param dst     Output buffer of at least utf8_normalize_length(src, form) bytes
+ *                (for invalid input, the normalization of the bytes before the error).
+ * @param written Output: number of bytes written.
+ * @return        UTF8_ERROR_NONE, or the first error and its byte offset in src.
+ */
+UTF8Validation utf8_normalize(UTF8View src, UTF8NormalForm form, uint8_t* dst, size_t* written);
+
+/**
+ * @brief Receives normalized output.
+ *
+ * @param normalized Output bytes (valid only during the call).
+ * @param ctx        User context.
+ * @return           true to continue, false to stop normalizing.
+ */
+typedef bool (*UTF8NormalCallback)(UTF8View normalized, void* ctx);
+
+// Segment entries held inline; longer runs of non-starters move to the heap.
+#define UTF8_NORMAL_SEGMENT 32
+
+typedef struct UTF8Normalizer {
+    UTF8NormalForm form;
+    uint32_t local[UTF8_NORMAL_SEGMENT];  // Pending decomposed codepoints, as ccc << 24 | cp
+    uint32_t* segment;  // Heap storage once local is full, or NULL
+    size_t count;
+    size_t capacity;
+    uint8_t* out;  // Output not yet delivered (or the caller's dst for utf8_normalize)
+    size_t out_len;
+    size_t out_capacity;
+    uint8_t carry[4];  // Incomplete sequence at the end of the last chunk
+    size_t carry_len;
+    size_t offset;  // Input bytes fed so far
+    UTF8Validation status;  // First error, if feeding stopped on invalid input
+    bool stopped;  // The callback asked to stop
+    UTF8NormalCallback emit;
+    void* ctx;
+} UTF8Normalizer;
+
+/**
+ * @brief Prepares a streaming normalizer.
+ *
+ * @return true on success, false on invalid input or allocation failure.
+ */
+bool utf8_normalizer_init(
+    UTF8Normalizer* normalizer, UTF8NormalForm form, UTF8NormalCallback emit, void* ctx
+);
+
+/**
+ * @brief Releases the normalizer's buffers.
+ */
+void utf8_normalizer_free(UTF8Normalizer* normalizer);
+
+/**
+ * @brief Pushes the next piece of input (any size, split anywhere).
+ *
+ * Output is delivered once per call, up to the last segment that later input can
+ * no longer change.
+ *
+ * @return true to keep feeding, false on invalid input (see status) or if the
+ *         callback stopped.
+ */
+bool utf8_normalizer_feed(UTF8Normalizer* normalizer, UTF8View chunk);
+
+/**
+ * @brief Signals end of input and delivers the remaining output.
+ *
+ * @return true on success, false on a truncated final sequence (see status) or if the
+ *         callback stopped.
+ */
+bool utf8_normalizer_finish(UTF8Normalizer* normalizer);
+
+#endif  // UTF8_NORMAL_H
@@ -0,0 +1,85 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/parallel.h
+ * @brief Multi-threaded join, split and regex search built on OpenMP.
+ *
+ * Each routine produces exactly the result of its sequential counterpart.
+ *
+ * The threads argument selects the worker count:
+ * - threads > 1 always runs that many workers.
+ * - threads == 1 runs the sequential routine.
+ * - threads <= 0 uses the OpenMP default, and falls back to the sequential routine
+ *   for inputs smaller than UTF8_PARALLEL_MIN_BYTES.
+ */
+
+#ifndef UTF8_PARALLEL_H
+#define UTF8_PARALLEL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "view.h"
+#include "span.h"
+#include "regex.h"
+
+// Inputs below this size are not worth waking a thread team for (auto mode only).
+#define UTF8_PARALLEL_MIN_BYTES ((size_t) 1 << 20)
+
+/**
+ * @brief Joins views with a length prefix sum, then copies every part concurrently.
+ *
+ * @see utf8_byte_join_view
+ */
+uint8_t* utf8_byte_join_view_parallel(
+    const UTF8View* parts, uint64_t count, UTF8View delim, int threads
+);
+
+/**
+ * @brief Joins null-terminated strings; parts are also measured concurrently.
+ *
+ * @see utf8_byte_join
+ */
+uint8_t* utf8_byte_join_parallel(uint8_t** parts, uint64_t count, const uint8_t* delim, int threads);
+
+/**
+ * @brief Splits src by delim using one chunk per worker, then stitches the spans.
+ *
+ * Matches are searched per chunk; a delimiter that can overlap itself (e.g., "aa")
+ * is re-scanned across chunk edges so results stay leftmost and non-overlapping.
+ *
+ * @see utf8_byte_split_delim_spans
+ */
+bool utf8_byte_split_delim_spans_parallel(
+    UTF8View src, UTF8View delim, UTF8SpanList* out, int threads
+);
+
+/**
+ * @brief Splits src into codepoint spans using chunks cut at lead bytes.
+ *
+ * Falls back to the sequential walk if the chunks do not line up (malformed input),
+ * so the result always matches utf8_cp_split_spans.
+ *
+ * @see utf8_cp_split_spans
+ */
+bool utf8_cp_split_spans_parallel(UTF8View src, UTF8SpanList* out, int threads);
+
+/**
+ * @brief Runs a pattern over blocks of documents, each worker with its own match data.
+ *
+ * Workers collect rows privately; the rows are then copied into out at their
+ * document-ordered positions. Small batches use the sequential routine.
+ *
+ * @see utf8_regex_findall
+ */
+bool utf8_regex_findall_parallel(
+    const pcre2_code* code,
+    const UTF8View* docs,
+    size_t n,
+    UTF8RegexMatches* out,
+    size_t* total,
+    int threads
+);
+
+#endif  // UTF8_PARALLEL_H
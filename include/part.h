@@ -0,0 +1,79 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/part.h
+ * @brief Growable list of owned, null-terminated strings.
+ *
+ * UTF8PartList is the container behind every heap-allocated split result. It
+ * grows geometrically, so building a list of n parts costs O(log n) reallocations
+ * of the pointer table. A finished list can be released as a plain uint8_t** array
+ * compatible with utf8_byte_split_free and utf8_byte_append.
+ */
+
+#ifndef UTF8_PART_H
+#define UTF8_PART_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "view.h"
+
+typedef struct UTF8PartList {
+    uint8_t** parts;  // Array of owned strings
+    size_t count;  // Number of parts in use
+    size_t capacity;  // Number of slots allocated (always a power of two)
+} UTF8PartList;
+
+/**
+ * @brief Ensures the list can hold at least capacity parts without reallocating.
+ *
+ * A zero-initialized UTF8PartList is a valid empty list. Capacity is rounded up
+ * to a power of two.
+ *
+ * @return true on success, false on allocation failure (list is unchanged).
+ */
+bool utf8_part_list_reserve(UTF8PartList* list, size_t capacity);
+
+/**
+ * @brief Appends a heap-allocated string; the list takes ownership of it.
+ *
+ * @return true on success, false on allocation failure (part is not taken).
+ */
+bool utf8_part_list_push(UTF8PartList* list, uint8_t* part);
+
+/**
+ * @brief Appends a null-terminated copy of the bytes in view.
+ *
+ * @return true on success, false on invalid input or allocation failure.
+ */
+bool utf8_part_list_push_view(UTF8PartList* list, UTF8View view);
+
+/**
+ * @brief Returns the part at index, or NULL if index is out of range.
+ */
+uint8_t* utf8_part_list_get(const UTF8PartList* list, size_t index);
+
+/**
+ * @brief Frees every part while keeping the pointer table for reuse.
+ */
+void utf8_part_list_clear(UTF8PartList* list);
+
+/**
+ * @brief Frees every part and the pointer table; resets the list to empty.
+ */
+void utf8_part_list_free(UTF8PartList* list);
+
+/**
+ * @brief Hands the pointer table and its parts to the caller; resets the list.
+ *
+ * @param list  List to release.
+ * @param count Output: number of parts in the returned array.
+ * @return      Array of parts (never NULL on success, even when empty), or NULL on error.
+ *
+ * @note Free with utf8_byte_split_free. The array is a plain heap allocation, so
+ *       utf8_byte_append can keep growing it.
+ */
+uint8_t** utf8_part_list_release(UTF8PartList* list, uint64_t* count);
+
+#endif  // UTF8_PART_H
@@ -21,6 +21,8 @@
 #include <time.h>
 #include <unistd.h>
 
+#include "arena.h"
+
 #define PATH_ACCESS_READ 0x01 // Read permission
 #define PATH_ACCESS_WRITE 0x02 // Write permission
 #define PATH_ACCESS_EXEC 0x04 // Execute permission
@@ -97,6 +99,7 @@ PathEntry* path_create_entry(
 void path_free_entry(PathEntry* entry); // Frees a PathEntry structure
 
 PathSplit* path_split(const char* path); // Splits a path into components
+PathSplit* path_split_arena(const char* path, UTF8Arena* arena); // Split lives in the arena (do not free)
 void path_free_split(PathSplit* split); // Frees a PathSplit object
 
 void path_free_string(char* path); // Frees a string returned by path functions
@@ -117,5 +120,6 @@ char* path_normalize(const char* path, PathNormalize flags); // Normalizes a pat
 char* path_dirname(const char* path); // Gets the directory part of a path
 char* path_basename(const char* path); // Gets the basename of a path
 char* path_join(const char* base, const char* sub); // Joins two paths
+char* path_join_arena(const char* base, const char* sub, UTF8Arena* arena); // Joins into the arena
 
 #endif // UTF8_PATH_H
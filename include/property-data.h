@@ -0,0 +1,63 @@
+/**
+ * @warning This file is auto-generated. Do not edit directly.
+ * @brief General_Category and White_Space property data.
+ * @ref Unicode UCD - Generated by unicode.property.py
+ * @version 1
+ * @date 2026-10-17
+ */
+
+#ifndef UTF8_PROPERTY_DATA_H
+#define UTF8_PROPERTY_DATA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef enum UTF8GeneralCategory {
+    UTF8_GC_CN = 0,
+    UTF8_GC_LU = 1,
+    UTF8_GC_LL = 2,
+    UTF8_GC_LT = 3,
+    UTF8_GC_LM = 4,
+    UTF8_GC_LO = 5,
+    UTF8_GC_MN = 6,
+    UTF8_GC_MC = 7,
+    UTF8_GC_ME = 8,
+    UTF8_GC_ND = 9,
+    UTF8_GC_NL = 10,
+    UTF8_GC_NO = 11,
+    UTF8_GC_PC = 12,
+    UTF8_GC_PD = 13,
+    UTF8_GC_PS = 14,
+    UTF8_GC_PE = 15,
+    UTF8_GC_PI = 16,
+    UTF8_GC_PF = 17,
+    UTF8_GC_PO = 18,
+    UTF8_GC_SM = 19,
+    UTF8_GC_SC = 20,
+    UTF8_GC_SK = 21,
+    UTF8_GC_SO = 22,
+    UTF8_GC_ZS = 23,
+    UTF8_GC_ZL = 24,
+    UTF8_GC_ZP = 25,
+    UTF8_GC_CC = 26,
+    UTF8_GC_CF = 27,
+    UTF8_GC_CS = 28,
+    UTF8_GC_CO = 29,
+} UTF8GeneralCategory;
+
+#define UTF8_GC_MASK_LETTER ((1u << UTF8_GC_LU) | (1u << UTF8_GC_LL) | (1u << UTF8_GC_LT) | (1u << UTF8_GC_LM) | (1u << UTF8_GC_LO))
+#define UTF8_GC_MASK_MARK ((1u << UTF8_GC_MN) | (1u << UTF8_GC_MC) | (1u << UTF8_GC_ME))
+#define UTF8_GC_MASK_NUMBER ((1u << UTF8_GC_ND) | (1u << UTF8_GC_NL) | (1u << UTF8_GC_NO))
+#define UTF8_GC_MASK_PUNCT ((1u << UTF8_GC_PC) | (1u << UTF8_GC_PD) | (1u << UTF8_GC_PS) | (1u << UTF8_GC_PE) | (1u << UTF8_GC_PI) | (1u << UTF8_GC_PF) | (1u << UTF8_GC_PO))
+#define UTF8_GC_MASK_SYMBOL ((1u << UTF8_GC_SM) | (1u << UTF8_GC_SC) | (1u << UTF8_GC_SK) | (1u << UTF8_GC_SO))
+#define UTF8_GC_MASK_SEPARATOR ((1u << UTF8_GC_ZS) | (1u << UTF8_GC_ZL) | (1u << UTF8_GC_ZP))
+#define UTF8_GC_MASK_OTHER ((1u << UTF8_GC_CN) | (1u << UTF8_GC_CC) | (1u << UTF8_GC_CF) | (1u << UTF8_GC_CS) | (1u << UTF8_GC_CO))
+
+#define UTF8_PROPERTY_CATEGORY 0x1F
+#define UTF8_PROPERTY_WHITE_SPACE 0x80
+#define UTF8_PROPERTY_SHIFT 8
+
+extern const uint8_t utf8_property_stage1[4352];
+extern const uint8_t utf8_property_stage2[40192];
+
+#endif // UTF8_PROPERTY_DATA_H
@@ -6,10 +6,33 @@
 #define UTF8_REGEX_H
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #define PCRE2_CODE_UNIT_WIDTH 8
 #include <pcre2.h>
 
+#include "view.h"
+
+/**
+ * @brief Lazily walks the matches of a compiled pattern over a subject.
+ *
+ * Matching always sees the whole subject (with a start offset), so lookbehind,
+ * \b and ^ behave as they would in a single global match. An empty match is
+ * followed by a non-empty attempt at the same position, then by a one-codepoint
+ * advance, so every position is visited once and the iterator always terminates.
+ */
+typedef struct UTF8RegexIter {
+    const pcre2_code* code;  // Borrowed; must outlive the iterator
+    pcre2_match_data* match;  // Owned; reused for every match
+    UTF8View subject;
+    size_t offset;  // Where the next search starts
+    uint32_t options;  // Extra options for the next search
+    bool crlf;  // CRLF counts as one newline for this pattern
+    bool done;
+    int error;  // Negative PCRE2 error code if matching failed, else 0
+} UTF8RegexIter;
+
 /**
  * @brief Compiles a UTF-8 regex pattern and creates a PCRE2 match data object.
  *
@@ -32,4 +55,101 @@ bool utf8_regex_compile(const uint8_t* pattern, pcre2_code** code, pcre2_match_d
  */
 void utf8_regex_free(pcre2_code* code, pcre2_match_data* match);
 
+// Offset stored for a capture group that did not take part in a match.
+#define UTF8_REGEX_UNSET PCRE2_UNSET
+
+/**
+ * @brief Columnar (structure-of-arrays) buffer of matches and their capture groups.
+ *
+ * Row i describes one match: doc[i], index[i] (its position among the matches of
+ * that document), and for every group g (0 is the whole match) the offsets
+ * starts[g * capacity + i] and ends[g * capacity + i] into that document.
+ * Each group is one contiguous column.
+ */
+typedef struct UTF8RegexMatches {
+    size_t* doc;  // Document index per match
+    size_t* index;  // Match index within its document
+    size_t* starts;  // groups columns of capacity offsets
+    size_t* ends;  // Same layout as starts
+    size_t groups;  // Columns per match: capture groups + 1
+    size_t capacity;  // Matches that fit
+    size_t count;  // Matches stored
+} UTF8RegexMatches;
+
+/**
+ * @brief Allocates a buffer for capacity matches of the given pattern.
+ *
+ * @return true on success, false on invalid input or allocation failure.
+ */
+bool utf8_regex_matches_init(UTF8RegexMatches* matches, const pcre2_code* code, size_t capacity);
+
+/**
+ * @brief Grows the buffer to hold at least capacity matches, keeping its rows.
+ */
+bool utf8_regex_matches_reserve(UTF8RegexMatches* matches, size_t capacity);
+
+/**
+ * @brief Appends a row from a PCRE2 ovector, growing the buffer if it is full.
+ *
+ * @param ovector At least matches->groups (start, end) pairs.
+ */
+bool utf8_regex_matches_push(
+    UTF8RegexMatches* matches, size_t doc, size_t index, const PCRE2_SIZE* ovector
+);
+
+/**
+ * @brief Releases the buffer and leaves it empty.
+ */
+void utf8_regex_matches_free(UTF8RegexMatches* matches);
+
+/**
+ * @brief Runs one compiled pattern over every document, recording all groups.
+ *
+ * Rows are ordered by document, then by position. The buffer is never grown:
+ * once it is full the remaining matches are only counted, so a caller can
+ * reserve total rows and run again.
+ *
+ * @param code   Compiled pattern.
+ * @param docs   Array of n valid UTF-8 views.
+ * @param n      Number of documents.
+ * @param out    Buffer from utf8_regex_matches_init for code; count is reset.
+ * @param total  Output: number of matches found (may exceed out->capacity).
+ * @return       true on success, false on invalid input, a pattern/buffer mismatch,
+ *               a matching error or allocation failure.
+ */
+bool utf8_regex_findall(
+    const pcre2_code* code, const UTF8View* docs, size_t n, UTF8RegexMatches* out, size_t* total
+);
+
+/**
+ * @brief Prepares an iterator over subject; the subject must be valid UTF-8.
+ *
+ * @param iter    Iterator to initialize.
+ * @param code    Compiled pattern (e.g. from utf8_regex_compile); not copied.
+ * @param subject Input view; not copied.
+ * @return        true on success, false on invalid input or allocation failure.
+ */
+bool utf8_regex_iter_init(UTF8RegexIter* iter, const pcre2_code* code, UTF8View subject);
+
+/**
+ * @brief Advances to the next match without allocating.
+ *
+ * @param iter  Iterator.
+ * @param start Output: byte offset where the match begins.
+ * @param end   Output: byte offset just past the match (equal to start if empty).
+ * @return      true if a match was found, false when exhausted or on error
+ *              (see iter->error).
+ */
+bool utf8_regex_iter_next(UTF8RegexIter* iter, size_t* start, size_t* end);
+
+/**
+ * @brief Restarts an iterator on a new subject, keeping its pattern and match data.
+ */
+void utf8_regex_iter_reset(UTF8RegexIter* iter, UTF8View subject);
+
+/**
+ * @brief Releases the iterator's match data (the pattern is left alone).
+ */
+void utf8_regex_iter_free(UTF8RegexIter* iter);
+
 #endif  // UTF8_REGEX_H
@@ -0,0 +1,128 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/search.h
+ * @brief Byte-oriented substring search engine.
+ *
+ * A UTF8Finder preprocesses a needle once and may then be run against any number
+ * of haystacks. The strategy is chosen from the needle length:
+ *
+ * - 1 byte:     memchr.
+ * - 2-32 bytes: SIMD filter on the needle's first and last byte, verified with memcmp.
+ * - longer:     Two-Way (Crochemore-Perrin), linear time and constant space.
+ *
+ * Delimiter splitting, occurrence counting and replacement are built on it.
+ * Matches are reported leftmost-first and never overlap.
+ */
+
+#ifndef UTF8_SEARCH_H
+#define UTF8_SEARCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "view.h"
+#include "span.h"
+
+// Needles up to this length use the SIMD first/last byte filter.
+#define UTF8_FIND_SHORT_MAX 32
+
+typedef enum UTF8FindKind {
+    UTF8_FIND_EMPTY,  // Matches at every offset
+    UTF8_FIND_BYTE,  // Single byte (memchr)
+    UTF8_FIND_SHORT,  // First/last byte filter
+    UTF8_FIND_LONG,  // Two-Way
+} UTF8FindKind;
+
+typedef struct UTF8Finder {
+    UTF8View needle;  // Borrowed; must outlive the finder
+    UTF8FindKind kind;
+    size_t critical;  // Two-Way: end of the left half of the critical factorization
+    size_t period;  // Two-Way: shift applied after a full match of the right half
+    size_t memory;  // Two-Way: prefix known to match after a periodic shift (0 if aperiodic)
+    size_t shift[256];  // Two-Way: last position + 1 of each byte in the needle (0 if absent)
+} UTF8Finder;
+
+/**
+ * @brief Preprocesses a needle for repeated searching.
+ *
+ * @param finder Finder to initialize.
+ * @param needle Needle view (borrowed, not copied).
+ * @return       true on success, false if either argument is invalid.
+ */
+bool utf8_finder_init(UTF8Finder* finder, UTF8View needle);
+
+/**
+ * @brief Finds the first occurrence of the finder's needle at or after from.
+ *
+ * @param finder   Initialized finder.
+ * @param haystack View to search.
+ * @param from     Byte offset at which to start searching.
+ * @return         Byte offset of the match, or -1 if there is none.
+ */
+int64_t utf8_finder_next(const UTF8Finder* finder, UTF8View haystack, size_t from);
+
+/**
+ * @brief Receives the byte offset of each match found by utf8_finder_scan.
+ *
+ * @return true to continue scanning, false to stop.
+ */
+typedef bool (*UTF8FindCallback)(size_t offset, void* ctx);
+
+/**
+ * @brief Reports every non-overlapping occurrence of the needle, left to right.
+ *
+ * Faster than repeated utf8_finder_next calls when matches are dense, because the
+ * vector loop does not restart after each match.
+ *
+ * @param finder   Initialized finder with a non-empty needle.
+ * @param haystack View to search.
+ * @param emit     Called once per match with its byte offset.
+ * @param ctx      Passed through to emit.
+ * @return         true if the scan completed, false on invalid input or if emit stopped it.
+ */
+bool utf8_finder_scan(
+    const UTF8Finder* finder, UTF8View haystack, UTF8FindCallback emit, void* ctx
+);
+
+/**
+ * @brief Finds the first occurrence of needle in haystack.
+ *
+ * @return Byte offset of the match, 0 for an empty needle, or -1 if not found or invalid.
+ */
+int64_t utf8_byte_find(UTF8View haystack, UTF8View needle);
+
+/**
+ * @brief Records every non-overlapping occurrence of needle as a span.
+ *
+ * @param haystack View to search.
+ * @param needle   Non-empty needle.
+ * @param out      Span list; cleared, then filled (capacity is reused).
+ * @return         true on success, false on invalid input or allocation failure.
+ */
+bool utf8_byte_find_all(UTF8View haystack, UTF8View needle, UTF8SpanList* out);
+
+/**
+ * @brief Counts the non-overlapping occurrences of needle in haystack.
+ *
+ * @return Number of occurrences, or -1 if either view is invalid or needle is empty.
+ */
+int64_t utf8_byte_find_count(UTF8View haystack, UTF8View needle);
+
+/**
+ * @brief Replaces every non-overlapping occurrence of from with to.
+ *
+ * @param src  Input view.
+ * @param from Non-empty byte sequence to replace.
+ * @param to   Replacement (may be empty).
+ * @return     Newly allocated, null-terminated result, or NULL on error. Caller must free.
+ */
+uint8_t* utf8_byte_replace_view(UTF8View src, UTF8View from, UTF8View to);
+
+/**
+ * @brief Null-terminated convenience wrapper for utf8_byte_replace_view.
+ */
+uint8_t* utf8_byte_replace(const uint8_t* src, const uint8_t* from, const uint8_t* to);
+
+#endif  // UTF8_SEARCH_H
@@ -0,0 +1,61 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/simd.h
+ * @brief Runtime CPU feature detection and SIMD kernel dispatch.
+ *
+ * The library compiles one kernel per instruction set and selects among them at
+ * load time based on what the running CPU supports. Callers never need to call
+ * anything here; it exists so tests and benchmarks can pin a specific level.
+ *
+ * - Kernels are only compiled on x86 targets (UTF8_SIMD_X86).
+ * - Every kernel has a portable scalar fallback (UTF8_SIMD_NONE).
+ */
+
+#ifndef UTF8_SIMD_H
+#define UTF8_SIMD_H
+
+#if defined(__x86_64__) || defined(__i386__)
+    #define UTF8_SIMD_X86 1
+    #include <immintrin.h>
+#else
+    #define UTF8_SIMD_X86 0
+#endif
+
+// Ordered from least to most capable; each level implies the ones below it.
+typedef enum UTF8SimdLevel {
+    UTF8_SIMD_NONE = 0,
+    UTF8_SIMD_SSE2 = 1,
+    UTF8_SIMD_SSSE3 = 2,
+    UTF8_SIMD_AVX2 = 3,
+    UTF8_SIMD_AVX512 = 4,  // AVX-512 F + BW
+} UTF8SimdLevel;
+
+/**
+ * @brief Returns the SIMD level currently used by dispatched kernels.
+ *
+ * Detected once at load time; may be lowered with utf8_simd_set_level().
+ */
+UTF8SimdLevel utf8_simd_level(void);
+
+/**
+ * @brief Returns the highest SIMD level supported by the running CPU.
+ */
+UTF8SimdLevel utf8_simd_detect(void);
+
+/**
+ * @brief Pins dispatched kernels to the given level.
+ *
+ * Requests above the detected level are clamped to the detected level.
+ *
+ * @param level Requested level.
+ * @return      The level actually in effect.
+ */
+UTF8SimdLevel utf8_simd_set_level(UTF8SimdLevel level);
+
+/**
+ * @brief Returns a printable name for a SIMD level (e.g., "avx2").
+ */
+const char* utf8_simd_name(UTF8SimdLevel level);
+
+#endif  // UTF8_SIMD_H
@@ -0,0 +1,103 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/span.h
+ * @brief Zero-copy split results as (offset, length) spans into a source buffer.
+ *
+ * Span-returning routines record where each part lives in the source instead of
+ * allocating a copy per part. All spans of one split share a single growable array
+ * that may be reused across calls. Callers needing null-terminated strings can
+ * materialize every span with one allocation.
+ */
+
+#ifndef UTF8_SPAN_H
+#define UTF8_SPAN_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "view.h"
+#include "arena.h"
+
+typedef struct UTF8Span {
+    size_t offset;  // Byte offset into the source
+    size_t len;  // Number of bytes
+} UTF8Span;
+
+typedef struct UTF8SpanList {
+    UTF8Span* spans;  // Array of spans (owned)
+    size_t count;  // Number of spans in use
+    size_t capacity;  // Number of spans allocated
+} UTF8SpanList;
+
+/**
+ * @brief Ensures the list can hold at least capacity spans without reallocating.
+ *
+ * A zero-initialized UTF8SpanList is a valid empty list.
+ *
+ * @return true on success, false on allocation failure (list is unchanged).
+ */
+bool utf8_span_list_reserve(UTF8SpanList* list, size_t capacity);
+
+/**
+ * @brief Appends a span, growing the array geometrically as needed.
+ *
+ * @return true on success, false on allocation failure (list is unchanged).
+ */
+bool utf8_span_list_push(UTF8SpanList* list, size_t offset, size_t len);
+
+/**
+ * @brief Removes all spans while keeping the allocation for reuse.
+ */
+void utf8_span_list_clear(UTF8SpanList* list);
+
+/**
+ * @brief Releases the span array and resets the list to empty.
+ */
+void utf8_span_list_free(UTF8SpanList* list);
+
+/**
+ * @brief Returns the view of src covered by span (clamped to src).
+ */
+UTF8View utf8_span_view(UTF8View src, UTF8Span span);
+
+/**
+ * @brief Copies each span into its own null-terminated heap string.
+ *
+ * @param src   Source the spans refer to.
+ * @param spans Array of spans.
+ * @param count Number of spans.
+ * @return      Array of count newly allocated strings, or NULL on error.
+ *
+ * @note Free with utf8_byte_split_free (each part, then the array).
+ */
+uint8_t** utf8_span_copy(UTF8View src, const UTF8Span* spans, size_t count);
+
+/**
+ * @brief Materializes every span as a null-terminated string using one allocation.
+ *
+ * The pointer table and all string bytes live in a single block, so the whole
+ * result is released with one call to free(parts).
+ *
+ * @param src   Source the spans refer to.
+ * @param spans Array of spans (each must lie within src).
+ * @param count Number of spans.
+ * @return      Array of count pointers into the block, or NULL on error.
+ *
+ * @note Do not free individual parts; free only the returned array.
+ */
+uint8_t** utf8_span_materialize(UTF8View src, const UTF8Span* spans, size_t count);
+
+/**
+ * @brief Materializes every span into the arena (same layout as utf8_span_materialize).
+ *
+ * @return Array of count pointers into the arena, or NULL on error.
+ *
+ * @note Released with the arena; never free the result.
+ */
+uint8_t** utf8_span_materialize_arena(
+    UTF8View src, const UTF8Span* spans, size_t count, UTF8Arena* arena
+);
+
+#endif  // UTF8_SPAN_H
@@ -0,0 +1,106 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/stream.h
+ * @brief Constant-memory delimiter splitting over chunked input.
+ *
+ * UTF8StreamSplit reports the fields of an input that arrives in pieces: pushed
+ * chunks, a file descriptor, or a FILE stream. Only one chunk plus a few carried
+ * bytes are held at a time, so memory use does not depend on the input size.
+ *
+ * - Delimiters straddling chunk boundaries are found; the bytes that could begin a
+ *   delimiter are carried into the next chunk.
+ * - A field longer than what is buffered is delivered as several fragments. Every
+ *   fragment but the last has partial set, and fragments never split a codepoint.
+ * - Fields match utf8_byte_split_delim: empty fields between delimiters are kept,
+ *   a trailing empty field after the final delimiter is not.
+ */
+
+#ifndef UTF8_STREAM_H
+#define UTF8_STREAM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "view.h"
+#include "search.h"
+
+// Default number of bytes read per chunk.
+#define UTF8_STREAM_CHUNK_SIZE ((size_t) 64 * 1024)
+
+/**
+ * @brief Receives a field, or a fragment of one.
+ *
+ * @param field   Bytes of the field (valid only during the call).
+ * @param partial true if more fragments of the same field follow.
+ * @param ctx     User context.
+ * @return        true to continue, false to stop splitting.
+ */
+typedef bool (*UTF8FieldCallback)(UTF8View field, bool partial, void* ctx);
+
+typedef struct UTF8StreamSplit {
+    UTF8Finder finder;  // Searches for the (owned) delimiter copy
+    uint8_t* buffer;  // Carried bytes followed by the current chunk
+    size_t chunk_size;  // Bytes accepted per processing step
+    size_t len;  // Bytes currently buffered
+    bool partial;  // A fragment of the pending field has been delivered
+    bool stopped;  // The callback asked to stop
+    uint64_t fields;  // Number of completed fields delivered
+    UTF8FieldCallback emit;
+    void* ctx;
+} UTF8StreamSplit;
+
+/**
+ * @brief Prepares a splitter; the delimiter is copied.
+ *
+ * @param split      Splitter to initialize.
+ * @param delim      Non-empty delimiter.
+ * @param chunk_size Bytes processed per step, or 0 for UTF8_STREAM_CHUNK_SIZE.
+ * @param emit       Field callback.
+ * @param ctx        Passed through to emit.
+ * @return           true on success, false on invalid input or allocation failure.
+ */
+bool utf8_stream_split_init(
+    UTF8StreamSplit* split,
+    UTF8View delim,
+    size_t chunk_size,
+    UTF8FieldCallback emit,
+    void* ctx
+);
+
+/**
+ * @brief Releases the splitter's buffer.
+ */
+void utf8_stream_split_free(UTF8StreamSplit* split);
+
+/**
+ * @brief Pushes the next piece of input (any size).
+ *
+ * @return true to keep feeding, false on invalid input or if the callback stopped.
+ */
+bool utf8_stream_split_feed(UTF8StreamSplit* split, UTF8View chunk);
+
+/**
+ * @brief Signals end of input and delivers the final field, if any.
+ *
+ * @return true on success, false on invalid input or if the callback stopped.
+ */
+bool utf8_stream_split_finish(UTF8StreamSplit* split);
+
+/**
+ * @brief Reads fd to end of input in chunk_size reads, then finishes.
+ *
+ * @return true on success, false on read error or if the callback stopped.
+ */
+bool utf8_stream_split_read_fd(UTF8StreamSplit* split, int fd);
+
+/**
+ * @brief Reads file to end of input in chunk_size reads, then finishes.
+ *
+ * @return true on success, false on read error or if the callback stopped.
+ */
+bool utf8_stream_split_read_file(UTF8StreamSplit* split, FILE* file);
+
+#endif  // UTF8_STREAM_H
@@ -0,0 +1,110 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/transcode.h
+ * @brief Bulk conversion between UTF-8, UTF-16 and UTF-32.
+ *
+ * Conversions write into caller-provided buffers; the `_length` functions give
+ * the exact output size up front, so one allocation always suffices.
+ *
+ * - UTF-32 values are host-endian uint32_t codepoints.
+ * - UTF-16 buffers hold uint16_t units whose bytes are in the order the
+ *   function names (le or be), regardless of the host; codepoints above
+ *   U+FFFF take a surrogate pair.
+ * - Output is never null-terminated.
+ * - Errors are reported as UTF8Validation (see validate.h): the kind and the
+ *   input offset of the first error, after converting everything before it.
+ *
+ * The vector kernels (SSSE3 and up) convert runs of ASCII, 2-byte and 3-byte
+ * sequences a block at a time and fall back to one codepoint per step elsewhere.
+ */
+
+#ifndef UTF8_TRANSCODE_H
+#define UTF8_TRANSCODE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "view.h"
+#include "validate.h"
+
+/**
+ * @brief Returns the number of UTF-32 codepoints src decodes to.
+ *
+ * @return Codepoint count, or -1 if src is not valid UTF-8.
+ */
+int64_t utf8_to_utf32_length(UTF8View src);
+
+/**
+ * @brief Decodes UTF-8 into UTF-32.
+ *
+ * @param src     Input view.
+ * @param dst     Output buffer of at least utf8_to_utf32_length(src) codepoints
+ *                (for invalid input, the codepoints before the error).
+ * @param written Output: number of codepoints written.
+ * @return        UTF8_ERROR_NONE, or the first error and its byte offset in src.
+ */
+UTF8Validation utf8_to_utf32(UTF8View src, uint32_t* dst, size_t* written);
+
+/**
+ * @brief Returns the number of UTF-8 bytes src encodes to.
+ *
+ * @return Byte count, or -1 if src holds a surrogate or a value above U+10FFFF.
+ */
+int64_t utf32_to_utf8_length(const uint32_t* src, size_t len);
+
+/**
+ * @brief Encodes UTF-32 into UTF-8.
+ *
+ * @param src     Input codepoints.
+ * @param len     Number of codepoints.
+ * @param dst     Output buffer of at least utf32_to_utf8_length(src, len) bytes.
+ * @param written Output: number of bytes written.
+ * @return        UTF8_ERROR_NONE, or UTF8_ERROR_SURROGATE / UTF8_ERROR_TOO_LARGE and
+ *                the index of the offending codepoint.
+ */
+UTF8Validation utf32_to_utf8(const uint32_t* src, size_t len, uint8_t* dst, size_t* written);
+
+/**
+ * @brief Returns the number of UTF-16 units src encodes to (in either byte order).
+ *
+ * @return Unit count, or -1 if src is not valid UTF-8.
+ */
+int64_t utf8_to_utf16_length(UTF8View src);
+
+/**
+ * @brief Encodes UTF-8 as UTF-16LE / UTF-16BE.
+ *
+ * @param src     Input view.
+ * @param dst     Output buffer of at least utf8_to_utf16_length(src) units.
+ * @param written Output: number of units written.
+ * @return        UTF8_ERROR_NONE, or the first error and its byte offset in src.
+ */
+UTF8Validation utf8_to_utf16le(UTF8View src, uint16_t* dst, size_t* written);
+UTF8Validation utf8_to_utf16be(UTF8View src, uint16_t* dst, size_t* written);
+
+/**
+ * @brief Returns the number of UTF-8 bytes UTF-16LE / UTF-16BE src decodes to.
+ *
+ * @return Byte count, or -1 if src holds an unpaired surrogate.
+ */
+int64_t utf16le_to_utf8_length(const uint16_t* src, size_t len);
+int64_t utf16be_to_utf8_length(const uint16_t* src, size_t len);
+
+/**
+ * @brief Decodes UTF-16LE / UTF-16BE into UTF-8.
+ *
+ * @param src     Input units.
+ * @param len     Number of units.
+ * @param dst     Output buffer of at least utf16le_to_utf8_length(src, len) bytes
+ *                (or the be variant).
+ * @param written Output: number of bytes written.
+ * @return        UTF8_ERROR_NONE; UTF8_ERROR_SURROGATE for an unpaired surrogate, or
+ *                UTF8_ERROR_TRUNCATED for a high surrogate ending the input, with the
+ *                unit index of the offending surrogate.
+ */
+UTF8Validation utf16le_to_utf8(const uint16_t* src, size_t len, uint8_t* dst, size_t* written);
+UTF8Validation utf16be_to_utf8(const uint16_t* src, size_t len, uint8_t* dst, size_t* written);
+
+#endif  // UTF8_TRANSCODE_H
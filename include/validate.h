@@ -0,0 +1,73 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/validate.h
+ * @brief Vectorized UTF-8 validation with error location.
+ *
+ * Validation follows RFC 3629: every sequence must be complete, minimal (no
+ * overlong forms), outside the surrogate range, and at most U+10FFFF.
+ *
+ * The vector kernels (SSSE3, AVX2, AVX-512) classify 64 bytes at a time with
+ * nibble lookup tables and skip pure ASCII blocks. They only decide whether a
+ * block is valid; when one is not, a scalar pass re-reads it from the last
+ * codepoint boundary to report the exact offset and kind of the first error.
+ * Levels below SSSE3 use the scalar pass alone.
+ */
+
+#ifndef UTF8_VALIDATE_H
+#define UTF8_VALIDATE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "view.h"
+
+typedef enum UTF8Error {
+    UTF8_ERROR_NONE = 0,
+    UTF8_ERROR_TRUNCATED,  // Lead byte without enough continuation bytes
+    UTF8_ERROR_CONTINUATION,  // Continuation byte without a lead byte
+    UTF8_ERROR_OVERLONG,  // Longer encoding than the codepoint needs (including C0, C1)
+    UTF8_ERROR_SURROGATE,  // U+D800 through U+DFFF
+    UTF8_ERROR_TOO_LARGE,  // Above U+10FFFF (including lead bytes F5 through FF)
+} UTF8Error;
+
+typedef struct UTF8Validation {
+    UTF8Error error;
+    size_t offset;  // Start of the offending sequence, or the view length if valid
+} UTF8Validation;
+
+/**
+ * @brief Validates a view and locates the first error.
+ *
+ * A truncated sequence takes precedence: "\xE0\x80" at the end of input is
+ * reported as truncated, not overlong.
+ *
+ * @param view Input view (embedded null bytes are valid).
+ * @return     The first error and its offset; UTF8_ERROR_NONE and view.len if valid.
+ *             An invalid view (NULL ptr) reports UTF8_ERROR_TRUNCATED at offset 0.
+ */
+UTF8Validation utf8_validate(UTF8View view);
+
+/**
+ * @brief Validates a view and counts its codepoints in the same pass.
+ *
+ * @param view  Input view.
+ * @param count Output: the number of codepoints, or on error the number of
+ *              codepoints before the error offset.
+ * @return      As utf8_validate. A NULL count (like a NULL view ptr) reports
+ *              UTF8_ERROR_TRUNCATED at offset 0.
+ */
+UTF8Validation utf8_validate_count(UTF8View view, size_t* count);
+
+/**
+ * @brief Returns true if the view is valid UTF-8 (no error location work).
+ */
+bool utf8_is_valid(UTF8View view);
+
+/**
+ * @brief Returns a printable name for an error kind (e.g., "overlong").
+ */
+const char* utf8_error_name(UTF8Error error);
+
+#endif  // UTF8_VALIDATE_H
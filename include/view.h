@@ -0,0 +1,68 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/include/view.h
+ * @brief Length-carrying, non-owning UTF-8 string slices.
+ *
+ * A view pairs a pointer with a byte length so that length is computed once and
+ * carried along instead of being rescanned by every call. Views never own memory,
+ * may contain embedded null bytes, and slicing one costs nothing.
+ *
+ * - A view with a NULL ptr is invalid; functions accepting views reject it.
+ * - A view with a non-NULL ptr and len 0 is the empty string.
+ */
+
+#ifndef UTF8_VIEW_H
+#define UTF8_VIEW_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct UTF8View {
+    const uint8_t* ptr;  // First byte (not necessarily null-terminated)
+    size_t len;  // Number of bytes
+} UTF8View;
+
+/**
+ * @brief Creates a view over a null-terminated string.
+ *
+ * @param start Pointer to a null-terminated UTF-8 string (may be NULL).
+ * @return      View spanning the bytes before the terminator, or an invalid view.
+ */
+UTF8View utf8_view(const uint8_t* start);
+
+/**
+ * @brief Creates a view over exactly len bytes starting at start.
+ *
+ * @param start Pointer to the first byte (may be NULL).
+ * @param len   Number of bytes; embedded null bytes are permitted.
+ * @return      View over [start, start + len), or an invalid view if start is NULL.
+ */
+UTF8View utf8_view_n(const uint8_t* start, size_t len);
+
+/**
+ * @brief Creates a view over the bytes in [start, end).
+ *
+ * @return View over the range, or an invalid view if end < start or either is NULL.
+ */
+UTF8View utf8_view_range(const uint8_t* start, const uint8_t* end);
+
+/**
+ * @brief Returns a sub-view of len bytes beginning offset bytes into view.
+ *
+ * The result is clamped to the bounds of view; no memory is touched.
+ *
+ * @param view   Source view.
+ * @param offset Byte offset into view.
+ * @param len    Maximum number of bytes in the result.
+ * @return       Sub-view, or an invalid view if view is invalid.
+ */
+UTF8View utf8_view_slice(UTF8View view, size_t offset, size_t len);
+
+/**
+ * @brief Returns true if the view points at memory (ptr is not NULL).
+ */
+bool utf8_view_is_valid(UTF8View view);
+
+#endif  // UTF8_VIEW_H
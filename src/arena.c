@@ -0,0 +1,131 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/arena.c
+ * @brief Bump-pointer arena for short-lived strings and split results.
+ */
+
+#include <stdalign.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "arena.h"
+
+void utf8_arena_init(UTF8Arena* arena, size_t block_size) {
+    if (arena) {
+        *arena = (UTF8Arena) {.head = NULL, .block_size = block_size};
+    }
+}
+
+void utf8_arena_free(UTF8Arena* arena) {
+    if (!arena) {
+        return;
+    }
+
+    UTF8ArenaBlock* block = arena->head;
+    while (block) {
+        UTF8ArenaBlock* next = block->next;
+        free(block);
+        block = next;
+    }
+    arena->head = NULL;
+}
+
+void* utf8_arena_alloc(UTF8Arena* arena, size_t size) {
+    if (!arena) {
+        return NULL;
+    }
+
+    // Keep every allocation aligned for any object type
+    size_t align = alignof(max_align_t);
+    if (size > SIZE_MAX - align) {
+        return NULL;
+    }
+    size = (size + align - 1) & ~(align - 1);
+
+    UTF8ArenaBlock* block = arena->head;
+    if (!block || size > block->size - block->used) {
+        size_t block_size = arena->block_size ? arena->block_size : UTF8_ARENA_BLOCK_SIZE;
+        if (size > block_size) {
+            block_size = size;  // Dedicated block for oversized requests
+        }
+        if (block_size > SIZE_MAX - sizeof(UTF8ArenaBlock)) {
+            return NULL;
+        }
+
+        block = malloc(sizeof(UTF8ArenaBlock) + block_size);
+        if (!block) {
+            return NULL;
+        }
+        block->next = arena->head;
+        block->size = block_size;
+        block->used = 0;
+        arena->head = block;
+    }
+
+    void* ptr = (uint8_t*) block->data + block->used;
+    block->used += size;
+    return ptr;
+}
+
+uint8_t* utf8_arena_copy(UTF8Arena* arena, UTF8View view) {
+    if (!arena || !view.ptr) {
+        return NULL;
+    }
+
+    uint8_t* dst = utf8_arena_alloc(arena, view.len + 1);
+    if (!dst) {
+        return NULL;
+    }
+
+    if (view.len > 0) {
+        memcpy(dst, view.ptr, view.len);
+    }
+    dst[view.len] = '\0';
+
+    return dst;
+}
+
+UTF8ArenaMark utf8_arena_mark(const UTF8Arena* arena) {
+    if (!arena || !arena->head) {
+        return (UTF8ArenaMark) {0};
+    }
+
+    return (UTF8ArenaMark) {.block = arena->head, .used = arena->head->used};
+}
+
+void utf8_arena_reset(UTF8Arena* arena, UTF8ArenaMark mark) {
+    if (!arena) {
+        return;
+    }
+
+    // Drop blocks newer than the mark; an empty mark keeps the oldest block
+    while (arena->head && arena->head != mark.block) {
+        if (!mark.block && !arena->head->next) {
+            break;
+        }
+        UTF8ArenaBlock* next = arena->head->next;
+        free(arena->head);
+        arena->head = next;
+    }
+
+    if (arena->head) {
+        arena->head->used = mark.block ? mark.used : 0;
+    }
+}
+
+void utf8_arena_clear(UTF8Arena* arena) {
+    utf8_arena_reset(arena, (UTF8ArenaMark) {0});
+}
+
+size_t utf8_arena_used(const UTF8Arena* arena) {
+    if (!arena) {
+        return 0;
+    }
+
+    size_t used = 0;
+    for (const UTF8ArenaBlock* block = arena->head; block; block = block->next) {
+        used += block->used;
+    }
+    return used;
+}
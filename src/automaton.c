@@ -0,0 +1,226 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/automaton.c
+ * @brief Aho-Corasick automaton for matching many byte patterns in one pass.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "automaton.h"
+
+void utf8_automaton_free(UTF8Automaton* automaton) {
+    if (automaton) {
+        free(automaton->next);
+        free(automaton->depth);
+        free(automaton->pattern);
+        free(automaton->output);
+        *automaton = (UTF8Automaton) {0};
+    }
+}
+
+bool utf8_automaton_init(UTF8Automaton* automaton, const UTF8View* patterns, size_t count) {
+    if (!automaton || !patterns || count == 0) {
+        return false;
+    }
+
+    *automaton = (UTF8Automaton) {0};
+
+    // The trie has at most one state per pattern byte, plus the root
+    size_t states = 1;
+    for (size_t i = 0; i < count; i++) {
+        if (!patterns[i].ptr || patterns[i].len == 0 || patterns[i].len > INT32_MAX) {
+            return false;
+        }
+        states += patterns[i].len;
+        if (patterns[i].len > automaton->longest) {
+            automaton->longest = patterns[i].len;
+        }
+        if (states > INT32_MAX / 256) {
+            return false;
+        }
+    }
+
+    automaton->next = malloc(states * 256 * sizeof(int32_t));
+    automaton->depth = calloc(states, sizeof(uint32_t));
+    automaton->pattern = calloc(states, sizeof(uint32_t));
+    automaton->output = malloc(states * sizeof(int32_t));
+    int32_t* fail = calloc(states, sizeof(int32_t));
+    int32_t* queue = malloc(states * sizeof(int32_t));
+    if (!automaton->next || !automaton->depth || !automaton->pattern || !automaton->output
+        || !fail || !queue) {
+        free(fail);
+        free(queue);
+        utf8_automaton_free(automaton);
+        return false;
+    }
+    memset(automaton->next, 0xFF, states * 256 * sizeof(int32_t));  // -1: no edge yet
+
+    // Build the trie
+    int32_t used = 1;
+    for (size_t i = 0; i < count; i++) {
+        int32_t state = 0;
+        for (size_t j = 0; j < patterns[i].len; j++) {
+            int32_t* edge = &automaton->next[(size_t) state * 256 + patterns[i].ptr[j]];
+            if (*edge < 0) {
+                *edge = used;
+                automaton->depth[used] = (uint32_t) j + 1;
+                used++;
+            }
+            state = *edge;
+        }
+        if (!automaton->pattern[state]) {
+            automaton->pattern[state] = (uint32_t) i + 1;  // Duplicates keep the first index
+        }
+        automaton->first[patterns[i].ptr[0]] = true;
+    }
+    automaton->states = (size_t) used;
+    automaton->count = count;
+
+    // Breadth-first: complete the DFA and link every state to its output chain
+    size_t head = 0;
+    size_t tail = 0;
+    automaton->output[0] = -1;
+    for (int c = 0; c < 256; c++) {
+        int32_t* edge = &automaton->next[c];
+        if (*edge < 0) {
+            *edge = 0;
+        } else {
+            fail[*edge] = 0;
+            automaton->output[*edge] = -1;
+            queue[tail++] = *edge;
+        }
+    }
+
+    while (head < tail) {
+        int32_t state = queue[head++];
+        int32_t* row = &automaton->next[(size_t) state * 256];
+        const int32_t* fail_row = &automaton->next[(size_t) fail[state] * 256];
+        for (int c = 0; c < 256; c++) {
+            if (row[c] < 0) {
+                row[c] = fail_row[c];
+                continue;
+            }
+
+            int32_t child = row[c];
+            int32_t link = fail_row[c];
+            fail[child] = link;
+            automaton->output[child] = automaton->pattern[link] ? link : automaton->output[link];
+            queue[tail++] = child;
+        }
+    }
+
+    free(fail);
+    free(queue);
+    return true;
+}
+
+// A codepoint boundary: the start or end of input, or any byte but a continuation.
+static inline bool utf8_automaton_boundary(UTF8View haystack, size_t offset) {
+    return offset == 0 || offset >= haystack.len || (haystack.ptr[offset] & 0xC0) != 0x80;
+}
+
+// A match found by the scan but not yet emitted.
+typedef struct UTF8AutomatonMatch {
+    size_t start;
+    size_t len;
+    size_t index;
+} UTF8AutomatonMatch;
+
+bool utf8_automaton_scan(
+    const UTF8Automaton* automaton, UTF8View haystack, UTF8MatchCallback emit, void* ctx
+) {
+    if (!automaton || !automaton->next || !haystack.ptr || !emit) {
+        return false;
+    }
+
+    const uint8_t* hay = haystack.ptr;
+    size_t n = haystack.len;
+
+    // Pending matches, left to right and non-overlapping: each is the leftmost-longest
+    // match seen so far that starts at or after the end of the one before it. They all
+    // lie within the current trie prefix plus one byte, so longest + 1 slots suffice.
+    size_t capacity = automaton->longest + 1;
+    UTF8AutomatonMatch* pending = malloc(capacity * sizeof(UTF8AutomatonMatch));
+    if (!pending) {
+        return false;
+    }
+    size_t head = 0;  // Ring buffer of pending matches
+    size_t size = 0;
+    size_t resume = 0;  // End of the last emitted match: nothing may start before it
+
+    int32_t state = 0;
+    size_t i = 0;
+    for (;;) {
+        // Idle at the root: skip bytes that cannot begin any pattern
+        if (state == 0 && size == 0) {
+            while (i < n && !automaton->first[hay[i]]) {
+                i++;
+            }
+        }
+
+        if (i < n) {
+            state = automaton->next[(size_t) state * 256 + hay[i]];
+            i++;
+
+            // Longest pattern ending here first; a shorter one only matters when the
+            // longer ones are misaligned or lose against what is already pending
+            int32_t match = automaton->pattern[state] ? state : automaton->output[state];
+            for (; match >= 0; match = automaton->output[match]) {
+                size_t len = automaton->depth[match];
+                size_t start = i - len;
+                if (start < resume || !utf8_automaton_boundary(haystack, start)
+                    || !utf8_automaton_boundary(haystack, i)) {
+                    continue;
+                }
+
+                // Find the pending match it competes with: the one whose predecessor
+                // ends at or before its start
+                size_t k = size;
+                while (k > 0) {
+                    const UTF8AutomatonMatch* prev = &pending[(head + k - 1) % capacity];
+                    if (prev->start + prev->len <= start) {
+                        break;
+                    }
+                    k--;
+                }
+
+                if (k < size) {
+                    const UTF8AutomatonMatch* rival = &pending[(head + k) % capacity];
+                    if (start > rival->start || (start == rival->start && len <= rival->len)) {
+                        continue;
+                    }
+                }
+
+                // It wins: everything pending after it overlaps it and is dropped
+                pending[(head + k) % capacity] = (UTF8AutomatonMatch) {
+                    .start = start,
+                    .len = len,
+                    .index = automaton->pattern[match] - 1,
+                };
+                size = k + 1;
+                break;
+            }
+        }
+
+        // Nothing still in progress can start at or before the first pending match
+        while (size > 0 && (i == n || i - automaton->depth[state] > pending[head].start)) {
+            const UTF8AutomatonMatch* first = &pending[head];
+            if (!emit(first->start, first->len, first->index, ctx)) {
+                free(pending);
+                return false;
+            }
+            resume = first->start + first->len;
+            head = (head + 1) % capacity;
+            size--;
+        }
+
+        if (i == n) {
+            break;
+        }
+    }
+
+    free(pending);
+    return true;
+}
@@ -0,0 +1,175 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/builder.c
+ * @brief Growable byte buffer for assembling UTF-8 output.
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "codepoint.h"
+#include "builder.h"
+
+#define UTF8_BUILDER_MIN 64
+
+bool utf8_builder_reserve(UTF8Builder* builder, size_t capacity) {
+    if (!builder) {
+        return false;
+    }
+
+    if (builder->data && capacity <= builder->capacity) {
+        return true;
+    }
+
+    if (capacity == SIZE_MAX) {
+        return false;
+    }
+
+    // One extra byte keeps the contents null-terminated at all times
+    uint8_t* temp = realloc(builder->data, capacity + 1);
+    if (!temp) {
+        return false;
+    }
+
+    if (!builder->data) {
+        temp[0] = '\0';
+    }
+    builder->data = temp;
+    builder->capacity = capacity;
+    return true;
+}
+
+// Grows geometrically so that n more bytes fit.
+static bool utf8_builder_grow(UTF8Builder* builder, size_t n) {
+    if (n > SIZE_MAX - 1 - builder->len) {
+        return false;
+    }
+
+    size_t needed = builder->len + n;
+    if (builder->data && needed <= builder->capacity) {
+        return true;
+    }
+
+    size_t capacity = builder->capacity ? builder->capacity : UTF8_BUILDER_MIN;
+    while (capacity < needed) {
+        capacity = capacity > SIZE_MAX / 2 ? needed : capacity * 2;
+    }
+
+    return utf8_builder_reserve(builder, capacity);
+}
+
+bool utf8_builder_append_bytes(UTF8Builder* builder, const uint8_t* bytes, size_t n) {
+    if (!builder || (!bytes && n > 0)) {
+        return false;
+    }
+
+    if (!utf8_builder_grow(builder, n)) {
+        return false;
+    }
+
+    if (n > 0) {
+        memcpy(builder->data + builder->len, bytes, n);
+        builder->len += n;
+    }
+    builder->data[builder->len] = '\0';
+    return true;
+}
+
+bool utf8_builder_append_view(UTF8Builder* builder, UTF8View view) {
+    if (!view.ptr) {
+        return false;
+    }
+
+    return utf8_builder_append_bytes(builder, view.ptr, view.len);
+}
+
+bool utf8_builder_append_cp(UTF8Builder* builder, uint32_t cp) {
+    uint8_t bytes[4];
+    int8_t n = cp <= 0x10FFFF ? utf8_cp_encode((int32_t) cp, bytes) : -1;
+    if (n < 0) {
+        return false;  // Surrogate or above U+10FFFF
+    }
+
+    return utf8_builder_append_bytes(builder, bytes, (size_t) n);
+}
+
+bool utf8_builder_append_fmt(UTF8Builder* builder, const char* format, ...) {
+    if (!builder || !format) {
+        return false;
+    }
+
+    // Make sure there is a buffer so the first attempt can write in place
+    if (!utf8_builder_grow(builder, 0)) {
+        return false;
+    }
+
+    va_list args;
+    va_start(args, format);
+    va_list retry;
+    va_copy(retry, args);
+
+    size_t room = builder->capacity - builder->len + 1;
+    int n = vsnprintf((char*) builder->data + builder->len, room, format, args);
+    va_end(args);
+
+    bool ok = n >= 0;
+    if (ok && (size_t) n >= room) {
+        // Did not fit: grow once to the exact size and format again
+        ok = utf8_builder_grow(builder, (size_t) n);
+        if (ok) {
+            vsnprintf((char*) builder->data + builder->len, (size_t) n + 1, format, retry);
+        }
+    }
+    va_end(retry);
+
+    if (!ok) {
+        builder->data[builder->len] = '\0';
+        return false;
+    }
+
+    builder->len += (size_t) n;
+    return true;
+}
+
+UTF8View utf8_builder_view(const UTF8Builder* builder) {
+    if (!builder || !builder->data) {
+        return (UTF8View) {.ptr = (const uint8_t*) "", .len = 0};
+    }
+
+    return (UTF8View) {.ptr = builder->data, .len = builder->len};
+}
+
+void utf8_builder_clear(UTF8Builder* builder) {
+    if (builder && builder->data) {
+        builder->len = 0;
+        builder->data[0] = '\0';
+    }
+}
+
+void utf8_builder_free(UTF8Builder* builder) {
+    if (builder) {
+        free(builder->data);
+        *builder = (UTF8Builder) {0};
+    }
+}
+
+uint8_t* utf8_builder_finish(UTF8Builder* builder, size_t* len) {
+    if (!builder) {
+        return NULL;
+    }
+
+    if (!builder->data && !utf8_builder_reserve(builder, 0)) {
+        return NULL;
+    }
+
+    uint8_t* data = builder->data;
+    if (len) {
+        *len = builder->len;
+    }
+
+    *builder = (UTF8Builder) {0};
+    return data;
+}
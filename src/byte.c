@@ -7,28 +7,212 @@
  * Low-level routines for working directly with bytes in null-terminated UTF-8 strings.
  * These routines operate purely on bytes—not codepoints or graphemes.
  *
- * All allocation routines return newly allocated buffers the caller must free.
+ * All allocation routines return newly allocated buffers the caller must free,
+ * except the `_arena` variants, which allocate from a UTF8Arena.
  * All functions treat empty strings ("") as valid input.
  */
 
 #include <stddef.h>
 #include <string.h>
 
+#include "simd.h"
+#include "arena.h"
+#include "span.h"
+#include "part.h"
+#include "builder.h"
+#include "search.h"
+#include "automaton.h"
+#include "interner.h"
 #include "regex.h"
 #include "byte.h"
 
+// --- Terminator scan kernels ---
+
+static int64_t utf8_byte_count_scalar(const uint8_t* start) {
+    int64_t count = 0;
+    while (start[count]) {
+        count++;
+    }
+
+    return count;
+}
+
+#if UTF8_SIMD_X86
+/**
+ * @note The vector kernels only issue aligned loads. An aligned load never crosses a
+ *       page boundary, so reading the tail of the block that holds the terminator is
+ *       safe even though those bytes lie outside the string. Leading bytes before
+ *       start are shifted out of the first mask. Unrolled groups are aligned to their
+ *       full width for the same reason.
+ */
+
+__attribute__((target("sse2"), no_sanitize_address))
+static int64_t utf8_byte_count_sse2(const uint8_t* start) {
+    const __m128i zero = _mm_setzero_si128();
+    uintptr_t skew = (uintptr_t) start & 15;
+    const uint8_t* block = start - skew;
+
+    uint32_t mask = (uint32_t) _mm_movemask_epi8(
+        _mm_cmpeq_epi8(_mm_load_si128((const __m128i*) block), zero)
+    );
+    mask >>= skew;
+    if (mask) {
+        return __builtin_ctz(mask);
+    }
+    block += 16;
+
+    // Step until the block is aligned to the unrolled group width
+    while ((uintptr_t) block & 63) {
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i*) block), zero));
+        if (mask) {
+            return (block - start) + __builtin_ctz(mask);
+        }
+        block += 16;
+    }
+
+    for (;;) {
+        __m128i a = _mm_load_si128((const __m128i*) block);
+        __m128i b = _mm_load_si128((const __m128i*) (block + 16));
+        __m128i c = _mm_load_si128((const __m128i*) (block + 32));
+        __m128i d = _mm_load_si128((const __m128i*) (block + 48));
+        __m128i m = _mm_min_epu8(_mm_min_epu8(a, b), _mm_min_epu8(c, d));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(m, zero))) {
+            break;
+        }
+        block += 64;
+    }
+
+    // The terminator is somewhere in this group
+    for (;; block += 16) {
+        mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i*) block), zero));
+        if (mask) {
+            return (block - start) + __builtin_ctz(mask);
+        }
+    }
+}
+
+__attribute__((target("avx2"), no_sanitize_address))
+static int64_t utf8_byte_count_avx2(const uint8_t* start) {
+    const __m256i zero = _mm256_setzero_si256();
+    uintptr_t skew = (uintptr_t) start & 31;
+    const uint8_t* block = start - skew;
+
+    uint32_t mask = (uint32_t) _mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(_mm256_load_si256((const __m256i*) block), zero)
+    );
+    mask >>= skew;
+    if (mask) {
+        return __builtin_ctz(mask);
+    }
+    block += 32;
+
+    // Step until the block is aligned to the unrolled group width
+    while ((uintptr_t) block & 127) {
+        mask = (uint32_t) _mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_load_si256((const __m256i*) block), zero)
+        );
+        if (mask) {
+            return (block - start) + __builtin_ctz(mask);
+        }
+        block += 32;
+    }
+
+    for (;;) {
+        __m256i a = _mm256_load_si256((const __m256i*) block);
+        __m256i b = _mm256_load_si256((const __m256i*) (block + 32));
+        __m256i c = _mm256_load_si256((const __m256i*) (block + 64));
+        __m256i d = _mm256_load_si256((const __m256i*) (block + 96));
+        __m256i m = _mm256_min_epu8(_mm256_min_epu8(a, b), _mm256_min_epu8(c, d));
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(m, zero))) {
+            break;
+        }
+        block += 128;
+    }
+
+    // The terminator is somewhere in this group
+    for (;; block += 32) {
+        mask = (uint32_t) _mm256_movemask_epi8(
+            _mm256_cmpeq_epi8(_mm256_load_si256((const __m256i*) block), zero)
+        );
+        if (mask) {
+            return (block - start) + __builtin_ctz(mask);
+        }
+    }
+}
+
+__attribute__((target("avx512f,avx512bw"), no_sanitize_address))
+static int64_t utf8_byte_count_avx512(const uint8_t* start) {
+    uintptr_t skew = (uintptr_t) start & 63;
+    const uint8_t* block = start - skew;
+
+    __m512i v = _mm512_load_si512((const void*) block);
+    uint64_t mask = _mm512_testn_epi8_mask(v, v) >> skew;
+    if (mask) {
+        return __builtin_ctzll(mask);
+    }
+    block += 64;
+
+    // Step until the block is aligned to the unrolled group width
+    while ((uintptr_t) block & 255) {
+        v = _mm512_load_si512((const void*) block);
+        mask = _mm512_testn_epi8_mask(v, v);
+        if (mask) {
+            return (block - start) + __builtin_ctzll(mask);
+        }
+        block += 64;
+    }
+
+    for (;;) {
+        __m512i a = _mm512_load_si512((const void*) block);
+        __m512i b = _mm512_load_si512((const void*) (block + 64));
+        __m512i c = _mm512_load_si512((const void*) (block + 128));
+        __m512i d = _mm512_load_si512((const void*) (block + 192));
+        __m512i m = _mm512_min_epu8(_mm512_min_epu8(a, b), _mm512_min_epu8(c, d));
+        if (_mm512_testn_epi8_mask(m, m)) {
+            break;
+        }
+        block += 256;
+    }
+
+    // The terminator is somewhere in this group
+    for (;; block += 64) {
+        v = _mm512_load_si512((const void*) block);
+        mask = _mm512_testn_epi8_mask(v, v);
+        if (mask) {
+            return (block - start) + __builtin_ctzll(mask);
+        }
+    }
+}
+#endif  // UTF8_SIMD_X86
+
 // Returns the number of bytes before the null terminator.
 int64_t utf8_byte_count(const uint8_t* start) {
     if (!start) {
         return -1;
     }
 
-    int64_t count = 0;
-    while (start[count]) {
-        count++;
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+            return utf8_byte_count_avx512(start);
+        case UTF8_SIMD_AVX2:
+            return utf8_byte_count_avx2(start);
+        case UTF8_SIMD_SSSE3:
+        case UTF8_SIMD_SSE2:
+            return utf8_byte_count_sse2(start);
+#endif
+        default:
+            return utf8_byte_count_scalar(start);
     }
+}
 
-    return count;
+// Views carry their length; this only rejects invalid views.
+int64_t utf8_byte_count_view(UTF8View view) {
+    if (!view.ptr) {
+        return -1;
+    }
+
+    return (int64_t) view.len;
 }
 
 // Returns the byte offset from start to end. Returns -1 if inputs are NULL.
@@ -40,52 +224,46 @@ ptrdiff_t utf8_byte_diff(const uint8_t* start, const uint8_t* end) {
     return (ptrdiff_t) end - (ptrdiff_t) start;
 }
 
-// Allocates a new null-terminated copy of the string.
-uint8_t* utf8_byte_copy(const uint8_t* start) {
-    if (!start) {
+// Allocates a new null-terminated copy of the view.
+uint8_t* utf8_byte_copy_view(UTF8View view) {
+    if (!view.ptr) {
         return NULL;
     }
 
-    int64_t count = utf8_byte_count(start);
-    if (count == -1) {
-        return NULL;
-    }
-
-    uint8_t* dst = calloc((count + 1), sizeof(uint8_t));
+    uint8_t* dst = calloc((view.len + 1), sizeof(uint8_t));
     if (!dst) {
         return NULL;
     }
 
-    if (count > 0) {
-        memcpy(dst, start, count);
+    if (view.len > 0) {
+        memcpy(dst, view.ptr, view.len);
     }
-    dst[count] = '\0';
+    dst[view.len] = '\0';
 
     return dst;
 }
 
+uint8_t* utf8_byte_copy_arena(UTF8View view, UTF8Arena* arena) {
+    return utf8_arena_copy(arena, view);
+}
+
+// Allocates a new null-terminated copy of the string.
+uint8_t* utf8_byte_copy(const uint8_t* start) {
+    return utf8_byte_copy_view(utf8_view(start));
+}
+
 // Copies exactly n bytes, as long as n <= count; always null-terminates.
 uint8_t* utf8_byte_copy_n(const uint8_t* start, uint64_t n) {
     if (!start) {
         return NULL;
     }
 
-    int64_t count = utf8_byte_count(start);
-    if (count == -1 || n > (uint64_t) count) {
-        return NULL;
-    }
-
-    uint8_t* dst = calloc((n + 1), sizeof(uint8_t));
-    if (!dst) {
+    // Only the first n bytes are inspected; a terminator among them means n > count.
+    if (n > 0 && memchr(start, '\0', n)) {
         return NULL;
     }
 
-    if (n > 0) {
-        memcpy(dst, start, n);
-    }
-    dst[n] = '\0';
-
-    return dst;
+    return utf8_byte_copy_view(utf8_view_n(start, n));
 }
 
 // Copies bytes from start to end (exclusive), if end >= start.
@@ -94,12 +272,8 @@ uint8_t* utf8_byte_copy_slice(const uint8_t* start, const uint8_t* end) {
         return NULL;
     }
 
-    ptrdiff_t diff = utf8_byte_diff(start, end);
-    if (diff < 0) {
-        return NULL;
-    }
-
-    return utf8_byte_copy_n(start, (uint64_t) diff);
+    // A range carries its own length, so embedded null bytes are copied as-is
+    return utf8_byte_copy_view(utf8_view_range(start, end));
 }
 
 uint8_t* utf8_byte_cat(const uint8_t* dst, const uint8_t* src) {
@@ -107,58 +281,298 @@ uint8_t* utf8_byte_cat(const uint8_t* dst, const uint8_t* src) {
         return NULL;
     }
 
-    int64_t dst_n = utf8_byte_count(dst);
-    int64_t src_n = utf8_byte_count(src);
-    if (dst_n == -1 || src_n == -1) {
+    UTF8View parts[2] = {utf8_view(dst), utf8_view(src)};
+    return utf8_byte_join_view(parts, 2, (UTF8View) {0});
+}
+
+uint8_t* utf8_byte_cat_arena(UTF8View dst, UTF8View src, UTF8Arena* arena) {
+    if (!dst.ptr || !src.ptr) {
         return NULL;
     }
 
-    size_t out_n = (size_t) (dst_n + src_n);
-    uint8_t* out = calloc((out_n + 1), sizeof(uint8_t));
-    if (!out) {
-        return NULL;
+    UTF8View parts[2] = {dst, src};
+    return utf8_byte_join_arena(parts, 2, (UTF8View) {0}, arena);
+}
+
+// --- Comparison kernels ---
+
+// Index of the first differing byte in [0, n), or n if the ranges are equal.
+static size_t utf8_byte_mismatch_scalar(const uint8_t* a, const uint8_t* b, size_t n) {
+    size_t i = 0;
+    while (i < n && a[i] == b[i]) {
+        i++;
     }
 
-    if (dst_n > 0) {
-        memcpy(out, dst, dst_n);
+    return i;
+}
+
+// Index of the first byte where a and b differ or a ends.
+static size_t utf8_byte_stop_scalar(const uint8_t* a, const uint8_t* b) {
+    size_t i = 0;
+    while (a[i] && a[i] == b[i]) {
+        i++;
     }
-    if (src_n > 0) {
-        memcpy(out + dst_n, src, src_n);
+
+    return i;
+}
+
+#if UTF8_SIMD_X86
+/**
+ * @note Bounded kernels finish with one overlapping (or masked) load ending at n, so
+ *       they never read outside either range. Terminated kernels cannot align two
+ *       independent pointers; instead they run vector loads up to the nearer page
+ *       boundary and step single bytes across it. A load that stays inside a page
+ *       cannot fault, even past the terminator.
+ */
+
+    #define UTF8_BYTE_PAGE_SIZE 4096
+
+// Bytes from a and b until either reaches a page boundary.
+static inline size_t utf8_byte_page_room(const uint8_t* a, const uint8_t* b) {
+    size_t room_a = UTF8_BYTE_PAGE_SIZE - ((uintptr_t) a & (UTF8_BYTE_PAGE_SIZE - 1));
+    size_t room_b = UTF8_BYTE_PAGE_SIZE - ((uintptr_t) b & (UTF8_BYTE_PAGE_SIZE - 1));
+    return room_a < room_b ? room_a : room_b;
+}
+
+__attribute__((target("sse2")))
+static size_t utf8_byte_mismatch_sse2(const uint8_t* a, const uint8_t* b, size_t n) {
+    if (n < 16) {
+        return utf8_byte_mismatch_scalar(a, b, n);
     }
-    out[out_n] = '\0';
 
-    return out;
+    for (size_t i = 0;; i += 16) {
+        i = i > n - 16 ? n - 16 : i;  // Final load overlaps the previous one
+        __m128i va = _mm_loadu_si128((const __m128i*) (a + i));
+        __m128i vb = _mm_loadu_si128((const __m128i*) (b + i));
+        uint32_t mask = (uint32_t) _mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) ^ 0xFFFF;
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+        if (i == n - 16) {
+            return n;
+        }
+    }
 }
 
-int8_t utf8_byte_cmp(const uint8_t* a, const uint8_t* b) {
-    if (!a || !b) {
-        return UTF8_COMPARE_INVALID;
+__attribute__((target("sse2"), no_sanitize_address))
+static size_t utf8_byte_stop_sse2(const uint8_t* a, const uint8_t* b) {
+    const __m128i zero = _mm_setzero_si128();
+    for (size_t i = 0;;) {
+        size_t room = utf8_byte_page_room(a + i, b + i);
+        if (room < 16) {
+            if (!a[i] || a[i] != b[i]) {
+                return i;
+            }
+            i++;
+            continue;
+        }
+
+        for (size_t end = i + room - 16; i <= end; i += 16) {
+            __m128i va = _mm_loadu_si128((const __m128i*) (a + i));
+            __m128i vb = _mm_loadu_si128((const __m128i*) (b + i));
+            // Equal and non-zero lanes become 0xFF; the first other lane stops the scan
+            __m128i go = _mm_andnot_si128(_mm_cmpeq_epi8(va, zero), _mm_cmpeq_epi8(va, vb));
+            uint32_t mask = (uint32_t) _mm_movemask_epi8(go) ^ 0xFFFF;
+            if (mask) {
+                return i + __builtin_ctz(mask);
+            }
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+static size_t utf8_byte_mismatch_avx2(const uint8_t* a, const uint8_t* b, size_t n) {
+    if (n < 32) {
+        return utf8_byte_mismatch_sse2(a, b, n);
+    }
+
+    for (size_t i = 0;; i += 32) {
+        i = i > n - 32 ? n - 32 : i;  // Final load overlaps the previous one
+        __m256i va = _mm256_loadu_si256((const __m256i*) (a + i));
+        __m256i vb = _mm256_loadu_si256((const __m256i*) (b + i));
+        uint32_t mask = ~(uint32_t) _mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb));
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+        if (i == n - 32) {
+            return n;
+        }
     }
+}
 
-    const uint8_t* a_stream = a;
-    const uint8_t* b_stream = b;
+__attribute__((target("avx2"), no_sanitize_address))
+static size_t utf8_byte_stop_avx2(const uint8_t* a, const uint8_t* b) {
+    const __m256i zero = _mm256_setzero_si256();
+    for (size_t i = 0;;) {
+        size_t room = utf8_byte_page_room(a + i, b + i);
+        if (room < 32) {
+            // Cross the boundary in 16-byte steps while they still fit
+            if (room >= 16) {
+                __m128i va = _mm_loadu_si128((const __m128i*) (a + i));
+                __m128i vb = _mm_loadu_si128((const __m128i*) (b + i));
+                __m128i go = _mm_andnot_si128(
+                    _mm_cmpeq_epi8(va, _mm_setzero_si128()), _mm_cmpeq_epi8(va, vb)
+                );
+                uint32_t mask = (uint32_t) _mm_movemask_epi8(go) ^ 0xFFFF;
+                if (mask) {
+                    return i + __builtin_ctz(mask);
+                }
+                i += 16;
+                continue;
+            }
+            if (!a[i] || a[i] != b[i]) {
+                return i;
+            }
+            i++;
+            continue;
+        }
 
-    while (*a_stream && *b_stream) {
-        if (*a_stream < *b_stream) {
-            return UTF8_COMPARE_LESS;
+        for (size_t end = i + room - 32; i <= end; i += 32) {
+            __m256i va = _mm256_loadu_si256((const __m256i*) (a + i));
+            __m256i vb = _mm256_loadu_si256((const __m256i*) (b + i));
+            __m256i go = _mm256_andnot_si256(_mm256_cmpeq_epi8(va, zero), _mm256_cmpeq_epi8(va, vb));
+            uint32_t mask = ~(uint32_t) _mm256_movemask_epi8(go);
+            if (mask) {
+                return i + __builtin_ctz(mask);
+            }
         }
-        if (*a_stream > *b_stream) {
-            return UTF8_COMPARE_GREATER;
+    }
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static size_t utf8_byte_mismatch_avx512(const uint8_t* a, const uint8_t* b, size_t n) {
+    size_t i = 0;
+    for (; n - i >= 64; i += 64) {
+        __m512i va = _mm512_loadu_si512((const void*) (a + i));
+        __m512i vb = _mm512_loadu_si512((const void*) (b + i));
+        uint64_t mask = _mm512_cmpneq_epi8_mask(va, vb);
+        if (mask) {
+            return i + __builtin_ctzll(mask);
         }
-        // Both bytes are equal, move to the next
-        a_stream++;
-        b_stream++;
     }
 
-    // Check if strings are of different lengths
-    if (*a_stream) {
-        return UTF8_COMPARE_GREATER;
+    // Masked loads never touch the lanes past n
+    if (i < n) {
+        __mmask64 live = (1ULL << (n - i)) - 1;
+        __m512i va = _mm512_maskz_loadu_epi8(live, a + i);
+        __m512i vb = _mm512_maskz_loadu_epi8(live, b + i);
+        uint64_t mask = _mm512_cmpneq_epi8_mask(va, vb);
+        if (mask) {
+            return i + __builtin_ctzll(mask);
+        }
+    }
+
+    return n;
+}
+
+__attribute__((target("avx512f,avx512bw"), no_sanitize_address))
+static size_t utf8_byte_stop_avx512(const uint8_t* a, const uint8_t* b) {
+    for (size_t i = 0;;) {
+        size_t room = utf8_byte_page_room(a + i, b + i);
+        if (room < 64) {
+            // Masked loads suppress faults, so the boundary is crossed in one step
+            __mmask64 live = (1ULL << room) - 1;
+            __m512i va = _mm512_maskz_loadu_epi8(live, a + i);
+            __m512i vb = _mm512_maskz_loadu_epi8(live, b + i);
+            uint64_t mask = (_mm512_cmpneq_epi8_mask(va, vb) | _mm512_testn_epi8_mask(va, va)) & live;
+            if (mask) {
+                return i + __builtin_ctzll(mask);
+            }
+            i += room;
+            continue;
+        }
+
+        for (size_t end = i + room - 64; i <= end; i += 64) {
+            __m512i va = _mm512_loadu_si512((const void*) (a + i));
+            __m512i vb = _mm512_loadu_si512((const void*) (b + i));
+            uint64_t mask = _mm512_cmpneq_epi8_mask(va, vb) | _mm512_testn_epi8_mask(va, va);
+            if (mask) {
+                return i + __builtin_ctzll(mask);
+            }
+        }
+    }
+}
+#endif  // UTF8_SIMD_X86
+
+static size_t utf8_byte_mismatch_n(const uint8_t* a, const uint8_t* b, size_t n) {
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+            return utf8_byte_mismatch_avx512(a, b, n);
+        case UTF8_SIMD_AVX2:
+            return utf8_byte_mismatch_avx2(a, b, n);
+        case UTF8_SIMD_SSSE3:
+        case UTF8_SIMD_SSE2:
+            return utf8_byte_mismatch_sse2(a, b, n);
+#endif
+        default:
+            return utf8_byte_mismatch_scalar(a, b, n);
+    }
+}
+
+static size_t utf8_byte_stop(const uint8_t* a, const uint8_t* b) {
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+            return utf8_byte_stop_avx512(a, b);
+        case UTF8_SIMD_AVX2:
+            return utf8_byte_stop_avx2(a, b);
+        case UTF8_SIMD_SSSE3:
+        case UTF8_SIMD_SSE2:
+            return utf8_byte_stop_sse2(a, b);
+#endif
+        default:
+            return utf8_byte_stop_scalar(a, b);
+    }
+}
+
+int8_t utf8_byte_cmp_mismatch(UTF8View a, UTF8View b, size_t* offset) {
+    if (!a.ptr || !b.ptr) {
+        return UTF8_COMPARE_INVALID;
+    }
+
+    size_t n = a.len < b.len ? a.len : b.len;
+    size_t i = utf8_byte_mismatch_n(a.ptr, b.ptr, n);
+    if (offset) {
+        *offset = i;
+    }
+
+    if (i < n) {
+        return a.ptr[i] < b.ptr[i] ? UTF8_COMPARE_LESS : UTF8_COMPARE_GREATER;
+    }
+
+    // Common prefix is equal; the shorter view sorts first
+    if (a.len == b.len) {
+        return UTF8_COMPARE_EQUAL;
     }
-    if (*b_stream) {
-        return UTF8_COMPARE_LESS;
+    return a.len < b.len ? UTF8_COMPARE_LESS : UTF8_COMPARE_GREATER;
+}
+
+size_t utf8_byte_mismatch(UTF8View a, UTF8View b) {
+    size_t offset = 0;
+    utf8_byte_cmp_mismatch(a, b, &offset);
+    return offset;
+}
+
+int8_t utf8_byte_cmp_n(const uint8_t* a, size_t a_len, const uint8_t* b, size_t b_len) {
+    return utf8_byte_cmp_mismatch(utf8_view_n(a, a_len), utf8_view_n(b, b_len), NULL);
+}
+
+int8_t utf8_byte_cmp_view(UTF8View a, UTF8View b) {
+    return utf8_byte_cmp_mismatch(a, b, NULL);
+}
+
+int8_t utf8_byte_cmp(const uint8_t* a, const uint8_t* b) {
+    if (!a || !b) {
+        return UTF8_COMPARE_INVALID;
     }
 
-    return UTF8_COMPARE_EQUAL;
+    // Stops at the first difference or at the end of a (which b then shares or exceeds)
+    size_t i = utf8_byte_stop(a, b);
+    if (a[i] == b[i]) {
+        return UTF8_COMPARE_EQUAL;
+    }
+    return a[i] < b[i] ? UTF8_COMPARE_LESS : UTF8_COMPARE_GREATER;
 }
 
 uint8_t** utf8_byte_append(const uint8_t* src, uint8_t** parts, uint64_t* count) {
@@ -219,36 +633,102 @@ uint8_t** utf8_byte_append_slice(
     return temp;
 }
 
-uint8_t** utf8_byte_split(const uint8_t* src, uint64_t* count) {
-    if (!src || !count) {
+// Copies every span into its own part; consumes (frees) the span list.
+static uint8_t** utf8_byte_split_parts(UTF8View src, UTF8SpanList* list, uint64_t* count) {
+    uint8_t** parts = utf8_span_copy(src, list->spans, list->count);
+    if (parts) {
+        *count = list->count;
+    }
+
+    utf8_span_list_free(list);
+    return parts;
+}
+
+// Materializes every span into the arena; consumes (frees) the span list.
+static uint8_t** utf8_byte_split_parts_arena(
+    UTF8View src, UTF8SpanList* list, uint64_t* count, UTF8Arena* arena
+) {
+    uint8_t** parts = utf8_span_materialize_arena(src, list->spans, list->count, arena);
+    if (parts) {
+        *count = list->count;
+    }
+
+    utf8_span_list_free(list);
+    return parts;
+}
+
+bool utf8_byte_split_spans(UTF8View src, UTF8SpanList* out) {
+    if (!src.ptr || !out) {
+        return false;
+    }
+
+    utf8_span_list_clear(out);
+    if (!utf8_span_list_reserve(out, src.len)) {
+        return false;
+    }
+
+    for (size_t i = 0; i < src.len; i++) {
+        out->spans[out->count++] = (UTF8Span) {.offset = i, .len = 1};
+    }
+
+    return true;
+}
+
+uint8_t** utf8_byte_split_view(UTF8View src, uint64_t* count) {
+    if (!src.ptr || !count) {
         return NULL;
     }
 
     *count = 0;
-    uint8_t** parts = calloc(1, sizeof(uint8_t*));
-    int64_t len = utf8_byte_count(src);
-    if (!parts || len < 0) {
+    UTF8SpanList list = {0};
+    if (!utf8_byte_split_spans(src, &list)) {
+        utf8_span_list_free(&list);
         return NULL;
     }
 
-    for (int64_t i = 0; i < len; i++) {
-        uint8_t* chunk = calloc(2, sizeof(uint8_t));
-        if (!chunk) {
-            // Optionally: free previous parts
-            return NULL;
-        }
-        chunk[0] = src[i];
-        chunk[1] = '\0';
+    return utf8_byte_split_parts(src, &list, count);
+}
+
+uint8_t** utf8_byte_split_arena(UTF8View src, uint64_t* count, UTF8Arena* arena) {
+    if (!src.ptr || !count || !arena) {
+        return NULL;
+    }
+
+    *count = 0;
+    UTF8SpanList list = {0};
+    if (!utf8_byte_split_spans(src, &list)) {
+        utf8_span_list_free(&list);
+        return NULL;
+    }
+
+    return utf8_byte_split_parts_arena(src, &list, count, arena);
+}
 
-        parts = utf8_byte_append(chunk, parts, count);
-        if (!parts) {
-            free(chunk);
-            // Optionally: free previous parts
+// Interns every span; consumes (frees) the span list.
+static uint32_t* utf8_byte_split_symbols(
+    UTF8View src, UTF8SpanList* list, uint64_t* count, UTF8Interner* interner
+) {
+    uint32_t* ids = malloc((list->count ? list->count : 1) * sizeof(uint32_t));
+    if (!ids) {
+        utf8_span_list_free(list);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < list->count; i++) {
+        if (!utf8_interner_intern(interner, utf8_span_view(src, list->spans[i]), &ids[i])) {
+            free(ids);
+            utf8_span_list_free(list);
             return NULL;
         }
     }
 
-    return parts;
+    *count = list->count;
+    utf8_span_list_free(list);
+    return ids;
+}
+
+uint8_t** utf8_byte_split(const uint8_t* src, uint64_t* count) {
+    return utf8_byte_split_view(utf8_view(src), count);
 }
 
 void utf8_byte_split_free(uint8_t** parts, uint64_t count) {
@@ -260,145 +740,388 @@ void utf8_byte_split_free(uint8_t** parts, uint64_t count) {
     }
 }
 
-uint8_t** utf8_byte_split_delim(const uint8_t* src, const uint8_t* delim, uint64_t* count) {
-    if (!src || !count) {
+typedef struct UTF8ByteSplitDelim {
+    UTF8SpanList* out;
+    size_t current;  // Start of the pending part
+    size_t delim_len;
+} UTF8ByteSplitDelim;
+
+// Delimiter match: record [current, offset)
+static bool utf8_byte_split_delim_emit(size_t offset, void* ctx) {
+    UTF8ByteSplitDelim* split = (UTF8ByteSplitDelim*) ctx;
+    if (!utf8_span_list_push(split->out, split->current, offset - split->current)) {
+        return false;
+    }
+
+    split->current = offset + split->delim_len;
+    return true;
+}
+
+bool utf8_byte_split_delim_spans(UTF8View src, UTF8View delim, UTF8SpanList* out) {
+    if (!src.ptr || !out) {
+        return false;
+    }
+
+    // Empty delimiter means split into bytes
+    if (!delim.ptr || delim.len == 0) {
+        return utf8_byte_split_spans(src, out);
+    }
+
+    utf8_span_list_clear(out);
+
+    UTF8Finder finder;
+    utf8_finder_init(&finder, delim);
+
+    UTF8ByteSplitDelim split = {.out = out, .current = 0, .delim_len = delim.len};
+    if (!utf8_finder_scan(&finder, src, utf8_byte_split_delim_emit, &split)) {
+        return false;
+    }
+    size_t current = split.current;
+
+    // Handle any trailing text after the last delimiter (or if no delimiter at all)
+    if (current < src.len) {
+        if (!utf8_span_list_push(out, current, src.len - current)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint8_t** utf8_byte_split_delim_view(UTF8View src, UTF8View delim, uint64_t* count) {
+    if (!src.ptr || !count) {
         return NULL;
     }
 
-    int64_t src_len = utf8_byte_count(src);
-    if (src_len < 0) {
+    *count = 0;
+    UTF8SpanList list = {0};
+    if (!utf8_byte_split_delim_spans(src, delim, &list)) {
+        utf8_span_list_free(&list);
         return NULL;
     }
 
-    // Empty delimiter means split into bytes
-    int64_t delim_len = utf8_byte_count(delim);
-    if (!delim || *delim == '\0' || delim_len < 1) {
-        return utf8_byte_split(src, count);
+    return utf8_byte_split_parts(src, &list, count);
+}
+
+uint8_t** utf8_byte_split_delim_arena(
+    UTF8View src, UTF8View delim, uint64_t* count, UTF8Arena* arena
+) {
+    if (!src.ptr || !count || !arena) {
+        return NULL;
     }
 
     *count = 0;
-    uint8_t** parts = calloc(1, sizeof(uint8_t*));
-    if (!parts) {
+    UTF8SpanList list = {0};
+    if (!utf8_byte_split_delim_spans(src, delim, &list)) {
+        utf8_span_list_free(&list);
         return NULL;
     }
 
-    const uint8_t* current = src;
-    const uint8_t* scan = src;
-    const uint8_t* end = src + src_len;
+    return utf8_byte_split_parts_arena(src, &list, count, arena);
+}
 
-    while (scan <= end - delim_len) {
-        if (memcmp(scan, delim, delim_len) == 0) {
-            // Delimiter match: copy [current, scan)
-            parts = utf8_byte_append_slice(current, scan, parts, count);
-            if (!parts) {
-                return NULL;
-            }
-            scan += delim_len;
-            current = scan;
-        } else {
-            scan++;
-        }
+uint32_t* utf8_byte_split_delim_intern(
+    UTF8View src, UTF8View delim, UTF8Interner* interner, uint64_t* count
+) {
+    if (!src.ptr || !count || !interner) {
+        return NULL;
+    }
+
+    *count = 0;
+    UTF8SpanList list = {0};
+    if (!utf8_byte_split_delim_spans(src, delim, &list)) {
+        utf8_span_list_free(&list);
+        return NULL;
+    }
+
+    return utf8_byte_split_symbols(src, &list, count, interner);
+}
+
+uint8_t** utf8_byte_split_delim(const uint8_t* src, const uint8_t* delim, uint64_t* count) {
+    return utf8_byte_split_delim_view(utf8_view(src), utf8_view(delim), count);
+}
+
+// Delimiter match: record [current, offset)
+static bool utf8_byte_split_any_emit(size_t offset, size_t len, size_t index, void* ctx) {
+    (void) index;
+    UTF8ByteSplitDelim* split = (UTF8ByteSplitDelim*) ctx;
+    if (!utf8_span_list_push(split->out, split->current, offset - split->current)) {
+        return false;
+    }
+
+    split->current = offset + len;
+    return true;
+}
+
+bool utf8_byte_split_any_spans(UTF8View src, const UTF8Automaton* automaton, UTF8SpanList* out) {
+    if (!src.ptr || !automaton || !out) {
+        return false;
+    }
+
+    utf8_span_list_clear(out);
+
+    UTF8ByteSplitDelim split = {.out = out, .current = 0, .delim_len = 0};
+    if (!utf8_automaton_scan(automaton, src, utf8_byte_split_any_emit, &split)) {
+        return false;
     }
 
     // Handle any trailing text after the last delimiter (or if no delimiter at all)
-    if (current < end) {
-        parts = utf8_byte_append_slice(current, end, parts, count);
-        if (!parts) {
-            return NULL;
+    if (split.current < src.len) {
+        if (!utf8_span_list_push(out, split.current, src.len - split.current)) {
+            return false;
         }
     }
 
-    return parts;
+    return true;
 }
 
-uint8_t** utf8_byte_split_regex(const uint8_t* src, const uint8_t* pattern, uint64_t* count) {
-    if (!src || !pattern || !count) {
+uint8_t** utf8_byte_split_any_view(
+    UTF8View src, const UTF8View* delims, size_t n, uint64_t* count
+) {
+    if (!src.ptr || !count) {
         return NULL;
     }
+
     *count = 0;
+    UTF8Automaton automaton;
+    if (!utf8_automaton_init(&automaton, delims, n)) {
+        return NULL;
+    }
+
+    UTF8SpanList list = {0};
+    bool ok = utf8_byte_split_any_spans(src, &automaton, &list);
+    utf8_automaton_free(&automaton);
+    if (!ok) {
+        utf8_span_list_free(&list);
+        return NULL;
+    }
+
+    return utf8_byte_split_parts(src, &list, count);
+}
+
+uint8_t** utf8_byte_split_any(
+    const uint8_t* src, const uint8_t** delims, size_t n, uint64_t* count
+) {
+    if (!delims || n == 0) {
+        return NULL;
+    }
+
+    UTF8View* views = malloc(n * sizeof(UTF8View));
+    if (!views) {
+        return NULL;
+    }
+    for (size_t i = 0; i < n; i++) {
+        views[i] = utf8_view(delims[i]);
+    }
+
+    uint8_t** parts = utf8_byte_split_any_view(utf8_view(src), views, n, count);
+    free(views);
+    return parts;
+}
+
+bool utf8_byte_split_regex_spans(UTF8View src, const uint8_t* pattern, UTF8SpanList* out) {
+    if (!src.ptr || !pattern || !out) {
+        return false;
+    }
+
+    utf8_span_list_clear(out);
 
     pcre2_code* code = NULL;
     pcre2_match_data* match = NULL;
     if (!utf8_regex_compile(pattern, &code, &match)) {
+        return false;
+    }
+    pcre2_match_data_free(match);  // The iterator brings its own
+
+    UTF8RegexIter iter;
+    if (!utf8_regex_iter_init(&iter, code, src)) {
+        utf8_regex_free(code, NULL);
+        return false;
+    }
+
+    bool ok = true;
+    size_t match_start;
+    size_t match_end;
+    while (utf8_regex_iter_next(&iter, &match_start, &match_end)) {
+        // Empty matches delimit nothing
+        if (match_end > match_start
+            && !utf8_span_list_push(out, match_start, match_end - match_start)) {
+            ok = false;
+            break;
+        }
+    }
+
+    ok = ok && iter.error == 0;  // e.g. src is not valid UTF-8
+    utf8_regex_iter_free(&iter);
+    utf8_regex_free(code, NULL);
+    return ok;
+}
+
+uint8_t** utf8_byte_split_regex_view(UTF8View src, const uint8_t* pattern, uint64_t* count) {
+    if (!src.ptr || !pattern || !count) {
         return NULL;
     }
+    *count = 0;
 
-    uint8_t** parts = calloc(1, sizeof(uint8_t*));
-    int64_t total_bytes = utf8_byte_count(src);
-    if (!parts || total_bytes <= 0) {
-        utf8_regex_free(code, match);
+    if (src.len == 0) {
         return NULL;
     }
 
-    int64_t offset = 0;
-    while (offset < total_bytes) {
-        int rc = pcre2_match(
-            code, (PCRE2_SPTR) (src + offset), total_bytes - offset, 0, 0, match, NULL
-        );
-        if (rc < 0) {
-            break;
+    UTF8SpanList list = {0};
+    if (!utf8_byte_split_regex_spans(src, pattern, &list)) {
+        utf8_span_list_free(&list);
+        return NULL;
+    }
+
+    return utf8_byte_split_parts(src, &list, count);
+}
+
+uint8_t** utf8_byte_split_regex_arena(
+    UTF8View src, const uint8_t* pattern, uint64_t* count, UTF8Arena* arena
+) {
+    if (!src.ptr || !pattern || !count || !arena) {
+        return NULL;
+    }
+    *count = 0;
+
+    if (src.len == 0) {
+        return NULL;
+    }
+
+    UTF8SpanList list = {0};
+    if (!utf8_byte_split_regex_spans(src, pattern, &list)) {
+        utf8_span_list_free(&list);
+        return NULL;
+    }
+
+    return utf8_byte_split_parts_arena(src, &list, count, arena);
+}
+
+uint32_t* utf8_byte_split_regex_intern(
+    UTF8View src, const uint8_t* pattern, UTF8Interner* interner, uint64_t* count
+) {
+    if (!src.ptr || !pattern || !count || !interner) {
+        return NULL;
+    }
+
+    *count = 0;
+    UTF8SpanList list = {0};
+    if (!utf8_byte_split_regex_spans(src, pattern, &list)) {
+        utf8_span_list_free(&list);
+        return NULL;
+    }
+
+    return utf8_byte_split_symbols(src, &list, count, interner);
+}
+
+uint8_t** utf8_byte_split_regex(const uint8_t* src, const uint8_t* pattern, uint64_t* count) {
+    return utf8_byte_split_regex_view(utf8_view(src), pattern, count);
+}
+
+// Returns the joined length including the terminator, or 0 if any part is invalid.
+static size_t utf8_byte_join_size(const UTF8View* parts, uint64_t count, size_t delim_len) {
+    size_t total = 1;  // For final null terminator
+    for (uint64_t i = 0; i < count; i++) {
+        if (!parts[i].ptr) {
+            return 0;  // Defensive
         }
+        total += parts[i].len;
+    }
+    if (delim_len > 0 && count > 1) {
+        total += delim_len * (count - 1);
+    }
 
-        PCRE2_SIZE* ovector = pcre2_get_ovector_pointer(match);
-        size_t match_start = ovector[0];
-        size_t match_end = ovector[1];
-
-        if (match_end > match_start) {
-            parts = utf8_byte_append_n(
-                src + offset + match_start, match_end - match_start, parts, count
-            );
-            if (!parts) {
-                utf8_regex_free(code, match);
-                return NULL;
-            }
+    return total;
+}
+
+// Copies parts and delimiters into buffer and null-terminates it.
+static uint8_t* utf8_byte_join_write(
+    const UTF8View* parts, uint64_t count, UTF8View delim, uint8_t* buffer
+) {
+    uint8_t* out = buffer;
+    for (uint64_t i = 0; i < count; i++) {
+        if (i > 0 && delim.len > 0) {
+            memcpy(out, delim.ptr, delim.len);
+            out += delim.len;
+        }
+        if (parts[i].len > 0) {
+            memcpy(out, parts[i].ptr, parts[i].len);
+            out += parts[i].len;
         }
-        offset += match_end;
     }
+    *out = '\0';  // Null-terminate
 
-    utf8_regex_free(code, match);
-    return parts;
+    return buffer;
 }
 
-uint8_t* utf8_byte_join(uint8_t** parts, uint64_t count, const uint8_t* delim) {
+uint8_t* utf8_byte_join_view(const UTF8View* parts, uint64_t count, UTF8View delim) {
     if (!parts || count == 0) {
         return NULL;
     }
 
-    int64_t delim_len = delim ? utf8_byte_count(delim) : 0;
+    delim.len = delim.ptr ? delim.len : 0;
+    size_t total = utf8_byte_join_size(parts, count, delim.len);
+    if (total == 0) {
+        return NULL;
+    }
+
+    // Sized up front, so the builder never reallocates
+    UTF8Builder builder = {0};
+    if (!utf8_builder_reserve(&builder, total - 1)) {
+        return NULL;
+    }
 
-    // Compute total length
-    size_t total = 1;  // For final null terminator
     for (uint64_t i = 0; i < count; i++) {
-        int64_t part_len = utf8_byte_count(parts[i]);
-        if (part_len < 0) {
-            return NULL;  // Defensive
+        if (i > 0 && delim.len > 0) {
+            utf8_builder_append_view(&builder, delim);
         }
-        total += (size_t) part_len;
+        utf8_builder_append_view(&builder, parts[i]);
     }
-    if (delim_len > 0 && count > 1) {
-        total += (size_t) delim_len * (count - 1);
+
+    return utf8_builder_finish(&builder, NULL);
+}
+
+uint8_t* utf8_byte_join_arena(
+    const UTF8View* parts, uint64_t count, UTF8View delim, UTF8Arena* arena
+) {
+    if (!parts || count == 0 || !arena) {
+        return NULL;
     }
 
-    // Allocate output buffer
-    uint8_t* buffer = calloc(total, sizeof(uint8_t));
+    delim.len = delim.ptr ? delim.len : 0;
+    size_t total = utf8_byte_join_size(parts, count, delim.len);
+    if (total == 0) {
+        return NULL;
+    }
+
+    uint8_t* buffer = utf8_arena_alloc(arena, total);
     if (!buffer) {
         return NULL;
     }
 
-    // Copy parts and delimiters
-    uint8_t* out = buffer;
+    return utf8_byte_join_write(parts, count, delim, buffer);
+}
+
+uint8_t* utf8_byte_join(uint8_t** parts, uint64_t count, const uint8_t* delim) {
+    if (!parts || count == 0) {
+        return NULL;
+    }
+
+    // Measure each part exactly once
+    UTF8View* views = malloc(count * sizeof(UTF8View));
+    if (!views) {
+        return NULL;
+    }
+
     for (uint64_t i = 0; i < count; i++) {
-        if (i > 0 && delim_len > 0) {
-            memcpy(out, delim, delim_len);
-            out += delim_len;
-        }
-        int64_t part_len = utf8_byte_count(parts[i]);
-        if (part_len > 0) {
-            memcpy(out, parts[i], part_len);
-            out += part_len;
+        views[i] = utf8_view(parts[i]);
+        if (!views[i].ptr) {
+            free(views);
+            return NULL;  // Defensive
         }
     }
-    *out = '\0';  // Null-terminate
 
+    uint8_t* buffer = utf8_byte_join_view(views, count, utf8_view(delim));
+    free(views);
     return buffer;
 }
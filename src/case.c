@@ -0,0 +1,282 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/case.c
+ * @brief Full Unicode case mapping and case folding.
+ */
+
+#include <string.h>
+
+#include "simd.h"
+#include "codepoint.h"
+#include "validate.h"
+#include "case.h"
+
+// --- Case Tables ---
+
+static inline const UTF8CaseRecord* utf8_case_record(uint32_t cp) {
+    if (cp > 0x10FFFF) {
+        return &utf8_case_records[0];
+    }
+
+    uint32_t block = utf8_case_stage1[cp >> UTF8_CASE_SHIFT];
+    uint32_t mask = (1u << UTF8_CASE_SHIFT) - 1;
+    return &utf8_case_records[utf8_case_stage2[(block << UTF8_CASE_SHIFT) | (cp & mask)]];
+}
+
+uint32_t utf8_case_cp(uint32_t cp, UTF8CaseMode mode) {
+    if (mode > UTF8_CASE_FOLD) {
+        return cp;
+    }
+
+    return (uint32_t) ((int32_t) cp + utf8_case_record(cp)->delta[mode]);
+}
+
+// --- ASCII Runs ---
+
+// ASCII lowercase (and folding) sets bit 5 of A-Z; uppercase clears it for a-z.
+static inline uint8_t utf8_case_ascii(uint8_t c, UTF8CaseMode mode) {
+    uint8_t first = mode == UTF8_CASE_UPPER ? 'a' : 'A';
+    return (uint8_t) (c - first) < 26 ? c ^ 0x20 : c;
+}
+
+/**
+ * @note Each kernel converts whole blocks that are entirely ASCII and stops at the
+ *       first block holding a non-ASCII byte, returning the number of bytes done.
+ *       Input and output offsets agree inside an ASCII block, so stores never run
+ *       past what the block itself produces.
+ */
+static size_t utf8_case_ascii_scalar(
+    const uint8_t* s, size_t len, uint8_t* dst, UTF8CaseMode mode
+) {
+    const uint64_t ones = 0x0101010101010101ULL;
+    // Adding 0x80 - first sets the high bit of every byte >= first; adding
+    // 0x80 - (last + 1) sets it for every byte > last. No byte can carry.
+    uint8_t first = mode == UTF8_CASE_UPPER ? 'a' : 'A';
+    uint64_t from = ones * (uint8_t) (0x80 - first);
+    uint64_t past = ones * (uint8_t) (0x80 - (first + 26));
+
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t word;
+        memcpy(&word, s + i, sizeof(word));
+        if (word & (ones * 0x80)) {
+            break;
+        }
+        uint64_t in_range = (word + from) & ~(word + past) & (ones * 0x80);
+        word ^= in_range >> 2;
+        memcpy(dst + i, &word, sizeof(word));
+    }
+
+    return i;
+}
+
+#if UTF8_SIMD_X86
+__attribute__((target("sse2")))
+static size_t utf8_case_ascii_sse2(
+    const uint8_t* s, size_t len, uint8_t* dst, UTF8CaseMode mode
+) {
+    // Biasing by 0x80 - first maps [first, first + 26) to the 26 lowest signed bytes
+    uint8_t first = mode == UTF8_CASE_UPPER ? 'a' : 'A';
+    const __m128i bias = _mm_set1_epi8((char) (0x80 - first));
+    const __m128i limit = _mm_set1_epi8((char) (-128 + 26));
+    const __m128i flip = _mm_set1_epi8(0x20);
+
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*) (s + i));
+        if (_mm_movemask_epi8(v)) {
+            break;
+        }
+        __m128i in_range = _mm_cmpgt_epi8(limit, _mm_add_epi8(v, bias));
+        v = _mm_xor_si128(v, _mm_and_si128(in_range, flip));
+        _mm_storeu_si128((__m128i*) (dst + i), v);
+    }
+
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t utf8_case_ascii_avx2(
+    const uint8_t* s, size_t len, uint8_t* dst, UTF8CaseMode mode
+) {
+    uint8_t first = mode == UTF8_CASE_UPPER ? 'a' : 'A';
+    const __m256i bias = _mm256_set1_epi8((char) (0x80 - first));
+    const __m256i limit = _mm256_set1_epi8((char) (-128 + 26));
+    const __m256i flip = _mm256_set1_epi8(0x20);
+
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*) (s + i));
+        if (_mm256_movemask_epi8(v)) {
+            break;
+        }
+        __m256i in_range = _mm256_cmpgt_epi8(limit, _mm256_add_epi8(v, bias));
+        v = _mm256_xor_si256(v, _mm256_and_si256(in_range, flip));
+        _mm256_storeu_si256((__m256i*) (dst + i), v);
+    }
+
+    return i;
+}
+#endif  // UTF8_SIMD_X86
+
+typedef size_t (*UTF8CaseAsciiFn)(const uint8_t* s, size_t len, uint8_t* dst, UTF8CaseMode mode);
+
+static UTF8CaseAsciiFn utf8_case_ascii_kernel(void) {
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+        case UTF8_SIMD_AVX2:
+            return utf8_case_ascii_avx2;
+        case UTF8_SIMD_SSSE3:
+        case UTF8_SIMD_SSE2:
+            return utf8_case_ascii_sse2;
+#endif
+        default:
+            return utf8_case_ascii_scalar;
+    }
+}
+
+// --- Conversion ---
+
+/**
+ * @note Final_Sigma (Unicode 3.13, Table 3-17): U+03A3 is preceded by a cased letter
+ *       and not followed by one, skipping case-ignorable codepoints either way.
+ *       A codepoint that is both (e.g., U+0345) is skipped as case-ignorable,
+ *       as ICU and CPython do.
+ */
+static bool utf8_case_final_sigma(const uint8_t* s, size_t at, size_t width, size_t len) {
+    UTF8CpCursor cursor = {s, s + at, s + len};
+    UTF8CpRef ref;
+    bool before = false;
+    while ((ref = utf8_cp_cursor_prev(&cursor)).width > 0) {
+        uint8_t flags = utf8_case_record((uint32_t) ref.cp)->flags;
+        if (!(flags & UTF8_CASE_IGNORABLE)) {
+            before = flags & UTF8_CASE_CASED;
+            break;
+        }
+    }
+    if (!before) {
+        return false;
+    }
+
+    cursor.current = s + at + width;
+    while ((ref = utf8_cp_cursor_next(&cursor)).width > 0) {
+        uint8_t flags = utf8_case_record((uint32_t) ref.cp)->flags;
+        if (!(flags & UTF8_CASE_IGNORABLE)) {
+            return !(flags & UTF8_CASE_CASED);
+        }
+    }
+
+    return true;
+}
+
+static inline size_t utf8_case_width(uint32_t cp) {
+    return 1 + (cp >= 0x80) + (cp >= 0x800) + (cp >= 0x10000);
+}
+
+// Converts (or with dst NULL, measures) s; stops at the first invalid sequence.
+static UTF8Validation utf8_case_run(
+    const uint8_t* s, size_t len, UTF8CaseMode mode, uint8_t* dst, size_t* written
+) {
+    UTF8CaseAsciiFn ascii = utf8_case_ascii_kernel();
+    size_t i = 0;
+    size_t n = 0;
+    while (i < len) {
+        if (dst && s[i] < 0x80) {
+            // Whole vectors first, then whole words of what is left of the run
+            size_t run = ascii(s + i, len - i, dst + n, mode);
+            run += utf8_case_ascii_scalar(s + i + run, len - i - run, dst + n + run, mode);
+            i += run;
+            n += run;
+        }
+
+        // Tails and the ASCII prefix of a mixed block, one byte at a time
+        while (i < len && s[i] < 0x80) {
+            if (dst) {
+                dst[n] = utf8_case_ascii(s[i], mode);
+            }
+            i++;
+            n++;
+        }
+        if (i >= len) {
+            break;
+        }
+
+        int32_t cp;
+        int8_t width = 2;
+        if (s[i] >= 0xC2 && s[i] < 0xE0 && i + 1 < len && (s[i + 1] & 0xC0) == 0x80) {
+            cp = ((s[i] & 0x1F) << 6) | (s[i + 1] & 0x3F);  // 2-byte fast path
+        } else {
+            width = utf8_cp_decode_next(s + i, s + len, &cp);
+        }
+        if (width < 1) {
+            UTF8Validation result = utf8_validate(utf8_view_n(s + i, len - i));
+            result.offset += i;
+            *written = n;
+            return result;
+        }
+
+        const UTF8CaseRecord* record = utf8_case_record((uint32_t) cp);
+        if (mode == UTF8_CASE_LOWER && (record->flags & UTF8_CASE_FINAL_SIGMA)
+            && utf8_case_final_sigma(s, i, (size_t) width, len)) {
+            if (dst) {
+                utf8_cp_encode(0x03C2, dst + n);
+            }
+            n += 2;
+        } else if (record->special[mode]) {
+            const UTF8CaseSpecial* special = &utf8_case_special[record->special[mode]];
+            if (dst) {
+                memcpy(dst + n, special->bytes, special->len);
+            }
+            n += special->len;
+        } else {
+            uint32_t mapped = (uint32_t) (cp + record->delta[mode]);
+            if (!dst) {
+                n += utf8_case_width(mapped);
+            } else if (mapped >= 0x80 && mapped < 0x800) {
+                dst[n++] = (uint8_t) (0xC0 | (mapped >> 6));
+                dst[n++] = (uint8_t) (0x80 | (mapped & 0x3F));
+            } else {
+                n += (size_t) utf8_cp_encode((int32_t) mapped, dst + n);
+            }
+        }
+        i += (size_t) width;
+    }
+
+    *written = n;
+    return (UTF8Validation) {UTF8_ERROR_NONE, len};
+}
+
+int64_t utf8_case_length(UTF8View src, UTF8CaseMode mode) {
+    if (!src.ptr || mode > UTF8_CASE_FOLD) {
+        return -1;
+    }
+
+    size_t n = 0;
+    if (utf8_case_run(src.ptr, src.len, mode, NULL, &n).error != UTF8_ERROR_NONE) {
+        return -1;
+    }
+
+    return (int64_t) n;
+}
+
+UTF8Validation utf8_case_convert(UTF8View src, UTF8CaseMode mode, uint8_t* dst, size_t* written) {
+    if (!src.ptr || !dst || !written || mode > UTF8_CASE_FOLD) {
+        return (UTF8Validation) {UTF8_ERROR_TRUNCATED, 0};
+    }
+
+    return utf8_case_run(src.ptr, src.len, mode, dst, written);
+}
+
+UTF8Validation utf8_to_lower(UTF8View src, uint8_t* dst, size_t* written) {
+    return utf8_case_convert(src, UTF8_CASE_LOWER, dst, written);
+}
+
+UTF8Validation utf8_to_upper(UTF8View src, uint8_t* dst, size_t* written) {
+    return utf8_case_convert(src, UTF8_CASE_UPPER, dst, written);
+}
+
+UTF8Validation utf8_casefold(UTF8View src, uint8_t* dst, size_t* written) {
+    return utf8_case_convert(src, UTF8_CASE_FOLD, dst, written);
+}
@@ -18,6 +18,8 @@
 #include <string.h>  // memcpy and friends
 #include <stdio.h>
 
+#include "simd.h"
+#include "validate.h"
 #include "codepoint.h"
 
 // --- UTF-8 Codepoint Operations ---
@@ -58,55 +60,135 @@ int32_t utf8_cp_decode(const uint8_t* start) {
     }
 }
 
-bool utf8_cp_is_valid(const uint8_t* start) {
-    if (!start) {
-        return false;
-    }
+// --- UTF-8 DFA Decoder ---
+
+/**
+ * @note Hoehrmann's DFA decoder: each byte maps to one of 12 classes, and each
+ *       (state, class) pair to the next state, so width, validity and value come
+ *       out of one table walk. Overlongs, surrogates, values above U+10FFFF, and
+ *       the bytes C0, C1 and F5-FF all reach REJECT.
+ *
+ *       Transitions use the shift encoding: a state is a bit offset (a multiple
+ *       of 6), and each class has one 64-bit row holding every state's successor
+ *       at that state's offset. The next state is (row >> state) & 63, and the row
+ *       load depends only on the byte, so the shift is the only step that waits
+ *       on the previous byte. ACCEPT is 0, REJECT is 6, and every larger state
+ *       is waiting on a continuation byte.
+ * @ref https://bjoern.hoehrmann.de/utf-8/decoder/dfa/
+ */
+#define UTF8_DFA_ACCEPT 0
+#define UTF8_DFA_REJECT 6
+
+static const uint8_t utf8_dfa_class[256] = {
+    // 00..7F: ASCII
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // 80..8F, 90..9F, A0..BF: continuation bytes, split by the ranges E0, ED, F0 and F4 allow
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    // C0..C1: overlong; C2..DF: 2-byte leads
+    8, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    // E0, E1..EC, ED, EE..EF; F0, F1..F3, F4, F5..FF
+    10, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3, 11, 6, 6, 6, 5, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+};
 
-    int8_t width = utf8_cp_width(start);
-    if (width == -1) {
-        return false;  // Early exit
+/**
+ * Rows by class, for states at offsets 0 (ACCEPT), 6 (REJECT), 12 (one continuation
+ * left), 18 (two left), 24 (after E0), 30 (after ED), 36 (after F0), 42 (three left)
+ * and 48 (after F4).
+ */
+static const uint64_t utf8_dfa_rows[12] = {
+    0x0006186186186180ULL,  // ASCII
+    0x0012486306300186ULL,  // 80..8F
+    0x000618618618618CULL,  // C2..DF
+    0x0006186186186192ULL,  // E1..EC, EE..EF
+    0x000618618618619EULL,  // ED
+    0x00061861861861B0ULL,  // F4
+    0x00061861861861AAULL,  // F1..F3
+    0x000649218C300186ULL,  // A0..BF
+    0x0006186186186186ULL,  // C0..C1, F5..FF
+    0x0006492306300186ULL,  // 90..9F
+    0x0006186186186198ULL,  // E0
+    0x00061861861861A4ULL,  // F0
+};
+
+// Walks one sequence through the DFA; end bounds the input (NULL for a
+// null-terminated string, where the terminator rejects any open sequence).
+static inline int8_t utf8_cp_decode_dfa(const uint8_t* start, const uint8_t* end, int32_t* cp) {
+    uint8_t byte = start[0];
+    if (byte < 0x80) {
+        *cp = byte;
+        return 1;
     }
 
-    if (width == 1) {
-        // Reject continuation bytes as standalone sequences
-        if ((start[0] & 0xC0) == 0x80) {
-            return false;
+    uint32_t type = utf8_dfa_class[byte];
+    uint32_t state = (uint32_t) utf8_dfa_rows[type] & 63;
+    uint32_t value = (0xFFu >> type) & byte;
+    int8_t width = 1;
+    while (state > UTF8_DFA_REJECT) {
+        if (end && start + width >= end) {
+            return -1;  // Truncated
         }
-        // ASCII (1-byte) characters are always valid
-        return true;
+        byte = start[width++];
+        value = (value << 6) | (byte & 0x3F);
+        state = (uint32_t) (utf8_dfa_rows[utf8_dfa_class[byte]] >> state) & 63;
     }
 
-    // Validate continuation bytes for multi-byte characters
-    for (int8_t i = 1; i < width; i++) {
-        if ((start[i] & 0xC0) != 0x80) {
-            return false;  // Invalid continuation byte
-        }
+    if (state != UTF8_DFA_ACCEPT) {
+        return -1;
+    }
+    if (width > 4) {
+        __builtin_unreachable();  // Every path through the DFA ends within 4 bytes
     }
 
-    // Additional checks for overlongs, surrogates, and invalid ranges
-    if (width == 2) {
-        if (start[0] < 0xC2) {
-            return false;  // Overlong encoding
-        }
-    } else if (width == 3) {
-        if (start[0] == 0xE0 && start[1] < 0xA0) {
-            return false;  // Overlong encoding
-        }
-        if (start[0] == 0xED && start[1] >= 0xA0) {
-            return false;  // Surrogate halves
-        }
-    } else if (width == 4) {
-        if (start[0] == 0xF0 && start[1] < 0x90) {
-            return false;  // Overlong encoding
-        }
-        if (start[0] == 0xF4 && start[1] > 0x8F) {
-            return false;  // Above U+10FFFF
+    *cp = (int32_t) value;
+    return width;
+}
+
+int8_t utf8_cp_decode_next(const uint8_t* start, const uint8_t* end, int32_t* cp) {
+    if (!start || !cp || (end && start >= end)) {
+        return -1;
+    }
+    return utf8_cp_decode_dfa(start, end, cp);
+}
+
+// Encode a codepoint as UTF-8 into dst (room for 4 bytes; not null-terminated).
+int8_t utf8_cp_encode(int32_t cp, uint8_t* dst) {
+    if (!dst || cp < 0) {
+        return -1;
+    }
+
+    if (cp < 0x80) {
+        dst[0] = (uint8_t) cp;
+        return 1;
+    } else if (cp < 0x800) {
+        dst[0] = (uint8_t) (0xC0 | (cp >> 6));
+        dst[1] = (uint8_t) (0x80 | (cp & 0x3F));
+        return 2;
+    } else if (cp < 0x10000) {
+        if (cp >= 0xD800 && cp <= 0xDFFF) {
+            return -1;  // Surrogates are not scalar values
         }
+        dst[0] = (uint8_t) (0xE0 | (cp >> 12));
+        dst[1] = (uint8_t) (0x80 | ((cp >> 6) & 0x3F));
+        dst[2] = (uint8_t) (0x80 | (cp & 0x3F));
+        return 3;
+    } else if (cp <= 0x10FFFF) {
+        dst[0] = (uint8_t) (0xF0 | (cp >> 18));
+        dst[1] = (uint8_t) (0x80 | ((cp >> 12) & 0x3F));
+        dst[2] = (uint8_t) (0x80 | ((cp >> 6) & 0x3F));
+        dst[3] = (uint8_t) (0x80 | (cp & 0x3F));
+        return 4;
     }
 
-    // If all checks passed, the character is valid
-    return true;
+    return -1;  // Above U+10FFFF
+}
+
+bool utf8_cp_is_valid(const uint8_t* start) {
+    int32_t cp;
+    return start && utf8_cp_decode_dfa(start, NULL, &cp) > 0;
 }
 
 bool utf8_cp_is_equal(const uint8_t* a, const uint8_t* b) {
@@ -136,29 +218,131 @@ ptrdiff_t utf8_cp_range(const uint8_t* start, const uint8_t* end) {
     return end - start;
 }
 
-int64_t utf8_cp_count(const uint8_t* start) {
-    if (!start) {
-        return -1;  // Invalid string
+// --- Codepoint counting kernels ---
+
+// Every byte that is not a continuation byte (10xxxxxx) starts a codepoint.
+static size_t utf8_cp_count_scalar(const uint8_t* s, size_t len) {
+    size_t continuations = 0;
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t word;
+        memcpy(&word, s + i, sizeof(word));
+        continuations += __builtin_popcountll(word & ~(word << 1) & 0x8080808080808080ULL);
+    }
+    for (; i < len; i++) {
+        continuations += (s[i] & 0xC0) == 0x80;
     }
 
-    if ('\0' == *start) {
-        return 0;  // Empty string
+    return len - continuations;
+}
+
+#if UTF8_SIMD_X86
+/**
+ * @note Lead bytes are those greater than 0xBF as signed bytes (-65). The SSE2 and
+ *       AVX2 kernels subtract each comparison mask (-1 per lead) from byte counters
+ *       and fold them into 64-bit sums before any counter can overflow.
+ */
+
+__attribute__((target("sse2")))
+static size_t utf8_cp_count_sse2(const uint8_t* s, size_t len) {
+    const __m128i threshold = _mm_set1_epi8(-65);
+    __m128i total = _mm_setzero_si128();
+
+    size_t i = 0;
+    while (i + 16 <= len) {
+        __m128i counters = _mm_setzero_si128();
+        for (int round = 0; round < 255 && i + 16 <= len; round++, i += 16) {
+            __m128i x = _mm_loadu_si128((const __m128i*) (s + i));
+            counters = _mm_sub_epi8(counters, _mm_cmpgt_epi8(x, threshold));
+        }
+        total = _mm_add_epi64(total, _mm_sad_epu8(counters, _mm_setzero_si128()));
     }
 
-    int64_t count = 0;
-    const uint8_t* stream = start;
-    while (*stream) {
-        int8_t width = utf8_cp_width(stream);
-        if (-1 == width || !utf8_cp_is_valid(stream)) {
-            return -1;
+    size_t count = (size_t) _mm_cvtsi128_si64(total)
+                   + (size_t) _mm_cvtsi128_si64(_mm_unpackhi_epi64(total, total));
+    return count + utf8_cp_count_scalar(s + i, len - i);
+}
+
+__attribute__((target("avx2")))
+static size_t utf8_cp_count_avx2(const uint8_t* s, size_t len) {
+    const __m256i threshold = _mm256_set1_epi8(-65);
+    __m256i total = _mm256_setzero_si256();
+
+    size_t i = 0;
+    while (i + 32 <= len) {
+        __m256i counters = _mm256_setzero_si256();
+        for (int round = 0; round < 255 && i + 32 <= len; round++, i += 32) {
+            __m256i x = _mm256_loadu_si256((const __m256i*) (s + i));
+            counters = _mm256_sub_epi8(counters, _mm256_cmpgt_epi8(x, threshold));
         }
+        total = _mm256_add_epi64(total, _mm256_sad_epu8(counters, _mm256_setzero_si256()));
+    }
 
-        count++;
-        stream += width;
+    __m128i half = _mm_add_epi64(_mm256_castsi256_si128(total), _mm256_extracti128_si256(total, 1));
+    size_t count = (size_t) _mm_cvtsi128_si64(half)
+                   + (size_t) _mm_cvtsi128_si64(_mm_unpackhi_epi64(half, half));
+    return count + utf8_cp_count_scalar(s + i, len - i);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static size_t utf8_cp_count_avx512(const uint8_t* s, size_t len) {
+    const __m512i threshold = _mm512_set1_epi8(-65);
+    size_t count = 0;
+
+    size_t i = 0;
+    for (; i + 64 <= len; i += 64) {
+        __m512i x = _mm512_loadu_si512((const void*) (s + i));
+        count += (size_t) __builtin_popcountll(_mm512_cmpgt_epi8_mask(x, threshold));
+    }
+
+    // The tail is a masked load; masked-off bytes are never touched
+    if (i < len) {
+        __mmask64 tail = (1ULL << (len - i)) - 1;
+        __m512i x = _mm512_maskz_loadu_epi8(tail, (const void*) (s + i));
+        count += (size_t) __builtin_popcountll(_mm512_mask_cmpgt_epi8_mask(tail, x, threshold));
     }
 
     return count;
 }
+#endif  // UTF8_SIMD_X86
+
+int64_t utf8_cp_count_fast(UTF8View view) {
+    if (!view.ptr) {
+        return -1;
+    }
+
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+            return (int64_t) utf8_cp_count_avx512(view.ptr, view.len);
+        case UTF8_SIMD_AVX2:
+            return (int64_t) utf8_cp_count_avx2(view.ptr, view.len);
+        case UTF8_SIMD_SSSE3:
+        case UTF8_SIMD_SSE2:
+            return (int64_t) utf8_cp_count_sse2(view.ptr, view.len);
+#endif
+        default:
+            return (int64_t) utf8_cp_count_scalar(view.ptr, view.len);
+    }
+}
+
+// Validates and counts in one pass over the input.
+int64_t utf8_cp_count_view(UTF8View view) {
+    if (!view.ptr) {
+        return -1;  // Invalid string
+    }
+
+    size_t count = 0;
+    if (utf8_validate_count(view, &count).error != UTF8_ERROR_NONE) {
+        return -1;
+    }
+
+    return (int64_t) count;
+}
+
+int64_t utf8_cp_count(const uint8_t* start) {
+    return utf8_cp_count_view(utf8_view(start));
+}
 
 uint8_t* utf8_cp_copy(const uint8_t* start) {
     int8_t width = utf8_cp_width((const uint8_t*) start);
@@ -191,12 +375,9 @@ uint8_t* utf8_cp_index(const uint8_t* start, uint32_t index) {
     const uint8_t* dst = start;
 
     while (*dst) {
-        if (!utf8_cp_is_valid(dst)) {
-            return NULL;  // invalid sequence
-        }
-
         // -1 on error, else a valid width
-        int8_t width = utf8_cp_width(dst);
+        int32_t cp;
+        int8_t width = utf8_cp_decode_dfa(dst, NULL, &cp);
         if (-1 == width) {
             return NULL;  // invalid sequence
         }
@@ -215,12 +396,9 @@ uint8_t* utf8_cp_index(const uint8_t* start, uint32_t index) {
 void utf8_cp_dump(const uint8_t* start) {
     size_t i = 0;
     while (start[i]) {
-        int8_t width = utf8_cp_width(&start[i]);
+        int32_t cp;
+        int8_t width = utf8_cp_decode_dfa(&start[i], NULL, &cp);
         if (-1 == width) {
-            fprintf(stderr, "Invalid byte width detected!\n");
-            break;
-        }
-        if (!utf8_cp_is_valid(&start[i])) {
             fprintf(stderr, "Invalid byte detected!\n");
             break;
         }
@@ -237,128 +415,75 @@ void utf8_cp_dump(const uint8_t* start) {
 
 // --- UTF-8 Codepoint Types ---
 
-bool utf8_cp_is_char(const uint8_t* start) {
-    if (!utf8_cp_is_valid(start)) {
-        return false;
-    }
-
-    int32_t codepoint = utf8_cp_decode(start);
-    if (-1 == codepoint) {
-        return false;
+/**
+ * @note Two-stage lookup into the generated property tables (see unicode/property.py):
+ *       stage 1 maps each 256-codepoint block to a deduplicated block in stage 2, which
+ *       holds one byte per codepoint (category | White_Space). Block 0 is always the
+ *       first block in stage 2, so U+0000..U+00FF index it directly.
+ */
+static inline uint8_t utf8_cp_property(uint32_t cp) {
+    if (cp < 0x100) {
+        return utf8_property_stage2[cp];
     }
-
-    if (codepoint < 0x20 || (codepoint >= 0x80 && codepoint <= 0x9F) || codepoint > 0x03FF) {
-        return false;
+    if (cp > 0x10FFFF) {
+        return UTF8_GC_CN;
     }
 
-    return true;
+    uint32_t block = utf8_property_stage1[cp >> UTF8_PROPERTY_SHIFT];
+    return utf8_property_stage2[(block << UTF8_PROPERTY_SHIFT) | (cp & 0xFF)];
 }
 
-bool utf8_cp_is_digit(const uint8_t* start) {
-    if (!utf8_cp_is_valid(start)) {
-        return false;
-    }
-
-    int32_t codepoint = utf8_cp_decode(start);
-    if (-1 == codepoint) {
-        return false;
+// Property byte of the codepoint at start; invalid sequences read as unassigned
+static inline uint8_t utf8_cp_property_at(const uint8_t* start) {
+    int32_t codepoint;
+    if (!start || utf8_cp_decode_dfa(start, NULL, &codepoint) < 1) {
+        return UTF8_GC_CN;
     }
 
-    if (codepoint < 0x30 || codepoint > 0x39) {
-        return false;
-    }
+    return utf8_cp_property((uint32_t) codepoint);
+}
 
-    return true;
+static inline bool utf8_cp_property_in(const uint8_t* start, uint32_t mask) {
+    uint8_t property = utf8_cp_property_at(start);
+    return (1u << (property & UTF8_PROPERTY_CATEGORY)) & mask;
 }
 
-bool utf8_cp_is_alpha(const uint8_t* start) {
-    if (!utf8_cp_is_valid(start)) {
-        return false;
-    }
+UTF8GeneralCategory utf8_cp_category(uint32_t cp) {
+    return (UTF8GeneralCategory) (utf8_cp_property(cp) & UTF8_PROPERTY_CATEGORY);
+}
 
-    int32_t codepoint = utf8_cp_decode(start);
-    if (-1 == codepoint) {
-        return false;
-    }
+bool utf8_cp_is_char(const uint8_t* start) {
+    // Any assigned codepoint other than controls (surrogates never decode)
+    return utf8_cp_property_in(start, ~((1u << UTF8_GC_CN) | (1u << UTF8_GC_CC)));
+}
 
-    if ((codepoint >= 0x41 && codepoint <= 0x5A) || (codepoint >= 0x61 && codepoint <= 0x7A)) {
-        return true;
-    }
+bool utf8_cp_is_digit(const uint8_t* start) {
+    return utf8_cp_property_in(start, 1u << UTF8_GC_ND);
+}
 
-    return false;
+bool utf8_cp_is_alpha(const uint8_t* start) {
+    return utf8_cp_property_in(start, UTF8_GC_MASK_LETTER);
 }
 
 bool utf8_cp_is_alnum(const uint8_t* start) {
-    return utf8_cp_is_alpha(start) || utf8_cp_is_digit(start);
+    return utf8_cp_property_in(start, UTF8_GC_MASK_LETTER | (1u << UTF8_GC_ND));
 }
 
 bool utf8_cp_is_upper(const uint8_t* start) {
-    if (!utf8_cp_is_valid(start)) {
-        return false;
-    }
-
-    int32_t codepoint = utf8_cp_decode(start);
-    if (-1 == codepoint) {
-        return false;
-    }
-
-    return (codepoint >= 0x41 && codepoint <= 0x5A);
+    return utf8_cp_property_in(start, (1u << UTF8_GC_LU) | (1u << UTF8_GC_LT));
 }
 
 bool utf8_cp_is_lower(const uint8_t* start) {
-    if (!utf8_cp_is_valid(start)) {
-        return false;
-    }
-
-    int32_t codepoint = utf8_cp_decode(start);
-    if (-1 == codepoint) {
-        return false;
-    }
-
-    return (codepoint >= 0x61 && codepoint <= 0x7A);
+    return utf8_cp_property_in(start, 1u << UTF8_GC_LL);
 }
 
 bool utf8_cp_is_space(const uint8_t* start) {
-    if (!utf8_cp_is_valid(start)) {
-        return false;
-    }
-
-    int32_t codepoint = utf8_cp_decode(start);
-    if (-1 == codepoint) {
-        return false;
-    }
-
-    switch (codepoint) {
-        case 0x20:  // ' '
-        case 0x09:  // '\t'
-        case 0x0A:  // '\n'
-        case 0x0D:  // '\r'
-            return true;
-        default:
-            return false;
-    }
+    return utf8_cp_property_at(start) & UTF8_PROPERTY_WHITE_SPACE;
 }
 
 bool utf8_cp_is_punct(const uint8_t* start) {
-    if (!utf8_cp_is_valid(start)) {
-        return false;
-    }
-
-    int32_t codepoint = utf8_cp_decode(start);
-    if (-1 == codepoint) {
-        return false;
-    }
-
-    // Punctuation ranges and single points (based on ASCII table)
-    if ((codepoint >= 0x21 && codepoint <= 0x2F) ||  // !"#$%&'()*+,-./
-        (codepoint >= 0x3A && codepoint <= 0x3F) ||  // :;<=>?@
-        (codepoint >= 0x5B && codepoint <= 0x5D) ||  // [\]
-        (codepoint == 0x5F) ||  // _
-        (codepoint >= 0x7B && codepoint <= 0x7E)) {  // {|}~
-        return true;
-    }
-
-    return false;
+    // Punctuation and symbols, which matches ispunct() over ASCII
+    return utf8_cp_property_in(start, UTF8_GC_MASK_PUNCT | UTF8_GC_MASK_SYMBOL);
 }
 
 // --- UTF-8 Codepoint Visitor ---
@@ -368,8 +493,9 @@ const uint8_t* utf8_cp_next(const uint8_t* current) {
         return NULL;
     }
 
-    const int8_t width = utf8_cp_width(current);
-    if (width < 1 || !utf8_cp_is_valid(current)) {
+    int32_t cp;
+    const int8_t width = utf8_cp_decode_dfa(current, NULL, &cp);
+    if (width < 1) {
         return NULL;
     }
 
@@ -382,8 +508,9 @@ const uint8_t* utf8_cp_next_width(const uint8_t* current, int8_t* out_width) {
         return NULL;
     }
 
-    int8_t width = utf8_cp_width(current);
-    if (-1 == width || !utf8_cp_is_valid(current)) {
+    int32_t cp;
+    int8_t width = utf8_cp_decode_dfa(current, NULL, &cp);
+    if (-1 == width) {
         *out_width = -1;
         return current + 1;  // Skip bad byte
     }
@@ -392,21 +519,28 @@ const uint8_t* utf8_cp_next_width(const uint8_t* current, int8_t* out_width) {
     return current + width;
 }
 
+// Finds the sequence ending at current: back over at most three continuation bytes to
+// the lead, then one pass through the DFA. Returns NULL if no valid sequence ends there.
+static inline const uint8_t* utf8_cp_lead_before(
+    const uint8_t* start, const uint8_t* current, int8_t* width, int32_t* cp
+) {
+    const uint8_t* lead = current - 1;
+    while (lead > start && current - lead < 4 && (*lead & 0xC0) == 0x80) {
+        lead--;
+    }
+
+    *width = utf8_cp_decode_dfa(lead, current, cp);
+    return *width > 0 && lead + *width == current ? lead : NULL;
+}
+
 const uint8_t* utf8_cp_prev(const uint8_t* start, const uint8_t* current) {
     if (!start || !current || current <= start) {
         return NULL;
     }
 
-    // Walk backwards at most 3 bytes to locate lead byte
-    const uint8_t* prev = current - 1;
-    for (int i = 0; i < 4 && prev >= start; ++i, --prev) {
-        int8_t width = utf8_cp_width(prev);
-        if (width > 0 && prev + width == current && utf8_cp_is_valid(prev)) {
-            return prev;
-        }
-    }
-
-    return NULL;
+    int8_t width;
+    int32_t cp;
+    return utf8_cp_lead_before(start, current, &width, &cp);
 }
 
 const uint8_t* utf8_cp_prev_width(
@@ -416,24 +550,12 @@ const uint8_t* utf8_cp_prev_width(
         return NULL;
     }
 
-    // Walk backwards at most 3 bytes to locate lead byte
-    const uint8_t* prev = current - 1;
-    for (int i = 0; i < 4 && prev >= start; ++i, --prev) {
-        int8_t width = utf8_cp_width(prev);
-
-        if (1 > width) {
-            continue;  // Not a valid lead byte
-        }
-
-        // Check if this forms a valid sequence ending exactly at current
-        if (prev + width == current && utf8_cp_is_valid(prev)) {
-            *out_width = width;
-            return prev;
-        }
+    int32_t cp;
+    const uint8_t* prev = utf8_cp_lead_before(start, current, out_width, &cp);
+    if (!prev) {
+        *out_width = -1;
     }
-
-    *out_width = -1;
-    return NULL;
+    return prev;
 }
 
 const uint8_t* utf8_cp_peek(const uint8_t* current, const size_t ahead) {
@@ -444,77 +566,458 @@ const uint8_t* utf8_cp_peek(const uint8_t* current, const size_t ahead) {
     return ptr;
 }
 
+/**
+ * @note The retreat kernels step back over whole blocks while a block holds fewer lead
+ *       bytes than the codepoints still to go, and leave the block that holds the
+ *       target to the byte loop in utf8_cp_retreat. Lead bytes are found as in
+ *       utf8_cp_count_fast.
+ */
+static const uint8_t* utf8_cp_retreat_scalar(
+    const uint8_t* start, const uint8_t* p, size_t* n
+) {
+    while (p - start >= 8) {
+        uint64_t word;
+        memcpy(&word, p - 8, sizeof(word));
+        size_t continuations = (size_t) __builtin_popcountll(
+            word & ~(word << 1) & 0x8080808080808080ULL
+        );
+        size_t leads = 8 - continuations;
+        if (leads >= *n) {
+            break;
+        }
+        *n -= leads;
+        p -= 8;
+    }
+    return p;
+}
+
+#if UTF8_SIMD_X86
+__attribute__((target("sse2")))
+static const uint8_t* utf8_cp_retreat_sse2(const uint8_t* start, const uint8_t* p, size_t* n) {
+    const __m128i threshold = _mm_set1_epi8(-65);
+    while (p - start >= 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*) (p - 16));
+        size_t leads = (size_t) __builtin_popcount(
+            (unsigned) _mm_movemask_epi8(_mm_cmpgt_epi8(x, threshold))
+        );
+        if (leads >= *n) {
+            break;
+        }
+        *n -= leads;
+        p -= 16;
+    }
+    return utf8_cp_retreat_scalar(start, p, n);
+}
+
+__attribute__((target("avx2")))
+static const uint8_t* utf8_cp_retreat_avx2(const uint8_t* start, const uint8_t* p, size_t* n) {
+    const __m256i threshold = _mm256_set1_epi8(-65);
+    while (p - start >= 32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*) (p - 32));
+        size_t leads = (size_t) __builtin_popcount(
+            (unsigned) _mm256_movemask_epi8(_mm256_cmpgt_epi8(x, threshold))
+        );
+        if (leads >= *n) {
+            break;
+        }
+        *n -= leads;
+        p -= 32;
+    }
+    return utf8_cp_retreat_sse2(start, p, n);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static const uint8_t* utf8_cp_retreat_avx512(
+    const uint8_t* start, const uint8_t* p, size_t* n
+) {
+    const __m512i threshold = _mm512_set1_epi8(-65);
+    while (p - start >= 64) {
+        __m512i x = _mm512_loadu_si512((const void*) (p - 64));
+        size_t leads = (size_t) __builtin_popcountll(_mm512_cmpgt_epi8_mask(x, threshold));
+        if (leads >= *n) {
+            break;
+        }
+        *n -= leads;
+        p -= 64;
+    }
+    return utf8_cp_retreat_avx2(start, p, n);
+}
+#endif  // UTF8_SIMD_X86
+
+const uint8_t* utf8_cp_retreat(const uint8_t* start, const uint8_t* current, size_t n) {
+    if (!start || !current || current < start) {
+        return NULL;
+    }
+
+    const uint8_t* p = current;
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+            p = utf8_cp_retreat_avx512(start, p, &n);
+            break;
+        case UTF8_SIMD_AVX2:
+            p = utf8_cp_retreat_avx2(start, p, &n);
+            break;
+        case UTF8_SIMD_SSSE3:
+        case UTF8_SIMD_SSE2:
+            p = utf8_cp_retreat_sse2(start, p, &n);
+            break;
+#endif
+        default:
+            p = utf8_cp_retreat_scalar(start, p, &n);
+            break;
+    }
+
+    // At most one block's worth of bytes remains to the target
+    while (n && p > start) {
+        p--;
+        n -= (*p & 0xC0) != 0x80;
+    }
+
+    return n ? NULL : p;
+}
+
+// --- UTF-8 Codepoint Cursor ---
+
+UTF8CpCursor utf8_cp_cursor(const uint8_t* start) {
+    return (UTF8CpCursor) {
+        .start = start,
+        .current = start,
+        .end = NULL,
+    };
+}
+
+UTF8CpCursor utf8_cp_cursor_view(UTF8View view) {
+    return (UTF8CpCursor) {
+        .start = view.ptr,
+        .current = view.ptr,
+        .end = view.ptr ? view.ptr + view.len : NULL,
+    };
+}
+
+UTF8CpCursor utf8_cp_cursor_view_end(UTF8View view) {
+    UTF8CpCursor cursor = utf8_cp_cursor_view(view);
+    cursor.current = cursor.end;
+    return cursor;
+}
+
+UTF8CpRef utf8_cp_cursor_next(UTF8CpCursor* cursor) {
+    if (!cursor || !cursor->current) {
+        return (UTF8CpRef) {NULL, -1, -1};
+    }
+
+    const uint8_t* ptr = cursor->current;
+    // Bounded cursors stop at end; unbounded ones at the null terminator
+    if (cursor->end ? ptr >= cursor->end : !*ptr) {
+        return (UTF8CpRef) {ptr, 0, -1};
+    }
+
+    UTF8CpRef ref = {ptr, 1, *ptr};
+    if (*ptr >= 0x80) {
+        ref.width = utf8_cp_decode_dfa(ptr, cursor->end, &ref.cp);
+        if (ref.width < 1) {
+            return (UTF8CpRef) {ptr, -1, -1};
+        }
+    }
+
+    cursor->current = ptr + ref.width;
+    return ref;
+}
+
+UTF8CpRef utf8_cp_cursor_prev(UTF8CpCursor* cursor) {
+    if (!cursor || !cursor->current || !cursor->start) {
+        return (UTF8CpRef) {NULL, -1, -1};
+    }
+
+    const uint8_t* ptr = cursor->current;
+    if (ptr <= cursor->start) {
+        return (UTF8CpRef) {ptr, 0, -1};
+    }
+    if (ptr[-1] < 0x80) {
+        cursor->current = ptr - 1;
+        return (UTF8CpRef) {ptr - 1, 1, ptr[-1]};
+    }
+
+    UTF8CpRef ref;
+    ref.ptr = utf8_cp_lead_before(cursor->start, ptr, &ref.width, &ref.cp);
+    if (!ref.ptr) {
+        return (UTF8CpRef) {ptr, -1, -1};
+    }
+
+    cursor->current = ref.ptr;
+    return ref;
+}
+
 // --- UTF-8 Codepoint Iterator ---
 
 UTF8CpIter utf8_cp_iter(const uint8_t* start) {
     return (UTF8CpIter) {
         .current = start,
+        .end = NULL,
+        .buffer = {0},
+    };
+}
+
+UTF8CpIter utf8_cp_iter_view(UTF8View view) {
+    return (UTF8CpIter) {
+        .current = view.ptr,
+        .end = view.ptr ? view.ptr + view.len : NULL,
         .buffer = {0},
     };
 }
 
 const char* utf8_cp_iter_next(UTF8CpIter* it) {
-    if (!it || !it->current || !*it->current) {
+    if (!it) {
         return NULL;
     }
 
-    int8_t width = utf8_cp_width(it->current);
-    if (-1 == width || !utf8_cp_is_valid(it->current)) {
-        return NULL; // invalid or corrupt
+    UTF8CpCursor cursor = {it->current, it->current, it->end};
+    UTF8CpRef ref = utf8_cp_cursor_next(&cursor);
+    if (ref.width < 1) {
+        return NULL;  // end of input, or invalid or corrupt
     }
 
     // Copy this codepoint into buffer
-    for (int i = 0; i < width; i++) {
-        it->buffer[i] = (char) it->current[i];
-    }
-    it->buffer[width] = '\0'; // null terminate
+    memcpy(it->buffer, ref.ptr, (size_t) ref.width);
+    it->buffer[ref.width] = '\0';  // null terminate
 
-    it->current += width; // advance current position
+    it->current = cursor.current;  // advance current position
     return it->buffer;
 }
 
-// --- UTF-8 Codepoint Split ---
+// --- UTF-8 Codepoint Index ---
 
-uint8_t** utf8_cp_split(const uint8_t* start, size_t* capacity) {
-    if (!start || !capacity) {
-        return NULL;
+// One bit per byte of a 64-byte block, set for bytes that start a codepoint
+typedef uint64_t (*UTF8LeadMaskFn)(const uint8_t* s);
+
+static uint64_t utf8_cp_lead_mask_scalar(const uint8_t* s) {
+    uint64_t mask = 0;
+    for (int i = 0; i < 64; i += 8) {
+        uint64_t word;
+        memcpy(&word, s + i, sizeof(word));
+        // High bit of each lead byte, gathered into the top byte by the multiply
+        uint64_t leads = (~(word & ~(word << 1)) & 0x8080808080808080ULL) >> 7;
+        mask |= ((leads * 0x0102040810204080ULL) >> 56) << i;
     }
+    return mask;
+}
 
-    *capacity = 0;
-    uint8_t** parts = calloc(1, sizeof(char*));
-    const uint8_t* stream = (const uint8_t*) start;
+#if UTF8_SIMD_X86
+__attribute__((target("sse2")))
+static uint64_t utf8_cp_lead_mask_sse2(const uint8_t* s) {
+    const __m128i threshold = _mm_set1_epi8(-65);
+    uint64_t mask = 0;
+    for (int i = 0; i < 64; i += 16) {
+        __m128i x = _mm_loadu_si128((const __m128i*) (s + i));
+        mask |= (uint64_t) (uint16_t) _mm_movemask_epi8(_mm_cmpgt_epi8(x, threshold)) << i;
+    }
+    return mask;
+}
 
-    while (*stream) {
-        int8_t width = utf8_cp_width(stream);
-        if (-1 == width) {
-            goto fail;
+__attribute__((target("avx2")))
+static uint64_t utf8_cp_lead_mask_avx2(const uint8_t* s) {
+    const __m256i threshold = _mm256_set1_epi8(-65);
+    __m256i lo = _mm256_loadu_si256((const __m256i*) s);
+    __m256i hi = _mm256_loadu_si256((const __m256i*) (s + 32));
+    uint32_t lo_mask = (uint32_t) _mm256_movemask_epi8(_mm256_cmpgt_epi8(lo, threshold));
+    uint32_t hi_mask = (uint32_t) _mm256_movemask_epi8(_mm256_cmpgt_epi8(hi, threshold));
+    return (uint64_t) lo_mask | ((uint64_t) hi_mask << 32);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static uint64_t utf8_cp_lead_mask_avx512(const uint8_t* s) {
+    __m512i x = _mm512_loadu_si512((const void*) s);
+    return _mm512_cmpgt_epi8_mask(x, _mm512_set1_epi8(-65));
+}
+#endif  // UTF8_SIMD_X86
+
+static UTF8LeadMaskFn utf8_cp_lead_mask_fn(void) {
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+            return utf8_cp_lead_mask_avx512;
+        case UTF8_SIMD_AVX2:
+            return utf8_cp_lead_mask_avx2;
+        case UTF8_SIMD_SSSE3:
+        case UTF8_SIMD_SSE2:
+            return utf8_cp_lead_mask_sse2;
+#endif
+        default:
+            return utf8_cp_lead_mask_scalar;
+    }
+}
+
+// Lead mask of the block at s[0..len), padding a short final block so no read
+// goes past the text.
+static uint64_t utf8_cp_lead_mask(UTF8LeadMaskFn fn, const uint8_t* s, size_t len) {
+    if (len >= 64) {
+        return fn(s);
+    }
+
+    uint8_t block[64] = {0};
+    memcpy(block, s, len);
+    return fn(block) & ((1ULL << len) - 1);
+}
+
+// Position of the nth (0-based) set bit in mask; mask must have more than n bits set.
+static inline unsigned utf8_cp_select(uint64_t mask, size_t n) {
+    while (n--) {
+        mask &= mask - 1;
+    }
+    return (unsigned) __builtin_ctzll(mask);
+}
+
+bool utf8_cp_index_init(UTF8CpIndex* index, UTF8View text, size_t stride) {
+    if (!index || !text.ptr) {
+        return false;
+    }
+
+    // Lookups trust the text, so it is validated once here
+    size_t length = 0;
+    if (utf8_validate_count(text, &length).error != UTF8_ERROR_NONE) {
+        return false;
+    }
+
+    stride = stride ? stride : UTF8_CP_INDEX_STRIDE;
+    size_t samples = length / stride + 1;
+    size_t* offsets = malloc(samples * sizeof(size_t));
+    if (!offsets) {
+        return false;
+    }
+
+    // Count lead bytes a block at a time; a block holding the next sample is
+    // searched for that lead's position
+    UTF8LeadMaskFn fn = utf8_cp_lead_mask_fn();
+    size_t k = 0;
+    size_t seen = 0;  // Codepoints before this block
+    for (size_t i = 0; i < text.len && k < samples; i += 64) {
+        uint64_t mask = utf8_cp_lead_mask(fn, text.ptr + i, text.len - i);
+        size_t leads = (size_t) __builtin_popcountll(mask);
+        while (k < samples && k * stride < seen + leads) {
+            offsets[k] = i + utf8_cp_select(mask, k * stride - seen);
+            k++;
         }
+        seen += leads;
+    }
+
+    // Only an empty text (or an exact multiple of stride) leaves a sample at the end
+    for (; k < samples; k++) {
+        offsets[k] = text.len;
+    }
+
+    *index = (UTF8CpIndex) {
+        .text = text,
+        .offsets = offsets,
+        .samples = samples,
+        .stride = stride,
+        .length = length,
+    };
+    return true;
+}
 
-        uint8_t* byte = utf8_cp_copy(stream);
-        if (!byte) {
-            goto fail;
+int64_t utf8_cp_index_offset(const UTF8CpIndex* index, size_t n) {
+    if (!index || !index->offsets || n > index->length) {
+        return -1;
+    }
+    if (n == index->length) {
+        return (int64_t) index->text.len;
+    }
+
+    // Skip whole blocks from the nearest sample, then select within the last one.
+    // A block may start mid-codepoint, so even remaining == 0 selects.
+    size_t pos = index->offsets[n / index->stride];
+    size_t remaining = n % index->stride;
+    UTF8LeadMaskFn fn = utf8_cp_lead_mask_fn();
+    for (;;) {
+        uint64_t mask = utf8_cp_lead_mask(fn, index->text.ptr + pos, index->text.len - pos);
+        size_t leads = (size_t) __builtin_popcountll(mask);
+        if (remaining < leads) {
+            return (int64_t) (pos + utf8_cp_select(mask, remaining));
         }
+        remaining -= leads;
+        pos += 64;
+    }
+}
 
-        uint8_t** temp = realloc(
-            parts,
-            sizeof(uint8_t*) * (*capacity + 1)  // new_size
-        );
+bool utf8_cp_index_at(const UTF8CpIndex* index, size_t n, UTF8CpRef* out) {
+    if (!out || !index || n >= index->length) {
+        return false;
+    }
+
+    const uint8_t* ptr = index->text.ptr + utf8_cp_index_offset(index, n);
+    const uint8_t* end = index->text.ptr + index->text.len;
+    out->ptr = ptr;
+    out->width = utf8_cp_decode_dfa(ptr, end, &out->cp);
+    return true;
+}
+
+void utf8_cp_index_free(UTF8CpIndex* index) {
+    if (index) {
+        free(index->offsets);
+        *index = (UTF8CpIndex) {0};
+    }
+}
+
+// --- UTF-8 Codepoint Split ---
+
+bool utf8_cp_split_spans(UTF8View view, UTF8SpanList* out) {
+    if (!view.ptr || !out) {
+        return false;
+    }
+
+    utf8_span_list_clear(out);
 
-        if (!temp) {
-            free(byte);
-            goto fail;
+    UTF8CpCursor cursor = utf8_cp_cursor_view(view);
+    UTF8CpRef ref;
+    while ((ref = utf8_cp_cursor_next(&cursor)).width > 0) {
+        if (!utf8_span_list_push(out, (size_t) (ref.ptr - view.ptr), (size_t) ref.width)) {
+            return false;
         }
+    }
 
-        parts = temp;
-        parts[(*capacity)++] = byte;
-        stream += width;
+    return ref.width == 0;
+}
+
+uint8_t** utf8_cp_split_view(UTF8View view, size_t* capacity) {
+    if (!view.ptr || !capacity) {
+        return NULL;
+    }
+
+    *capacity = 0;
+    UTF8SpanList list = {0};
+    uint8_t** parts = NULL;
+    if (utf8_cp_split_spans(view, &list)) {
+        parts = utf8_span_copy(view, list.spans, list.count);
+        if (parts) {
+            *capacity = list.count;
+        }
     }
 
+    utf8_span_list_free(&list);
     return parts;
+}
 
-fail:
-    utf8_cp_split_free(parts, *capacity);
-    return NULL;
+uint8_t** utf8_cp_split_arena(UTF8View view, size_t* capacity, UTF8Arena* arena) {
+    if (!view.ptr || !capacity || !arena) {
+        return NULL;
+    }
+
+    *capacity = 0;
+    UTF8SpanList list = {0};
+    uint8_t** parts = NULL;
+    if (utf8_cp_split_spans(view, &list)) {
+        parts = utf8_span_materialize_arena(view, list.spans, list.count, arena);
+        if (parts) {
+            *capacity = list.count;
+        }
+    }
+
+    utf8_span_list_free(&list);
+    return parts;
+}
+
+uint8_t** utf8_cp_split(const uint8_t* start, size_t* capacity) {
+    return utf8_cp_split_view(utf8_view(start), capacity);
 }
 
 void utf8_cp_split_free(uint8_t** parts, size_t capacity) {
@@ -112,78 +112,76 @@ void utf8_gcb_buffer_push(UTF8GraphemeBuffer* gb, uint32_t cp) {
     gb->cp[0] = cp;
 }
 
-int64_t utf8_gcb_count(const char* src) {
-    if (!src) {
+int64_t utf8_gcb_count_view(UTF8View view) {
+    if (!view.ptr) {
         return -1;
     }
 
-    if (!*src) {
-        return 0;
-    }
-
-    const uint8_t* stream = (const uint8_t*) src;
+    UTF8CpCursor cursor = utf8_cp_cursor_view(view);
 
     int64_t count = 0;
     UTF8GraphemeBuffer gb = {0};
     bool first = true;
 
-    while (*stream) {
-        int8_t width = utf8_cp_width(stream);
-        if (-1 == width || !utf8_cp_is_valid(stream)) {
-            return -1;
-        }
-
-        uint32_t cp = utf8_cp_decode(stream);
-        if (first || utf8_gcb_is_break(&gb, cp)) {
+    UTF8CpRef ref;
+    while ((ref = utf8_cp_cursor_next(&cursor)).width > 0) {
+        if (first || utf8_gcb_is_break(&gb, ref.cp)) {
             first = false;
             count++;
         }
 
-        utf8_gcb_buffer_push(&gb, cp);
-        stream += width;
+        utf8_gcb_buffer_push(&gb, (uint32_t) ref.cp);
     }
 
-    return count;
+    return ref.width == 0 ? count : -1;
+}
+
+int64_t utf8_gcb_count(const char* src) {
+    return utf8_gcb_count_view(utf8_view((const uint8_t*) src));
 }
 
 UTF8GraphemeIter utf8_gcb_iter(const char* start) {
     return (UTF8GraphemeIter) {
         .current = start,
+        .end = NULL,
+        .first = true,
+    };
+}
+
+UTF8GraphemeIter utf8_gcb_iter_view(UTF8View view) {
+    return (UTF8GraphemeIter) {
+        .current = (const char*) view.ptr,
+        .end = view.ptr ? (const char*) view.ptr + view.len : NULL,
         .first = true,
     };
 }
 
 const char* utf8_gcb_iter_next(UTF8GraphemeIter* it) {
-    if (!it || !it->current || !*it->current) {
+    if (!it || !it->current) {
         return NULL;
     }
 
     const uint8_t* stream = (const uint8_t*) it->current;
+    UTF8CpCursor cursor = {stream, stream, (const uint8_t*) it->end};
     size_t cluster_len = 0;
-    size_t offset = 0;
 
     memset(it->buffer, 0, UTF8_GCB_SIZE);
 
-    while (stream[offset]) {
-        int8_t width = utf8_cp_width(&stream[offset]);
-        if (width < 1) {
-            break;  // invalid byte
+    while (true) {
+        UTF8CpRef ref = utf8_cp_cursor_next(&cursor);
+        if (ref.width < 1) {
+            break;  // end of input, or invalid or truncated byte sequence
         }
 
-        uint32_t cp = utf8_cp_decode(&stream[offset]);
-        if (offset != 0 && utf8_gcb_is_break(&it->gb, cp)) {
+        if ((cluster_len != 0 && utf8_gcb_is_break(&it->gb, ref.cp))
+            || cluster_len + ref.width >= UTF8_GCB_SIZE) {
+            cursor.current = ref.ptr;  // leave the break (or overflowing codepoint) for next time
             break;
         }
 
-        if (cluster_len + width < UTF8_GCB_SIZE) {
-            memcpy(&it->buffer[cluster_len], &stream[offset], width);
-            cluster_len += width;
-        } else {
-            break;  // overflow and truncate
-        }
-
-        utf8_gcb_buffer_push(&it->gb, cp);
-        offset += width;
+        memcpy(&it->buffer[cluster_len], ref.ptr, (size_t) ref.width);
+        cluster_len += (size_t) ref.width;
+        utf8_gcb_buffer_push(&it->gb, (uint32_t) ref.cp);
     }
 
     if (cluster_len == 0) {
@@ -191,77 +189,93 @@ const char* utf8_gcb_iter_next(UTF8GraphemeIter* it) {
     }
 
     it->buffer[cluster_len] = '\0';
-    it->current += offset;
+    it->current = (const char*) cursor.current;
 
     // end of string
-    if (!*it->current) {
+    if (it->end ? it->current >= it->end : !*it->current) {
         it->current = NULL;
     }
 
     return it->buffer;
 }
 
-char** utf8_gcb_split(const char* src, size_t* capacity) {
-    if (!src || !*src || !capacity) {
-        return NULL;
+bool utf8_gcb_split_spans(UTF8View view, UTF8SpanList* out) {
+    if (!view.ptr || !out) {
+        return false;
     }
 
-    const uint8_t* stream = (const uint8_t*) src;
-
-    // Get the literal byte length
-    size_t len = 0;
-    while (stream[len]) {
-        len++;
-    }
+    utf8_span_list_clear(out);
 
-    *capacity = 0;
-    char** parts = calloc(1, sizeof(char*));
+    size_t len = view.len;
+    UTF8CpCursor cursor = utf8_cp_cursor_view(view);
 
     UTF8GraphemeBuffer gb = {0};
 
     size_t cluster_start = 0;
-    for (size_t i = 0; i < len;) {
-        int8_t width = utf8_cp_width(&stream[i]);
-        if (width < 1) {
-            break;
-        }
-
-        uint32_t curr_cp = utf8_cp_decode(&stream[i]);
-
-        if (i != 0 && utf8_gcb_is_break(&gb, curr_cp)) {
+    UTF8CpRef ref;
+    while ((ref = utf8_cp_cursor_next(&cursor)).width > 0) {
+        size_t i = (size_t) (ref.ptr - view.ptr);
+        if (i != 0 && utf8_gcb_is_break(&gb, ref.cp)) {
             // End of previous cluster
-            size_t cluster_len = i - cluster_start;
-            char* cluster = calloc(cluster_len + 1, sizeof(char));
-            memcpy(cluster, &stream[cluster_start], cluster_len);
-            cluster[cluster_len] = '\0';
-
-            parts = realloc(
-                parts,
-                sizeof(char*) * (*capacity + 1) // new_size
-            );
-            parts[(*capacity)++] = cluster;
+            if (!utf8_span_list_push(out, cluster_start, i - cluster_start)) {
+                return false;
+            }
             cluster_start = i;
         }
 
-        utf8_gcb_buffer_push(&gb, curr_cp);
-        i += width;
+        utf8_gcb_buffer_push(&gb, (uint32_t) ref.cp);
     }
 
-    // Copy final cluster
+    // Record final cluster
     if (cluster_start < len) {
-        size_t cluster_len = len - cluster_start;
-        char* cluster = calloc(cluster_len + 1, sizeof(char));
-        memcpy(cluster, &stream[cluster_start], cluster_len);
-        cluster[cluster_len] = '\0';
-
-        parts = realloc(
-            parts,
-            sizeof(char*) * (*capacity + 1) // new size
-        );
-        parts[(*capacity)++] = cluster;
+        if (!utf8_span_list_push(out, cluster_start, len - cluster_start)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+char** utf8_gcb_split_view(UTF8View view, size_t* capacity) {
+    if (!view.ptr || !view.len || !capacity) {
+        return NULL;
+    }
+
+    *capacity = 0;
+    UTF8SpanList list = {0};
+    uint8_t** parts = NULL;
+    if (utf8_gcb_split_spans(view, &list)) {
+        parts = utf8_span_copy(view, list.spans, list.count);
+        if (parts) {
+            *capacity = list.count;
+        }
     }
 
-    return parts;
+    utf8_span_list_free(&list);
+    return (char**) parts;
+}
+
+char** utf8_gcb_split_arena(UTF8View view, size_t* capacity, UTF8Arena* arena) {
+    if (!view.ptr || !view.len || !capacity || !arena) {
+        return NULL;
+    }
+
+    *capacity = 0;
+    UTF8SpanList list = {0};
+    uint8_t** parts = NULL;
+    if (utf8_gcb_split_spans(view, &list)) {
+        parts = utf8_span_materialize_arena(view, list.spans, list.count, arena);
+        if (parts) {
+            *capacity = list.count;
+        }
+    }
+
+    utf8_span_list_free(&list);
+    return (char**) parts;
+}
+
+char** utf8_gcb_split(const char* src, size_t* capacity) {
+    return utf8_gcb_split_view(utf8_view((const uint8_t*) src), capacity);
 }
 
 void utf8_gcb_split_free(char** parts, size_t capacity) {
@@ -0,0 +1,241 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/interner.c
+ * @brief String interning: maps byte strings to small, stable symbol IDs.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "interner.h"
+
+#define UTF8_INTERNER_MIN_SLOTS 64
+
+// 64x64 -> 128-bit multiply, folded back to 64 bits
+static inline uint64_t utf8_interner_mix(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+    __uint128_t r = (__uint128_t) a * b;
+    return (uint64_t) r ^ (uint64_t) (r >> 64);
+#else
+    // Four 32x32 -> 64-bit partial products (e.g., on 32-bit targets)
+    uint64_t a_lo = (uint32_t) a;
+    uint64_t a_hi = a >> 32;
+    uint64_t b_lo = (uint32_t) b;
+    uint64_t b_hi = b >> 32;
+    uint64_t lo_lo = a_lo * b_lo;
+    uint64_t hi_lo = a_hi * b_lo;
+    uint64_t lo_hi = a_lo * b_hi;
+    uint64_t hi_hi = a_hi * b_hi;
+
+    uint64_t cross = (lo_lo >> 32) + (uint32_t) hi_lo + lo_hi;
+    uint64_t lo = (cross << 32) | (uint32_t) lo_lo;
+    uint64_t hi = hi_hi + (hi_lo >> 32) + (cross >> 32);
+    return lo ^ hi;
+#endif
+}
+
+static inline uint64_t utf8_interner_read64(const uint8_t* p) {
+    uint64_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline uint64_t utf8_interner_read32(const uint8_t* p) {
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+uint64_t utf8_interner_hash(UTF8View view) {
+    const uint64_t k0 = 0xa0761d6478bd642fULL;
+    const uint64_t k1 = 0xe7037ed1a0b428dbULL;
+    const uint64_t k2 = 0x8ebc6af09c88c6e3ULL;
+
+    const uint8_t* p = view.ptr;
+    size_t n = view.len;
+    uint64_t seed = k0 ^ utf8_interner_mix(n, k1);
+
+    // 16 bytes per step; the tail is covered by (possibly overlapping) loads
+    while (n > 16) {
+        seed = utf8_interner_mix(utf8_interner_read64(p) ^ k1, utf8_interner_read64(p + 8) ^ seed);
+        p += 16;
+        n -= 16;
+    }
+
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if (n >= 8) {
+        a = utf8_interner_read64(p);
+        b = utf8_interner_read64(p + n - 8);
+    } else if (n >= 4) {
+        a = utf8_interner_read32(p);
+        b = utf8_interner_read32(p + n - 4);
+    } else if (n > 0) {
+        a = ((uint64_t) p[0] << 16) | ((uint64_t) p[n >> 1] << 8) | p[n - 1];
+    }
+
+    return utf8_interner_mix(k2 ^ view.len, utf8_interner_mix(a ^ k1, b ^ seed));
+}
+
+// Returns the slot holding view, or the empty slot where it belongs.
+static size_t utf8_interner_probe(const UTF8Interner* interner, UTF8View view, uint64_t hash) {
+    size_t mask = interner->slot_count - 1;
+    size_t slot = (size_t) hash & mask;
+
+    for (;;) {
+        uint32_t entry = interner->slots[slot];
+        if (entry == 0) {
+            return slot;
+        }
+
+        const UTF8Symbol* symbol = &interner->symbols[entry - 1];
+        if (symbol->hash == hash && symbol->len == view.len
+            && (view.len == 0
+                || memcmp(interner->strings.data + symbol->offset, view.ptr, view.len) == 0)) {
+            return slot;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+}
+
+// Doubles the table and re-inserts every symbol from its stored hash.
+static bool utf8_interner_grow_slots(UTF8Interner* interner) {
+    size_t slot_count = interner->slot_count ? interner->slot_count * 2 : UTF8_INTERNER_MIN_SLOTS;
+    uint32_t* slots = calloc(slot_count, sizeof(uint32_t));
+    if (!slots) {
+        return false;
+    }
+
+    size_t mask = slot_count - 1;
+    for (size_t i = 0; i < interner->count; i++) {
+        size_t slot = (size_t) interner->symbols[i].hash & mask;
+        while (slots[slot]) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = (uint32_t) i + 1;
+    }
+
+    free(interner->slots);
+    interner->slots = slots;
+    interner->slot_count = slot_count;
+    return true;
+}
+
+static bool utf8_interner_grow_symbols(UTF8Interner* interner) {
+    size_t capacity = interner->capacity ? interner->capacity * 2 : UTF8_INTERNER_MIN_SLOTS / 2;
+    UTF8Symbol* symbols = realloc(interner->symbols, capacity * sizeof(UTF8Symbol));
+    if (!symbols) {
+        return false;
+    }
+
+    interner->symbols = symbols;
+    interner->capacity = capacity;
+    return true;
+}
+
+bool utf8_interner_intern(UTF8Interner* interner, UTF8View view, uint32_t* id) {
+    if (!interner || !id || (!view.ptr && view.len > 0)) {
+        return false;
+    }
+
+    // Keep the load factor at or below one half
+    if ((interner->count + 1) * 2 > interner->slot_count) {
+        if (!utf8_interner_grow_slots(interner)) {
+            return false;
+        }
+    }
+
+    uint64_t hash = utf8_interner_hash(view);
+    size_t slot = utf8_interner_probe(interner, view, hash);
+    if (interner->slots[slot]) {
+        *id = interner->slots[slot] - 1;
+        return true;
+    }
+
+    // UTF8_SYMBOL_NONE is reserved; slots store ID + 1
+    if (interner->count >= UTF8_SYMBOL_NONE - 1) {
+        return false;
+    }
+    if (interner->count == interner->capacity && !utf8_interner_grow_symbols(interner)) {
+        return false;
+    }
+
+    size_t offset = interner->strings.len;
+    if (!utf8_builder_append_bytes(&interner->strings, view.ptr, view.len)
+        || !utf8_builder_append_bytes(&interner->strings, (const uint8_t*) "", 1)) {
+        interner->strings.len = offset;  // Roll back a partial append
+        if (interner->strings.data) {
+            interner->strings.data[offset] = '\0';
+        }
+        return false;
+    }
+
+    interner->symbols[interner->count] = (UTF8Symbol) {
+        .hash = hash,
+        .offset = offset,
+        .len = view.len,
+    };
+    interner->slots[slot] = (uint32_t) interner->count + 1;
+    *id = (uint32_t) interner->count++;
+    return true;
+}
+
+uint32_t utf8_interner_find(const UTF8Interner* interner, UTF8View view) {
+    if (!interner || !interner->slots || (!view.ptr && view.len > 0)) {
+        return UTF8_SYMBOL_NONE;
+    }
+
+    size_t slot = utf8_interner_probe(interner, view, utf8_interner_hash(view));
+    return interner->slots[slot] ? interner->slots[slot] - 1 : UTF8_SYMBOL_NONE;
+}
+
+UTF8View utf8_interner_view(const UTF8Interner* interner, uint32_t id) {
+    if (!interner || id >= interner->count) {
+        return (UTF8View) {0};
+    }
+
+    const UTF8Symbol* symbol = &interner->symbols[id];
+    return utf8_view_n(interner->strings.data + symbol->offset, symbol->len);
+}
+
+const uint8_t* utf8_interner_str(const UTF8Interner* interner, uint32_t id) {
+    if (!interner || id >= interner->count) {
+        return NULL;
+    }
+
+    return interner->strings.data + interner->symbols[id].offset;
+}
+
+size_t utf8_interner_size(const UTF8Interner* interner) {
+    if (!interner) {
+        return 0;
+    }
+
+    return interner->strings.capacity + interner->capacity * sizeof(UTF8Symbol)
+           + interner->slot_count * sizeof(uint32_t);
+}
+
+void utf8_interner_clear(UTF8Interner* interner) {
+    if (!interner) {
+        return;
+    }
+
+    utf8_builder_clear(&interner->strings);
+    if (interner->slots) {
+        memset(interner->slots, 0, interner->slot_count * sizeof(uint32_t));
+    }
+    interner->count = 0;
+}
+
+void utf8_interner_free(UTF8Interner* interner) {
+    if (!interner) {
+        return;
+    }
+
+    utf8_builder_free(&interner->strings);
+    free(interner->symbols);
+    free(interner->slots);
+    *interner = (UTF8Interner) {0};
+}
@@ -0,0 +1,8008 @@
+/**
+ * @warning This file is auto-generated. Do not edit directly.
+ * @brief Normalization (NFC, NFD, NFKC, NFKD) property data.
+ * @ref Unicode UCD - Generated by unicode.normal.py
+ * @version 1
+ * @date 2026-10-17
+ */
+
+#include "normal-data.h"
+
+const uint8_t utf8_normal_stage1[8704] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+    0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+    0x1F, 0x20, 0x21, 0x22, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x25,
+    0x00, 0x26, 0x27, 0x00, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+    0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x00, 0x3B, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x3D, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x41, 0x42, 0x00, 0x43, 0x44, 0x45,
+    0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0x4F, 0x50, 0x51,
+    0x52, 0x53, 0x54, 0x55, 0x00, 0x56, 0x57, 0x58, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59,
+    0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x59, 0x5A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x5B, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x00, 0x00, 0x00, 0x69, 0x00, 0x6A, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6C,
+    0x00, 0x00, 0x00, 0x00, 0x6D, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00, 0x00, 0x70, 0x71, 0x72,
+    0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x00, 0x7A, 0x7B, 0x00, 0x7C, 0x7D, 0x7E, 0x7F, 0x00,
+    0x80, 0x00, 0x81, 0x82, 0x83, 0x84, 0x00, 0x00, 0x7D, 0x00, 0x85, 0x86, 0x00, 0x00, 0x87, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8C, 0x8D, 0x8E, 0x00, 0x00, 0x00, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x97, 0x98, 0x89, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x9A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9B, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0x9E, 0x00, 0x00,
+    0x00, 0x00, 0x9F, 0xA0, 0xA1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const uint16_t utf8_normal_stage2[21504] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0002, 0x0000, 0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0000, 0x0000, 0x0005, 0x0006,
+    0x0007, 0x0008, 0x0000, 0x0000, 0x0009, 0x000A, 0x000B, 0x0000, 0x000C, 0x000D, 0x000E, 0x0000,
+    0x000F, 0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0000, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019,
+    0x001A, 0x001B, 0x001C, 0x001D, 0x0000, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0000,
+    0x0000, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0000, 0x0000, 0x0029, 0x002A, 0x002B, 0x002C,
+    0x002D, 0x002E, 0x0000, 0x002F, 0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0000, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x0000, 0x0000, 0x003E, 0x003F, 0x0040,
+    0x0041, 0x0042, 0x0000, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B,
+    0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0x0053, 0x0000, 0x0000, 0x0054, 0x0055,
+    0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F, 0x0060, 0x0061,
+    0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0000, 0x0000, 0x0068, 0x0069, 0x006A, 0x006B,
+    0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0000, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076,
+    0x0000, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x0000, 0x0000, 0x007F,
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0000, 0x0000, 0x0086, 0x0087, 0x0088, 0x0089,
+    0x008A, 0x008B, 0x0000, 0x0000, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090, 0x0091, 0x0092, 0x0093,
+    0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x0000, 0x0000,
+    0x009E, 0x009F, 0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9,
+    0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00B6, 0x00B7, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00B8,
+    0x00B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00BA, 0x00BB, 0x00BC, 0x00BD,
+    0x00BE, 0x00BF, 0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9,
+    0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF, 0x00D0, 0x00D1, 0x00D2, 0x0000, 0x00D3, 0x00D4,
+    0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x0000, 0x0000, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE,
+    0x00DF, 0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x0000, 0x0000,
+    0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF, 0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4,
+    0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF, 0x0100,
+    0x0101, 0x0102, 0x0103, 0x0104, 0x0105, 0x0106, 0x0107, 0x0108, 0x0109, 0x010A, 0x010B, 0x010C,
+    0x0000, 0x0000, 0x010D, 0x010E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x010F, 0x0110,
+    0x0111, 0x0112, 0x0113, 0x0114, 0x0115, 0x0116, 0x0117, 0x0118, 0x0119, 0x011A, 0x011B, 0x011C,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x011D, 0x011E, 0x011F, 0x0120, 0x0121, 0x0122, 0x0123, 0x0124,
+    0x0125, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0126, 0x0127, 0x0128, 0x0129,
+    0x012A, 0x012B, 0x0000, 0x0000, 0x012C, 0x012D, 0x00B5, 0x012E, 0x012F, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0130, 0x0130, 0x0130, 0x0130, 0x0130, 0x0131, 0x0130, 0x0130, 0x0130, 0x0130, 0x0130, 0x0130,
+    0x0130, 0x0131, 0x0131, 0x0130, 0x0131, 0x0130, 0x0131, 0x0130, 0x0130, 0x0132, 0x0133, 0x0133,
+    0x0133, 0x0133, 0x0132, 0x0134, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0135, 0x0135, 0x0136,
+    0x0136, 0x0136, 0x0136, 0x0137, 0x0137, 0x0133, 0x0133, 0x0133, 0x0133, 0x0136, 0x0136, 0x0133,
+    0x0136, 0x0136, 0x0133, 0x0133, 0x0138, 0x0138, 0x0138, 0x0138, 0x0139, 0x0133, 0x0133, 0x0133,
+    0x0133, 0x0131, 0x0131, 0x0131, 0x013A, 0x013B, 0x0130, 0x013C, 0x013D, 0x013E, 0x0131, 0x0133,
+    0x0133, 0x0133, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0000, 0x0131, 0x0131, 0x0131, 0x0133,
+    0x0133, 0x0133, 0x0133, 0x0131, 0x0132, 0x0133, 0x0133, 0x0131, 0x013F, 0x0140, 0x0140, 0x013F,
+    0x0140, 0x0140, 0x013F, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0141, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0142, 0x0000, 0x0000, 0x0000, 0x0143, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0007, 0x0144, 0x0145, 0x0146, 0x0147, 0x0148, 0x0149, 0x0000, 0x014A, 0x0000, 0x014B, 0x014C,
+    0x014D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x014E, 0x014F, 0x0150, 0x0151, 0x0152, 0x0153, 0x0154, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0155, 0x0156,
+    0x0157, 0x0158, 0x0159, 0x0000, 0x015A, 0x015B, 0x015C, 0x015D, 0x015E, 0x015F, 0x0160, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0161, 0x0162, 0x0163, 0x0000, 0x0164, 0x0165, 0x0000, 0x0000, 0x0000, 0x0166, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0167, 0x0168, 0x0000, 0x0169, 0x0000, 0x0000, 0x0000, 0x016A,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x016B, 0x016C, 0x016D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x016E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x016F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0170, 0x0171, 0x0000, 0x0172, 0x0000, 0x0000, 0x0000, 0x0173, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0174, 0x0175, 0x0176, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0177, 0x0178, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0179, 0x017A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x017B, 0x017C, 0x017D, 0x017E,
+    0x0000, 0x0000, 0x017F, 0x0180, 0x0000, 0x0000, 0x0181, 0x0182, 0x0183, 0x0184, 0x0185, 0x0186,
+    0x0000, 0x0000, 0x0187, 0x0188, 0x0189, 0x018A, 0x018B, 0x018C, 0x0000, 0x0000, 0x018D, 0x018E,
+    0x018F, 0x0190, 0x0191, 0x0192, 0x0193, 0x0194, 0x0195, 0x0196, 0x0197, 0x0198, 0x0000, 0x0000,
+    0x0199, 0x019A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x019B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0131, 0x019C, 0x0133,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133,
+    0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x019C, 0x019D, 0x0131, 0x019E, 0x019F, 0x01A0, 0x01A1,
+    0x01A2, 0x01A3, 0x01A4, 0x01A5, 0x01A6, 0x01A7, 0x01A7, 0x01A8, 0x01A9, 0x01AA, 0x0000, 0x01AB,
+    0x0000, 0x01AC, 0x01AD, 0x0000, 0x0131, 0x0133, 0x0000, 0x01A6, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x01AE, 0x01AF, 0x01B0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01B1, 0x01B2, 0x01B3, 0x01B4, 0x01B5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01B6, 0x01B7, 0x01B8, 0x01AE, 0x01AF,
+    0x01B0, 0x01B9, 0x01BA, 0x0130, 0x0130, 0x0136, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0133, 0x0131, 0x0131, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01BB, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01BC, 0x01BD, 0x01BE, 0x01BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01C0, 0x0000, 0x01C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C2,
+    0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0000, 0x0000, 0x0131, 0x0131, 0x0000, 0x0133, 0x0131,
+    0x0131, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0133, 0x0131, 0x0131,
+    0x0133, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0131, 0x0133, 0x0133, 0x0131, 0x0133, 0x0131,
+    0x0131, 0x0131, 0x0133, 0x0131, 0x0133, 0x0131, 0x0133, 0x0131, 0x0133, 0x0131, 0x0131, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0000, 0x0131, 0x0131, 0x0131, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0133, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0133, 0x0133, 0x0133,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0133,
+    0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133,
+    0x01B6, 0x01B7, 0x01B8, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0133, 0x0133, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C4, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C5, 0x0000, 0x0000, 0x01C6, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000,
+    0x0000, 0x0131, 0x0133, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x01C9, 0x01CA, 0x01CB, 0x01CC,
+    0x01CD, 0x01CE, 0x01CF, 0x01D0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01D1, 0x0000, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01D3, 0x01D4, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D5, 0x01D6, 0x0000, 0x01D7,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D8,
+    0x0000, 0x0000, 0x01D9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01DA, 0x01DB, 0x01DC, 0x0000, 0x0000, 0x01DD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01D1, 0x0000, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01DE, 0x0000, 0x0000, 0x01DF, 0x01E0, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01D2, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E1, 0x01E2, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01E3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D2, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E4, 0x01E5,
+    0x01E6, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D2,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01E7, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01E8, 0x01E9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01D1, 0x0000, 0x0000, 0x0000, 0x01EA, 0x0000, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x01EB,
+    0x01EC, 0x0000, 0x01ED, 0x01EE, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01D2, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x01C8, 0x0000, 0x01D2, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01EF, 0x01F0,
+    0x01F1, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D2,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01F2, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D2,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01F3, 0x0000,
+    0x01F4, 0x01F5, 0x01F6, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01F7, 0x0000, 0x0000, 0x0000, 0x0000, 0x01F8, 0x01F8, 0x01C8, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01F9, 0x01F9, 0x01F9, 0x01F9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FA,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01FB, 0x01FB, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01FC, 0x01FC, 0x01FC, 0x01FC,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01FD, 0x01FE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01FF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0000, 0x0133,
+    0x0000, 0x0200, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0201,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0202, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0203, 0x0000, 0x0000, 0x0000, 0x0000, 0x0204, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0205, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0206, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0207, 0x0208, 0x0209,
+    0x020A, 0x020B, 0x020C, 0x020D, 0x020E, 0x020F, 0x0208, 0x0208, 0x0208, 0x0208, 0x0000, 0x0000,
+    0x0208, 0x0210, 0x0131, 0x0131, 0x01C8, 0x0000, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0211, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0212, 0x0000, 0x0000, 0x0000, 0x0000, 0x0213, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0214, 0x0000, 0x0000, 0x0000, 0x0000, 0x0215, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0216, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0217, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01D1, 0x0000, 0x01C8, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0218, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2,
+    0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2,
+    0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2, 0x01D2,
+    0x01D2, 0x01D2, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x01C8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x019D, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x019C, 0x0131, 0x0133,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0133, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0000, 0x0000, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133,
+    0x0133, 0x0133, 0x0133, 0x0131, 0x0131, 0x0133, 0x0000, 0x0133, 0x0133, 0x0131, 0x0131, 0x0133,
+    0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0219, 0x0000, 0x021A, 0x0000, 0x021B, 0x0000,
+    0x021C, 0x0000, 0x021D, 0x0000, 0x0000, 0x0000, 0x021E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x021F,
+    0x0000, 0x0220, 0x0000, 0x0000, 0x0221, 0x0222, 0x0000, 0x0223, 0x01C8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131,
+    0x0133, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01C8, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01C8, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0000,
+    0x0138, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0133,
+    0x0131, 0x0000, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0000, 0x0000, 0x0000,
+    0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0224, 0x0225, 0x0226, 0x0000, 0x0227, 0x0228, 0x0229, 0x022A,
+    0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0000, 0x0232, 0x0233, 0x0234, 0x0235,
+    0x0236, 0x0237, 0x0238, 0x0003, 0x0239, 0x023A, 0x023B, 0x023C, 0x023D, 0x023E, 0x023F, 0x0240,
+    0x0241, 0x0242, 0x0000, 0x0243, 0x0244, 0x0245, 0x000B, 0x0246, 0x0247, 0x0248, 0x0249, 0x024A,
+    0x024B, 0x024C, 0x024D, 0x024E, 0x024F, 0x015A, 0x0250, 0x0251, 0x015F, 0x0252, 0x0253, 0x0120,
+    0x024B, 0x024E, 0x015A, 0x0250, 0x0162, 0x015F, 0x0252, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0254, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0255, 0x0256, 0x0257, 0x0258, 0x0241,
+    0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F, 0x0260, 0x0261, 0x0262, 0x0263, 0x0264,
+    0x0265, 0x0266, 0x0267, 0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F, 0x0270,
+    0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277, 0x015B, 0x0131, 0x0131, 0x0133, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0131, 0x0140, 0x0278, 0x0133,
+    0x0135, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0132, 0x019D, 0x019D, 0x0133, 0x0279, 0x0131, 0x013F, 0x0133, 0x0131, 0x0133,
+    0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F, 0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285,
+    0x0286, 0x0287, 0x0288, 0x0289, 0x028A, 0x028B, 0x028C, 0x028D, 0x028E, 0x028F, 0x0290, 0x0291,
+    0x0292, 0x0293, 0x0294, 0x0295, 0x0296, 0x0297, 0x0298, 0x0299, 0x029A, 0x029B, 0x029C, 0x029D,
+    0x029E, 0x029F, 0x02A0, 0x02A1, 0x02A2, 0x02A3, 0x02A4, 0x02A5, 0x02A6, 0x02A7, 0x02A8, 0x02A9,
+    0x02AA, 0x02AB, 0x02AC, 0x02AD, 0x02AE, 0x02AF, 0x02B0, 0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5,
+    0x02B6, 0x02B7, 0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF, 0x02C0, 0x02C1,
+    0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7, 0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD,
+    0x02CE, 0x02CF, 0x02D0, 0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7, 0x02D8, 0x02D9,
+    0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF, 0x02E0, 0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5,
+    0x02E6, 0x02E7, 0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF, 0x02F0, 0x02F1,
+    0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7, 0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD,
+    0x02FE, 0x02FF, 0x0300, 0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307, 0x0308, 0x0309,
+    0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F, 0x0310, 0x0311, 0x0312, 0x0313, 0x0314, 0x0315,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0316, 0x0317, 0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D,
+    0x031E, 0x031F, 0x0320, 0x0321, 0x0322, 0x0323, 0x0324, 0x0325, 0x0326, 0x0327, 0x0328, 0x0329,
+    0x032A, 0x032B, 0x032C, 0x032D, 0x032E, 0x032F, 0x0330, 0x0331, 0x0332, 0x0333, 0x0334, 0x0335,
+    0x0336, 0x0337, 0x0338, 0x0339, 0x033A, 0x033B, 0x033C, 0x033D, 0x033E, 0x033F, 0x0340, 0x0341,
+    0x0342, 0x0343, 0x0344, 0x0345, 0x0346, 0x0347, 0x0348, 0x0349, 0x034A, 0x034B, 0x034C, 0x034D,
+    0x034E, 0x034F, 0x0350, 0x0351, 0x0352, 0x0353, 0x0354, 0x0355, 0x0356, 0x0357, 0x0358, 0x0359,
+    0x035A, 0x035B, 0x035C, 0x035D, 0x035E, 0x035F, 0x0360, 0x0361, 0x0362, 0x0363, 0x0364, 0x0365,
+    0x0366, 0x0367, 0x0368, 0x0369, 0x036A, 0x036B, 0x036C, 0x036D, 0x036E, 0x036F, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0370, 0x0371, 0x0372, 0x0373, 0x0374, 0x0375, 0x0376, 0x0377,
+    0x0378, 0x0379, 0x037A, 0x037B, 0x037C, 0x037D, 0x037E, 0x037F, 0x0380, 0x0381, 0x0382, 0x0383,
+    0x0384, 0x0385, 0x0000, 0x0000, 0x0386, 0x0387, 0x0388, 0x0389, 0x038A, 0x038B, 0x0000, 0x0000,
+    0x038C, 0x038D, 0x038E, 0x038F, 0x0390, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397,
+    0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A2, 0x03A3,
+    0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x03AA, 0x03AB, 0x03AC, 0x03AD, 0x03AE, 0x03AF,
+    0x03B0, 0x03B1, 0x0000, 0x0000, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x0000, 0x0000,
+    0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x0000, 0x03C0, 0x0000, 0x03C1,
+    0x0000, 0x03C2, 0x0000, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x03CA, 0x03CB,
+    0x03CC, 0x03CD, 0x03CE, 0x03CF, 0x03D0, 0x03D1, 0x03D2, 0x03D3, 0x03D4, 0x03D5, 0x03D6, 0x03D7,
+    0x03D8, 0x03D9, 0x03DA, 0x03DB, 0x03DC, 0x03DD, 0x03DE, 0x03DF, 0x03E0, 0x03E1, 0x0000, 0x0000,
+    0x03E2, 0x03E3, 0x03E4, 0x03E5, 0x03E6, 0x03E7, 0x03E8, 0x03E9, 0x03EA, 0x03EB, 0x03EC, 0x03ED,
+    0x03EE, 0x03EF, 0x03F0, 0x03F1, 0x03F2, 0x03F3, 0x03F4, 0x03F5, 0x03F6, 0x03F7, 0x03F8, 0x03F9,
+    0x03FA, 0x03FB, 0x03FC, 0x03FD, 0x03FE, 0x03FF, 0x0400, 0x0401, 0x0402, 0x0403, 0x0404, 0x0405,
+    0x0406, 0x0407, 0x0408, 0x0409, 0x040A, 0x040B, 0x040C, 0x040D, 0x040E, 0x040F, 0x0410, 0x0411,
+    0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0000, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C,
+    0x041D, 0x041E, 0x041F, 0x041E, 0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0000, 0x0425, 0x0426,
+    0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F, 0x0430, 0x0431, 0x0432,
+    0x0000, 0x0000, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437, 0x0438, 0x0000, 0x0439, 0x043A, 0x043B,
+    0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+    0x0448, 0x0449, 0x044A, 0x044B, 0x0000, 0x0000, 0x044C, 0x044D, 0x044E, 0x0000, 0x044F, 0x0450,
+    0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457, 0x0000, 0x0458, 0x0459, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x045A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x045B, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x045C, 0x045D, 0x045E, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x045F,
+    0x0460, 0x0000, 0x0461, 0x0462, 0x0000, 0x0000, 0x0000, 0x0000, 0x0463, 0x0000, 0x0464, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0465, 0x0466, 0x0467, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0468,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0469, 0x0253, 0x0000, 0x0000, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0470, 0x0471,
+    0x0472, 0x0473, 0x0474, 0x0475, 0x0469, 0x000A, 0x0005, 0x0006, 0x046A, 0x046B, 0x046C, 0x046D,
+    0x046E, 0x046F, 0x0470, 0x0471, 0x0472, 0x0473, 0x0474, 0x0000, 0x0003, 0x023E, 0x000B, 0x012E,
+    0x023F, 0x011D, 0x0243, 0x012D, 0x0244, 0x0475, 0x0249, 0x00B5, 0x024A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0476, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0131, 0x0131, 0x0138, 0x0138, 0x0131, 0x0131, 0x0131, 0x0131, 0x0138, 0x0138, 0x0138, 0x0131,
+    0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0000, 0x0000, 0x0000, 0x0138, 0x0138, 0x0131,
+    0x0133, 0x0131, 0x0138, 0x0138, 0x0133, 0x0133, 0x0133, 0x0133, 0x0131, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0477, 0x0478, 0x0479, 0x047A, 0x0000, 0x047B, 0x047C, 0x047D, 0x0000, 0x047E, 0x0242, 0x022B,
+    0x022B, 0x022B, 0x011D, 0x047F, 0x022C, 0x022C, 0x022F, 0x012D, 0x0000, 0x0231, 0x0480, 0x0000,
+    0x0000, 0x0234, 0x0481, 0x0235, 0x0235, 0x0235, 0x0000, 0x0000, 0x0482, 0x0483, 0x0484, 0x0000,
+    0x0485, 0x0000, 0x0486, 0x0000, 0x0485, 0x0000, 0x0487, 0x0488, 0x0226, 0x0479, 0x0000, 0x023E,
+    0x0228, 0x0489, 0x0000, 0x0230, 0x000B, 0x048A, 0x048B, 0x048C, 0x048D, 0x0253, 0x0000, 0x048E,
+    0x0160, 0x0250, 0x048F, 0x0490, 0x0491, 0x0000, 0x0000, 0x0000, 0x0000, 0x0227, 0x023D, 0x023E,
+    0x0253, 0x011F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0492, 0x0493, 0x0494, 0x0495,
+    0x0496, 0x0497, 0x0498, 0x0499, 0x049A, 0x049B, 0x049C, 0x049D, 0x049E, 0x049F, 0x04A0, 0x04A1,
+    0x022C, 0x04A2, 0x04A3, 0x04A4, 0x04A5, 0x04A6, 0x04A7, 0x04A8, 0x04A9, 0x04AA, 0x04AB, 0x04AC,
+    0x022F, 0x0479, 0x0227, 0x0230, 0x0253, 0x04AD, 0x04AE, 0x04AF, 0x024E, 0x04B0, 0x04B1, 0x04B2,
+    0x04B3, 0x012E, 0x04B4, 0x04B5, 0x012D, 0x0256, 0x023D, 0x0244, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04B7, 0x04B8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04B9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x04BA, 0x04BB, 0x04BC, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04BD, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x04BE, 0x0000, 0x0000, 0x04BF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x04C0, 0x0000, 0x04C1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x04C2, 0x04C3, 0x0000, 0x04C4, 0x04C5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04C6, 0x0000, 0x0000,
+    0x04C7, 0x0000, 0x0000, 0x04C8, 0x0000, 0x04C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x04CA, 0x0000, 0x04CB, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04CC, 0x04CD, 0x04CE, 0x04CF, 0x04D0, 0x0000, 0x0000,
+    0x04D1, 0x04D2, 0x0000, 0x0000, 0x04D3, 0x04D4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x04D5, 0x04D6, 0x0000, 0x0000, 0x04D7, 0x04D8, 0x0000, 0x0000, 0x04D9, 0x04DA, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04DB, 0x04DC, 0x04DD, 0x04DE,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x04DF, 0x04E0, 0x04E1, 0x04E2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04E3, 0x04E4,
+    0x04E5, 0x04E6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x04E7, 0x04E8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x000A, 0x0005, 0x0006, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E,
+    0x046F, 0x04E9, 0x04EA, 0x04EB, 0x04EC, 0x04ED, 0x04EE, 0x04EF, 0x04F0, 0x04F1, 0x04F2, 0x04F3,
+    0x04F4, 0x04F5, 0x04F6, 0x04F7, 0x04F8, 0x04F9, 0x04FA, 0x04FB, 0x04FC, 0x04FD, 0x04FE, 0x04FF,
+    0x0500, 0x0501, 0x0502, 0x0503, 0x0504, 0x0505, 0x0506, 0x0507, 0x0508, 0x0509, 0x050A, 0x050B,
+    0x050C, 0x050D, 0x050E, 0x050F, 0x0510, 0x0511, 0x0512, 0x0513, 0x0514, 0x0515, 0x0516, 0x0517,
+    0x0518, 0x0519, 0x051A, 0x051B, 0x051C, 0x051D, 0x051E, 0x051F, 0x0520, 0x0521, 0x0522, 0x0523,
+    0x0524, 0x0525, 0x0526, 0x0527, 0x0528, 0x0529, 0x052A, 0x052B, 0x052C, 0x052D, 0x052E, 0x052F,
+    0x0530, 0x0531, 0x0532, 0x0533, 0x0534, 0x0535, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489,
+    0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235,
+    0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0003, 0x023C, 0x0256, 0x023D,
+    0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x000B, 0x0249,
+    0x0538, 0x0120, 0x00B5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0469, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0539, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x053A, 0x053B, 0x053C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x053D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x011F, 0x04A5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131,
+    0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x053E, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x053F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0540, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0541, 0x0542, 0x0543, 0x0544, 0x0545, 0x0546, 0x0547, 0x0548,
+    0x0549, 0x054A, 0x054B, 0x054C, 0x054D, 0x054E, 0x054F, 0x0550, 0x0551, 0x0552, 0x0553, 0x0554,
+    0x0555, 0x0556, 0x0557, 0x0558, 0x0559, 0x055A, 0x055B, 0x055C, 0x055D, 0x055E, 0x055F, 0x0560,
+    0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567, 0x0568, 0x0569, 0x056A, 0x056B, 0x056C,
+    0x056D, 0x056E, 0x056F, 0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577, 0x0578,
+    0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F, 0x0580, 0x0581, 0x0582, 0x0583, 0x0584,
+    0x0585, 0x0586, 0x0587, 0x0588, 0x0589, 0x058A, 0x058B, 0x058C, 0x058D, 0x058E, 0x058F, 0x0590,
+    0x0591, 0x0592, 0x0593, 0x0594, 0x0595, 0x0596, 0x0597, 0x0598, 0x0599, 0x059A, 0x059B, 0x059C,
+    0x059D, 0x059E, 0x059F, 0x05A0, 0x05A1, 0x05A2, 0x05A3, 0x05A4, 0x05A5, 0x05A6, 0x05A7, 0x05A8,
+    0x05A9, 0x05AA, 0x05AB, 0x05AC, 0x05AD, 0x05AE, 0x05AF, 0x05B0, 0x05B1, 0x05B2, 0x05B3, 0x05B4,
+    0x05B5, 0x05B6, 0x05B7, 0x05B8, 0x05B9, 0x05BA, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF, 0x05C0,
+    0x05C1, 0x05C2, 0x05C3, 0x05C4, 0x05C5, 0x05C6, 0x05C7, 0x05C8, 0x05C9, 0x05CA, 0x05CB, 0x05CC,
+    0x05CD, 0x05CE, 0x05CF, 0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7, 0x05D8,
+    0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF, 0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4,
+    0x05E5, 0x05E6, 0x05E7, 0x05E8, 0x05E9, 0x05EA, 0x05EB, 0x05EC, 0x05ED, 0x05EE, 0x05EF, 0x05F0,
+    0x05F1, 0x05F2, 0x05F3, 0x05F4, 0x05F5, 0x05F6, 0x05F7, 0x05F8, 0x05F9, 0x05FA, 0x05FB, 0x05FC,
+    0x05FD, 0x05FE, 0x05FF, 0x0600, 0x0601, 0x0602, 0x0603, 0x0604, 0x0605, 0x0606, 0x0607, 0x0608,
+    0x0609, 0x060A, 0x060B, 0x060C, 0x060D, 0x060E, 0x060F, 0x0610, 0x0611, 0x0612, 0x0613, 0x0614,
+    0x0615, 0x0616, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0279, 0x019D, 0x0132, 0x019C, 0x0617, 0x0617, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0618, 0x0000, 0x0558, 0x0619, 0x061A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x061B, 0x0000, 0x061C, 0x0000, 0x061D, 0x0000, 0x061E, 0x0000, 0x061F, 0x0000, 0x0620, 0x0000,
+    0x0621, 0x0000, 0x0622, 0x0000, 0x0623, 0x0000, 0x0624, 0x0000, 0x0625, 0x0000, 0x0626, 0x0000,
+    0x0000, 0x0627, 0x0000, 0x0628, 0x0000, 0x0629, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x062A, 0x062B, 0x0000, 0x062C, 0x062D, 0x0000, 0x062E, 0x062F, 0x0000, 0x0630, 0x0631, 0x0000,
+    0x0632, 0x0633, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0634, 0x0000, 0x0000, 0x0000, 0x0000, 0x0635, 0x0635, 0x0636, 0x0637, 0x0000, 0x0638, 0x0639,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x063A, 0x0000, 0x063B, 0x0000, 0x063C, 0x0000, 0x063D, 0x0000, 0x063E, 0x0000, 0x063F, 0x0000,
+    0x0640, 0x0000, 0x0641, 0x0000, 0x0642, 0x0000, 0x0643, 0x0000, 0x0644, 0x0000, 0x0645, 0x0000,
+    0x0000, 0x0646, 0x0000, 0x0647, 0x0000, 0x0648, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0649, 0x064A, 0x0000, 0x064B, 0x064C, 0x0000, 0x064D, 0x064E, 0x0000, 0x064F, 0x0650, 0x0000,
+    0x0651, 0x0652, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0653, 0x0000, 0x0000, 0x0654, 0x0655, 0x0656, 0x0657, 0x0000, 0x0000, 0x0000, 0x0658, 0x0659,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x065A, 0x065B, 0x065C, 0x065D, 0x065E, 0x065F, 0x0660, 0x0661, 0x0662, 0x0663, 0x0664,
+    0x0665, 0x0666, 0x0667, 0x0668, 0x0669, 0x066A, 0x066B, 0x066C, 0x066D, 0x066E, 0x066F, 0x0670,
+    0x0671, 0x0672, 0x0673, 0x0674, 0x0675, 0x0676, 0x0677, 0x0678, 0x0679, 0x067A, 0x067B, 0x067C,
+    0x067D, 0x067E, 0x067F, 0x0680, 0x0681, 0x0682, 0x0683, 0x0684, 0x0685, 0x0686, 0x0687, 0x0688,
+    0x0689, 0x068A, 0x068B, 0x068C, 0x068D, 0x068E, 0x068F, 0x0690, 0x0691, 0x0692, 0x0693, 0x0694,
+    0x0695, 0x0696, 0x0697, 0x0698, 0x0699, 0x069A, 0x069B, 0x069C, 0x069D, 0x069E, 0x069F, 0x06A0,
+    0x06A1, 0x06A2, 0x06A3, 0x06A4, 0x06A5, 0x06A6, 0x06A7, 0x06A8, 0x06A9, 0x06AA, 0x06AB, 0x06AC,
+    0x06AD, 0x06AE, 0x06AF, 0x06B0, 0x06B1, 0x06B2, 0x06B3, 0x06B4, 0x06B5, 0x06B6, 0x06B7, 0x0000,
+    0x0000, 0x0000, 0x0541, 0x0547, 0x06B8, 0x06B9, 0x06BA, 0x06BB, 0x06BC, 0x06BD, 0x0545, 0x06BE,
+    0x06BF, 0x06C0, 0x06C1, 0x0549, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x06C2, 0x06C3, 0x06C4, 0x06C5, 0x06C6, 0x06C7, 0x06C8, 0x06C9,
+    0x06CA, 0x06CB, 0x06CC, 0x06CD, 0x06CE, 0x06CF, 0x06D0, 0x06D1, 0x06D2, 0x06D3, 0x06D4, 0x06D5,
+    0x06D6, 0x06D7, 0x06D8, 0x06D9, 0x06DA, 0x06DB, 0x06DC, 0x06DD, 0x06DE, 0x06DF, 0x06E0, 0x0000,
+    0x06E1, 0x06E2, 0x06E3, 0x06E4, 0x06E5, 0x06E6, 0x06E7, 0x06E8, 0x06E9, 0x06EA, 0x06EB, 0x06EC,
+    0x06ED, 0x06EE, 0x06EF, 0x06F0, 0x06F1, 0x06F2, 0x06F3, 0x06F4, 0x06F5, 0x06F6, 0x06F7, 0x06F8,
+    0x06F9, 0x06FA, 0x06FB, 0x06FC, 0x06FD, 0x06FE, 0x06FF, 0x0700, 0x0701, 0x0702, 0x0703, 0x0704,
+    0x0705, 0x0706, 0x0583, 0x0707, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0708, 0x0709, 0x070A, 0x070B, 0x070C, 0x070D, 0x070E, 0x070F, 0x0710, 0x0711, 0x0712, 0x0713,
+    0x0714, 0x0715, 0x0716, 0x0717, 0x065A, 0x065D, 0x0660, 0x0662, 0x066A, 0x066B, 0x066E, 0x0670,
+    0x0671, 0x0673, 0x0674, 0x0675, 0x0676, 0x0677, 0x0718, 0x0719, 0x071A, 0x071B, 0x071C, 0x071D,
+    0x071E, 0x071F, 0x0720, 0x0721, 0x0722, 0x0723, 0x0724, 0x0725, 0x0726, 0x0727, 0x0728, 0x0000,
+    0x0541, 0x0547, 0x06B8, 0x06B9, 0x0729, 0x072A, 0x072B, 0x054C, 0x072C, 0x0558, 0x058A, 0x0596,
+    0x0595, 0x058B, 0x05E7, 0x0560, 0x0588, 0x072D, 0x072E, 0x072F, 0x0730, 0x0731, 0x0732, 0x0733,
+    0x0734, 0x0735, 0x0736, 0x0566, 0x0737, 0x0738, 0x0739, 0x073A, 0x073B, 0x073C, 0x073D, 0x073E,
+    0x06BA, 0x06BB, 0x06BC, 0x073F, 0x0740, 0x0741, 0x0742, 0x0743, 0x0744, 0x0745, 0x0746, 0x0747,
+    0x0748, 0x0749, 0x074A, 0x074B, 0x074C, 0x074D, 0x074E, 0x074F, 0x0750, 0x0751, 0x0752, 0x0753,
+    0x0754, 0x0755, 0x0756, 0x0757, 0x0758, 0x0759, 0x075A, 0x075B, 0x075C, 0x075D, 0x075E, 0x075F,
+    0x0760, 0x0761, 0x0762, 0x0763, 0x0764, 0x0765, 0x0766, 0x0767, 0x0768, 0x0769, 0x076A, 0x076B,
+    0x076C, 0x076D, 0x076E, 0x076F, 0x0770, 0x0771, 0x0772, 0x0773, 0x0774, 0x0775, 0x0776, 0x0777,
+    0x0778, 0x0779, 0x077A, 0x077B, 0x077C, 0x077D, 0x077E, 0x077F, 0x0780, 0x0781, 0x0782, 0x0783,
+    0x0784, 0x0785, 0x0786, 0x0787, 0x0788, 0x0789, 0x078A, 0x078B, 0x078C, 0x078D, 0x078E, 0x078F,
+    0x0790, 0x0791, 0x0792, 0x0793, 0x0794, 0x0795, 0x0796, 0x0797, 0x0798, 0x0799, 0x079A, 0x079B,
+    0x079C, 0x079D, 0x079E, 0x079F, 0x07A0, 0x07A1, 0x07A2, 0x07A3, 0x07A4, 0x07A5, 0x07A6, 0x07A7,
+    0x07A8, 0x07A9, 0x07AA, 0x07AB, 0x07AC, 0x07AD, 0x07AE, 0x07AF, 0x07B0, 0x07B1, 0x07B2, 0x07B3,
+    0x07B4, 0x07B5, 0x07B6, 0x07B7, 0x07B8, 0x07B9, 0x07BA, 0x07BB, 0x07BC, 0x07BD, 0x07BE, 0x07BF,
+    0x07C0, 0x07C1, 0x07C2, 0x07C3, 0x07C4, 0x07C5, 0x07C6, 0x07C7, 0x07C8, 0x07C9, 0x07CA, 0x07CB,
+    0x07CC, 0x07CD, 0x07CE, 0x07CF, 0x07D0, 0x07D1, 0x07D2, 0x07D3, 0x07D4, 0x07D5, 0x07D6, 0x07D7,
+    0x07D8, 0x07D9, 0x07DA, 0x07DB, 0x07DC, 0x07DD, 0x07DE, 0x07DF, 0x07E0, 0x07E1, 0x07E2, 0x07E3,
+    0x07E4, 0x07E5, 0x07E6, 0x07E7, 0x07E8, 0x07E9, 0x07EA, 0x07EB, 0x07EC, 0x07ED, 0x07EE, 0x07EF,
+    0x07F0, 0x07F1, 0x07F2, 0x07F3, 0x07F4, 0x07F5, 0x07F6, 0x07F7, 0x07F8, 0x07F9, 0x07FA, 0x07FB,
+    0x07FC, 0x07FD, 0x07FE, 0x07FF, 0x0800, 0x0801, 0x0802, 0x0803, 0x0804, 0x0805, 0x0806, 0x0807,
+    0x0808, 0x0809, 0x080A, 0x080B, 0x080C, 0x080D, 0x080E, 0x080F, 0x0810, 0x0811, 0x0812, 0x0813,
+    0x0814, 0x0815, 0x0816, 0x0817, 0x0818, 0x0819, 0x081A, 0x081B, 0x081C, 0x081D, 0x081E, 0x081F,
+    0x0820, 0x0821, 0x0822, 0x0823, 0x0824, 0x0825, 0x0826, 0x0827, 0x0828, 0x0829, 0x082A, 0x082B,
+    0x082C, 0x082D, 0x082E, 0x082F, 0x0830, 0x0831, 0x0832, 0x0833, 0x0834, 0x0835, 0x0836, 0x0837,
+    0x0838, 0x0839, 0x083A, 0x083B, 0x083C, 0x083D, 0x083E, 0x083F, 0x0840, 0x0841, 0x0842, 0x0843,
+    0x0844, 0x0845, 0x0846, 0x0847, 0x0848, 0x0849, 0x084A, 0x084B, 0x084C, 0x084D, 0x084E, 0x084F,
+    0x0850, 0x0851, 0x0852, 0x0853, 0x0854, 0x0855, 0x0856, 0x0857, 0x0858, 0x0859, 0x085A, 0x085B,
+    0x085C, 0x085D, 0x085E, 0x085F, 0x0860, 0x0861, 0x0862, 0x0863, 0x0864, 0x0865, 0x0866, 0x0867,
+    0x0868, 0x0869, 0x086A, 0x086B, 0x086C, 0x086D, 0x086E, 0x086F, 0x0870, 0x0871, 0x0872, 0x0873,
+    0x0874, 0x0875, 0x0876, 0x0877, 0x0878, 0x0879, 0x087A, 0x087B, 0x087C, 0x087D, 0x087E, 0x087F,
+    0x0880, 0x0881, 0x0882, 0x0883, 0x0884, 0x0885, 0x0886, 0x0887, 0x0888, 0x0889, 0x088A, 0x088B,
+    0x088C, 0x088D, 0x088E, 0x088F, 0x0890, 0x0891, 0x0892, 0x0893, 0x0894, 0x0895, 0x0896, 0x0897,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0898, 0x0899, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x089A, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0479, 0x0489, 0x0481, 0x0000, 0x0000, 0x0000,
+    0x089B, 0x089C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0133, 0x0133, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D1,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0000, 0x0131, 0x0131, 0x0133, 0x0000, 0x0000, 0x0131,
+    0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0000, 0x0131, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x089D, 0x089E, 0x089F, 0x08A0,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A1, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2, 0x08A2,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x08A3, 0x08A4, 0x08A5, 0x08A6,
+    0x08A7, 0x08A8, 0x08A9, 0x08AA, 0x08AA, 0x08AB, 0x08AC, 0x08AD, 0x08AE, 0x08AF, 0x08B0, 0x08B1,
+    0x08B2, 0x08B3, 0x08B4, 0x08B5, 0x08B6, 0x08B7, 0x08B8, 0x08B9, 0x08BA, 0x08BB, 0x08BC, 0x08BD,
+    0x08BE, 0x08BF, 0x08C0, 0x08C1, 0x08C2, 0x08C3, 0x08C4, 0x08C5, 0x08C6, 0x08C7, 0x08C8, 0x08C9,
+    0x08CA, 0x08CB, 0x08CC, 0x08CD, 0x08CE, 0x08CF, 0x08D0, 0x08D1, 0x08D2, 0x08D3, 0x08D4, 0x08D5,
+    0x08D6, 0x08D7, 0x08D8, 0x08D9, 0x08DA, 0x08DB, 0x08DC, 0x08DD, 0x08DE, 0x08DF, 0x08E0, 0x08E1,
+    0x08E2, 0x08E3, 0x08E4, 0x08E5, 0x08E6, 0x08E7, 0x08E8, 0x08E9, 0x08EA, 0x08EB, 0x08EC, 0x08ED,
+    0x08EE, 0x08EF, 0x08F0, 0x08F1, 0x08F2, 0x08F3, 0x08F4, 0x08F5, 0x08F6, 0x08F7, 0x08F8, 0x08F9,
+    0x08FA, 0x08FB, 0x08FC, 0x08FD, 0x08B6, 0x08FE, 0x08FF, 0x0900, 0x0901, 0x0902, 0x0903, 0x0904,
+    0x0905, 0x0906, 0x0907, 0x0908, 0x0909, 0x090A, 0x090B, 0x090C, 0x090D, 0x090E, 0x090F, 0x0910,
+    0x0911, 0x0912, 0x0913, 0x0914, 0x0915, 0x0916, 0x0917, 0x0918, 0x0919, 0x091A, 0x091B, 0x091C,
+    0x091D, 0x091E, 0x091F, 0x0920, 0x0921, 0x0922, 0x0923, 0x0924, 0x0925, 0x0926, 0x0927, 0x0928,
+    0x0929, 0x092A, 0x092B, 0x092C, 0x092D, 0x092E, 0x092F, 0x0930, 0x0931, 0x0932, 0x0933, 0x0934,
+    0x0935, 0x0936, 0x0937, 0x0938, 0x0939, 0x093A, 0x093B, 0x093C, 0x093D, 0x093E, 0x093F, 0x0940,
+    0x0941, 0x0910, 0x0942, 0x0943, 0x0944, 0x0945, 0x0946, 0x0947, 0x0948, 0x0949, 0x0900, 0x094A,
+    0x094B, 0x094C, 0x094D, 0x094E, 0x094F, 0x0950, 0x0951, 0x0952, 0x0953, 0x0954, 0x0955, 0x0956,
+    0x0957, 0x0958, 0x0959, 0x095A, 0x095B, 0x095C, 0x095D, 0x08B6, 0x095E, 0x095F, 0x0960, 0x0961,
+    0x0962, 0x0963, 0x0964, 0x0965, 0x0966, 0x0967, 0x0968, 0x0969, 0x096A, 0x096B, 0x096C, 0x096D,
+    0x096E, 0x096F, 0x0970, 0x0971, 0x0972, 0x0973, 0x0974, 0x0975, 0x0976, 0x0977, 0x0978, 0x0902,
+    0x0979, 0x097A, 0x097B, 0x097C, 0x097D, 0x097E, 0x097F, 0x0980, 0x0981, 0x0982, 0x0983, 0x0984,
+    0x0985, 0x0986, 0x0987, 0x0988, 0x0989, 0x098A, 0x098B, 0x098C, 0x098D, 0x098E, 0x098F, 0x0990,
+    0x0991, 0x0992, 0x0993, 0x0994, 0x0995, 0x0996, 0x0997, 0x0998, 0x0999, 0x099A, 0x099B, 0x099C,
+    0x099D, 0x099E, 0x099F, 0x09A0, 0x09A1, 0x09A2, 0x09A3, 0x09A4, 0x09A5, 0x09A6, 0x09A7, 0x09A8,
+    0x09A9, 0x09AA, 0x0000, 0x0000, 0x09AB, 0x0000, 0x09AC, 0x0000, 0x0000, 0x09AD, 0x09AE, 0x09AF,
+    0x09B0, 0x09B1, 0x09B2, 0x09B3, 0x09B4, 0x09B5, 0x09B6, 0x0000, 0x09B7, 0x0000, 0x09B8, 0x0000,
+    0x0000, 0x09B9, 0x09BA, 0x0000, 0x0000, 0x0000, 0x09BB, 0x09BC, 0x09BD, 0x09BE, 0x09BF, 0x09C0,
+    0x09C1, 0x09C2, 0x09C3, 0x09C4, 0x09C5, 0x09C6, 0x09C7, 0x09C8, 0x09C9, 0x09CA, 0x09CB, 0x09CC,
+    0x09CD, 0x09CE, 0x09CF, 0x09D0, 0x09D1, 0x09D2, 0x09D3, 0x09D4, 0x09D5, 0x09D6, 0x09D7, 0x09D8,
+    0x09D9, 0x09DA, 0x09DB, 0x09DC, 0x09DD, 0x09DE, 0x09DF, 0x09E0, 0x09E1, 0x09E2, 0x09E3, 0x09E4,
+    0x09E5, 0x09E6, 0x09E7, 0x0937, 0x09E8, 0x09E9, 0x09EA, 0x09EB, 0x09EC, 0x09ED, 0x09ED, 0x09EE,
+    0x09EF, 0x09F0, 0x09F1, 0x09F2, 0x09F3, 0x09F4, 0x09F5, 0x09B9, 0x09F6, 0x09F7, 0x09F8, 0x09F9,
+    0x09FA, 0x09FB, 0x0000, 0x0000, 0x09FC, 0x09FD, 0x09FE, 0x09FF, 0x0A00, 0x0A01, 0x0A02, 0x0A03,
+    0x09C7, 0x0A04, 0x0A05, 0x0A06, 0x09AB, 0x0A07, 0x0A08, 0x0A09, 0x0A0A, 0x0A0B, 0x0A0C, 0x0A0D,
+    0x0A0E, 0x0A0F, 0x0A10, 0x0A11, 0x0A12, 0x09D0, 0x0A13, 0x09D1, 0x0A14, 0x0A15, 0x0A16, 0x0A17,
+    0x0A18, 0x09AC, 0x08CB, 0x0A19, 0x0A1A, 0x0A1B, 0x0911, 0x0968, 0x0A1C, 0x0A1D, 0x09D8, 0x0A1E,
+    0x09D9, 0x0A1F, 0x0A20, 0x0A21, 0x09AE, 0x0A22, 0x0A23, 0x0A24, 0x0A25, 0x0A26, 0x09AF, 0x0A27,
+    0x0A28, 0x0A29, 0x0A2A, 0x0A2B, 0x0A2C, 0x09E7, 0x0A2D, 0x0A2E, 0x0937, 0x0A2F, 0x09EB, 0x0A30,
+    0x0A31, 0x0A32, 0x0A33, 0x0A34, 0x09F0, 0x0A35, 0x09B8, 0x0A36, 0x09F1, 0x08FE, 0x0A37, 0x09F2,
+    0x0A38, 0x09F4, 0x0A39, 0x0A3A, 0x0A3B, 0x0A3C, 0x0A3D, 0x09F6, 0x09B4, 0x0A3E, 0x09F7, 0x0A3F,
+    0x09F8, 0x0A40, 0x08AA, 0x0A41, 0x0A42, 0x0A43, 0x0A44, 0x0A45, 0x0A46, 0x0A47, 0x0A48, 0x0A49,
+    0x0A4A, 0x0A4B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0A4C, 0x0A4D, 0x0A4E, 0x0A4F, 0x0A50, 0x0A51, 0x0A51, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A52,
+    0x0A53, 0x0A54, 0x0A55, 0x0A56, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0A57, 0x0A58, 0x0A59,
+    0x0A5A, 0x048A, 0x048D, 0x0A5B, 0x0A5C, 0x0A5D, 0x0A5E, 0x0A5F, 0x0A60, 0x0470, 0x0A61, 0x0A62,
+    0x0A63, 0x0A64, 0x0A65, 0x0A66, 0x0A67, 0x0A68, 0x0A69, 0x0A6A, 0x0A6B, 0x0A6C, 0x0A6D, 0x0000,
+    0x0A6E, 0x0A6F, 0x0A70, 0x0A71, 0x0A72, 0x0000, 0x0A73, 0x0000, 0x0A74, 0x0A75, 0x0000, 0x0A76,
+    0x0A77, 0x0000, 0x0A78, 0x0A79, 0x0A7A, 0x0A7B, 0x0A7C, 0x0A7D, 0x0A7E, 0x0A7F, 0x0A80, 0x0A81,
+    0x0A82, 0x0A82, 0x0A83, 0x0A83, 0x0A83, 0x0A83, 0x0A84, 0x0A84, 0x0A84, 0x0A84, 0x0A85, 0x0A85,
+    0x0A85, 0x0A85, 0x0A86, 0x0A86, 0x0A86, 0x0A86, 0x0A87, 0x0A87, 0x0A87, 0x0A87, 0x0A88, 0x0A88,
+    0x0A88, 0x0A88, 0x0A89, 0x0A89, 0x0A89, 0x0A89, 0x0A8A, 0x0A8A, 0x0A8A, 0x0A8A, 0x0A8B, 0x0A8B,
+    0x0A8B, 0x0A8B, 0x0A8C, 0x0A8C, 0x0A8C, 0x0A8C, 0x0A8D, 0x0A8D, 0x0A8D, 0x0A8D, 0x0A8E, 0x0A8E,
+    0x0A8E, 0x0A8E, 0x0A8F, 0x0A8F, 0x0A90, 0x0A90, 0x0A91, 0x0A91, 0x0A92, 0x0A92, 0x0A93, 0x0A93,
+    0x0A94, 0x0A94, 0x0A95, 0x0A95, 0x0A95, 0x0A95, 0x0A96, 0x0A96, 0x0A96, 0x0A96, 0x0A97, 0x0A97,
+    0x0A97, 0x0A97, 0x0A98, 0x0A98, 0x0A98, 0x0A98, 0x0A99, 0x0A99, 0x0A9A, 0x0A9A, 0x0A9A, 0x0A9A,
+    0x0A9B, 0x0A9B, 0x0A9C, 0x0A9C, 0x0A9C, 0x0A9C, 0x0A9D, 0x0A9D, 0x0A9D, 0x0A9D, 0x0A9E, 0x0A9E,
+    0x0A9F, 0x0A9F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0AA0,
+    0x0AA0, 0x0AA0, 0x0AA0, 0x0AA1, 0x0AA1, 0x0AA2, 0x0AA2, 0x0AA3, 0x0AA3, 0x01BE, 0x0AA4, 0x0AA4,
+    0x0AA5, 0x0AA5, 0x0AA6, 0x0AA6, 0x0AA7, 0x0AA7, 0x0AA7, 0x0AA7, 0x0AA8, 0x0AA8, 0x0AA9, 0x0AA9,
+    0x0AAA, 0x0AAA, 0x0AAB, 0x0AAB, 0x0AAC, 0x0AAC, 0x0AAD, 0x0AAD, 0x0AAE, 0x0AAE, 0x0AAF, 0x0AAF,
+    0x0AAF, 0x0AB0, 0x0AB0, 0x0AB0, 0x0AB1, 0x0AB1, 0x0AB1, 0x0AB1, 0x0AB2, 0x0AB3, 0x0AB4, 0x0AB0,
+    0x0AB5, 0x0AB6, 0x0AB7, 0x0AB8, 0x0AB9, 0x0ABA, 0x0ABB, 0x0ABC, 0x0ABD, 0x0ABE, 0x0ABF, 0x0AC0,
+    0x0AC1, 0x0AC2, 0x0AC3, 0x0AC4, 0x0AC5, 0x0AC6, 0x0AC7, 0x0AC8, 0x0AC9, 0x0ACA, 0x0ACB, 0x0ACC,
+    0x0ACD, 0x0ACE, 0x0ACF, 0x0AD0, 0x0AD1, 0x0AD2, 0x0AD3, 0x0AD4, 0x0AD5, 0x0AD6, 0x0AD7, 0x0AD8,
+    0x0AD9, 0x0ADA, 0x0ADB, 0x0ADC, 0x0ADD, 0x0ADE, 0x0ADF, 0x0AE0, 0x0AE1, 0x0AE2, 0x0AE3, 0x0AE4,
+    0x0AE5, 0x0AE6, 0x0AE7, 0x0AE8, 0x0AE9, 0x0AEA, 0x0AEB, 0x0AEC, 0x0AED, 0x0AEE, 0x0AEF, 0x0AF0,
+    0x0AF1, 0x0AF2, 0x0AF3, 0x0AF4, 0x0AF5, 0x0AF6, 0x0AF7, 0x0AF8, 0x0AF9, 0x0AFA, 0x0AFB, 0x0AFC,
+    0x0AFD, 0x0AFE, 0x0AFF, 0x0B00, 0x0B01, 0x0B02, 0x0B03, 0x0B04, 0x0B05, 0x0B06, 0x0B07, 0x0B08,
+    0x0B09, 0x0B0A, 0x0B0B, 0x0B0C, 0x0B0D, 0x0B0E, 0x0B0F, 0x0B10, 0x0B11, 0x0B12, 0x0B13, 0x0B14,
+    0x0B15, 0x0B16, 0x0AB4, 0x0B17, 0x0AB0, 0x0AB5, 0x0B18, 0x0B19, 0x0AB9, 0x0B1A, 0x0ABA, 0x0ABB,
+    0x0B1B, 0x0B1C, 0x0ABF, 0x0B1D, 0x0AC0, 0x0AC1, 0x0B1E, 0x0B1F, 0x0AC3, 0x0B20, 0x0AC4, 0x0AC5,
+    0x0AE2, 0x0AE3, 0x0AE6, 0x0AE7, 0x0AE8, 0x0AEC, 0x0AED, 0x0AEE, 0x0AEF, 0x0AF3, 0x0AF4, 0x0AF5,
+    0x0B21, 0x0AF9, 0x0B22, 0x0B23, 0x0AFF, 0x0B24, 0x0B00, 0x0B01, 0x0B0E, 0x0B25, 0x0B26, 0x0B09,
+    0x0B27, 0x0B0A, 0x0B0B, 0x0AB2, 0x0AB3, 0x0B28, 0x0AB4, 0x0B29, 0x0AB6, 0x0AB7, 0x0AB8, 0x0AB9,
+    0x0B2A, 0x0ABC, 0x0ABD, 0x0ABE, 0x0ABF, 0x0B2B, 0x0AC3, 0x0AC6, 0x0AC7, 0x0AC8, 0x0AC9, 0x0ACA,
+    0x0ACC, 0x0ACD, 0x0ACE, 0x0ACF, 0x0AD0, 0x0AD1, 0x0B2C, 0x0AD2, 0x0AD3, 0x0AD4, 0x0AD5, 0x0AD6,
+    0x0AD7, 0x0AD9, 0x0ADA, 0x0ADB, 0x0ADC, 0x0ADD, 0x0ADE, 0x0ADF, 0x0AE0, 0x0AE1, 0x0AE4, 0x0AE5,
+    0x0AE9, 0x0AEA, 0x0AEB, 0x0AEC, 0x0AED, 0x0AF0, 0x0AF1, 0x0AF2, 0x0AF3, 0x0B2D, 0x0AF6, 0x0AF7,
+    0x0AF8, 0x0AF9, 0x0AFC, 0x0AFD, 0x0AFE, 0x0AFF, 0x0B2E, 0x0B02, 0x0B03, 0x0B2F, 0x0B06, 0x0B07,
+    0x0B08, 0x0B09, 0x0B30, 0x0AB4, 0x0B29, 0x0AB9, 0x0B2A, 0x0ABF, 0x0B2B, 0x0AC3, 0x0B31, 0x0AD0,
+    0x0B32, 0x0B33, 0x0B34, 0x0AEC, 0x0AED, 0x0AF3, 0x0AFF, 0x0B2E, 0x0B09, 0x0B30, 0x0B35, 0x0B36,
+    0x0B37, 0x0B38, 0x0B39, 0x0B3A, 0x0B3B, 0x0B3C, 0x0B3D, 0x0B3E, 0x0B3F, 0x0B40, 0x0B41, 0x0B42,
+    0x0B43, 0x0B44, 0x0B45, 0x0B46, 0x0B47, 0x0B48, 0x0B49, 0x0B4A, 0x0B4B, 0x0B4C, 0x0B4D, 0x0B4E,
+    0x0B33, 0x0B4F, 0x0B50, 0x0B51, 0x0B52, 0x0B38, 0x0B39, 0x0B3A, 0x0B3B, 0x0B3C, 0x0B3D, 0x0B3E,
+    0x0B3F, 0x0B40, 0x0B41, 0x0B42, 0x0B43, 0x0B44, 0x0B45, 0x0B46, 0x0B47, 0x0B48, 0x0B49, 0x0B4A,
+    0x0B4B, 0x0B4C, 0x0B4D, 0x0B4E, 0x0B33, 0x0B4F, 0x0B50, 0x0B51, 0x0B52, 0x0B4C, 0x0B4D, 0x0B4E,
+    0x0B33, 0x0B32, 0x0B34, 0x0AD8, 0x0ACD, 0x0ACE, 0x0ACF, 0x0B4C, 0x0B4D, 0x0B4E, 0x0AD8, 0x0AD9,
+    0x0B53, 0x0B53, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0B54, 0x0B55, 0x0B55, 0x0B56,
+    0x0B57, 0x0B58, 0x0B59, 0x0B5A, 0x0B5B, 0x0B5B, 0x0B5C, 0x0B5D, 0x0B5E, 0x0B5F, 0x0B60, 0x0B61,
+    0x0B61, 0x0B62, 0x0B63, 0x0B63, 0x0B64, 0x0B64, 0x0B65, 0x0B66, 0x0B66, 0x0B67, 0x0B68, 0x0B68,
+    0x0B69, 0x0B69, 0x0B6A, 0x0B6B, 0x0B6B, 0x0B6C, 0x0B6C, 0x0B6D, 0x0B6E, 0x0B6F, 0x0B70, 0x0B70,
+    0x0B71, 0x0B72, 0x0B73, 0x0B74, 0x0B75, 0x0B75, 0x0B76, 0x0B77, 0x0B78, 0x0B79, 0x0B7A, 0x0B7B,
+    0x0B7B, 0x0B7C, 0x0B7C, 0x0B7D, 0x0B7D, 0x0B7E, 0x0B7F, 0x0B80, 0x0B81, 0x0B82, 0x0B83, 0x0B84,
+    0x0000, 0x0000, 0x0B85, 0x0B86, 0x0B87, 0x0B88, 0x0B89, 0x0B8A, 0x0B8A, 0x0B8B, 0x0B8C, 0x0B8D,
+    0x0B8E, 0x0B8E, 0x0B8F, 0x0B90, 0x0B91, 0x0B92, 0x0B93, 0x0B94, 0x0B95, 0x0B96, 0x0B97, 0x0B98,
+    0x0B99, 0x0B9A, 0x0B9B, 0x0B9C, 0x0B9D, 0x0B9E, 0x0B9F, 0x0BA0, 0x0BA1, 0x0BA2, 0x0BA3, 0x0BA4,
+    0x0B76, 0x0B78, 0x0BA5, 0x0BA6, 0x0BA7, 0x0BA8, 0x0BA9, 0x0BAA, 0x0BA9, 0x0BA7, 0x0BAB, 0x0BAC,
+    0x0BAD, 0x0BAE, 0x0BAF, 0x0BAA, 0x0B6F, 0x0B65, 0x0BB0, 0x0BB1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0BB2, 0x0BB3, 0x0BB4, 0x0BB5, 0x0BB6, 0x0BB7, 0x0BB8, 0x0BB9, 0x0BBA, 0x0BBB, 0x0BBC, 0x0BBD,
+    0x0BBE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BBF, 0x0BC0, 0x0BC1, 0x0BC2,
+    0x0BC3, 0x0BC4, 0x0BC5, 0x0BC6, 0x0BC7, 0x045E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133,
+    0x0133, 0x0133, 0x0131, 0x0131, 0x045D, 0x0BC8, 0x0BC9, 0x0BCA, 0x0BCA, 0x0473, 0x0474, 0x0BCB,
+    0x0BCC, 0x0BCD, 0x0BCE, 0x0BCF, 0x0BD0, 0x0BD1, 0x0BD2, 0x0BD3, 0x0BD4, 0x0BD5, 0x0BD6, 0x0BD7,
+    0x0BD8, 0x0000, 0x0000, 0x0BD9, 0x0BDA, 0x0464, 0x0464, 0x0464, 0x0464, 0x0BCA, 0x0BCA, 0x0BCA,
+    0x0BBF, 0x0BC0, 0x045C, 0x0000, 0x0BC3, 0x0BC2, 0x0BC5, 0x0BC4, 0x0BC8, 0x0473, 0x0474, 0x0BCB,
+    0x0BCC, 0x0BCD, 0x0BCE, 0x0BDB, 0x0BDC, 0x0BDD, 0x0470, 0x0BDE, 0x0BDF, 0x0BE0, 0x0472, 0x0000,
+    0x0BE1, 0x0BE2, 0x0BE3, 0x0BE4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BE5, 0x0BE6, 0x0BE7, 0x0000,
+    0x0BE8, 0x0000, 0x0BE9, 0x0BEA, 0x0BEB, 0x0BEC, 0x0BED, 0x0BEE, 0x0BEF, 0x0BF0, 0x0BF1, 0x0BF2,
+    0x0BF3, 0x0BF4, 0x0BF4, 0x0BF5, 0x0BF5, 0x0BF6, 0x0BF6, 0x0BF7, 0x0BF7, 0x0BF8, 0x0BF8, 0x0BF8,
+    0x0BF8, 0x0BF9, 0x0BF9, 0x0BFA, 0x0BFA, 0x0BFA, 0x0BFA, 0x0BFB, 0x0BFB, 0x0BFC, 0x0BFC, 0x0BFC,
+    0x0BFC, 0x0BFD, 0x0BFD, 0x0BFD, 0x0BFD, 0x0BFE, 0x0BFE, 0x0BFE, 0x0BFE, 0x0BFF, 0x0BFF, 0x0BFF,
+    0x0BFF, 0x0C00, 0x0C00, 0x0C00, 0x0C00, 0x0C01, 0x0C01, 0x0C02, 0x0C02, 0x0C03, 0x0C03, 0x0C04,
+    0x0C04, 0x0C05, 0x0C05, 0x0C05, 0x0C05, 0x0C06, 0x0C06, 0x0C06, 0x0C06, 0x0C07, 0x0C07, 0x0C07,
+    0x0C07, 0x0C08, 0x0C08, 0x0C08, 0x0C08, 0x0C09, 0x0C09, 0x0C09, 0x0C09, 0x0C0A, 0x0C0A, 0x0C0A,
+    0x0C0A, 0x0C0B, 0x0C0B, 0x0C0B, 0x0C0B, 0x0C0C, 0x0C0C, 0x0C0C, 0x0C0C, 0x0C0D, 0x0C0D, 0x0C0D,
+    0x0C0D, 0x0C0E, 0x0C0E, 0x0C0E, 0x0C0E, 0x0C0F, 0x0C0F, 0x0C0F, 0x0C0F, 0x0C10, 0x0C10, 0x0C10,
+    0x0C10, 0x0C11, 0x0C11, 0x0C11, 0x0C11, 0x0C12, 0x0C12, 0x0C12, 0x0C12, 0x0C13, 0x0C13, 0x0C13,
+    0x0C13, 0x0C14, 0x0C14, 0x0AA8, 0x0AA8, 0x0C15, 0x0C15, 0x0C15, 0x0C15, 0x0C16, 0x0C16, 0x0C17,
+    0x0C17, 0x0C18, 0x0C18, 0x0C19, 0x0C19, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BC4, 0x0C1A, 0x0BDB,
+    0x0BE2, 0x0BE3, 0x0BDC, 0x0C1B, 0x0473, 0x0474, 0x0BDD, 0x0470, 0x0BBF, 0x0BDE, 0x045C, 0x0C1C,
+    0x0469, 0x000A, 0x0005, 0x0006, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0BC2, 0x0BC3,
+    0x0BDF, 0x0472, 0x0BE0, 0x0BC5, 0x0BE4, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A,
+    0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536,
+    0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0BD9, 0x0BE1, 0x0BDA, 0x0C1D, 0x0BCA,
+    0x0C1E, 0x0003, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243,
+    0x012D, 0x0244, 0x0475, 0x000B, 0x0249, 0x0538, 0x0120, 0x00B5, 0x024A, 0x024B, 0x024E, 0x0124,
+    0x012E, 0x0125, 0x0274, 0x0BCB, 0x0C1F, 0x0BCC, 0x0C20, 0x0C21, 0x0C22, 0x0BC1, 0x0BD5, 0x0BD6,
+    0x0BC0, 0x0C23, 0x0796, 0x0C24, 0x0C25, 0x0C26, 0x0C27, 0x0C28, 0x0C29, 0x0C2A, 0x0C2B, 0x0C2C,
+    0x0C2D, 0x0768, 0x0769, 0x076A, 0x076B, 0x076C, 0x076D, 0x076E, 0x076F, 0x0770, 0x0771, 0x0772,
+    0x0773, 0x0774, 0x0775, 0x0776, 0x0777, 0x0778, 0x0779, 0x077A, 0x077B, 0x077C, 0x077D, 0x077E,
+    0x077F, 0x0780, 0x0781, 0x0782, 0x0783, 0x0784, 0x0785, 0x0786, 0x0787, 0x0788, 0x0789, 0x078A,
+    0x078B, 0x078C, 0x078D, 0x078E, 0x078F, 0x0790, 0x0791, 0x0792, 0x0793, 0x0C2E, 0x0C2F, 0x0C30,
+    0x068D, 0x065A, 0x065B, 0x065C, 0x065D, 0x065E, 0x065F, 0x0660, 0x0661, 0x0662, 0x0663, 0x0664,
+    0x0665, 0x0666, 0x0667, 0x0668, 0x0669, 0x066A, 0x066B, 0x066C, 0x066D, 0x066E, 0x066F, 0x0670,
+    0x0671, 0x0672, 0x0673, 0x0674, 0x0675, 0x0676, 0x0677, 0x0000, 0x0000, 0x0000, 0x0678, 0x0679,
+    0x067A, 0x067B, 0x067C, 0x067D, 0x0000, 0x0000, 0x067E, 0x067F, 0x0680, 0x0681, 0x0682, 0x0683,
+    0x0000, 0x0000, 0x0684, 0x0685, 0x0686, 0x0687, 0x0688, 0x0689, 0x0000, 0x0000, 0x068A, 0x068B,
+    0x068C, 0x0000, 0x0000, 0x0000, 0x0C31, 0x0C32, 0x0C33, 0x0004, 0x0C34, 0x0C35, 0x0C36, 0x0000,
+    0x0C37, 0x0C38, 0x0C39, 0x0C3A, 0x0C3B, 0x0C3C, 0x0C3D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0C3E, 0x0C3F, 0x0C40, 0x0C41, 0x0C42, 0x0000, 0x0C43, 0x0C44, 0x0C45, 0x0C46, 0x0C47,
+    0x0C48, 0x0C49, 0x0C4A, 0x0C4B, 0x0C4C, 0x0C4D, 0x0C4E, 0x0C4F, 0x0C50, 0x047F, 0x0C51, 0x0C52,
+    0x0C53, 0x0C54, 0x0C55, 0x0C56, 0x0C57, 0x0C58, 0x0C59, 0x0C5A, 0x0C5B, 0x0C5C, 0x0C5D, 0x0C5E,
+    0x0C5F, 0x0538, 0x0C60, 0x0C61, 0x0C62, 0x0C63, 0x0C64, 0x0C65, 0x0C66, 0x0C67, 0x0C68, 0x0C69,
+    0x0C6A, 0x0000, 0x0C6B, 0x0C6C, 0x0C6D, 0x0C6E, 0x0C6F, 0x0C70, 0x0C71, 0x0C72, 0x0C73, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0000, 0x0131,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0138, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0133, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0133, 0x0133, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0133, 0x0133, 0x0131, 0x0131, 0x0131, 0x0133, 0x0131, 0x0133, 0x0133, 0x0133,
+    0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0131, 0x0133, 0x0131, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C74, 0x0000, 0x0C75, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C76,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01C8, 0x01C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C77, 0x0C78,
+    0x0000, 0x0000, 0x0000, 0x01C8, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x01D1, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x01C8, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x01D1, 0x0000, 0x01D2, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C79,
+    0x0C7A, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D2,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000,
+    0x0000, 0x0000, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D2, 0x0C7B,
+    0x0C7C, 0x01D2, 0x0C7D, 0x0000, 0x0000, 0x0000, 0x01C8, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D2, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C7E, 0x0C7F, 0x0000, 0x0000, 0x0000, 0x01C8,
+    0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01C8, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x01D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C80, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01C8, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x01D1, 0x0000, 0x01C8, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01C8, 0x01C8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0138, 0x0138, 0x0138, 0x0138, 0x0138, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0C81, 0x0C81, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0138, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0C82, 0x0C83, 0x0C84, 0x0C85, 0x0C86, 0x0C87, 0x0C88, 0x0200, 0x0200, 0x0138,
+    0x0138, 0x0138, 0x0000, 0x0000, 0x0000, 0x0C89, 0x0200, 0x0200, 0x0200, 0x0200, 0x0200, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133,
+    0x0133, 0x0133, 0x0133, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0133, 0x0133,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0C8A,
+    0x0C8B, 0x0C8C, 0x0C8D, 0x0C8E, 0x0C8F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B,
+    0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236,
+    0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0003, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259,
+    0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x000B, 0x0249, 0x0538, 0x0120,
+    0x00B5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x0479, 0x0227,
+    0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234,
+    0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0003, 0x023C,
+    0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x0000, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475,
+    0x000B, 0x0249, 0x0538, 0x0120, 0x00B5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274,
+    0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F,
+    0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA,
+    0x0537, 0x0485, 0x0003, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F,
+    0x0243, 0x012D, 0x0244, 0x0475, 0x000B, 0x0249, 0x0538, 0x0120, 0x00B5, 0x024A, 0x024B, 0x024E,
+    0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0000, 0x0479, 0x0227, 0x0000, 0x0000, 0x022A, 0x0000,
+    0x0000, 0x022D, 0x022E, 0x0000, 0x0000, 0x0231, 0x0232, 0x0234, 0x0481, 0x0000, 0x0536, 0x0236,
+    0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0003, 0x023C, 0x0256, 0x023D, 0x0000, 0x0259,
+    0x0000, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x0000, 0x0249, 0x0538, 0x0120,
+    0x00B5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x0479, 0x0227,
+    0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234,
+    0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0003, 0x023C,
+    0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475,
+    0x000B, 0x0249, 0x0538, 0x0120, 0x00B5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274,
+    0x0224, 0x0226, 0x0000, 0x0227, 0x0228, 0x0489, 0x022A, 0x0000, 0x0000, 0x022D, 0x022E, 0x022F,
+    0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0000, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA,
+    0x0537, 0x0000, 0x0003, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F,
+    0x0243, 0x012D, 0x0244, 0x0475, 0x000B, 0x0249, 0x0538, 0x0120, 0x00B5, 0x024A, 0x024B, 0x024E,
+    0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x0000, 0x0227, 0x0228, 0x0489, 0x022A, 0x0000,
+    0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0000, 0x0232, 0x0000, 0x0000, 0x0000, 0x0536, 0x0236,
+    0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0000, 0x0003, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259,
+    0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x000B, 0x0249, 0x0538, 0x0120,
+    0x00B5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x0479, 0x0227,
+    0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234,
+    0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0003, 0x023C,
+    0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475,
+    0x000B, 0x0249, 0x0538, 0x0120, 0x00B5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274,
+    0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F,
+    0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA,
+    0x0537, 0x0485, 0x0003, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F,
+    0x0243, 0x012D, 0x0244, 0x0475, 0x000B, 0x0249, 0x0538, 0x0120, 0x00B5, 0x024A, 0x024B, 0x024E,
+    0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B,
+    0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236,
+    0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0003, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259,
+    0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x000B, 0x0249, 0x0538, 0x0120,
+    0x00B5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x0479, 0x0227,
+    0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234,
+    0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0003, 0x023C,
+    0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475,
+    0x000B, 0x0249, 0x0538, 0x0120, 0x00B5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274,
+    0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F,
+    0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA,
+    0x0537, 0x0485, 0x0003, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259, 0x0242, 0x011D, 0x0253, 0x011F,
+    0x0243, 0x012D, 0x0244, 0x0475, 0x000B, 0x0249, 0x0538, 0x0120, 0x00B5, 0x024A, 0x024B, 0x024E,
+    0x0124, 0x012E, 0x0125, 0x0274, 0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B,
+    0x022C, 0x022D, 0x022E, 0x022F, 0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236,
+    0x0237, 0x04A5, 0x0238, 0x04AA, 0x0537, 0x0485, 0x0003, 0x023C, 0x0256, 0x023D, 0x023E, 0x0259,
+    0x0242, 0x011D, 0x0253, 0x011F, 0x0243, 0x012D, 0x0244, 0x0475, 0x000B, 0x0249, 0x0538, 0x0120,
+    0x00B5, 0x024A, 0x024B, 0x024E, 0x0124, 0x012E, 0x0125, 0x0274, 0x0C90, 0x0C91, 0x0000, 0x0000,
+    0x0C92, 0x0C93, 0x048F, 0x0C94, 0x0C95, 0x0C96, 0x0C97, 0x0164, 0x0C98, 0x0C99, 0x0C9A, 0x0C9B,
+    0x0C9C, 0x0C9D, 0x0C9E, 0x0490, 0x0C9F, 0x0164, 0x0166, 0x0CA0, 0x015C, 0x0CA1, 0x0CA2, 0x0CA3,
+    0x0CA4, 0x0CA5, 0x0CA6, 0x015A, 0x0250, 0x0251, 0x0165, 0x0CA7, 0x0CA8, 0x015B, 0x0CA9, 0x0161,
+    0x0CAA, 0x0008, 0x0CAB, 0x0CAC, 0x0CAD, 0x0160, 0x0162, 0x0163, 0x0CAE, 0x0CAF, 0x0CB0, 0x015F,
+    0x0252, 0x0CB1, 0x0CB2, 0x0CB3, 0x0165, 0x015B, 0x0161, 0x015F, 0x0162, 0x0160, 0x0C92, 0x0C93,
+    0x048F, 0x0C94, 0x0C95, 0x0C96, 0x0C97, 0x0164, 0x0C98, 0x0C99, 0x0C9A, 0x0C9B, 0x0C9C, 0x0C9D,
+    0x0C9E, 0x0490, 0x0C9F, 0x0164, 0x0166, 0x0CA0, 0x015C, 0x0CA1, 0x0CA2, 0x0CA3, 0x0CA4, 0x0CA5,
+    0x0CA6, 0x015A, 0x0250, 0x0251, 0x0165, 0x0CA7, 0x0CA8, 0x015B, 0x0CA9, 0x0161, 0x0CAA, 0x0008,
+    0x0CAB, 0x0CAC, 0x0CAD, 0x0160, 0x0162, 0x0163, 0x0CAE, 0x0CAF, 0x0CB0, 0x015F, 0x0252, 0x0CB1,
+    0x0CB2, 0x0CB3, 0x0165, 0x015B, 0x0161, 0x015F, 0x0162, 0x0160, 0x0C92, 0x0C93, 0x048F, 0x0C94,
+    0x0C95, 0x0C96, 0x0C97, 0x0164, 0x0C98, 0x0C99, 0x0C9A, 0x0C9B, 0x0C9C, 0x0C9D, 0x0C9E, 0x0490,
+    0x0C9F, 0x0164, 0x0166, 0x0CA0, 0x015C, 0x0CA1, 0x0CA2, 0x0CA3, 0x0CA4, 0x0CA5, 0x0CA6, 0x015A,
+    0x0250, 0x0251, 0x0165, 0x0CA7, 0x0CA8, 0x015B, 0x0CA9, 0x0161, 0x0CAA, 0x0008, 0x0CAB, 0x0CAC,
+    0x0CAD, 0x0160, 0x0162, 0x0163, 0x0CAE, 0x0CAF, 0x0CB0, 0x015F, 0x0252, 0x0CB1, 0x0CB2, 0x0CB3,
+    0x0165, 0x015B, 0x0161, 0x015F, 0x0162, 0x0160, 0x0C92, 0x0C93, 0x048F, 0x0C94, 0x0C95, 0x0C96,
+    0x0C97, 0x0164, 0x0C98, 0x0C99, 0x0C9A, 0x0C9B, 0x0C9C, 0x0C9D, 0x0C9E, 0x0490, 0x0C9F, 0x0164,
+    0x0166, 0x0CA0, 0x015C, 0x0CA1, 0x0CA2, 0x0CA3, 0x0CA4, 0x0CA5, 0x0CA6, 0x015A, 0x0250, 0x0251,
+    0x0165, 0x0CA7, 0x0CA8, 0x015B, 0x0CA9, 0x0161, 0x0CAA, 0x0008, 0x0CAB, 0x0CAC, 0x0CAD, 0x0160,
+    0x0162, 0x0163, 0x0CAE, 0x0CAF, 0x0CB0, 0x015F, 0x0252, 0x0CB1, 0x0CB2, 0x0CB3, 0x0165, 0x015B,
+    0x0161, 0x015F, 0x0162, 0x0160, 0x0C92, 0x0C93, 0x048F, 0x0C94, 0x0C95, 0x0C96, 0x0C97, 0x0164,
+    0x0C98, 0x0C99, 0x0C9A, 0x0C9B, 0x0C9C, 0x0C9D, 0x0C9E, 0x0490, 0x0C9F, 0x0164, 0x0166, 0x0CA0,
+    0x015C, 0x0CA1, 0x0CA2, 0x0CA3, 0x0CA4, 0x0CA5, 0x0CA6, 0x015A, 0x0250, 0x0251, 0x0165, 0x0CA7,
+    0x0CA8, 0x015B, 0x0CA9, 0x0161, 0x0CAA, 0x0008, 0x0CAB, 0x0CAC, 0x0CAD, 0x0160, 0x0162, 0x0163,
+    0x0CAE, 0x0CAF, 0x0CB0, 0x015F, 0x0252, 0x0CB1, 0x0CB2, 0x0CB3, 0x0165, 0x015B, 0x0161, 0x015F,
+    0x0162, 0x0160, 0x0CB4, 0x0CB5, 0x0000, 0x0000, 0x0469, 0x000A, 0x0005, 0x0006, 0x046A, 0x046B,
+    0x046C, 0x046D, 0x046E, 0x046F, 0x0469, 0x000A, 0x0005, 0x0006, 0x046A, 0x046B, 0x046C, 0x046D,
+    0x046E, 0x046F, 0x0469, 0x000A, 0x0005, 0x0006, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F,
+    0x0469, 0x000A, 0x0005, 0x0006, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0469, 0x000A,
+    0x0005, 0x0006, 0x046A, 0x046B, 0x046C, 0x046D, 0x046E, 0x046F, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0131, 0x0131, 0x0000, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0CB6, 0x0CB7, 0x0CB8, 0x0CB9,
+    0x0CBA, 0x0CBB, 0x0CBC, 0x0CBD, 0x0CBE, 0x0CBF, 0x0CC0, 0x0CC1, 0x0CC2, 0x0CC3, 0x0CC4, 0x0CC5,
+    0x0CC6, 0x0CC7, 0x0CC8, 0x0CC9, 0x0CCA, 0x0CCB, 0x0CCC, 0x0CCD, 0x0CCE, 0x0CCF, 0x0CD0, 0x0CD1,
+    0x0CD2, 0x0CD3, 0x0CD4, 0x0CD5, 0x0CD6, 0x0CB6, 0x0CB7, 0x0CB8, 0x0CB9, 0x0CBA, 0x0CBB, 0x0CBC,
+    0x0CBD, 0x0CBE, 0x0CBF, 0x0CC0, 0x0CC2, 0x0CC3, 0x0CC5, 0x0CC7, 0x0CC8, 0x0CC9, 0x0CCA, 0x0CCB,
+    0x0CCC, 0x0898, 0x0CCD, 0x0CD7, 0x0CD2, 0x0CD8, 0x0CD9, 0x0CDA, 0x0CDB, 0x0CDC, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0131, 0x0131, 0x0131, 0x0131, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0132, 0x0132, 0x0133, 0x0131,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0133, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0131, 0x0131, 0x0131, 0x0131,
+    0x0131, 0x0131, 0x01D1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BF9, 0x0BFA, 0x0BFE, 0x0C01,
+    0x0000, 0x0C14, 0x0C04, 0x0BFF, 0x0C09, 0x0C15, 0x0C0F, 0x0C10, 0x0C11, 0x0C12, 0x0C05, 0x0C0B,
+    0x0C0D, 0x0C07, 0x0C0E, 0x0C03, 0x0C06, 0x0BFC, 0x0BFD, 0x0C00, 0x0C02, 0x0C08, 0x0C0A, 0x0C0C,
+    0x0CDD, 0x0A99, 0x0CDE, 0x0CDF, 0x0000, 0x0BFA, 0x0BFE, 0x0000, 0x0C13, 0x0000, 0x0000, 0x0BFF,
+    0x0000, 0x0C15, 0x0C0F, 0x0C10, 0x0C11, 0x0C12, 0x0C05, 0x0C0B, 0x0C0D, 0x0C07, 0x0C0E, 0x0000,
+    0x0C06, 0x0BFC, 0x0BFD, 0x0C00, 0x0000, 0x0C08, 0x0000, 0x0C0C, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0BFE, 0x0000, 0x0000, 0x0000, 0x0000, 0x0BFF, 0x0000, 0x0C15, 0x0000, 0x0C10,
+    0x0000, 0x0C12, 0x0C05, 0x0C0B, 0x0000, 0x0C07, 0x0C0E, 0x0000, 0x0C06, 0x0000, 0x0000, 0x0C00,
+    0x0000, 0x0C08, 0x0000, 0x0C0C, 0x0000, 0x0A99, 0x0000, 0x0CDF, 0x0000, 0x0BFA, 0x0BFE, 0x0000,
+    0x0C13, 0x0000, 0x0000, 0x0BFF, 0x0C09, 0x0C15, 0x0C0F, 0x0000, 0x0C11, 0x0C12, 0x0C05, 0x0C0B,
+    0x0C0D, 0x0C07, 0x0C0E, 0x0000, 0x0C06, 0x0BFC, 0x0BFD, 0x0C00, 0x0000, 0x0C08, 0x0C0A, 0x0C0C,
+    0x0CDD, 0x0000, 0x0CDE, 0x0000, 0x0BF9, 0x0BFA, 0x0BFE, 0x0C01, 0x0C13, 0x0C14, 0x0C04, 0x0BFF,
+    0x0C09, 0x0C15, 0x0000, 0x0C10, 0x0C11, 0x0C12, 0x0C05, 0x0C0B, 0x0C0D, 0x0C07, 0x0C0E, 0x0C03,
+    0x0C06, 0x0BFC, 0x0BFD, 0x0C00, 0x0C02, 0x0C08, 0x0C0A, 0x0C0C, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0BFA, 0x0BFE, 0x0C01, 0x0000, 0x0C14, 0x0C04, 0x0BFF, 0x0C09, 0x0C15, 0x0000, 0x0C10,
+    0x0C11, 0x0C12, 0x0C05, 0x0C0B, 0x0C0D, 0x0C07, 0x0C0E, 0x0C03, 0x0C06, 0x0BFC, 0x0BFD, 0x0C00,
+    0x0C02, 0x0C08, 0x0C0A, 0x0C0C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0CE0, 0x0CE1, 0x0CE2, 0x0CE3, 0x0CE4, 0x0CE5, 0x0CE6, 0x0CE7, 0x0CE8, 0x0CE9, 0x0CEA, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0CEB, 0x0CEC, 0x0CED, 0x0CEE, 0x0CEF, 0x0CF0, 0x0CF1, 0x0CF2,
+    0x0CF3, 0x0CF4, 0x0CF5, 0x0CF6, 0x0CF7, 0x0CF8, 0x0CF9, 0x0CFA, 0x0CFB, 0x0CFC, 0x0CFD, 0x0CFE,
+    0x0CFF, 0x0D00, 0x0D01, 0x0D02, 0x0D03, 0x0D04, 0x0D05, 0x0479, 0x0235, 0x0D06, 0x0D07, 0x0000,
+    0x0224, 0x0226, 0x0479, 0x0227, 0x0228, 0x0489, 0x022A, 0x022B, 0x022C, 0x022D, 0x022E, 0x022F,
+    0x0230, 0x0231, 0x0232, 0x0234, 0x0481, 0x0235, 0x0536, 0x0236, 0x0237, 0x04A5, 0x0238, 0x04AA,
+    0x0537, 0x0485, 0x0D08, 0x0851, 0x0D09, 0x0D0A, 0x0D0B, 0x0D0C, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D0D, 0x0D0E,
+    0x0D0F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0D10, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0D11, 0x0D12, 0x0772, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0580, 0x0D13, 0x0D14, 0x0D15,
+    0x0547, 0x0D16, 0x0D17, 0x06C0, 0x0D18, 0x0D19, 0x0D1A, 0x0D1B, 0x0D1C, 0x0D1D, 0x0D1E, 0x0D1F,
+    0x0D20, 0x0D21, 0x05A4, 0x0D22, 0x0D23, 0x0D24, 0x0D25, 0x0D26, 0x0D27, 0x0541, 0x06B8, 0x0D28,
+    0x073F, 0x06BB, 0x0740, 0x0D29, 0x05DC, 0x0D2A, 0x0D2B, 0x0D2C, 0x0D2D, 0x0D2E, 0x072E, 0x058A,
+    0x0D2F, 0x0D30, 0x0D31, 0x0D32, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D33, 0x0D34, 0x0D35, 0x0D36,
+    0x0D37, 0x0D38, 0x0D39, 0x0D3A, 0x0D3B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0D3C, 0x0D3D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0469, 0x000A, 0x0005, 0x0006, 0x046A, 0x046B, 0x046C, 0x046D,
+    0x046E, 0x046F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D3E, 0x0D3F, 0x0D40, 0x0D41,
+    0x0D42, 0x09C1, 0x0D43, 0x0D44, 0x0D45, 0x0D46, 0x09C2, 0x0D47, 0x0D48, 0x0D49, 0x09C3, 0x0D4A,
+    0x0D4B, 0x0D4C, 0x0D4D, 0x0D4E, 0x0D4F, 0x0D50, 0x0D51, 0x0D52, 0x0D53, 0x0D54, 0x0D55, 0x09FD,
+    0x0D56, 0x0D57, 0x0D58, 0x0D59, 0x0D5A, 0x0D5B, 0x0D5C, 0x0D5D, 0x0D5E, 0x0A02, 0x09C4, 0x09C5,
+    0x0A03, 0x0D5F, 0x0D60, 0x0904, 0x0D61, 0x09C6, 0x0D62, 0x0D63, 0x0D64, 0x0D65, 0x0D65, 0x0D65,
+    0x0D66, 0x0D67, 0x0D68, 0x0D69, 0x0D6A, 0x0D6B, 0x0D6C, 0x0D6D, 0x0D6E, 0x0D6F, 0x0D70, 0x0D71,
+    0x0D72, 0x0D73, 0x0D74, 0x0D75, 0x0D76, 0x0D77, 0x0D77, 0x0A05, 0x0D78, 0x0D79, 0x0D7A, 0x0D7B,
+    0x09C8, 0x0D7C, 0x0D7D, 0x0D7E, 0x099D, 0x0D7F, 0x0D80, 0x0D81, 0x0D82, 0x0D83, 0x0D84, 0x0D85,
+    0x0D86, 0x0D87, 0x0D88, 0x0D89, 0x0D8A, 0x0D8B, 0x0D8C, 0x0D8D, 0x0D8E, 0x0D8F, 0x0D90, 0x0D91,
+    0x0D92, 0x0D93, 0x0D94, 0x0D95, 0x0D96, 0x0D97, 0x0D98, 0x0D98, 0x0D99, 0x0D9A, 0x0D9B, 0x0900,
+    0x0D9C, 0x0D9D, 0x0D9E, 0x0D9F, 0x0DA0, 0x0DA1, 0x0DA2, 0x0DA3, 0x09CD, 0x0DA4, 0x0DA5, 0x0DA6,
+    0x0DA7, 0x0DA8, 0x0DA9, 0x0DAA, 0x0DAB, 0x0DAC, 0x0DAD, 0x0DAE, 0x0DAF, 0x0DB0, 0x0DB1, 0x0DB2,
+    0x0DB3, 0x0DB4, 0x0DB5, 0x0DB6, 0x0DB7, 0x0DB8, 0x08CA, 0x0DB9, 0x0DBA, 0x0DBB, 0x0DBB, 0x0DBC,
+    0x0DBD, 0x0DBD, 0x0DBE, 0x0DBF, 0x0DC0, 0x0DC1, 0x0DC2, 0x0DC3, 0x0DC4, 0x0DC5, 0x0DC6, 0x0DC7,
+    0x0DC8, 0x0DC9, 0x0DCA, 0x09CE, 0x0DCB, 0x0DCC, 0x0DCD, 0x0DCE, 0x0A11, 0x0DCE, 0x0DCF, 0x09D0,
+    0x0DD0, 0x0DD1, 0x0DD2, 0x0DD3, 0x09D1, 0x08AF, 0x0DD4, 0x0DD5, 0x0DD6, 0x0DD7, 0x0DD8, 0x0DD9,
+    0x0DDA, 0x0DDB, 0x0DDC, 0x0DDD, 0x0DDE, 0x0DDF, 0x0DE0, 0x0DE1, 0x0DE2, 0x0DE3, 0x0DE4, 0x0DE5,
+    0x0DE6, 0x0DE7, 0x0DE8, 0x0DE9, 0x09D2, 0x0DEA, 0x0DEB, 0x0DEC, 0x0DED, 0x0DEE, 0x0DEF, 0x09D4,
+    0x0DF0, 0x0DF1, 0x0DF2, 0x0DF3, 0x0DF4, 0x0DF5, 0x0DF6, 0x0DF7, 0x08CB, 0x0A19, 0x0DF8, 0x0DF9,
+    0x0DFA, 0x0DFB, 0x0DFC, 0x0DFD, 0x0DFE, 0x0DFF, 0x09D5, 0x0E00, 0x0E01, 0x0E02, 0x0E03, 0x0A44,
+    0x0E04, 0x0E05, 0x0E06, 0x0E07, 0x0E08, 0x0E09, 0x0E0A, 0x0E0B, 0x0E0C, 0x0E0D, 0x0E0E, 0x0E0F,
+    0x0E10, 0x0911, 0x0E11, 0x0E12, 0x0E13, 0x0E14, 0x0E15, 0x0E16, 0x0E17, 0x0E18, 0x0E19, 0x0E1A,
+    0x0E1B, 0x09D6, 0x0968, 0x0E1C, 0x0E1D, 0x0E1E, 0x0E1F, 0x0E20, 0x0E21, 0x0E22, 0x0E23, 0x0A1D,
+    0x0E24, 0x0E25, 0x0E26, 0x0E27, 0x0E28, 0x0E29, 0x0E2A, 0x0E2B, 0x0A1E, 0x0E2C, 0x0E2D, 0x0E2E,
+    0x0E2F, 0x0E30, 0x0E31, 0x0E32, 0x0E33, 0x0E34, 0x0E35, 0x0E36, 0x0E37, 0x0A20, 0x0E38, 0x0E39,
+    0x0E3A, 0x0E3B, 0x0E3C, 0x0E3D, 0x0E3E, 0x0E3F, 0x0E40, 0x0E41, 0x0E42, 0x0E42, 0x0E43, 0x0E44,
+    0x0A22, 0x0E45, 0x0E46, 0x0E47, 0x0E48, 0x0E49, 0x0E4A, 0x0E4B, 0x0903, 0x0E4C, 0x0E4D, 0x0E4E,
+    0x0E4F, 0x0E50, 0x0E51, 0x0E52, 0x0A28, 0x0E53, 0x0E54, 0x0E55, 0x0E56, 0x0E57, 0x0E58, 0x0E58,
+    0x0A29, 0x0A46, 0x0E59, 0x0E5A, 0x0E5B, 0x0E5C, 0x0E5D, 0x08DD, 0x0A2B, 0x0E5E, 0x0E5F, 0x09E1,
+    0x0E60, 0x0E61, 0x09B3, 0x0E62, 0x0E63, 0x09E5, 0x0E64, 0x0E65, 0x0E66, 0x0E67, 0x0E67, 0x0E68,
+    0x0E69, 0x0E6A, 0x0E6B, 0x0E6C, 0x0E6D, 0x0E6E, 0x0E6F, 0x0E70, 0x0E71, 0x0E72, 0x0E73, 0x0E74,
+    0x0E75, 0x0E76, 0x0E77, 0x0E78, 0x0E79, 0x0E7A, 0x0E7B, 0x0E7C, 0x0E7D, 0x0E7E, 0x0E7F, 0x0E80,
+    0x0E81, 0x0E82, 0x09EB, 0x0E83, 0x0E84, 0x0E85, 0x0E86, 0x0E87, 0x0E88, 0x0E89, 0x0E8A, 0x0E8B,
+    0x0E8C, 0x0E8D, 0x0E8E, 0x0E8F, 0x0E90, 0x0E91, 0x0E92, 0x0DBC, 0x0E93, 0x0E94, 0x0E95, 0x0E96,
+    0x0E97, 0x0E98, 0x0E99, 0x0E9A, 0x0E9B, 0x0E9C, 0x0E9D, 0x0E9E, 0x0915, 0x0E9F, 0x0EA0, 0x0EA1,
+    0x0EA2, 0x0EA3, 0x0EA4, 0x09EE, 0x0EA5, 0x0EA6, 0x0EA7, 0x0EA8, 0x0EA9, 0x0EAA, 0x0EAB, 0x0EAC,
+    0x0EAD, 0x0EAE, 0x0EAF, 0x0EB0, 0x0EB1, 0x0EB2, 0x0EB3, 0x0EB4, 0x0EB5, 0x0EB6, 0x0EB7, 0x0EB8,
+    0x08D8, 0x0EB9, 0x0EBA, 0x0EBB, 0x0EBC, 0x0EBD, 0x0EBE, 0x0A32, 0x0EBF, 0x0EC0, 0x0EC1, 0x0EC2,
+    0x0EC3, 0x0EC4, 0x0EC5, 0x0EC6, 0x0EC7, 0x0EC8, 0x0EC9, 0x0ECA, 0x0ECB, 0x0ECC, 0x0ECD, 0x0ECE,
+    0x0ECF, 0x0ED0, 0x0ED1, 0x0ED2, 0x0A37, 0x0A38, 0x0ED3, 0x0ED4, 0x0ED5, 0x0ED6, 0x0ED7, 0x0ED8,
+    0x0ED9, 0x0EDA, 0x0EDB, 0x0EDC, 0x0EDD, 0x0EDE, 0x0EDF, 0x0A39, 0x0EE0, 0x0EE1, 0x0EE2, 0x0EE3,
+    0x0EE4, 0x0EE5, 0x0EE6, 0x0EE7, 0x0EE8, 0x0EE9, 0x0EEA, 0x0EEB, 0x0EEC, 0x0EED, 0x0EEE, 0x0EEF,
+    0x0EF0, 0x0EF1, 0x0EF2, 0x0EF3, 0x0EF4, 0x0EF5, 0x0EF6, 0x0EF7, 0x0EF8, 0x0EF9, 0x0EFA, 0x0EFB,
+    0x0EFC, 0x0EFD, 0x0A3F, 0x0A3F, 0x0EFE, 0x0EFF, 0x0F00, 0x0F01, 0x0F02, 0x0F03, 0x0F04, 0x0F05,
+    0x0F06, 0x0F07, 0x0A40, 0x0F08, 0x0F09, 0x0F0A, 0x0F0B, 0x0F0C, 0x0F0D, 0x0F0E, 0x0F0F, 0x0F10,
+    0x0F11, 0x0F12, 0x0F13, 0x0F14, 0x0F15, 0x0F16, 0x0F17, 0x0F18, 0x0F19, 0x0F1A, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+const UTF8NormalRecord utf8_normal_records[3867] = {
+    {0, 0, 0, 0, 0, 0x00},
+    {0, 0, 0, 0, 1, 0x12},
+    {0, 0, 0, 1, 2, 0x12},
+    {0, 0, 0, 3, 1, 0x12},
+    {0, 0, 0, 4, 2, 0x12},
+    {0, 0, 0, 6, 1, 0x12},
+    {0, 0, 0, 7, 1, 0x12},
+    {0, 0, 0, 8, 2, 0x12},
+    {0, 0, 0, 10, 1, 0x12},
+    {0, 0, 0, 11, 2, 0x12},
+    {0, 0, 0, 13, 1, 0x12},
+    {0, 0, 0, 14, 1, 0x12},
+    {0, 0, 0, 15, 3, 0x12},
+    {0, 0, 0, 18, 3, 0x12},
+    {0, 0, 0, 21, 3, 0x12},
+    {24, 2, 0, 24, 2, 0x03},
+    {26, 2, 0, 26, 2, 0x03},
+    {28, 2, 0, 28, 2, 0x03},
+    {30, 2, 0, 30, 2, 0x03},
+    {32, 2, 0, 32, 2, 0x03},
+    {34, 2, 0, 34, 2, 0x03},
+    {36, 2, 0, 36, 2, 0x03},
+    {38, 2, 0, 38, 2, 0x03},
+    {40, 2, 0, 40, 2, 0x03},
+    {42, 2, 0, 42, 2, 0x03},
+    {44, 2, 0, 44, 2, 0x03},
+    {46, 2, 0, 46, 2, 0x03},
+    {48, 2, 0, 48, 2, 0x03},
+    {50, 2, 0, 50, 2, 0x03},
+    {52, 2, 0, 52, 2, 0x03},
+    {54, 2, 0, 54, 2, 0x03},
+    {56, 2, 0, 56, 2, 0x03},
+    {58, 2, 0, 58, 2, 0x03},
+    {60, 2, 0, 60, 2, 0x03},
+    {62, 2, 0, 62, 2, 0x03},
+    {64, 2, 0, 64, 2, 0x03},
+    {66, 2, 0, 66, 2, 0x03},
+    {68, 2, 0, 68, 2, 0x03},
+    {70, 2, 0, 70, 2, 0x03},
+    {72, 2, 0, 72, 2, 0x03},
+    {74, 2, 0, 74, 2, 0x03},
+    {76, 2, 0, 76, 2, 0x03},
+    {78, 2, 0, 78, 2, 0x03},
+    {80, 2, 0, 80, 2, 0x03},
+    {82, 2, 0, 82, 2, 0x03},
+    {84, 2, 0, 84, 2, 0x03},
+    {86, 2, 0, 86, 2, 0x03},
+    {88, 2, 0, 88, 2, 0x03},
+    {90, 2, 0, 90, 2, 0x03},
+    {92, 2, 0, 92, 2, 0x03},
+    {94, 2, 0, 94, 2, 0x03},
+    {96, 2, 0, 96, 2, 0x03},
+    {98, 2, 0, 98, 2, 0x03},
+    {100, 2, 0, 100, 2, 0x03},
+    {102, 2, 0, 102, 2, 0x03},
+    {104, 2, 0, 104, 2, 0x03},
+    {106, 2, 0, 106, 2, 0x03},
+    {108, 2, 0, 108, 2, 0x03},
+    {110, 2, 0, 110, 2, 0x03},
+    {112, 2, 0, 112, 2, 0x03},
+    {114, 2, 0, 114, 2, 0x03},
+    {116, 2, 0, 116, 2, 0x03},
+    {118, 2, 0, 118, 2, 0x03},
+    {120, 2, 0, 120, 2, 0x03},
+    {122, 2, 0, 122, 2, 0x03},
+    {124, 2, 0, 124, 2, 0x03},
+    {126, 2, 0, 126, 2, 0x03},
+    {128, 2, 0, 128, 2, 0x03},
+    {130, 2, 0, 130, 2, 0x03},
+    {132, 2, 0, 132, 2, 0x03},
+    {134, 2, 0, 134, 2, 0x03},
+    {136, 2, 0, 136, 2, 0x03},
+    {138, 2, 0, 138, 2, 0x03},
+    {140, 2, 0, 140, 2, 0x03},
+    {142, 2, 0, 142, 2, 0x03},
+    {144, 2, 0, 144, 2, 0x03},
+    {146, 2, 0, 146, 2, 0x03},
+    {148, 2, 0, 148, 2, 0x03},
+    {150, 2, 0, 150, 2, 0x03},
+    {152, 2, 0, 152, 2, 0x03},
+    {154, 2, 0, 154, 2, 0x03},
+    {156, 2, 0, 156, 2, 0x03},
+    {158, 2, 0, 158, 2, 0x03},
+    {160, 2, 0, 160, 2, 0x03},
+    {162, 2, 0, 162, 2, 0x03},
+    {164, 2, 0, 164, 2, 0x03},
+    {166, 2, 0, 166, 2, 0x03},
+    {168, 2, 0, 168, 2, 0x03},
+    {170, 2, 0, 170, 2, 0x03},
+    {172, 2, 0, 172, 2, 0x03},
+    {174, 2, 0, 174, 2, 0x03},
+    {176, 2, 0, 176, 2, 0x03},
+    {178, 2, 0, 178, 2, 0x03},
+    {180, 2, 0, 180, 2, 0x03},
+    {182, 2, 0, 182, 2, 0x03},
+    {184, 2, 0, 184, 2, 0x03},
+    {186, 2, 0, 186, 2, 0x03},
+    {188, 2, 0, 188, 2, 0x03},
+    {190, 2, 0, 190, 2, 0x03},
+    {192, 2, 0, 192, 2, 0x03},
+    {194, 2, 0, 194, 2, 0x03},
+    {196, 2, 0, 196, 2, 0x03},
+    {198, 2, 0, 198, 2, 0x03},
+    {200, 2, 0, 200, 2, 0x03},
+    {202, 2, 0, 202, 2, 0x03},
+    {204, 2, 0, 204, 2, 0x03},
+    {206, 2, 0, 206, 2, 0x03},
+    {208, 2, 0, 208, 2, 0x03},
+    {210, 2, 0, 210, 2, 0x03},
+    {212, 2, 0, 212, 2, 0x03},
+    {214, 2, 0, 214, 2, 0x03},
+    {216, 2, 0, 216, 2, 0x03},
+    {218, 2, 0, 218, 2, 0x03},
+    {0, 0, 0, 220, 2, 0x12},
+    {0, 0, 0, 222, 2, 0x12},
+    {224, 2, 0, 224, 2, 0x03},
+    {226, 2, 0, 226, 2, 0x03},
+    {228, 2, 0, 228, 2, 0x03},
+    {230, 2, 0, 230, 2, 0x03},
+    {232, 2, 0, 232, 2, 0x03},
+    {234, 2, 0, 234, 2, 0x03},
+    {236, 2, 0, 236, 2, 0x03},
+    {238, 2, 0, 238, 2, 0x03},
+    {240, 2, 0, 240, 2, 0x03},
+    {242, 2, 0, 242, 2, 0x03},
+    {0, 0, 0, 244, 2, 0x12},
+    {0, 0, 0, 246, 2, 0x12},
+    {248, 2, 0, 248, 2, 0x03},
+    {250, 2, 0, 250, 2, 0x03},
+    {252, 2, 0, 252, 2, 0x03},
+    {254, 2, 0, 254, 2, 0x03},
+    {256, 2, 0, 256, 2, 0x03},
+    {258, 2, 0, 258, 2, 0x03},
+    {0, 0, 0, 260, 2, 0x12},
+    {262, 2, 0, 262, 2, 0x03},
+    {264, 2, 0, 264, 2, 0x03},
+    {266, 2, 0, 266, 2, 0x03},
+    {268, 2, 0, 268, 2, 0x03},
+    {270, 2, 0, 270, 2, 0x03},
+    {272, 2, 0, 272, 2, 0x03},
+    {274, 2, 0, 274, 2, 0x03},
+    {276, 2, 0, 276, 2, 0x03},
+    {278, 2, 0, 278, 2, 0x03},
+    {280, 2, 0, 280, 2, 0x03},
+    {282, 2, 0, 282, 2, 0x03},
+    {284, 2, 0, 284, 2, 0x03},
+    {286, 2, 0, 286, 2, 0x03},
+    {288, 2, 0, 288, 2, 0x03},
+    {290, 2, 0, 290, 2, 0x03},
+    {292, 2, 0, 292, 2, 0x03},
+    {294, 2, 0, 294, 2, 0x03},
+    {296, 2, 0, 296, 2, 0x03},
+    {298, 2, 0, 298, 2, 0x03},
+    {300, 2, 0, 300, 2, 0x03},
+    {302, 2, 0, 302, 2, 0x03},
+    {304, 2, 0, 304, 2, 0x03},
+    {306, 2, 0, 306, 2, 0x03},
+    {308, 2, 0, 308, 2, 0x03},
+    {310, 2, 0, 310, 2, 0x03},
+    {312, 2, 0, 312, 2, 0x03},
+    {314, 2, 0, 314, 2, 0x03},
+    {316, 2, 0, 316, 2, 0x03},
+    {318, 2, 0, 318, 2, 0x03},
+    {320, 2, 0, 320, 2, 0x03},
+    {322, 2, 0, 322, 2, 0x03},
+    {324, 2, 0, 324, 2, 0x03},
+    {326, 2, 0, 326, 2, 0x03},
+    {328, 2, 0, 328, 2, 0x03},
+    {330, 2, 0, 330, 2, 0x03},
+    {332, 2, 0, 332, 2, 0x03},
+    {334, 2, 0, 334, 2, 0x03},
+    {336, 2, 0, 336, 2, 0x03},
+    {338, 2, 0, 338, 2, 0x03},
+    {340, 2, 0, 340, 2, 0x03},
+    {342, 2, 0, 342, 2, 0x03},
+    {344, 2, 0, 344, 2, 0x03},
+    {346, 2, 0, 346, 2, 0x03},
+    {348, 2, 0, 348, 2, 0x03},
+    {350, 2, 0, 350, 2, 0x03},
+    {352, 2, 0, 352, 2, 0x03},
+    {354, 2, 0, 354, 2, 0x03},
+    {0, 0, 0, 356, 1, 0x12},
+    {357, 2, 0, 357, 2, 0x03},
+    {359, 2, 0, 359, 2, 0x03},
+    {361, 2, 0, 361, 2, 0x03},
+    {363, 2, 0, 363, 2, 0x03},
+    {0, 0, 0, 365, 3, 0x12},
+    {0, 0, 0, 368, 3, 0x12},
+    {0, 0, 0, 371, 3, 0x12},
+    {0, 0, 0, 374, 2, 0x12},
+    {0, 0, 0, 376, 2, 0x12},
+    {0, 0, 0, 378, 2, 0x12},
+    {0, 0, 0, 380, 2, 0x12},
+    {0, 0, 0, 382, 2, 0x12},
+    {0, 0, 0, 384, 2, 0x12},
+    {386, 2, 0, 386, 2, 0x03},
+    {388, 2, 0, 388, 2, 0x03},
+    {390, 2, 0, 390, 2, 0x03},
+    {392, 2, 0, 392, 2, 0x03},
+    {394, 2, 0, 394, 2, 0x03},
+    {396, 2, 0, 396, 2, 0x03},
+    {398, 2, 0, 398, 2, 0x03},
+    {400, 2, 0, 400, 2, 0x03},
+    {402, 3, 0, 402, 3, 0x03},
+    {405, 3, 0, 405, 3, 0x03},
+    {408, 3, 0, 408, 3, 0x03},
+    {411, 3, 0, 411, 3, 0x03},
+    {414, 3, 0, 414, 3, 0x03},
+    {417, 3, 0, 417, 3, 0x03},
+    {420, 3, 0, 420, 3, 0x03},
+    {423, 3, 0, 423, 3, 0x03},
+    {426, 3, 0, 426, 3, 0x03},
+    {429, 3, 0, 429, 3, 0x03},
+    {432, 3, 0, 432, 3, 0x03},
+    {435, 3, 0, 435, 3, 0x03},
+    {438, 2, 0, 438, 2, 0x03},
+    {440, 2, 0, 440, 2, 0x03},
+    {442, 2, 0, 442, 2, 0x03},
+    {444, 2, 0, 444, 2, 0x03},
+    {446, 2, 0, 446, 2, 0x03},
+    {448, 2, 0, 448, 2, 0x03},
+    {450, 2, 0, 450, 2, 0x03},
+    {452, 2, 0, 452, 2, 0x03},
+    {454, 3, 0, 454, 3, 0x03},
+    {457, 3, 0, 457, 3, 0x03},
+    {460, 2, 0, 460, 2, 0x03},
+    {462, 2, 0, 462, 2, 0x03},
+    {464, 2, 0, 464, 2, 0x03},
+    {0, 0, 0, 466, 2, 0x12},
+    {0, 0, 0, 468, 2, 0x12},
+    {0, 0, 0, 470, 2, 0x12},
+    {472, 2, 0, 472, 2, 0x03},
+    {474, 2, 0, 474, 2, 0x03},
+    {476, 2, 0, 476, 2, 0x03},
+    {478, 2, 0, 478, 2, 0x03},
+    {480, 3, 0, 480, 3, 0x03},
+    {483, 3, 0, 483, 3, 0x03},
+    {486, 2, 0, 486, 2, 0x03},
+    {488, 2, 0, 488, 2, 0x03},
+    {490, 2, 0, 490, 2, 0x03},
+    {492, 2, 0, 492, 2, 0x03},
+    {494, 2, 0, 494, 2, 0x03},
+    {496, 2, 0, 496, 2, 0x03},
+    {498, 2, 0, 498, 2, 0x03},
+    {500, 2, 0, 500, 2, 0x03},
+    {502, 2, 0, 502, 2, 0x03},
+    {504, 2, 0, 504, 2, 0x03},
+    {506, 2, 0, 506, 2, 0x03},
+    {508, 2, 0, 508, 2, 0x03},
+    {510, 2, 0, 510, 2, 0x03},
+    {512, 2, 0, 512, 2, 0x03},
+    {514, 2, 0, 514, 2, 0x03},
+    {516, 2, 0, 516, 2, 0x03},
+    {518, 2, 0, 518, 2, 0x03},
+    {520, 2, 0, 520, 2, 0x03},
+    {522, 2, 0, 522, 2, 0x03},
+    {524, 2, 0, 524, 2, 0x03},
+    {526, 2, 0, 526, 2, 0x03},
+    {528, 2, 0, 528, 2, 0x03},
+    {530, 2, 0, 530, 2, 0x03},
+    {532, 2, 0, 532, 2, 0x03},
+    {534, 2, 0, 534, 2, 0x03},
+    {536, 2, 0, 536, 2, 0x03},
+    {538, 2, 0, 538, 2, 0x03},
+    {540, 2, 0, 540, 2, 0x03},
+    {542, 2, 0, 542, 2, 0x03},
+    {544, 2, 0, 544, 2, 0x03},
+    {546, 2, 0, 546, 2, 0x03},
+    {548, 2, 0, 548, 2, 0x03},
+    {550, 2, 0, 550, 2, 0x03},
+    {552, 2, 0, 552, 2, 0x03},
+    {554, 2, 0, 554, 2, 0x03},
+    {556, 2, 0, 556, 2, 0x03},
+    {558, 2, 0, 558, 2, 0x03},
+    {560, 2, 0, 560, 2, 0x03},
+    {562, 3, 0, 562, 3, 0x03},
+    {565, 3, 0, 565, 3, 0x03},
+    {568, 3, 0, 568, 3, 0x03},
+    {571, 3, 0, 571, 3, 0x03},
+    {574, 2, 0, 574, 2, 0x03},
+    {576, 2, 0, 576, 2, 0x03},
+    {578, 3, 0, 578, 3, 0x03},
+    {581, 3, 0, 581, 3, 0x03},
+    {584, 2, 0, 584, 2, 0x03},
+    {586, 2, 0, 586, 2, 0x03},
+    {0, 0, 0, 588, 1, 0x12},
+    {0, 0, 0, 589, 1, 0x12},
+    {0, 0, 0, 590, 1, 0x12},
+    {0, 0, 0, 591, 1, 0x12},
+    {0, 0, 0, 592, 1, 0x12},
+    {0, 0, 0, 593, 1, 0x12},
+    {0, 0, 0, 594, 1, 0x12},
+    {0, 0, 0, 595, 1, 0x12},
+    {0, 0, 0, 596, 1, 0x12},
+    {0, 0, 0, 597, 2, 0x12},
+    {0, 0, 0, 599, 2, 0x12},
+    {0, 0, 0, 601, 2, 0x12},
+    {0, 0, 0, 603, 2, 0x12},
+    {0, 0, 0, 605, 2, 0x12},
+    {0, 0, 0, 607, 2, 0x12},
+    {0, 0, 0, 609, 1, 0x12},
+    {0, 0, 0, 610, 1, 0x12},
+    {0, 0, 0, 611, 1, 0x12},
+    {0, 0, 0, 612, 1, 0x12},
+    {0, 0, 230, 0, 0, 0x28},
+    {0, 0, 230, 0, 0, 0x00},
+    {0, 0, 232, 0, 0, 0x00},
+    {0, 0, 220, 0, 0, 0x00},
+    {0, 0, 216, 0, 0, 0x28},
+    {0, 0, 202, 0, 0, 0x00},
+    {0, 0, 220, 0, 0, 0x28},
+    {0, 0, 202, 0, 0, 0x28},
+    {0, 0, 1, 0, 0, 0x00},
+    {0, 0, 1, 0, 0, 0x28},
+    {613, 1, 230, 613, 1, 0x17},
+    {614, 1, 230, 614, 1, 0x17},
+    {615, 1, 230, 615, 1, 0x17},
+    {616, 2, 230, 616, 2, 0x17},
+    {0, 0, 240, 0, 0, 0x28},
+    {0, 0, 233, 0, 0, 0x00},
+    {0, 0, 234, 0, 0, 0x00},
+    {618, 1, 0, 618, 1, 0x17},
+    {0, 0, 0, 619, 2, 0x12},
+    {621, 1, 0, 621, 1, 0x17},
+    {622, 2, 0, 624, 3, 0x13},
+    {627, 2, 0, 627, 2, 0x03},
+    {629, 1, 0, 629, 1, 0x17},
+    {630, 2, 0, 630, 2, 0x03},
+    {632, 2, 0, 632, 2, 0x03},
+    {634, 2, 0, 634, 2, 0x03},
+    {636, 2, 0, 636, 2, 0x03},
+    {638, 2, 0, 638, 2, 0x03},
+    {640, 2, 0, 640, 2, 0x03},
+    {642, 3, 0, 642, 3, 0x03},
+    {645, 2, 0, 645, 2, 0x03},
+    {647, 2, 0, 647, 2, 0x03},
+    {649, 2, 0, 649, 2, 0x03},
+    {651, 2, 0, 651, 2, 0x03},
+    {653, 2, 0, 653, 2, 0x03},
+    {655, 2, 0, 655, 2, 0x03},
+    {657, 3, 0, 657, 3, 0x03},
+    {660, 2, 0, 660, 2, 0x03},
+    {662, 2, 0, 662, 2, 0x03},
+    {664, 2, 0, 664, 2, 0x03},
+    {666, 2, 0, 666, 2, 0x03},
+    {668, 2, 0, 668, 2, 0x03},
+    {0, 0, 0, 670, 1, 0x12},
+    {0, 0, 0, 671, 1, 0x12},
+    {0, 0, 0, 672, 1, 0x12},
+    {673, 2, 0, 638, 2, 0x13},
+    {675, 2, 0, 647, 2, 0x13},
+    {0, 0, 0, 677, 1, 0x12},
+    {0, 0, 0, 678, 1, 0x12},
+    {0, 0, 0, 679, 1, 0x12},
+    {0, 0, 0, 680, 1, 0x12},
+    {0, 0, 0, 681, 1, 0x12},
+    {0, 0, 0, 682, 1, 0x12},
+    {0, 0, 0, 683, 1, 0x12},
+    {0, 0, 0, 684, 1, 0x12},
+    {685, 2, 0, 685, 2, 0x03},
+    {687, 2, 0, 687, 2, 0x03},
+    {689, 2, 0, 689, 2, 0x03},
+    {691, 2, 0, 691, 2, 0x03},
+    {693, 2, 0, 693, 2, 0x03},
+    {695, 2, 0, 695, 2, 0x03},
+    {697, 2, 0, 697, 2, 0x03},
+    {699, 2, 0, 699, 2, 0x03},
+    {701, 2, 0, 701, 2, 0x03},
+    {703, 2, 0, 703, 2, 0x03},
+    {705, 2, 0, 705, 2, 0x03},
+    {707, 2, 0, 707, 2, 0x03},
+    {709, 2, 0, 709, 2, 0x03},
+    {711, 2, 0, 711, 2, 0x03},
+    {713, 2, 0, 713, 2, 0x03},
+    {715, 2, 0, 715, 2, 0x03},
+    {717, 2, 0, 717, 2, 0x03},
+    {719, 2, 0, 719, 2, 0x03},
+    {721, 2, 0, 721, 2, 0x03},
+    {723, 2, 0, 723, 2, 0x03},
+    {725, 2, 0, 725, 2, 0x03},
+    {727, 2, 0, 727, 2, 0x03},
+    {729, 2, 0, 729, 2, 0x03},
+    {731, 2, 0, 731, 2, 0x03},
+    {733, 2, 0, 733, 2, 0x03},
+    {735, 2, 0, 735, 2, 0x03},
+    {737, 2, 0, 737, 2, 0x03},
+    {739, 2, 0, 739, 2, 0x03},
+    {741, 2, 0, 741, 2, 0x03},
+    {743, 2, 0, 743, 2, 0x03},
+    {745, 2, 0, 745, 2, 0x03},
+    {747, 2, 0, 747, 2, 0x03},
+    {749, 2, 0, 749, 2, 0x03},
+    {751, 2, 0, 751, 2, 0x03},
+    {753, 2, 0, 753, 2, 0x03},
+    {755, 2, 0, 755, 2, 0x03},
+    {757, 2, 0, 757, 2, 0x03},
+    {759, 2, 0, 759, 2, 0x03},
+    {761, 2, 0, 761, 2, 0x03},
+    {763, 2, 0, 763, 2, 0x03},
+    {765, 2, 0, 765, 2, 0x03},
+    {767, 2, 0, 767, 2, 0x03},
+    {769, 2, 0, 769, 2, 0x03},
+    {771, 2, 0, 771, 2, 0x03},
+    {773, 2, 0, 773, 2, 0x03},
+    {775, 2, 0, 775, 2, 0x03},
+    {777, 2, 0, 777, 2, 0x03},
+    {779, 2, 0, 779, 2, 0x03},
+    {781, 2, 0, 781, 2, 0x03},
+    {783, 2, 0, 783, 2, 0x03},
+    {785, 2, 0, 785, 2, 0x03},
+    {787, 2, 0, 787, 2, 0x03},
+    {0, 0, 0, 789, 2, 0x12},
+    {0, 0, 222, 0, 0, 0x00},
+    {0, 0, 228, 0, 0, 0x00},
+    {0, 0, 10, 0, 0, 0x00},
+    {0, 0, 11, 0, 0, 0x00},
+    {0, 0, 12, 0, 0, 0x00},
+    {0, 0, 13, 0, 0, 0x00},
+    {0, 0, 14, 0, 0, 0x00},
+    {0, 0, 15, 0, 0, 0x00},
+    {0, 0, 16, 0, 0, 0x00},
+    {0, 0, 17, 0, 0, 0x00},
+    {0, 0, 18, 0, 0, 0x00},
+    {0, 0, 19, 0, 0, 0x00},
+    {0, 0, 20, 0, 0, 0x00},
+    {0, 0, 21, 0, 0, 0x00},
+    {0, 0, 22, 0, 0, 0x00},
+    {0, 0, 23, 0, 0, 0x00},
+    {0, 0, 24, 0, 0, 0x00},
+    {0, 0, 25, 0, 0, 0x00},
+    {0, 0, 30, 0, 0, 0x00},
+    {0, 0, 31, 0, 0, 0x00},
+    {0, 0, 32, 0, 0, 0x00},
+    {791, 2, 0, 791, 2, 0x03},
+    {793, 2, 0, 793, 2, 0x03},
+    {795, 2, 0, 795, 2, 0x03},
+    {797, 2, 0, 797, 2, 0x03},
+    {799, 2, 0, 799, 2, 0x03},
+    {0, 0, 27, 0, 0, 0x00},
+    {0, 0, 28, 0, 0, 0x00},
+    {0, 0, 29, 0, 0, 0x00},
+    {0, 0, 33, 0, 0, 0x00},
+    {0, 0, 34, 0, 0, 0x00},
+    {0, 0, 35, 0, 0, 0x00},
+    {0, 0, 0, 801, 2, 0x12},
+    {0, 0, 0, 803, 2, 0x12},
+    {0, 0, 0, 805, 2, 0x12},
+    {0, 0, 0, 807, 2, 0x12},
+    {809, 2, 0, 809, 2, 0x03},
+    {811, 2, 0, 811, 2, 0x03},
+    {813, 2, 0, 813, 2, 0x03},
+    {0, 0, 36, 0, 0, 0x00},
+    {815, 2, 0, 815, 2, 0x03},
+    {817, 2, 0, 817, 2, 0x03},
+    {819, 2, 0, 819, 2, 0x03},
+    {0, 0, 7, 0, 0, 0x28},
+    {0, 0, 9, 0, 0, 0x00},
+    {821, 2, 0, 821, 2, 0x17},
+    {823, 2, 0, 823, 2, 0x17},
+    {825, 2, 0, 825, 2, 0x17},
+    {827, 2, 0, 827, 2, 0x17},
+    {829, 2, 0, 829, 2, 0x17},
+    {831, 2, 0, 831, 2, 0x17},
+    {833, 2, 0, 833, 2, 0x17},
+    {835, 2, 0, 835, 2, 0x17},
+    {0, 0, 7, 0, 0, 0x00},
+    {0, 0, 0, 0, 0, 0x28},
+    {837, 2, 0, 837, 2, 0x03},
+    {839, 2, 0, 839, 2, 0x03},
+    {841, 2, 0, 841, 2, 0x17},
+    {843, 2, 0, 843, 2, 0x17},
+    {845, 2, 0, 845, 2, 0x17},
+    {847, 2, 0, 847, 2, 0x17},
+    {849, 2, 0, 849, 2, 0x17},
+    {851, 2, 0, 851, 2, 0x17},
+    {853, 2, 0, 853, 2, 0x17},
+    {855, 2, 0, 855, 2, 0x17},
+    {857, 2, 0, 857, 2, 0x17},
+    {859, 2, 0, 859, 2, 0x03},
+    {861, 2, 0, 861, 2, 0x03},
+    {863, 2, 0, 863, 2, 0x03},
+    {865, 2, 0, 865, 2, 0x17},
+    {867, 2, 0, 867, 2, 0x17},
+    {869, 2, 0, 869, 2, 0x03},
+    {871, 2, 0, 871, 2, 0x03},
+    {873, 2, 0, 873, 2, 0x03},
+    {875, 2, 0, 875, 2, 0x03},
+    {877, 2, 0, 877, 2, 0x03},
+    {0, 0, 84, 0, 0, 0x00},
+    {0, 0, 91, 0, 0, 0x28},
+    {879, 2, 0, 879, 2, 0x03},
+    {881, 2, 0, 881, 2, 0x03},
+    {883, 2, 0, 883, 2, 0x03},
+    {885, 2, 0, 885, 2, 0x03},
+    {887, 3, 0, 887, 3, 0x03},
+    {890, 2, 0, 890, 2, 0x03},
+    {892, 2, 0, 892, 2, 0x03},
+    {894, 2, 0, 894, 2, 0x03},
+    {0, 0, 9, 0, 0, 0x28},
+    {896, 2, 0, 896, 2, 0x03},
+    {898, 2, 0, 898, 2, 0x03},
+    {900, 3, 0, 900, 3, 0x03},
+    {903, 2, 0, 903, 2, 0x03},
+    {0, 0, 0, 905, 2, 0x12},
+    {0, 0, 103, 0, 0, 0x00},
+    {0, 0, 107, 0, 0, 0x00},
+    {0, 0, 0, 907, 2, 0x12},
+    {0, 0, 118, 0, 0, 0x00},
+    {0, 0, 122, 0, 0, 0x00},
+    {0, 0, 0, 909, 2, 0x12},
+    {0, 0, 0, 911, 2, 0x12},
+    {0, 0, 0, 913, 1, 0x12},
+    {0, 0, 216, 0, 0, 0x00},
+    {914, 2, 0, 914, 2, 0x17},
+    {916, 2, 0, 916, 2, 0x17},
+    {918, 2, 0, 918, 2, 0x17},
+    {920, 2, 0, 920, 2, 0x17},
+    {922, 2, 0, 922, 2, 0x17},
+    {924, 2, 0, 924, 2, 0x17},
+    {0, 0, 129, 0, 0, 0x00},
+    {0, 0, 130, 0, 0, 0x00},
+    {926, 2, 0, 926, 2, 0x17},
+    {0, 0, 132, 0, 0, 0x00},
+    {928, 2, 0, 928, 2, 0x17},
+    {930, 2, 0, 930, 2, 0x17},
+    {0, 0, 0, 932, 3, 0x12},
+    {935, 2, 0, 935, 2, 0x17},
+    {0, 0, 0, 937, 3, 0x12},
+    {940, 2, 0, 940, 2, 0x17},
+    {942, 2, 0, 942, 2, 0x17},
+    {944, 2, 0, 944, 2, 0x17},
+    {946, 2, 0, 946, 2, 0x17},
+    {948, 2, 0, 948, 2, 0x17},
+    {950, 2, 0, 950, 2, 0x17},
+    {952, 2, 0, 952, 2, 0x17},
+    {954, 2, 0, 954, 2, 0x03},
+    {0, 0, 0, 956, 1, 0x12},
+    {957, 2, 0, 957, 2, 0x03},
+    {959, 2, 0, 959, 2, 0x03},
+    {961, 2, 0, 961, 2, 0x03},
+    {963, 2, 0, 963, 2, 0x03},
+    {965, 2, 0, 965, 2, 0x03},
+    {967, 2, 0, 967, 2, 0x03},
+    {969, 2, 0, 969, 2, 0x03},
+    {971, 2, 0, 971, 2, 0x03},
+    {973, 2, 0, 973, 2, 0x03},
+    {975, 2, 0, 975, 2, 0x03},
+    {977, 2, 0, 977, 2, 0x03},
+    {0, 0, 0, 979, 1, 0x12},
+    {0, 0, 0, 980, 1, 0x12},
+    {0, 0, 0, 981, 1, 0x12},
+    {0, 0, 0, 982, 1, 0x12},
+    {0, 0, 0, 983, 1, 0x12},
+    {0, 0, 0, 984, 1, 0x12},
+    {0, 0, 0, 985, 1, 0x12},
+    {0, 0, 0, 986, 1, 0x12},
+    {0, 0, 0, 987, 1, 0x12},
+    {0, 0, 0, 988, 1, 0x12},
+    {0, 0, 0, 989, 1, 0x12},
+    {0, 0, 0, 990, 1, 0x12},
+    {0, 0, 0, 991, 1, 0x12},
+    {0, 0, 0, 992, 1, 0x12},
+    {0, 0, 0, 993, 1, 0x12},
+    {0, 0, 0, 994, 1, 0x12},
+    {0, 0, 0, 995, 1, 0x12},
+    {0, 0, 0, 996, 1, 0x12},
+    {0, 0, 0, 997, 1, 0x12},
+    {0, 0, 0, 998, 1, 0x12},
+    {0, 0, 0, 999, 1, 0x12},
+    {0, 0, 0, 1000, 1, 0x12},
+    {0, 0, 0, 1001, 1, 0x12},
+    {0, 0, 0, 1002, 1, 0x12},
+    {0, 0, 0, 1003, 1, 0x12},
+    {0, 0, 0, 1004, 1, 0x12},
+    {0, 0, 0, 1005, 1, 0x12},
+    {0, 0, 0, 1006, 1, 0x12},
+    {0, 0, 0, 1007, 1, 0x12},
+    {0, 0, 0, 1008, 1, 0x12},
+    {0, 0, 0, 1009, 1, 0x12},
+    {0, 0, 0, 1010, 1, 0x12},
+    {0, 0, 0, 1011, 1, 0x12},
+    {0, 0, 0, 1012, 1, 0x12},
+    {0, 0, 0, 1013, 1, 0x12},
+    {0, 0, 0, 1014, 1, 0x12},
+    {0, 0, 0, 1015, 1, 0x12},
+    {0, 0, 0, 1016, 1, 0x12},
+    {0, 0, 0, 1017, 1, 0x12},
+    {0, 0, 0, 1018, 1, 0x12},
+    {0, 0, 0, 1019, 1, 0x12},
+    {0, 0, 0, 1020, 1, 0x12},
+    {0, 0, 0, 1021, 1, 0x12},
+    {0, 0, 0, 1022, 1, 0x12},
+    {0, 0, 0, 1023, 1, 0x12},
+    {0, 0, 0, 1024, 1, 0x12},
+    {0, 0, 0, 1025, 1, 0x12},
+    {0, 0, 0, 1026, 1, 0x12},
+    {0, 0, 0, 1027, 1, 0x12},
+    {0, 0, 0, 1028, 1, 0x12},
+    {0, 0, 0, 1029, 1, 0x12},
+    {0, 0, 0, 1030, 1, 0x12},
+    {0, 0, 0, 1031, 1, 0x12},
+    {0, 0, 0, 1032, 1, 0x12},
+    {0, 0, 0, 1033, 1, 0x12},
+    {0, 0, 0, 1034, 1, 0x12},
+    {0, 0, 0, 1035, 1, 0x12},
+    {0, 0, 0, 1036, 1, 0x12},
+    {0, 0, 0, 1037, 1, 0x12},
+    {0, 0, 0, 1038, 1, 0x12},
+    {0, 0, 0, 1039, 1, 0x12},
+    {0, 0, 0, 1040, 1, 0x12},
+    {0, 0, 0, 1041, 1, 0x12},
+    {0, 0, 0, 1042, 1, 0x12},
+    {0, 0, 0, 1043, 1, 0x12},
+    {0, 0, 0, 1044, 1, 0x12},
+    {0, 0, 0, 1045, 1, 0x12},
+    {0, 0, 0, 1046, 1, 0x12},
+    {0, 0, 0, 1047, 1, 0x12},
+    {0, 0, 0, 1048, 1, 0x12},
+    {0, 0, 0, 1049, 1, 0x12},
+    {0, 0, 0, 1050, 1, 0x12},
+    {0, 0, 0, 1051, 1, 0x12},
+    {0, 0, 0, 1052, 1, 0x12},
+    {0, 0, 0, 1053, 1, 0x12},
+    {0, 0, 0, 1054, 1, 0x12},
+    {0, 0, 0, 1055, 1, 0x12},
+    {0, 0, 0, 1056, 1, 0x12},
+    {0, 0, 0, 1057, 1, 0x12},
+    {0, 0, 0, 1058, 1, 0x12},
+    {0, 0, 0, 1059, 1, 0x12},
+    {0, 0, 0, 1060, 1, 0x12},
+    {0, 0, 0, 1061, 1, 0x12},
+    {0, 0, 0, 1062, 1, 0x12},
+    {0, 0, 214, 0, 0, 0x00},
+    {0, 0, 218, 0, 0, 0x00},
+    {1063, 2, 0, 1063, 2, 0x03},
+    {1065, 2, 0, 1065, 2, 0x03},
+    {1067, 2, 0, 1067, 2, 0x03},
+    {1069, 2, 0, 1069, 2, 0x03},
+    {1071, 2, 0, 1071, 2, 0x03},
+    {1073, 2, 0, 1073, 2, 0x03},
+    {1075, 2, 0, 1075, 2, 0x03},
+    {1077, 2, 0, 1077, 2, 0x03},
+    {1079, 3, 0, 1079, 3, 0x03},
+    {1082, 3, 0, 1082, 3, 0x03},
+    {1085, 2, 0, 1085, 2, 0x03},
+    {1087, 2, 0, 1087, 2, 0x03},
+    {1089, 2, 0, 1089, 2, 0x03},
+    {1091, 2, 0, 1091, 2, 0x03},
+    {1093, 2, 0, 1093, 2, 0x03},
+    {1095, 2, 0, 1095, 2, 0x03},
+    {1097, 2, 0, 1097, 2, 0x03},
+    {1099, 2, 0, 1099, 2, 0x03},
+    {1101, 2, 0, 1101, 2, 0x03},
+    {1103, 2, 0, 1103, 2, 0x03},
+    {1105, 3, 0, 1105, 3, 0x03},
+    {1108, 3, 0, 1108, 3, 0x03},
+    {1111, 3, 0, 1111, 3, 0x03},
+    {1114, 3, 0, 1114, 3, 0x03},
+    {1117, 2, 0, 1117, 2, 0x03},
+    {1119, 2, 0, 1119, 2, 0x03},
+    {1121, 2, 0, 1121, 2, 0x03},
+    {1123, 2, 0, 1123, 2, 0x03},
+    {1125, 3, 0, 1125, 3, 0x03},
+    {1128, 3, 0, 1128, 3, 0x03},
+    {1131, 2, 0, 1131, 2, 0x03},
+    {1133, 2, 0, 1133, 2, 0x03},
+    {1135, 2, 0, 1135, 2, 0x03},
+    {1137, 2, 0, 1137, 2, 0x03},
+    {1139, 2, 0, 1139, 2, 0x03},
+    {1141, 2, 0, 1141, 2, 0x03},
+    {1143, 2, 0, 1143, 2, 0x03},
+    {1145, 2, 0, 1145, 2, 0x03},
+    {1147, 2, 0, 1147, 2, 0x03},
+    {1149, 2, 0, 1149, 2, 0x03},
+    {1151, 2, 0, 1151, 2, 0x03},
+    {1153, 2, 0, 1153, 2, 0x03},
+    {1155, 2, 0, 1155, 2, 0x03},
+    {1157, 2, 0, 1157, 2, 0x03},
+    {1159, 2, 0, 1159, 2, 0x03},
+    {1161, 2, 0, 1161, 2, 0x03},
+    {1163, 3, 0, 1163, 3, 0x03},
+    {1166, 3, 0, 1166, 3, 0x03},
+    {1169, 2, 0, 1169, 2, 0x03},
+    {1171, 2, 0, 1171, 2, 0x03},
+    {1173, 2, 0, 1173, 2, 0x03},
+    {1175, 2, 0, 1175, 2, 0x03},
+    {1177, 2, 0, 1177, 2, 0x03},
+    {1179, 2, 0, 1179, 2, 0x03},
+    {1181, 2, 0, 1181, 2, 0x03},
+    {1183, 2, 0, 1183, 2, 0x03},
+    {1185, 3, 0, 1185, 3, 0x03},
+    {1188, 3, 0, 1188, 3, 0x03},
+    {1191, 2, 0, 1191, 2, 0x03},
+    {1193, 2, 0, 1193, 2, 0x03},
+    {1195, 2, 0, 1195, 2, 0x03},
+    {1197, 2, 0, 1197, 2, 0x03},
+    {1199, 2, 0, 1199, 2, 0x03},
+    {1201, 2, 0, 1201, 2, 0x03},
+    {1203, 2, 0, 1203, 2, 0x03},
+    {1205, 2, 0, 1205, 2, 0x03},
+    {1207, 2, 0, 1207, 2, 0x03},
+    {1209, 2, 0, 1209, 2, 0x03},
+    {1211, 2, 0, 1211, 2, 0x03},
+    {1213, 2, 0, 1213, 2, 0x03},
+    {1215, 2, 0, 1215, 2, 0x03},
+    {1217, 2, 0, 1217, 2, 0x03},
+    {1219, 2, 0, 1219, 2, 0x03},
+    {1221, 2, 0, 1221, 2, 0x03},
+    {1223, 2, 0, 1223, 2, 0x03},
+    {1225, 2, 0, 1225, 2, 0x03},
+    {1227, 3, 0, 1227, 3, 0x03},
+    {1230, 3, 0, 1230, 3, 0x03},
+    {1233, 3, 0, 1233, 3, 0x03},
+    {1236, 3, 0, 1236, 3, 0x03},
+    {1239, 3, 0, 1239, 3, 0x03},
+    {1242, 3, 0, 1242, 3, 0x03},
+    {1245, 3, 0, 1245, 3, 0x03},
+    {1248, 3, 0, 1248, 3, 0x03},
+    {1251, 2, 0, 1251, 2, 0x03},
+    {1253, 2, 0, 1253, 2, 0x03},
+    {1255, 2, 0, 1255, 2, 0x03},
+    {1257, 2, 0, 1257, 2, 0x03},
+    {1259, 2, 0, 1259, 2, 0x03},
+    {1261, 2, 0, 1261, 2, 0x03},
+    {1263, 2, 0, 1263, 2, 0x03},
+    {1265, 2, 0, 1265, 2, 0x03},
+    {1267, 3, 0, 1267, 3, 0x03},
+    {1270, 3, 0, 1270, 3, 0x03},
+    {1273, 2, 0, 1273, 2, 0x03},
+    {1275, 2, 0, 1275, 2, 0x03},
+    {1277, 2, 0, 1277, 2, 0x03},
+    {1279, 2, 0, 1279, 2, 0x03},
+    {1281, 2, 0, 1281, 2, 0x03},
+    {1283, 2, 0, 1283, 2, 0x03},
+    {1285, 3, 0, 1285, 3, 0x03},
+    {1288, 3, 0, 1288, 3, 0x03},
+    {1291, 3, 0, 1291, 3, 0x03},
+    {1294, 3, 0, 1294, 3, 0x03},
+    {1297, 3, 0, 1297, 3, 0x03},
+    {1300, 3, 0, 1300, 3, 0x03},
+    {1303, 2, 0, 1303, 2, 0x03},
+    {1305, 2, 0, 1305, 2, 0x03},
+    {1307, 2, 0, 1307, 2, 0x03},
+    {1309, 2, 0, 1309, 2, 0x03},
+    {1311, 2, 0, 1311, 2, 0x03},
+    {1313, 2, 0, 1313, 2, 0x03},
+    {1315, 2, 0, 1315, 2, 0x03},
+    {1317, 2, 0, 1317, 2, 0x03},
+    {1319, 2, 0, 1319, 2, 0x03},
+    {1321, 2, 0, 1321, 2, 0x03},
+    {1323, 2, 0, 1323, 2, 0x03},
+    {1325, 2, 0, 1325, 2, 0x03},
+    {1327, 2, 0, 1327, 2, 0x03},
+    {1329, 2, 0, 1329, 2, 0x03},
+    {1331, 3, 0, 1331, 3, 0x03},
+    {1334, 3, 0, 1334, 3, 0x03},
+    {1337, 3, 0, 1337, 3, 0x03},
+    {1340, 3, 0, 1340, 3, 0x03},
+    {1343, 2, 0, 1343, 2, 0x03},
+    {1345, 2, 0, 1345, 2, 0x03},
+    {1347, 2, 0, 1347, 2, 0x03},
+    {1349, 2, 0, 1349, 2, 0x03},
+    {1351, 2, 0, 1351, 2, 0x03},
+    {1353, 2, 0, 1353, 2, 0x03},
+    {1355, 2, 0, 1355, 2, 0x03},
+    {1357, 2, 0, 1357, 2, 0x03},
+    {1359, 2, 0, 1359, 2, 0x03},
+    {1361, 2, 0, 1361, 2, 0x03},
+    {1363, 2, 0, 1363, 2, 0x03},
+    {1365, 2, 0, 1365, 2, 0x03},
+    {1367, 2, 0, 1367, 2, 0x03},
+    {1369, 2, 0, 1369, 2, 0x03},
+    {1371, 2, 0, 1371, 2, 0x03},
+    {1373, 2, 0, 1373, 2, 0x03},
+    {1375, 2, 0, 1375, 2, 0x03},
+    {1377, 2, 0, 1377, 2, 0x03},
+    {1379, 2, 0, 1379, 2, 0x03},
+    {1381, 2, 0, 1381, 2, 0x03},
+    {1383, 2, 0, 1383, 2, 0x03},
+    {1385, 2, 0, 1385, 2, 0x03},
+    {1387, 2, 0, 1387, 2, 0x03},
+    {1389, 2, 0, 1389, 2, 0x03},
+    {1391, 2, 0, 1391, 2, 0x03},
+    {1393, 2, 0, 1393, 2, 0x03},
+    {1395, 2, 0, 1395, 2, 0x03},
+    {1397, 2, 0, 1397, 2, 0x03},
+    {1399, 2, 0, 1399, 2, 0x03},
+    {1401, 2, 0, 1401, 2, 0x03},
+    {0, 0, 0, 1403, 2, 0x12},
+    {1405, 2, 0, 1279, 2, 0x13},
+    {1407, 2, 0, 1407, 2, 0x03},
+    {1409, 2, 0, 1409, 2, 0x03},
+    {1411, 2, 0, 1411, 2, 0x03},
+    {1413, 2, 0, 1413, 2, 0x03},
+    {1415, 3, 0, 1415, 3, 0x03},
+    {1418, 3, 0, 1418, 3, 0x03},
+    {1421, 3, 0, 1421, 3, 0x03},
+    {1424, 3, 0, 1424, 3, 0x03},
+    {1427, 3, 0, 1427, 3, 0x03},
+    {1430, 3, 0, 1430, 3, 0x03},
+    {1433, 3, 0, 1433, 3, 0x03},
+    {1436, 3, 0, 1436, 3, 0x03},
+    {1439, 3, 0, 1439, 3, 0x03},
+    {1442, 3, 0, 1442, 3, 0x03},
+    {1445, 3, 0, 1445, 3, 0x03},
+    {1448, 3, 0, 1448, 3, 0x03},
+    {1451, 3, 0, 1451, 3, 0x03},
+    {1454, 3, 0, 1454, 3, 0x03},
+    {1457, 3, 0, 1457, 3, 0x03},
+    {1460, 3, 0, 1460, 3, 0x03},
+    {1463, 3, 0, 1463, 3, 0x03},
+    {1466, 3, 0, 1466, 3, 0x03},
+    {1469, 3, 0, 1469, 3, 0x03},
+    {1472, 3, 0, 1472, 3, 0x03},
+    {1475, 2, 0, 1475, 2, 0x03},
+    {1477, 2, 0, 1477, 2, 0x03},
+    {1479, 2, 0, 1479, 2, 0x03},
+    {1481, 2, 0, 1481, 2, 0x03},
+    {1483, 2, 0, 1483, 2, 0x03},
+    {1485, 2, 0, 1485, 2, 0x03},
+    {1487, 3, 0, 1487, 3, 0x03},
+    {1490, 3, 0, 1490, 3, 0x03},
+    {1493, 3, 0, 1493, 3, 0x03},
+    {1496, 3, 0, 1496, 3, 0x03},
+    {1499, 3, 0, 1499, 3, 0x03},
+    {1502, 3, 0, 1502, 3, 0x03},
+    {1505, 3, 0, 1505, 3, 0x03},
+    {1508, 3, 0, 1508, 3, 0x03},
+    {1511, 3, 0, 1511, 3, 0x03},
+    {1514, 3, 0, 1514, 3, 0x03},
+    {1517, 2, 0, 1517, 2, 0x03},
+    {1519, 2, 0, 1519, 2, 0x03},
+    {1521, 2, 0, 1521, 2, 0x03},
+    {1523, 2, 0, 1523, 2, 0x03},
+    {1525, 2, 0, 1525, 2, 0x03},
+    {1527, 2, 0, 1527, 2, 0x03},
+    {1529, 2, 0, 1529, 2, 0x03},
+    {1531, 2, 0, 1531, 2, 0x03},
+    {1533, 3, 0, 1533, 3, 0x03},
+    {1536, 3, 0, 1536, 3, 0x03},
+    {1539, 3, 0, 1539, 3, 0x03},
+    {1542, 3, 0, 1542, 3, 0x03},
+    {1545, 3, 0, 1545, 3, 0x03},
+    {1548, 3, 0, 1548, 3, 0x03},
+    {1551, 3, 0, 1551, 3, 0x03},
+    {1554, 3, 0, 1554, 3, 0x03},
+    {1557, 3, 0, 1557, 3, 0x03},
+    {1560, 3, 0, 1560, 3, 0x03},
+    {1563, 3, 0, 1563, 3, 0x03},
+    {1566, 3, 0, 1566, 3, 0x03},
+    {1569, 3, 0, 1569, 3, 0x03},
+    {1572, 3, 0, 1572, 3, 0x03},
+    {1575, 3, 0, 1575, 3, 0x03},
+    {1578, 3, 0, 1578, 3, 0x03},
+    {1581, 3, 0, 1581, 3, 0x03},
+    {1584, 3, 0, 1584, 3, 0x03},
+    {1587, 3, 0, 1587, 3, 0x03},
+    {1590, 3, 0, 1590, 3, 0x03},
+    {1593, 2, 0, 1593, 2, 0x03},
+    {1595, 2, 0, 1595, 2, 0x03},
+    {1597, 2, 0, 1597, 2, 0x03},
+    {1599, 2, 0, 1599, 2, 0x03},
+    {1601, 3, 0, 1601, 3, 0x03},
+    {1604, 3, 0, 1604, 3, 0x03},
+    {1607, 3, 0, 1607, 3, 0x03},
+    {1610, 3, 0, 1610, 3, 0x03},
+    {1613, 3, 0, 1613, 3, 0x03},
+    {1616, 3, 0, 1616, 3, 0x03},
+    {1619, 3, 0, 1619, 3, 0x03},
+    {1622, 3, 0, 1622, 3, 0x03},
+    {1625, 3, 0, 1625, 3, 0x03},
+    {1628, 3, 0, 1628, 3, 0x03},
+    {1631, 2, 0, 1631, 2, 0x03},
+    {1633, 2, 0, 1633, 2, 0x03},
+    {1635, 2, 0, 1635, 2, 0x03},
+    {1637, 2, 0, 1637, 2, 0x03},
+    {1639, 2, 0, 1639, 2, 0x03},
+    {1641, 2, 0, 1641, 2, 0x03},
+    {1643, 2, 0, 1643, 2, 0x03},
+    {1645, 2, 0, 1645, 2, 0x03},
+    {1647, 2, 0, 1647, 2, 0x03},
+    {1649, 2, 0, 1649, 2, 0x03},
+    {1651, 3, 0, 1651, 3, 0x03},
+    {1654, 3, 0, 1654, 3, 0x03},
+    {1657, 3, 0, 1657, 3, 0x03},
+    {1660, 3, 0, 1660, 3, 0x03},
+    {1663, 3, 0, 1663, 3, 0x03},
+    {1666, 3, 0, 1666, 3, 0x03},
+    {1669, 2, 0, 1669, 2, 0x03},
+    {1671, 2, 0, 1671, 2, 0x03},
+    {1673, 3, 0, 1673, 3, 0x03},
+    {1676, 3, 0, 1676, 3, 0x03},
+    {1679, 3, 0, 1679, 3, 0x03},
+    {1682, 3, 0, 1682, 3, 0x03},
+    {1685, 3, 0, 1685, 3, 0x03},
+    {1688, 3, 0, 1688, 3, 0x03},
+    {1691, 2, 0, 1691, 2, 0x03},
+    {1693, 2, 0, 1693, 2, 0x03},
+    {1695, 3, 0, 1695, 3, 0x03},
+    {1698, 3, 0, 1698, 3, 0x03},
+    {1701, 3, 0, 1701, 3, 0x03},
+    {1704, 3, 0, 1704, 3, 0x03},
+    {1707, 2, 0, 1707, 2, 0x03},
+    {1709, 2, 0, 1709, 2, 0x03},
+    {1711, 3, 0, 1711, 3, 0x03},
+    {1714, 3, 0, 1714, 3, 0x03},
+    {1717, 3, 0, 1717, 3, 0x03},
+    {1720, 3, 0, 1720, 3, 0x03},
+    {1723, 2, 0, 1723, 2, 0x03},
+    {1725, 2, 0, 1725, 2, 0x03},
+    {1727, 3, 0, 1727, 3, 0x03},
+    {1730, 3, 0, 1730, 3, 0x03},
+    {1733, 3, 0, 1733, 3, 0x03},
+    {1736, 3, 0, 1736, 3, 0x03},
+    {1739, 3, 0, 1739, 3, 0x03},
+    {1742, 3, 0, 1742, 3, 0x03},
+    {1745, 2, 0, 1745, 2, 0x03},
+    {1747, 2, 0, 1747, 2, 0x03},
+    {1749, 3, 0, 1749, 3, 0x03},
+    {1752, 3, 0, 1752, 3, 0x03},
+    {1755, 3, 0, 1755, 3, 0x03},
+    {1758, 3, 0, 1758, 3, 0x03},
+    {1761, 3, 0, 1761, 3, 0x03},
+    {1764, 3, 0, 1764, 3, 0x03},
+    {1767, 2, 0, 1767, 2, 0x03},
+    {1769, 2, 0, 1769, 2, 0x03},
+    {1771, 3, 0, 1771, 3, 0x03},
+    {1774, 3, 0, 1774, 3, 0x03},
+    {1777, 3, 0, 1777, 3, 0x03},
+    {1780, 3, 0, 1780, 3, 0x03},
+    {1783, 3, 0, 1783, 3, 0x03},
+    {1786, 3, 0, 1786, 3, 0x03},
+    {1789, 2, 0, 1789, 2, 0x03},
+    {1791, 2, 0, 1791, 2, 0x03},
+    {1793, 3, 0, 1793, 3, 0x03},
+    {1796, 3, 0, 1796, 3, 0x03},
+    {1799, 3, 0, 1799, 3, 0x03},
+    {1802, 3, 0, 1802, 3, 0x03},
+    {1805, 3, 0, 1805, 3, 0x03},
+    {1808, 3, 0, 1808, 3, 0x03},
+    {1811, 2, 0, 1811, 2, 0x03},
+    {1813, 2, 0, 1813, 2, 0x03},
+    {1815, 3, 0, 1815, 3, 0x03},
+    {1818, 3, 0, 1818, 3, 0x03},
+    {1821, 3, 0, 1821, 3, 0x03},
+    {1824, 3, 0, 1824, 3, 0x03},
+    {1827, 2, 0, 1827, 2, 0x03},
+    {1829, 2, 0, 1829, 2, 0x03},
+    {1831, 3, 0, 1831, 3, 0x03},
+    {1834, 3, 0, 1834, 3, 0x03},
+    {1837, 3, 0, 1837, 3, 0x03},
+    {1840, 3, 0, 1840, 3, 0x03},
+    {1843, 2, 0, 1843, 2, 0x03},
+    {1845, 2, 0, 1845, 2, 0x03},
+    {1847, 3, 0, 1847, 3, 0x03},
+    {1850, 3, 0, 1850, 3, 0x03},
+    {1853, 3, 0, 1853, 3, 0x03},
+    {1856, 3, 0, 1856, 3, 0x03},
+    {1859, 3, 0, 1859, 3, 0x03},
+    {1862, 3, 0, 1862, 3, 0x03},
+    {1865, 2, 0, 1865, 2, 0x03},
+    {1867, 3, 0, 1867, 3, 0x03},
+    {1870, 3, 0, 1870, 3, 0x03},
+    {1873, 3, 0, 1873, 3, 0x03},
+    {1876, 2, 0, 1876, 2, 0x03},
+    {1878, 2, 0, 1878, 2, 0x03},
+    {1880, 3, 0, 1880, 3, 0x03},
+    {1883, 3, 0, 1883, 3, 0x03},
+    {1886, 3, 0, 1886, 3, 0x03},
+    {1889, 3, 0, 1889, 3, 0x03},
+    {1892, 3, 0, 1892, 3, 0x03},
+    {1895, 3, 0, 1895, 3, 0x03},
+    {1898, 2, 0, 1898, 2, 0x03},
+    {1900, 2, 0, 1900, 2, 0x03},
+    {1902, 3, 0, 1902, 3, 0x03},
+    {1905, 3, 0, 1905, 3, 0x03},
+    {1908, 3, 0, 1908, 3, 0x03},
+    {1911, 3, 0, 1911, 3, 0x03},
+    {1914, 3, 0, 1914, 3, 0x03},
+    {1917, 3, 0, 1917, 3, 0x03},
+    {1920, 2, 0, 1920, 2, 0x03},
+    {649, 2, 0, 649, 2, 0x17},
+    {1922, 2, 0, 1922, 2, 0x03},
+    {651, 2, 0, 651, 2, 0x17},
+    {1924, 2, 0, 1924, 2, 0x03},
+    {653, 2, 0, 653, 2, 0x17},
+    {1926, 2, 0, 1926, 2, 0x03},
+    {655, 2, 0, 655, 2, 0x17},
+    {1928, 2, 0, 1928, 2, 0x03},
+    {664, 2, 0, 664, 2, 0x17},
+    {1930, 2, 0, 1930, 2, 0x03},
+    {666, 2, 0, 666, 2, 0x17},
+    {1932, 2, 0, 1932, 2, 0x03},
+    {668, 2, 0, 668, 2, 0x17},
+    {1934, 3, 0, 1934, 3, 0x03},
+    {1937, 3, 0, 1937, 3, 0x03},
+    {1940, 4, 0, 1940, 4, 0x03},
+    {1944, 4, 0, 1944, 4, 0x03},
+    {1948, 4, 0, 1948, 4, 0x03},
+    {1952, 4, 0, 1952, 4, 0x03},
+    {1956, 4, 0, 1956, 4, 0x03},
+    {1960, 4, 0, 1960, 4, 0x03},
+    {1964, 3, 0, 1964, 3, 0x03},
+    {1967, 3, 0, 1967, 3, 0x03},
+    {1970, 4, 0, 1970, 4, 0x03},
+    {1974, 4, 0, 1974, 4, 0x03},
+    {1978, 4, 0, 1978, 4, 0x03},
+    {1982, 4, 0, 1982, 4, 0x03},
+    {1986, 4, 0, 1986, 4, 0x03},
+    {1990, 4, 0, 1990, 4, 0x03},
+    {1994, 3, 0, 1994, 3, 0x03},
+    {1997, 3, 0, 1997, 3, 0x03},
+    {2000, 4, 0, 2000, 4, 0x03},
+    {2004, 4, 0, 2004, 4, 0x03},
+    {2008, 4, 0, 2008, 4, 0x03},
+    {2012, 4, 0, 2012, 4, 0x03},
+    {2016, 4, 0, 2016, 4, 0x03},
+    {2020, 4, 0, 2020, 4, 0x03},
+    {2024, 3, 0, 2024, 3, 0x03},
+    {2027, 3, 0, 2027, 3, 0x03},
+    {2030, 4, 0, 2030, 4, 0x03},
+    {2034, 4, 0, 2034, 4, 0x03},
+    {2038, 4, 0, 2038, 4, 0x03},
+    {2042, 4, 0, 2042, 4, 0x03},
+    {2046, 4, 0, 2046, 4, 0x03},
+    {2050, 4, 0, 2050, 4, 0x03},
+    {2054, 3, 0, 2054, 3, 0x03},
+    {2057, 3, 0, 2057, 3, 0x03},
+    {2060, 4, 0, 2060, 4, 0x03},
+    {2064, 4, 0, 2064, 4, 0x03},
+    {2068, 4, 0, 2068, 4, 0x03},
+    {2072, 4, 0, 2072, 4, 0x03},
+    {2076, 4, 0, 2076, 4, 0x03},
+    {2080, 4, 0, 2080, 4, 0x03},
+    {2084, 3, 0, 2084, 3, 0x03},
+    {2087, 3, 0, 2087, 3, 0x03},
+    {2090, 4, 0, 2090, 4, 0x03},
+    {2094, 4, 0, 2094, 4, 0x03},
+    {2098, 4, 0, 2098, 4, 0x03},
+    {2102, 4, 0, 2102, 4, 0x03},
+    {2106, 4, 0, 2106, 4, 0x03},
+    {2110, 4, 0, 2110, 4, 0x03},
+    {2114, 2, 0, 2114, 2, 0x03},
+    {2116, 2, 0, 2116, 2, 0x03},
+    {2118, 3, 0, 2118, 3, 0x03},
+    {2121, 2, 0, 2121, 2, 0x03},
+    {2123, 3, 0, 2123, 3, 0x03},
+    {2126, 2, 0, 2126, 2, 0x03},
+    {2128, 3, 0, 2128, 3, 0x03},
+    {2131, 2, 0, 2131, 2, 0x03},
+    {2133, 2, 0, 2133, 2, 0x03},
+    {2135, 2, 0, 2135, 2, 0x03},
+    {627, 2, 0, 627, 2, 0x17},
+    {2137, 2, 0, 2137, 2, 0x03},
+    {0, 0, 0, 2139, 2, 0x12},
+    {2141, 1, 0, 2141, 1, 0x17},
+    {0, 0, 0, 2142, 2, 0x12},
+    {2144, 2, 0, 2146, 3, 0x13},
+    {2149, 3, 0, 2149, 3, 0x03},
+    {2152, 2, 0, 2152, 2, 0x03},
+    {2154, 3, 0, 2154, 3, 0x03},
+    {2157, 2, 0, 2157, 2, 0x03},
+    {2159, 3, 0, 2159, 3, 0x03},
+    {2162, 2, 0, 2162, 2, 0x03},
+    {630, 2, 0, 630, 2, 0x17},
+    {2164, 2, 0, 2164, 2, 0x03},
+    {632, 2, 0, 632, 2, 0x17},
+    {2166, 2, 0, 2166, 2, 0x03},
+    {2168, 2, 0, 2170, 3, 0x13},
+    {2173, 2, 0, 2175, 3, 0x13},
+    {2178, 2, 0, 2180, 3, 0x13},
+    {2183, 2, 0, 2183, 2, 0x03},
+    {2185, 2, 0, 2185, 2, 0x03},
+    {2187, 3, 0, 2187, 3, 0x03},
+    {642, 3, 0, 642, 3, 0x17},
+    {2190, 2, 0, 2190, 2, 0x03},
+    {2192, 3, 0, 2192, 3, 0x03},
+    {2195, 2, 0, 2195, 2, 0x03},
+    {2197, 2, 0, 2197, 2, 0x03},
+    {2199, 2, 0, 2199, 2, 0x03},
+    {634, 2, 0, 634, 2, 0x17},
+    {2201, 2, 0, 2203, 3, 0x13},
+    {2206, 2, 0, 2208, 3, 0x13},
+    {2211, 2, 0, 2213, 3, 0x13},
+    {2216, 2, 0, 2216, 2, 0x03},
+    {2218, 2, 0, 2218, 2, 0x03},
+    {2220, 3, 0, 2220, 3, 0x03},
+    {657, 3, 0, 657, 3, 0x17},
+    {2223, 2, 0, 2223, 2, 0x03},
+    {2225, 2, 0, 2225, 2, 0x03},
+    {2227, 2, 0, 2227, 2, 0x03},
+    {2229, 3, 0, 2229, 3, 0x03},
+    {2232, 2, 0, 2232, 2, 0x03},
+    {2234, 2, 0, 2234, 2, 0x03},
+    {2236, 2, 0, 2236, 2, 0x03},
+    {638, 2, 0, 638, 2, 0x17},
+    {2238, 2, 0, 2238, 2, 0x03},
+    {2240, 2, 0, 2242, 3, 0x13},
+    {622, 2, 0, 624, 3, 0x17},
+    {2245, 1, 0, 2245, 1, 0x17},
+    {2246, 3, 0, 2246, 3, 0x03},
+    {2249, 2, 0, 2249, 2, 0x03},
+    {2251, 3, 0, 2251, 3, 0x03},
+    {2254, 2, 0, 2254, 2, 0x03},
+    {2256, 3, 0, 2256, 3, 0x03},
+    {2259, 2, 0, 2259, 2, 0x03},
+    {636, 2, 0, 636, 2, 0x17},
+    {2261, 2, 0, 2261, 2, 0x03},
+    {640, 2, 0, 640, 2, 0x17},
+    {2263, 2, 0, 2263, 2, 0x03},
+    {2265, 1, 0, 8, 2, 0x17},
+    {0, 0, 0, 2266, 2, 0x12},
+    {2268, 1, 0, 0, 1, 0x17},
+    {2269, 1, 0, 0, 1, 0x17},
+    {0, 0, 0, 2270, 1, 0x12},
+    {0, 0, 0, 2271, 2, 0x12},
+    {0, 0, 0, 2273, 1, 0x12},
+    {0, 0, 0, 2274, 2, 0x12},
+    {0, 0, 0, 2276, 3, 0x12},
+    {0, 0, 0, 2279, 2, 0x12},
+    {0, 0, 0, 2281, 3, 0x12},
+    {0, 0, 0, 2284, 2, 0x12},
+    {0, 0, 0, 2286, 3, 0x12},
+    {0, 0, 0, 2289, 2, 0x12},
+    {0, 0, 0, 2291, 2, 0x12},
+    {0, 0, 0, 2293, 2, 0x12},
+    {0, 0, 0, 2295, 2, 0x12},
+    {0, 0, 0, 2297, 2, 0x12},
+    {0, 0, 0, 2299, 4, 0x12},
+    {0, 0, 0, 2303, 1, 0x12},
+    {0, 0, 0, 2304, 1, 0x12},
+    {0, 0, 0, 2305, 1, 0x12},
+    {0, 0, 0, 2306, 1, 0x12},
+    {0, 0, 0, 2307, 1, 0x12},
+    {0, 0, 0, 2308, 1, 0x12},
+    {0, 0, 0, 2309, 1, 0x12},
+    {0, 0, 0, 2310, 1, 0x12},
+    {0, 0, 0, 2311, 1, 0x12},
+    {0, 0, 0, 2312, 1, 0x12},
+    {0, 0, 0, 2313, 1, 0x12},
+    {0, 0, 0, 2314, 1, 0x12},
+    {0, 0, 0, 2315, 1, 0x12},
+    {0, 0, 0, 2316, 2, 0x12},
+    {0, 0, 0, 2318, 3, 0x12},
+    {0, 0, 0, 2321, 3, 0x12},
+    {0, 0, 0, 2324, 1, 0x12},
+    {0, 0, 0, 2325, 2, 0x12},
+    {0, 0, 0, 2327, 3, 0x12},
+    {0, 0, 0, 2330, 3, 0x12},
+    {0, 0, 0, 2333, 1, 0x12},
+    {0, 0, 0, 2334, 2, 0x12},
+    {0, 0, 0, 2336, 1, 0x12},
+    {0, 0, 0, 2337, 2, 0x12},
+    {0, 0, 0, 2339, 1, 0x12},
+    {0, 0, 0, 2340, 2, 0x12},
+    {0, 0, 0, 2342, 3, 0x12},
+    {0, 0, 0, 2345, 2, 0x12},
+    {0, 0, 0, 2347, 1, 0x12},
+    {2348, 1, 0, 2348, 1, 0x17},
+    {989, 1, 0, 989, 1, 0x17},
+    {34, 2, 0, 34, 2, 0x17},
+    {0, 0, 0, 2349, 1, 0x12},
+    {0, 0, 0, 2350, 1, 0x12},
+    {0, 0, 0, 2351, 1, 0x12},
+    {0, 0, 0, 2352, 1, 0x12},
+    {0, 0, 0, 2353, 1, 0x12},
+    {0, 0, 0, 2354, 3, 0x12},
+    {0, 0, 0, 2357, 1, 0x12},
+    {0, 0, 0, 2358, 1, 0x12},
+    {0, 0, 0, 2359, 1, 0x12},
+    {0, 0, 0, 2360, 3, 0x12},
+    {0, 0, 0, 2363, 3, 0x12},
+    {0, 0, 0, 2366, 4, 0x12},
+    {0, 0, 0, 2370, 3, 0x12},
+    {0, 0, 0, 2373, 3, 0x12},
+    {0, 0, 0, 2376, 3, 0x12},
+    {0, 0, 0, 2379, 3, 0x12},
+    {0, 0, 0, 2382, 3, 0x12},
+    {0, 0, 0, 2385, 3, 0x12},
+    {0, 0, 0, 2388, 3, 0x12},
+    {0, 0, 0, 2391, 3, 0x12},
+    {0, 0, 0, 2394, 3, 0x12},
+    {0, 0, 0, 2397, 3, 0x12},
+    {0, 0, 0, 2400, 3, 0x12},
+    {0, 0, 0, 2403, 3, 0x12},
+    {0, 0, 0, 2406, 2, 0x12},
+    {0, 0, 0, 2408, 2, 0x12},
+    {0, 0, 0, 2410, 3, 0x12},
+    {0, 0, 0, 2413, 2, 0x12},
+    {0, 0, 0, 2415, 1, 0x12},
+    {0, 0, 0, 2416, 2, 0x12},
+    {0, 0, 0, 2418, 3, 0x12},
+    {0, 0, 0, 2421, 4, 0x12},
+    {0, 0, 0, 2425, 2, 0x12},
+    {0, 0, 0, 2427, 1, 0x12},
+    {0, 0, 0, 2428, 2, 0x12},
+    {0, 0, 0, 2430, 3, 0x12},
+    {0, 0, 0, 2433, 2, 0x12},
+    {0, 0, 0, 2435, 3, 0x12},
+    {0, 0, 0, 2438, 2, 0x12},
+    {0, 0, 0, 2440, 2, 0x12},
+    {0, 0, 0, 2442, 3, 0x12},
+    {0, 0, 0, 2445, 4, 0x12},
+    {0, 0, 0, 2449, 2, 0x12},
+    {0, 0, 0, 2451, 2, 0x12},
+    {0, 0, 0, 2453, 3, 0x12},
+    {0, 0, 0, 2456, 3, 0x12},
+    {2459, 2, 0, 2459, 2, 0x03},
+    {2461, 2, 0, 2461, 2, 0x03},
+    {2463, 2, 0, 2463, 2, 0x03},
+    {2465, 2, 0, 2465, 2, 0x03},
+    {2467, 2, 0, 2467, 2, 0x03},
+    {2469, 2, 0, 2469, 2, 0x03},
+    {2471, 2, 0, 2471, 2, 0x03},
+    {2473, 2, 0, 2473, 2, 0x03},
+    {2475, 2, 0, 2475, 2, 0x03},
+    {2477, 2, 0, 2477, 2, 0x03},
+    {2479, 2, 0, 2479, 2, 0x03},
+    {0, 0, 0, 2481, 2, 0x12},
+    {0, 0, 0, 2483, 3, 0x12},
+    {0, 0, 0, 2486, 2, 0x12},
+    {0, 0, 0, 2488, 3, 0x12},
+    {2491, 2, 0, 2491, 2, 0x03},
+    {2493, 2, 0, 2493, 2, 0x03},
+    {2495, 2, 0, 2495, 2, 0x03},
+    {2497, 2, 0, 2497, 2, 0x03},
+    {2499, 2, 0, 2499, 2, 0x03},
+    {2501, 2, 0, 2501, 2, 0x03},
+    {2503, 2, 0, 2503, 2, 0x03},
+    {2505, 2, 0, 2505, 2, 0x03},
+    {2507, 2, 0, 2507, 2, 0x03},
+    {2509, 2, 0, 2509, 2, 0x03},
+    {2511, 2, 0, 2511, 2, 0x03},
+    {2513, 2, 0, 2513, 2, 0x03},
+    {2515, 2, 0, 2515, 2, 0x03},
+    {2517, 2, 0, 2517, 2, 0x03},
+    {2519, 2, 0, 2519, 2, 0x03},
+    {2521, 2, 0, 2521, 2, 0x03},
+    {2523, 2, 0, 2523, 2, 0x03},
+    {2525, 2, 0, 2525, 2, 0x03},
+    {2527, 2, 0, 2527, 2, 0x03},
+    {2529, 2, 0, 2529, 2, 0x03},
+    {2531, 2, 0, 2531, 2, 0x03},
+    {2533, 2, 0, 2533, 2, 0x03},
+    {2535, 2, 0, 2535, 2, 0x03},
+    {2537, 2, 0, 2537, 2, 0x03},
+    {2539, 2, 0, 2539, 2, 0x03},
+    {2541, 2, 0, 2541, 2, 0x03},
+    {2543, 2, 0, 2543, 2, 0x03},
+    {2545, 2, 0, 2545, 2, 0x03},
+    {2547, 2, 0, 2547, 2, 0x03},
+    {2549, 2, 0, 2549, 2, 0x03},
+    {2551, 2, 0, 2551, 2, 0x03},
+    {2553, 2, 0, 2553, 2, 0x03},
+    {2555, 2, 0, 2555, 2, 0x03},
+    {2557, 1, 0, 2557, 1, 0x17},
+    {2558, 1, 0, 2558, 1, 0x17},
+    {0, 0, 0, 2559, 2, 0x12},
+    {0, 0, 0, 2561, 2, 0x12},
+    {0, 0, 0, 2563, 2, 0x12},
+    {0, 0, 0, 2565, 2, 0x12},
+    {0, 0, 0, 2567, 2, 0x12},
+    {0, 0, 0, 2569, 2, 0x12},
+    {0, 0, 0, 2571, 2, 0x12},
+    {0, 0, 0, 2573, 2, 0x12},
+    {0, 0, 0, 2575, 2, 0x12},
+    {0, 0, 0, 2577, 2, 0x12},
+    {0, 0, 0, 2579, 2, 0x12},
+    {0, 0, 0, 2581, 3, 0x12},
+    {0, 0, 0, 2584, 3, 0x12},
+    {0, 0, 0, 2587, 3, 0x12},
+    {0, 0, 0, 2590, 3, 0x12},
+    {0, 0, 0, 2593, 3, 0x12},
+    {0, 0, 0, 2596, 3, 0x12},
+    {0, 0, 0, 2599, 3, 0x12},
+    {0, 0, 0, 2602, 3, 0x12},
+    {0, 0, 0, 2605, 3, 0x12},
+    {0, 0, 0, 2608, 4, 0x12},
+    {0, 0, 0, 2612, 4, 0x12},
+    {0, 0, 0, 2616, 4, 0x12},
+    {0, 0, 0, 2620, 4, 0x12},
+    {0, 0, 0, 2624, 4, 0x12},
+    {0, 0, 0, 2628, 4, 0x12},
+    {0, 0, 0, 2632, 4, 0x12},
+    {0, 0, 0, 2636, 4, 0x12},
+    {0, 0, 0, 2640, 4, 0x12},
+    {0, 0, 0, 2644, 4, 0x12},
+    {0, 0, 0, 2648, 4, 0x12},
+    {0, 0, 0, 2652, 2, 0x12},
+    {0, 0, 0, 2654, 2, 0x12},
+    {0, 0, 0, 2656, 2, 0x12},
+    {0, 0, 0, 2658, 2, 0x12},
+    {0, 0, 0, 2660, 2, 0x12},
+    {0, 0, 0, 2662, 2, 0x12},
+    {0, 0, 0, 2664, 2, 0x12},
+    {0, 0, 0, 2666, 2, 0x12},
+    {0, 0, 0, 2668, 2, 0x12},
+    {0, 0, 0, 2670, 3, 0x12},
+    {0, 0, 0, 2673, 3, 0x12},
+    {0, 0, 0, 2676, 3, 0x12},
+    {0, 0, 0, 2679, 3, 0x12},
+    {0, 0, 0, 2682, 3, 0x12},
+    {0, 0, 0, 2685, 3, 0x12},
+    {0, 0, 0, 2688, 3, 0x12},
+    {0, 0, 0, 2691, 3, 0x12},
+    {0, 0, 0, 2694, 3, 0x12},
+    {0, 0, 0, 2697, 3, 0x12},
+    {0, 0, 0, 2700, 3, 0x12},
+    {0, 0, 0, 2703, 3, 0x12},
+    {0, 0, 0, 2706, 3, 0x12},
+    {0, 0, 0, 2709, 3, 0x12},
+    {0, 0, 0, 2712, 3, 0x12},
+    {0, 0, 0, 2715, 3, 0x12},
+    {0, 0, 0, 2718, 3, 0x12},
+    {0, 0, 0, 2721, 3, 0x12},
+    {0, 0, 0, 2724, 3, 0x12},
+    {0, 0, 0, 2727, 3, 0x12},
+    {0, 0, 0, 2730, 3, 0x12},
+    {0, 0, 0, 2733, 3, 0x12},
+    {0, 0, 0, 2736, 3, 0x12},
+    {0, 0, 0, 2739, 3, 0x12},
+    {0, 0, 0, 2742, 3, 0x12},
+    {0, 0, 0, 2745, 3, 0x12},
+    {0, 0, 0, 2748, 3, 0x12},
+    {0, 0, 0, 2751, 3, 0x12},
+    {0, 0, 0, 2754, 3, 0x12},
+    {0, 0, 0, 2757, 3, 0x12},
+    {0, 0, 0, 2760, 3, 0x12},
+    {0, 0, 0, 2763, 3, 0x12},
+    {0, 0, 0, 2766, 3, 0x12},
+    {0, 0, 0, 2769, 3, 0x12},
+    {0, 0, 0, 2772, 3, 0x12},
+    {0, 0, 0, 2775, 3, 0x12},
+    {0, 0, 0, 2778, 3, 0x12},
+    {0, 0, 0, 2781, 1, 0x12},
+    {0, 0, 0, 2782, 1, 0x12},
+    {0, 0, 0, 2783, 1, 0x12},
+    {0, 0, 0, 2784, 4, 0x12},
+    {0, 0, 0, 2788, 3, 0x12},
+    {0, 0, 0, 2791, 2, 0x12},
+    {0, 0, 0, 2793, 3, 0x12},
+    {2796, 2, 0, 2796, 2, 0x17},
+    {0, 0, 0, 2798, 1, 0x12},
+    {0, 0, 0, 2799, 1, 0x12},
+    {0, 0, 0, 2800, 1, 0x12},
+    {0, 0, 0, 2801, 1, 0x12},
+    {0, 0, 0, 2802, 1, 0x12},
+    {0, 0, 0, 2803, 1, 0x12},
+    {0, 0, 0, 2804, 1, 0x12},
+    {0, 0, 0, 2805, 1, 0x12},
+    {0, 0, 0, 2806, 1, 0x12},
+    {0, 0, 0, 2807, 1, 0x12},
+    {0, 0, 0, 2808, 1, 0x12},
+    {0, 0, 0, 2809, 1, 0x12},
+    {0, 0, 0, 2810, 1, 0x12},
+    {0, 0, 0, 2811, 1, 0x12},
+    {0, 0, 0, 2812, 1, 0x12},
+    {0, 0, 0, 2813, 1, 0x12},
+    {0, 0, 0, 2814, 1, 0x12},
+    {0, 0, 0, 2815, 1, 0x12},
+    {0, 0, 0, 2816, 1, 0x12},
+    {0, 0, 0, 2817, 1, 0x12},
+    {0, 0, 0, 2818, 1, 0x12},
+    {0, 0, 0, 2819, 1, 0x12},
+    {0, 0, 0, 2820, 1, 0x12},
+    {0, 0, 0, 2821, 1, 0x12},
+    {0, 0, 0, 2822, 1, 0x12},
+    {0, 0, 0, 2823, 1, 0x12},
+    {0, 0, 0, 2824, 1, 0x12},
+    {0, 0, 0, 2825, 1, 0x12},
+    {0, 0, 0, 2826, 1, 0x12},
+    {0, 0, 0, 2827, 1, 0x12},
+    {0, 0, 0, 2828, 1, 0x12},
+    {0, 0, 0, 2829, 1, 0x12},
+    {0, 0, 0, 2830, 1, 0x12},
+    {0, 0, 0, 2831, 1, 0x12},
+    {0, 0, 0, 2832, 1, 0x12},
+    {0, 0, 0, 2833, 1, 0x12},
+    {0, 0, 0, 2834, 1, 0x12},
+    {0, 0, 0, 2835, 1, 0x12},
+    {0, 0, 0, 2836, 1, 0x12},
+    {0, 0, 0, 2837, 1, 0x12},
+    {0, 0, 0, 2838, 1, 0x12},
+    {0, 0, 0, 2839, 1, 0x12},
+    {0, 0, 0, 2840, 1, 0x12},
+    {0, 0, 0, 2841, 1, 0x12},
+    {0, 0, 0, 2842, 1, 0x12},
+    {0, 0, 0, 2843, 1, 0x12},
+    {0, 0, 0, 2844, 1, 0x12},
+    {0, 0, 0, 2845, 1, 0x12},
+    {0, 0, 0, 2846, 1, 0x12},
+    {0, 0, 0, 2847, 1, 0x12},
+    {0, 0, 0, 2848, 1, 0x12},
+    {0, 0, 0, 2849, 1, 0x12},
+    {0, 0, 0, 2850, 1, 0x12},
+    {0, 0, 0, 2851, 1, 0x12},
+    {0, 0, 0, 2852, 1, 0x12},
+    {0, 0, 0, 2853, 1, 0x12},
+    {0, 0, 0, 2854, 1, 0x12},
+    {0, 0, 0, 2855, 1, 0x12},
+    {0, 0, 0, 2856, 1, 0x12},
+    {0, 0, 0, 2857, 1, 0x12},
+    {0, 0, 0, 2858, 1, 0x12},
+    {0, 0, 0, 2859, 1, 0x12},
+    {0, 0, 0, 2860, 1, 0x12},
+    {0, 0, 0, 2861, 1, 0x12},
+    {0, 0, 0, 2862, 1, 0x12},
+    {0, 0, 0, 2863, 1, 0x12},
+    {0, 0, 0, 2864, 1, 0x12},
+    {0, 0, 0, 2865, 1, 0x12},
+    {0, 0, 0, 2866, 1, 0x12},
+    {0, 0, 0, 2867, 1, 0x12},
+    {0, 0, 0, 2868, 1, 0x12},
+    {0, 0, 0, 2869, 1, 0x12},
+    {0, 0, 0, 2870, 1, 0x12},
+    {0, 0, 0, 2871, 1, 0x12},
+    {0, 0, 0, 2872, 1, 0x12},
+    {0, 0, 0, 2873, 1, 0x12},
+    {0, 0, 0, 2874, 1, 0x12},
+    {0, 0, 0, 2875, 1, 0x12},
+    {0, 0, 0, 2876, 1, 0x12},
+    {0, 0, 0, 2877, 1, 0x12},
+    {0, 0, 0, 2878, 1, 0x12},
+    {0, 0, 0, 2879, 1, 0x12},
+    {0, 0, 0, 2880, 1, 0x12},
+    {0, 0, 0, 2881, 1, 0x12},
+    {0, 0, 0, 2882, 1, 0x12},
+    {0, 0, 0, 2883, 1, 0x12},
+    {0, 0, 0, 2884, 1, 0x12},
+    {0, 0, 0, 2885, 1, 0x12},
+    {0, 0, 0, 2886, 1, 0x12},
+    {0, 0, 0, 2887, 1, 0x12},
+    {0, 0, 0, 2888, 1, 0x12},
+    {0, 0, 0, 2889, 1, 0x12},
+    {0, 0, 0, 2890, 1, 0x12},
+    {0, 0, 0, 2891, 1, 0x12},
+    {0, 0, 0, 2892, 1, 0x12},
+    {0, 0, 0, 2893, 1, 0x12},
+    {0, 0, 0, 2894, 1, 0x12},
+    {0, 0, 0, 2895, 1, 0x12},
+    {0, 0, 0, 2896, 1, 0x12},
+    {0, 0, 0, 2897, 1, 0x12},
+    {0, 0, 0, 2898, 1, 0x12},
+    {0, 0, 0, 2899, 1, 0x12},
+    {0, 0, 0, 2900, 1, 0x12},
+    {0, 0, 0, 2901, 1, 0x12},
+    {0, 0, 0, 2902, 1, 0x12},
+    {0, 0, 0, 2903, 1, 0x12},
+    {0, 0, 0, 2904, 1, 0x12},
+    {0, 0, 0, 2905, 1, 0x12},
+    {0, 0, 0, 2906, 1, 0x12},
+    {0, 0, 0, 2907, 1, 0x12},
+    {0, 0, 0, 2908, 1, 0x12},
+    {0, 0, 0, 2909, 1, 0x12},
+    {0, 0, 0, 2910, 1, 0x12},
+    {0, 0, 0, 2911, 1, 0x12},
+    {0, 0, 0, 2912, 1, 0x12},
+    {0, 0, 0, 2913, 1, 0x12},
+    {0, 0, 0, 2914, 1, 0x12},
+    {0, 0, 0, 2915, 1, 0x12},
+    {0, 0, 0, 2916, 1, 0x12},
+    {0, 0, 0, 2917, 1, 0x12},
+    {0, 0, 0, 2918, 1, 0x12},
+    {0, 0, 0, 2919, 1, 0x12},
+    {0, 0, 0, 2920, 1, 0x12},
+    {0, 0, 0, 2921, 1, 0x12},
+    {0, 0, 0, 2922, 1, 0x12},
+    {0, 0, 0, 2923, 1, 0x12},
+    {0, 0, 0, 2924, 1, 0x12},
+    {0, 0, 0, 2925, 1, 0x12},
+    {0, 0, 0, 2926, 1, 0x12},
+    {0, 0, 0, 2927, 1, 0x12},
+    {0, 0, 0, 2928, 1, 0x12},
+    {0, 0, 0, 2929, 1, 0x12},
+    {0, 0, 0, 2930, 1, 0x12},
+    {0, 0, 0, 2931, 1, 0x12},
+    {0, 0, 0, 2932, 1, 0x12},
+    {0, 0, 0, 2933, 1, 0x12},
+    {0, 0, 0, 2934, 1, 0x12},
+    {0, 0, 0, 2935, 1, 0x12},
+    {0, 0, 0, 2936, 1, 0x12},
+    {0, 0, 0, 2937, 1, 0x12},
+    {0, 0, 0, 2938, 1, 0x12},
+    {0, 0, 0, 2939, 1, 0x12},
+    {0, 0, 0, 2940, 1, 0x12},
+    {0, 0, 0, 2941, 1, 0x12},
+    {0, 0, 0, 2942, 1, 0x12},
+    {0, 0, 0, 2943, 1, 0x12},
+    {0, 0, 0, 2944, 1, 0x12},
+    {0, 0, 0, 2945, 1, 0x12},
+    {0, 0, 0, 2946, 1, 0x12},
+    {0, 0, 0, 2947, 1, 0x12},
+    {0, 0, 0, 2948, 1, 0x12},
+    {0, 0, 0, 2949, 1, 0x12},
+    {0, 0, 0, 2950, 1, 0x12},
+    {0, 0, 0, 2951, 1, 0x12},
+    {0, 0, 0, 2952, 1, 0x12},
+    {0, 0, 0, 2953, 1, 0x12},
+    {0, 0, 0, 2954, 1, 0x12},
+    {0, 0, 0, 2955, 1, 0x12},
+    {0, 0, 0, 2956, 1, 0x12},
+    {0, 0, 0, 2957, 1, 0x12},
+    {0, 0, 0, 2958, 1, 0x12},
+    {0, 0, 0, 2959, 1, 0x12},
+    {0, 0, 0, 2960, 1, 0x12},
+    {0, 0, 0, 2961, 1, 0x12},
+    {0, 0, 0, 2962, 1, 0x12},
+    {0, 0, 0, 2963, 1, 0x12},
+    {0, 0, 0, 2964, 1, 0x12},
+    {0, 0, 0, 2965, 1, 0x12},
+    {0, 0, 0, 2966, 1, 0x12},
+    {0, 0, 0, 2967, 1, 0x12},
+    {0, 0, 0, 2968, 1, 0x12},
+    {0, 0, 0, 2969, 1, 0x12},
+    {0, 0, 0, 2970, 1, 0x12},
+    {0, 0, 0, 2971, 1, 0x12},
+    {0, 0, 0, 2972, 1, 0x12},
+    {0, 0, 0, 2973, 1, 0x12},
+    {0, 0, 0, 2974, 1, 0x12},
+    {0, 0, 0, 2975, 1, 0x12},
+    {0, 0, 0, 2976, 1, 0x12},
+    {0, 0, 0, 2977, 1, 0x12},
+    {0, 0, 0, 2978, 1, 0x12},
+    {0, 0, 0, 2979, 1, 0x12},
+    {0, 0, 0, 2980, 1, 0x12},
+    {0, 0, 0, 2981, 1, 0x12},
+    {0, 0, 0, 2982, 1, 0x12},
+    {0, 0, 0, 2983, 1, 0x12},
+    {0, 0, 0, 2984, 1, 0x12},
+    {0, 0, 0, 2985, 1, 0x12},
+    {0, 0, 0, 2986, 1, 0x12},
+    {0, 0, 0, 2987, 1, 0x12},
+    {0, 0, 0, 2988, 1, 0x12},
+    {0, 0, 0, 2989, 1, 0x12},
+    {0, 0, 0, 2990, 1, 0x12},
+    {0, 0, 0, 2991, 1, 0x12},
+    {0, 0, 0, 2992, 1, 0x12},
+    {0, 0, 0, 2993, 1, 0x12},
+    {0, 0, 0, 2994, 1, 0x12},
+    {0, 0, 0, 2995, 1, 0x12},
+    {0, 0, 0, 2996, 1, 0x12},
+    {0, 0, 0, 2997, 1, 0x12},
+    {0, 0, 0, 2998, 1, 0x12},
+    {0, 0, 0, 2999, 1, 0x12},
+    {0, 0, 0, 3000, 1, 0x12},
+    {0, 0, 0, 3001, 1, 0x12},
+    {0, 0, 0, 3002, 1, 0x12},
+    {0, 0, 0, 3003, 1, 0x12},
+    {0, 0, 0, 3004, 1, 0x12},
+    {0, 0, 0, 3005, 1, 0x12},
+    {0, 0, 0, 3006, 1, 0x12},
+    {0, 0, 0, 3007, 1, 0x12},
+    {0, 0, 0, 3008, 1, 0x12},
+    {0, 0, 0, 3009, 1, 0x12},
+    {0, 0, 0, 3010, 1, 0x12},
+    {0, 0, 0, 3011, 1, 0x12},
+    {0, 0, 0, 3012, 1, 0x12},
+    {0, 0, 0, 3013, 1, 0x12},
+    {0, 0, 0, 3014, 1, 0x12},
+    {0, 0, 224, 0, 0, 0x00},
+    {0, 0, 0, 3015, 1, 0x12},
+    {0, 0, 0, 3016, 1, 0x12},
+    {0, 0, 0, 3017, 1, 0x12},
+    {3018, 2, 0, 3018, 2, 0x03},
+    {3020, 2, 0, 3020, 2, 0x03},
+    {3022, 2, 0, 3022, 2, 0x03},
+    {3024, 2, 0, 3024, 2, 0x03},
+    {3026, 2, 0, 3026, 2, 0x03},
+    {3028, 2, 0, 3028, 2, 0x03},
+    {3030, 2, 0, 3030, 2, 0x03},
+    {3032, 2, 0, 3032, 2, 0x03},
+    {3034, 2, 0, 3034, 2, 0x03},
+    {3036, 2, 0, 3036, 2, 0x03},
+    {3038, 2, 0, 3038, 2, 0x03},
+    {3040, 2, 0, 3040, 2, 0x03},
+    {3042, 2, 0, 3042, 2, 0x03},
+    {3044, 2, 0, 3044, 2, 0x03},
+    {3046, 2, 0, 3046, 2, 0x03},
+    {3048, 2, 0, 3048, 2, 0x03},
+    {3050, 2, 0, 3050, 2, 0x03},
+    {3052, 2, 0, 3052, 2, 0x03},
+    {3054, 2, 0, 3054, 2, 0x03},
+    {3056, 2, 0, 3056, 2, 0x03},
+    {3058, 2, 0, 3058, 2, 0x03},
+    {3060, 2, 0, 3060, 2, 0x03},
+    {3062, 2, 0, 3062, 2, 0x03},
+    {3064, 2, 0, 3064, 2, 0x03},
+    {3066, 2, 0, 3066, 2, 0x03},
+    {3068, 2, 0, 3068, 2, 0x03},
+    {0, 0, 8, 0, 0, 0x28},
+    {0, 0, 0, 3070, 2, 0x12},
+    {0, 0, 0, 3072, 2, 0x12},
+    {3074, 2, 0, 3074, 2, 0x03},
+    {0, 0, 0, 3076, 2, 0x12},
+    {3078, 2, 0, 3078, 2, 0x03},
+    {3080, 2, 0, 3080, 2, 0x03},
+    {3082, 2, 0, 3082, 2, 0x03},
+    {3084, 2, 0, 3084, 2, 0x03},
+    {3086, 2, 0, 3086, 2, 0x03},
+    {3088, 2, 0, 3088, 2, 0x03},
+    {3090, 2, 0, 3090, 2, 0x03},
+    {3092, 2, 0, 3092, 2, 0x03},
+    {3094, 2, 0, 3094, 2, 0x03},
+    {3096, 2, 0, 3096, 2, 0x03},
+    {3098, 2, 0, 3098, 2, 0x03},
+    {3100, 2, 0, 3100, 2, 0x03},
+    {3102, 2, 0, 3102, 2, 0x03},
+    {3104, 2, 0, 3104, 2, 0x03},
+    {3106, 2, 0, 3106, 2, 0x03},
+    {3108, 2, 0, 3108, 2, 0x03},
+    {3110, 2, 0, 3110, 2, 0x03},
+    {3112, 2, 0, 3112, 2, 0x03},
+    {3114, 2, 0, 3114, 2, 0x03},
+    {3116, 2, 0, 3116, 2, 0x03},
+    {3118, 2, 0, 3118, 2, 0x03},
+    {3120, 2, 0, 3120, 2, 0x03},
+    {3122, 2, 0, 3122, 2, 0x03},
+    {3124, 2, 0, 3124, 2, 0x03},
+    {3126, 2, 0, 3126, 2, 0x03},
+    {3128, 2, 0, 3128, 2, 0x03},
+    {3130, 2, 0, 3130, 2, 0x03},
+    {3132, 2, 0, 3132, 2, 0x03},
+    {3134, 2, 0, 3134, 2, 0x03},
+    {3136, 2, 0, 3136, 2, 0x03},
+    {3138, 2, 0, 3138, 2, 0x03},
+    {0, 0, 0, 3140, 2, 0x12},
+    {0, 0, 0, 3142, 1, 0x12},
+    {0, 0, 0, 3143, 1, 0x12},
+    {0, 0, 0, 3144, 1, 0x12},
+    {0, 0, 0, 3145, 1, 0x12},
+    {0, 0, 0, 3146, 1, 0x12},
+    {0, 0, 0, 3147, 1, 0x12},
+    {0, 0, 0, 3148, 1, 0x12},
+    {0, 0, 0, 3149, 1, 0x12},
+    {0, 0, 0, 3150, 1, 0x12},
+    {0, 0, 0, 3151, 1, 0x12},
+    {0, 0, 0, 3152, 1, 0x12},
+    {0, 0, 0, 3153, 1, 0x12},
+    {0, 0, 0, 3154, 1, 0x12},
+    {0, 0, 0, 3155, 1, 0x12},
+    {0, 0, 0, 3156, 1, 0x12},
+    {0, 0, 0, 3157, 1, 0x12},
+    {0, 0, 0, 3158, 1, 0x12},
+    {0, 0, 0, 3159, 1, 0x12},
+    {0, 0, 0, 3160, 1, 0x12},
+    {0, 0, 0, 3161, 1, 0x12},
+    {0, 0, 0, 3162, 1, 0x12},
+    {0, 0, 0, 3163, 1, 0x12},
+    {0, 0, 0, 3164, 1, 0x12},
+    {0, 0, 0, 3165, 1, 0x12},
+    {0, 0, 0, 3166, 1, 0x12},
+    {0, 0, 0, 3167, 1, 0x12},
+    {0, 0, 0, 3168, 1, 0x12},
+    {0, 0, 0, 3169, 1, 0x12},
+    {0, 0, 0, 3170, 1, 0x12},
+    {0, 0, 0, 3171, 1, 0x12},
+    {0, 0, 0, 3172, 1, 0x12},
+    {0, 0, 0, 3173, 1, 0x12},
+    {0, 0, 0, 3174, 1, 0x12},
+    {0, 0, 0, 3175, 1, 0x12},
+    {0, 0, 0, 3176, 1, 0x12},
+    {0, 0, 0, 3177, 1, 0x12},
+    {0, 0, 0, 3178, 1, 0x12},
+    {0, 0, 0, 3179, 1, 0x12},
+    {0, 0, 0, 3180, 1, 0x12},
+    {0, 0, 0, 3181, 1, 0x12},
+    {0, 0, 0, 3182, 1, 0x12},
+    {0, 0, 0, 3183, 1, 0x12},
+    {0, 0, 0, 3184, 1, 0x12},
+    {0, 0, 0, 3185, 1, 0x12},
+    {0, 0, 0, 3186, 1, 0x12},
+    {0, 0, 0, 3187, 1, 0x12},
+    {0, 0, 0, 3188, 1, 0x12},
+    {0, 0, 0, 3189, 1, 0x12},
+    {0, 0, 0, 3190, 1, 0x12},
+    {0, 0, 0, 3191, 1, 0x12},
+    {0, 0, 0, 3192, 1, 0x12},
+    {0, 0, 0, 3193, 1, 0x12},
+    {0, 0, 0, 3194, 1, 0x12},
+    {0, 0, 0, 3195, 1, 0x12},
+    {0, 0, 0, 3196, 1, 0x12},
+    {0, 0, 0, 3197, 1, 0x12},
+    {0, 0, 0, 3198, 1, 0x12},
+    {0, 0, 0, 3199, 1, 0x12},
+    {0, 0, 0, 3200, 1, 0x12},
+    {0, 0, 0, 3201, 1, 0x12},
+    {0, 0, 0, 3202, 1, 0x12},
+    {0, 0, 0, 3203, 1, 0x12},
+    {0, 0, 0, 3204, 1, 0x12},
+    {0, 0, 0, 3205, 1, 0x12},
+    {0, 0, 0, 3206, 1, 0x12},
+    {0, 0, 0, 3207, 1, 0x12},
+    {0, 0, 0, 3208, 1, 0x12},
+    {0, 0, 0, 3209, 1, 0x12},
+    {0, 0, 0, 3210, 1, 0x12},
+    {0, 0, 0, 3211, 1, 0x12},
+    {0, 0, 0, 3212, 1, 0x12},
+    {0, 0, 0, 3213, 1, 0x12},
+    {0, 0, 0, 3214, 1, 0x12},
+    {0, 0, 0, 3215, 1, 0x12},
+    {0, 0, 0, 3216, 1, 0x12},
+    {0, 0, 0, 3217, 1, 0x12},
+    {0, 0, 0, 3218, 1, 0x12},
+    {0, 0, 0, 3219, 1, 0x12},
+    {0, 0, 0, 3220, 1, 0x12},
+    {0, 0, 0, 3221, 1, 0x12},
+    {0, 0, 0, 3222, 1, 0x12},
+    {0, 0, 0, 3223, 1, 0x12},
+    {0, 0, 0, 3224, 1, 0x12},
+    {0, 0, 0, 3225, 1, 0x12},
+    {0, 0, 0, 3226, 1, 0x12},
+    {0, 0, 0, 3227, 1, 0x12},
+    {0, 0, 0, 3228, 1, 0x12},
+    {0, 0, 0, 3229, 1, 0x12},
+    {0, 0, 0, 3230, 1, 0x12},
+    {0, 0, 0, 3231, 1, 0x12},
+    {0, 0, 0, 3232, 1, 0x12},
+    {0, 0, 0, 3233, 1, 0x12},
+    {0, 0, 0, 3234, 1, 0x12},
+    {0, 0, 0, 3235, 1, 0x12},
+    {0, 0, 0, 3236, 1, 0x12},
+    {0, 0, 0, 3237, 1, 0x12},
+    {0, 0, 0, 3238, 1, 0x12},
+    {0, 0, 0, 3239, 1, 0x12},
+    {0, 0, 0, 3240, 1, 0x12},
+    {0, 0, 0, 3241, 1, 0x12},
+    {0, 0, 0, 3242, 1, 0x12},
+    {0, 0, 0, 3243, 1, 0x12},
+    {0, 0, 0, 3244, 1, 0x12},
+    {0, 0, 0, 3245, 1, 0x12},
+    {0, 0, 0, 3246, 3, 0x12},
+    {0, 0, 0, 3249, 3, 0x12},
+    {0, 0, 0, 3252, 3, 0x12},
+    {0, 0, 0, 3255, 3, 0x12},
+    {0, 0, 0, 3258, 3, 0x12},
+    {0, 0, 0, 3261, 3, 0x12},
+    {0, 0, 0, 3264, 3, 0x12},
+    {0, 0, 0, 3267, 3, 0x12},
+    {0, 0, 0, 3270, 3, 0x12},
+    {0, 0, 0, 3273, 3, 0x12},
+    {0, 0, 0, 3276, 3, 0x12},
+    {0, 0, 0, 3279, 3, 0x12},
+    {0, 0, 0, 3282, 3, 0x12},
+    {0, 0, 0, 3285, 3, 0x12},
+    {0, 0, 0, 3288, 4, 0x12},
+    {0, 0, 0, 3292, 4, 0x12},
+    {0, 0, 0, 3296, 4, 0x12},
+    {0, 0, 0, 3300, 4, 0x12},
+    {0, 0, 0, 3304, 4, 0x12},
+    {0, 0, 0, 3308, 4, 0x12},
+    {0, 0, 0, 3312, 4, 0x12},
+    {0, 0, 0, 3316, 4, 0x12},
+    {0, 0, 0, 3320, 4, 0x12},
+    {0, 0, 0, 3324, 4, 0x12},
+    {0, 0, 0, 3328, 4, 0x12},
+    {0, 0, 0, 3332, 4, 0x12},
+    {0, 0, 0, 3336, 4, 0x12},
+    {0, 0, 0, 3340, 4, 0x12},
+    {0, 0, 0, 3344, 4, 0x12},
+    {0, 0, 0, 3348, 7, 0x12},
+    {0, 0, 0, 3355, 6, 0x12},
+    {0, 0, 0, 3361, 3, 0x12},
+    {0, 0, 0, 3364, 3, 0x12},
+    {0, 0, 0, 3367, 3, 0x12},
+    {0, 0, 0, 3370, 3, 0x12},
+    {0, 0, 0, 3373, 3, 0x12},
+    {0, 0, 0, 3376, 3, 0x12},
+    {0, 0, 0, 3379, 3, 0x12},
+    {0, 0, 0, 3382, 3, 0x12},
+    {0, 0, 0, 3385, 3, 0x12},
+    {0, 0, 0, 3388, 3, 0x12},
+    {0, 0, 0, 3391, 3, 0x12},
+    {0, 0, 0, 3394, 3, 0x12},
+    {0, 0, 0, 3397, 3, 0x12},
+    {0, 0, 0, 3400, 3, 0x12},
+    {0, 0, 0, 3403, 3, 0x12},
+    {0, 0, 0, 3406, 3, 0x12},
+    {0, 0, 0, 3409, 3, 0x12},
+    {0, 0, 0, 3412, 3, 0x12},
+    {0, 0, 0, 3415, 3, 0x12},
+    {0, 0, 0, 3418, 3, 0x12},
+    {0, 0, 0, 3421, 3, 0x12},
+    {0, 0, 0, 3424, 3, 0x12},
+    {0, 0, 0, 3427, 3, 0x12},
+    {0, 0, 0, 3430, 3, 0x12},
+    {0, 0, 0, 3433, 3, 0x12},
+    {0, 0, 0, 3436, 3, 0x12},
+    {0, 0, 0, 3439, 3, 0x12},
+    {0, 0, 0, 3442, 3, 0x12},
+    {0, 0, 0, 3445, 3, 0x12},
+    {0, 0, 0, 3448, 3, 0x12},
+    {0, 0, 0, 3451, 3, 0x12},
+    {0, 0, 0, 3454, 3, 0x12},
+    {0, 0, 0, 3457, 3, 0x12},
+    {0, 0, 0, 3460, 3, 0x12},
+    {0, 0, 0, 3463, 3, 0x12},
+    {0, 0, 0, 3466, 3, 0x12},
+    {0, 0, 0, 3469, 1, 0x12},
+    {0, 0, 0, 3470, 1, 0x12},
+    {0, 0, 0, 3471, 1, 0x12},
+    {0, 0, 0, 3472, 3, 0x12},
+    {0, 0, 0, 3475, 2, 0x12},
+    {0, 0, 0, 3477, 2, 0x12},
+    {0, 0, 0, 3479, 2, 0x12},
+    {0, 0, 0, 3481, 2, 0x12},
+    {0, 0, 0, 3483, 2, 0x12},
+    {0, 0, 0, 3485, 2, 0x12},
+    {0, 0, 0, 3487, 2, 0x12},
+    {0, 0, 0, 3489, 2, 0x12},
+    {0, 0, 0, 3491, 2, 0x12},
+    {0, 0, 0, 3493, 2, 0x12},
+    {0, 0, 0, 3495, 2, 0x12},
+    {0, 0, 0, 3497, 2, 0x12},
+    {0, 0, 0, 3499, 2, 0x12},
+    {0, 0, 0, 3501, 2, 0x12},
+    {0, 0, 0, 3503, 2, 0x12},
+    {0, 0, 0, 3505, 2, 0x12},
+    {0, 0, 0, 3507, 2, 0x12},
+    {0, 0, 0, 3509, 2, 0x12},
+    {0, 0, 0, 3511, 2, 0x12},
+    {0, 0, 0, 3513, 2, 0x12},
+    {0, 0, 0, 3515, 2, 0x12},
+    {0, 0, 0, 3517, 2, 0x12},
+    {0, 0, 0, 3519, 2, 0x12},
+    {0, 0, 0, 3521, 2, 0x12},
+    {0, 0, 0, 3523, 2, 0x12},
+    {0, 0, 0, 3525, 2, 0x12},
+    {0, 0, 0, 3527, 2, 0x12},
+    {0, 0, 0, 3529, 2, 0x12},
+    {0, 0, 0, 3531, 2, 0x12},
+    {0, 0, 0, 3533, 5, 0x12},
+    {0, 0, 0, 3538, 4, 0x12},
+    {0, 0, 0, 3542, 2, 0x12},
+    {0, 0, 0, 3544, 1, 0x12},
+    {0, 0, 0, 3545, 1, 0x12},
+    {0, 0, 0, 3546, 1, 0x12},
+    {0, 0, 0, 3547, 1, 0x12},
+    {0, 0, 0, 3548, 1, 0x12},
+    {0, 0, 0, 3549, 1, 0x12},
+    {0, 0, 0, 3550, 1, 0x12},
+    {0, 0, 0, 3551, 1, 0x12},
+    {0, 0, 0, 3552, 1, 0x12},
+    {0, 0, 0, 3553, 1, 0x12},
+    {0, 0, 0, 3554, 1, 0x12},
+    {0, 0, 0, 3555, 1, 0x12},
+    {0, 0, 0, 3556, 1, 0x12},
+    {0, 0, 0, 3557, 1, 0x12},
+    {0, 0, 0, 3558, 1, 0x12},
+    {0, 0, 0, 3559, 1, 0x12},
+    {0, 0, 0, 3560, 1, 0x12},
+    {0, 0, 0, 3561, 1, 0x12},
+    {0, 0, 0, 3562, 1, 0x12},
+    {0, 0, 0, 3563, 1, 0x12},
+    {0, 0, 0, 3564, 1, 0x12},
+    {0, 0, 0, 3565, 1, 0x12},
+    {0, 0, 0, 3566, 1, 0x12},
+    {0, 0, 0, 3567, 1, 0x12},
+    {0, 0, 0, 3568, 1, 0x12},
+    {0, 0, 0, 3569, 1, 0x12},
+    {0, 0, 0, 3570, 1, 0x12},
+    {0, 0, 0, 3571, 1, 0x12},
+    {0, 0, 0, 3572, 1, 0x12},
+    {0, 0, 0, 3573, 1, 0x12},
+    {0, 0, 0, 3574, 1, 0x12},
+    {0, 0, 0, 3575, 1, 0x12},
+    {0, 0, 0, 3576, 2, 0x12},
+    {0, 0, 0, 3578, 2, 0x12},
+    {0, 0, 0, 3580, 2, 0x12},
+    {0, 0, 0, 3582, 2, 0x12},
+    {0, 0, 0, 3584, 2, 0x12},
+    {0, 0, 0, 3586, 2, 0x12},
+    {0, 0, 0, 3588, 2, 0x12},
+    {0, 0, 0, 3590, 2, 0x12},
+    {0, 0, 0, 3592, 2, 0x12},
+    {0, 0, 0, 3594, 2, 0x12},
+    {0, 0, 0, 3596, 2, 0x12},
+    {0, 0, 0, 3598, 2, 0x12},
+    {0, 0, 0, 3600, 2, 0x12},
+    {0, 0, 0, 3602, 2, 0x12},
+    {0, 0, 0, 3604, 2, 0x12},
+    {0, 0, 0, 3606, 2, 0x12},
+    {0, 0, 0, 3608, 2, 0x12},
+    {0, 0, 0, 3610, 2, 0x12},
+    {0, 0, 0, 3612, 2, 0x12},
+    {0, 0, 0, 3614, 2, 0x12},
+    {0, 0, 0, 3616, 2, 0x12},
+    {0, 0, 0, 3618, 2, 0x12},
+    {0, 0, 0, 3620, 2, 0x12},
+    {0, 0, 0, 3622, 2, 0x12},
+    {0, 0, 0, 3624, 3, 0x12},
+    {0, 0, 0, 3627, 3, 0x12},
+    {0, 0, 0, 3630, 3, 0x12},
+    {0, 0, 0, 3633, 2, 0x12},
+    {0, 0, 0, 3635, 3, 0x12},
+    {0, 0, 0, 3638, 2, 0x12},
+    {0, 0, 0, 3640, 3, 0x12},
+    {0, 0, 0, 3643, 1, 0x12},
+    {0, 0, 0, 3644, 1, 0x12},
+    {0, 0, 0, 3645, 1, 0x12},
+    {0, 0, 0, 3646, 1, 0x12},
+    {0, 0, 0, 3647, 1, 0x12},
+    {0, 0, 0, 3648, 1, 0x12},
+    {0, 0, 0, 3649, 1, 0x12},
+    {0, 0, 0, 3650, 1, 0x12},
+    {0, 0, 0, 3651, 1, 0x12},
+    {0, 0, 0, 3652, 1, 0x12},
+    {0, 0, 0, 3653, 1, 0x12},
+    {0, 0, 0, 3654, 1, 0x12},
+    {0, 0, 0, 3655, 1, 0x12},
+    {0, 0, 0, 3656, 1, 0x12},
+    {0, 0, 0, 3657, 1, 0x12},
+    {0, 0, 0, 3658, 1, 0x12},
+    {0, 0, 0, 3659, 1, 0x12},
+    {0, 0, 0, 3660, 1, 0x12},
+    {0, 0, 0, 3661, 1, 0x12},
+    {0, 0, 0, 3662, 1, 0x12},
+    {0, 0, 0, 3663, 1, 0x12},
+    {0, 0, 0, 3664, 1, 0x12},
+    {0, 0, 0, 3665, 1, 0x12},
+    {0, 0, 0, 3666, 1, 0x12},
+    {0, 0, 0, 3667, 1, 0x12},
+    {0, 0, 0, 3668, 1, 0x12},
+    {0, 0, 0, 3669, 1, 0x12},
+    {0, 0, 0, 3670, 1, 0x12},
+    {0, 0, 0, 3671, 1, 0x12},
+    {0, 0, 0, 3672, 1, 0x12},
+    {0, 0, 0, 3673, 1, 0x12},
+    {0, 0, 0, 3674, 1, 0x12},
+    {0, 0, 0, 3675, 1, 0x12},
+    {0, 0, 0, 3676, 1, 0x12},
+    {0, 0, 0, 3677, 1, 0x12},
+    {0, 0, 0, 3678, 1, 0x12},
+    {0, 0, 0, 3679, 1, 0x12},
+    {0, 0, 0, 3680, 1, 0x12},
+    {0, 0, 0, 3681, 1, 0x12},
+    {0, 0, 0, 3682, 1, 0x12},
+    {0, 0, 0, 3683, 1, 0x12},
+    {0, 0, 0, 3684, 1, 0x12},
+    {0, 0, 0, 3685, 1, 0x12},
+    {0, 0, 0, 3686, 1, 0x12},
+    {0, 0, 0, 3687, 1, 0x12},
+    {0, 0, 0, 3688, 1, 0x12},
+    {0, 0, 0, 3689, 1, 0x12},
+    {0, 0, 0, 3690, 2, 0x12},
+    {0, 0, 0, 3692, 5, 0x12},
+    {0, 0, 0, 3697, 4, 0x12},
+    {0, 0, 0, 3701, 5, 0x12},
+    {0, 0, 0, 3706, 3, 0x12},
+    {0, 0, 0, 3709, 5, 0x12},
+    {0, 0, 0, 3714, 3, 0x12},
+    {0, 0, 0, 3717, 3, 0x12},
+    {0, 0, 0, 3720, 6, 0x12},
+    {0, 0, 0, 3726, 4, 0x12},
+    {0, 0, 0, 3730, 3, 0x12},
+    {0, 0, 0, 3733, 3, 0x12},
+    {0, 0, 0, 3736, 3, 0x12},
+    {0, 0, 0, 3739, 4, 0x12},
+    {0, 0, 0, 3743, 4, 0x12},
+    {0, 0, 0, 3747, 4, 0x12},
+    {0, 0, 0, 3751, 4, 0x12},
+    {0, 0, 0, 3755, 4, 0x12},
+    {0, 0, 0, 3759, 4, 0x12},
+    {0, 0, 0, 3763, 4, 0x12},
+    {0, 0, 0, 3767, 6, 0x12},
+    {0, 0, 0, 3773, 2, 0x12},
+    {0, 0, 0, 3775, 6, 0x12},
+    {0, 0, 0, 3781, 6, 0x12},
+    {0, 0, 0, 3787, 5, 0x12},
+    {0, 0, 0, 3792, 4, 0x12},
+    {0, 0, 0, 3796, 6, 0x12},
+    {0, 0, 0, 3802, 6, 0x12},
+    {0, 0, 0, 3808, 4, 0x12},
+    {0, 0, 0, 3812, 3, 0x12},
+    {0, 0, 0, 3815, 3, 0x12},
+    {0, 0, 0, 3818, 4, 0x12},
+    {0, 0, 0, 3822, 4, 0x12},
+    {0, 0, 0, 3826, 5, 0x12},
+    {0, 0, 0, 3831, 5, 0x12},
+    {0, 0, 0, 3836, 3, 0x12},
+    {0, 0, 0, 3839, 3, 0x12},
+    {0, 0, 0, 3842, 4, 0x12},
+    {0, 0, 0, 3846, 3, 0x12},
+    {0, 0, 0, 3849, 3, 0x12},
+    {0, 0, 0, 3852, 2, 0x12},
+    {0, 0, 0, 3854, 2, 0x12},
+    {0, 0, 0, 3856, 3, 0x12},
+    {0, 0, 0, 3859, 3, 0x12},
+    {0, 0, 0, 3862, 6, 0x12},
+    {0, 0, 0, 3868, 4, 0x12},
+    {0, 0, 0, 3872, 5, 0x12},
+    {0, 0, 0, 3877, 6, 0x12},
+    {0, 0, 0, 3883, 4, 0x12},
+    {0, 0, 0, 3887, 3, 0x12},
+    {0, 0, 0, 3890, 3, 0x12},
+    {0, 0, 0, 3893, 6, 0x12},
+    {0, 0, 0, 3899, 4, 0x12},
+    {0, 0, 0, 3903, 6, 0x12},
+    {0, 0, 0, 3909, 3, 0x12},
+    {0, 0, 0, 3912, 5, 0x12},
+    {0, 0, 0, 3917, 3, 0x12},
+    {0, 0, 0, 3920, 4, 0x12},
+    {0, 0, 0, 3924, 3, 0x12},
+    {0, 0, 0, 3927, 4, 0x12},
+    {0, 0, 0, 3931, 5, 0x12},
+    {0, 0, 0, 3936, 4, 0x12},
+    {0, 0, 0, 3940, 5, 0x12},
+    {0, 0, 0, 3945, 4, 0x12},
+    {0, 0, 0, 3949, 2, 0x12},
+    {0, 0, 0, 3951, 5, 0x12},
+    {0, 0, 0, 3956, 3, 0x12},
+    {0, 0, 0, 3959, 3, 0x12},
+    {0, 0, 0, 3962, 4, 0x12},
+    {0, 0, 0, 3966, 3, 0x12},
+    {0, 0, 0, 3969, 3, 0x12},
+    {0, 0, 0, 3972, 3, 0x12},
+    {0, 0, 0, 3975, 5, 0x12},
+    {0, 0, 0, 3980, 4, 0x12},
+    {0, 0, 0, 3984, 2, 0x12},
+    {0, 0, 0, 3986, 6, 0x12},
+    {0, 0, 0, 3992, 3, 0x12},
+    {0, 0, 0, 3995, 5, 0x12},
+    {0, 0, 0, 4000, 4, 0x12},
+    {0, 0, 0, 4004, 4, 0x12},
+    {0, 0, 0, 4008, 3, 0x12},
+    {0, 0, 0, 4011, 3, 0x12},
+    {0, 0, 0, 4014, 4, 0x12},
+    {0, 0, 0, 4018, 2, 0x12},
+    {0, 0, 0, 4020, 4, 0x12},
+    {0, 0, 0, 4024, 5, 0x12},
+    {0, 0, 0, 4029, 2, 0x12},
+    {0, 0, 0, 4031, 6, 0x12},
+    {0, 0, 0, 4037, 3, 0x12},
+    {0, 0, 0, 4040, 2, 0x12},
+    {0, 0, 0, 4042, 2, 0x12},
+    {0, 0, 0, 4044, 2, 0x12},
+    {0, 0, 0, 4046, 2, 0x12},
+    {0, 0, 0, 4048, 2, 0x12},
+    {0, 0, 0, 4050, 2, 0x12},
+    {0, 0, 0, 4052, 2, 0x12},
+    {0, 0, 0, 4054, 2, 0x12},
+    {0, 0, 0, 4056, 2, 0x12},
+    {0, 0, 0, 4058, 2, 0x12},
+    {0, 0, 0, 4060, 3, 0x12},
+    {0, 0, 0, 4063, 3, 0x12},
+    {0, 0, 0, 4066, 3, 0x12},
+    {0, 0, 0, 4069, 3, 0x12},
+    {0, 0, 0, 4072, 3, 0x12},
+    {0, 0, 0, 4075, 3, 0x12},
+    {0, 0, 0, 4078, 3, 0x12},
+    {0, 0, 0, 4081, 3, 0x12},
+    {0, 0, 0, 4084, 3, 0x12},
+    {0, 0, 0, 4087, 3, 0x12},
+    {0, 0, 0, 4090, 3, 0x12},
+    {0, 0, 0, 4093, 3, 0x12},
+    {0, 0, 0, 4096, 3, 0x12},
+    {0, 0, 0, 4099, 3, 0x12},
+    {0, 0, 0, 4102, 3, 0x12},
+    {0, 0, 0, 4105, 3, 0x12},
+    {0, 0, 0, 4108, 2, 0x12},
+    {0, 0, 0, 4110, 2, 0x12},
+    {0, 0, 0, 4112, 3, 0x12},
+    {0, 0, 0, 4115, 2, 0x12},
+    {0, 0, 0, 4117, 2, 0x12},
+    {0, 0, 0, 4119, 2, 0x12},
+    {0, 0, 0, 4121, 3, 0x12},
+    {0, 0, 0, 4124, 3, 0x12},
+    {0, 0, 0, 4127, 2, 0x12},
+    {0, 0, 0, 4129, 2, 0x12},
+    {0, 0, 0, 4131, 2, 0x12},
+    {0, 0, 0, 4133, 2, 0x12},
+    {0, 0, 0, 4135, 2, 0x12},
+    {0, 0, 0, 4137, 4, 0x12},
+    {0, 0, 0, 4141, 2, 0x12},
+    {0, 0, 0, 4143, 2, 0x12},
+    {0, 0, 0, 4145, 2, 0x12},
+    {0, 0, 0, 4147, 2, 0x12},
+    {0, 0, 0, 4149, 2, 0x12},
+    {0, 0, 0, 4151, 2, 0x12},
+    {0, 0, 0, 4153, 2, 0x12},
+    {0, 0, 0, 4155, 2, 0x12},
+    {0, 0, 0, 4157, 3, 0x12},
+    {0, 0, 0, 4160, 4, 0x12},
+    {0, 0, 0, 4164, 2, 0x12},
+    {0, 0, 0, 4166, 2, 0x12},
+    {0, 0, 0, 4168, 2, 0x12},
+    {0, 0, 0, 4170, 2, 0x12},
+    {0, 0, 0, 4172, 2, 0x12},
+    {0, 0, 0, 4174, 2, 0x12},
+    {0, 0, 0, 4176, 2, 0x12},
+    {0, 0, 0, 4178, 3, 0x12},
+    {0, 0, 0, 4181, 3, 0x12},
+    {0, 0, 0, 4184, 3, 0x12},
+    {0, 0, 0, 4187, 3, 0x12},
+    {0, 0, 0, 4190, 2, 0x12},
+    {0, 0, 0, 4192, 2, 0x12},
+    {0, 0, 0, 4194, 2, 0x12},
+    {0, 0, 0, 4196, 2, 0x12},
+    {0, 0, 0, 4198, 2, 0x12},
+    {0, 0, 0, 4200, 2, 0x12},
+    {0, 0, 0, 4202, 2, 0x12},
+    {0, 0, 0, 4204, 2, 0x12},
+    {0, 0, 0, 4206, 2, 0x12},
+    {0, 0, 0, 4208, 2, 0x12},
+    {0, 0, 0, 4210, 3, 0x12},
+    {0, 0, 0, 4213, 3, 0x12},
+    {0, 0, 0, 4216, 2, 0x12},
+    {0, 0, 0, 4218, 3, 0x12},
+    {0, 0, 0, 4221, 3, 0x12},
+    {0, 0, 0, 4224, 3, 0x12},
+    {0, 0, 0, 4227, 2, 0x12},
+    {0, 0, 0, 4229, 3, 0x12},
+    {0, 0, 0, 4232, 3, 0x12},
+    {0, 0, 0, 4235, 4, 0x12},
+    {0, 0, 0, 4239, 2, 0x12},
+    {0, 0, 0, 4241, 3, 0x12},
+    {0, 0, 0, 4244, 3, 0x12},
+    {0, 0, 0, 4247, 3, 0x12},
+    {0, 0, 0, 4250, 3, 0x12},
+    {0, 0, 0, 4253, 5, 0x12},
+    {0, 0, 0, 4258, 6, 0x12},
+    {0, 0, 0, 4264, 2, 0x12},
+    {0, 0, 0, 4266, 2, 0x12},
+    {0, 0, 0, 4268, 2, 0x12},
+    {0, 0, 0, 4270, 2, 0x12},
+    {0, 0, 0, 4272, 2, 0x12},
+    {0, 0, 0, 4274, 2, 0x12},
+    {0, 0, 0, 4276, 2, 0x12},
+    {0, 0, 0, 4278, 2, 0x12},
+    {0, 0, 0, 4280, 2, 0x12},
+    {0, 0, 0, 4282, 2, 0x12},
+    {0, 0, 0, 4284, 2, 0x12},
+    {0, 0, 0, 4286, 2, 0x12},
+    {0, 0, 0, 4288, 2, 0x12},
+    {0, 0, 0, 4290, 2, 0x12},
+    {0, 0, 0, 4292, 2, 0x12},
+    {0, 0, 0, 4294, 2, 0x12},
+    {0, 0, 0, 4296, 2, 0x12},
+    {0, 0, 0, 4298, 2, 0x12},
+    {0, 0, 0, 4300, 4, 0x12},
+    {0, 0, 0, 4304, 2, 0x12},
+    {0, 0, 0, 4306, 2, 0x12},
+    {0, 0, 0, 4308, 2, 0x12},
+    {0, 0, 0, 4310, 4, 0x12},
+    {0, 0, 0, 4314, 3, 0x12},
+    {0, 0, 0, 4317, 2, 0x12},
+    {0, 0, 0, 4319, 2, 0x12},
+    {0, 0, 0, 4321, 2, 0x12},
+    {0, 0, 0, 4323, 2, 0x12},
+    {0, 0, 0, 4325, 2, 0x12},
+    {0, 0, 0, 4327, 2, 0x12},
+    {0, 0, 0, 4329, 2, 0x12},
+    {0, 0, 0, 4331, 2, 0x12},
+    {0, 0, 0, 4333, 2, 0x12},
+    {0, 0, 0, 4335, 2, 0x12},
+    {0, 0, 0, 4337, 3, 0x12},
+    {0, 0, 0, 4340, 2, 0x12},
+    {0, 0, 0, 4342, 2, 0x12},
+    {0, 0, 0, 4344, 3, 0x12},
+    {0, 0, 0, 4347, 3, 0x12},
+    {0, 0, 0, 4350, 2, 0x12},
+    {0, 0, 0, 4352, 4, 0x12},
+    {0, 0, 0, 4356, 3, 0x12},
+    {0, 0, 0, 4359, 2, 0x12},
+    {0, 0, 0, 4361, 2, 0x12},
+    {0, 0, 0, 4363, 2, 0x12},
+    {0, 0, 0, 4365, 2, 0x12},
+    {0, 0, 0, 4367, 3, 0x12},
+    {0, 0, 0, 4370, 3, 0x12},
+    {0, 0, 0, 4373, 2, 0x12},
+    {0, 0, 0, 4375, 2, 0x12},
+    {0, 0, 0, 4377, 2, 0x12},
+    {0, 0, 0, 4379, 2, 0x12},
+    {0, 0, 0, 4381, 2, 0x12},
+    {0, 0, 0, 4383, 2, 0x12},
+    {0, 0, 0, 4385, 2, 0x12},
+    {0, 0, 0, 4387, 2, 0x12},
+    {0, 0, 0, 4389, 2, 0x12},
+    {0, 0, 0, 4391, 3, 0x12},
+    {0, 0, 0, 4394, 3, 0x12},
+    {0, 0, 0, 4397, 3, 0x12},
+    {0, 0, 0, 4400, 3, 0x12},
+    {0, 0, 0, 4403, 3, 0x12},
+    {0, 0, 0, 4406, 3, 0x12},
+    {0, 0, 0, 4409, 3, 0x12},
+    {0, 0, 0, 4412, 3, 0x12},
+    {0, 0, 0, 4415, 3, 0x12},
+    {0, 0, 0, 4418, 3, 0x12},
+    {0, 0, 0, 4421, 3, 0x12},
+    {0, 0, 0, 4424, 3, 0x12},
+    {0, 0, 0, 4427, 3, 0x12},
+    {0, 0, 0, 4430, 3, 0x12},
+    {0, 0, 0, 4433, 3, 0x12},
+    {0, 0, 0, 4436, 3, 0x12},
+    {0, 0, 0, 4439, 3, 0x12},
+    {0, 0, 0, 4442, 3, 0x12},
+    {0, 0, 0, 4445, 3, 0x12},
+    {0, 0, 0, 4448, 3, 0x12},
+    {0, 0, 0, 4451, 3, 0x12},
+    {0, 0, 0, 4454, 3, 0x12},
+    {0, 0, 0, 4457, 3, 0x12},
+    {0, 0, 0, 4460, 1, 0x12},
+    {0, 0, 0, 4461, 1, 0x12},
+    {0, 0, 0, 4462, 1, 0x12},
+    {0, 0, 0, 4463, 1, 0x12},
+    {0, 0, 0, 4464, 1, 0x12},
+    {0, 0, 0, 4465, 1, 0x12},
+    {0, 0, 0, 4466, 1, 0x12},
+    {0, 0, 0, 4467, 1, 0x12},
+    {0, 0, 0, 4468, 1, 0x12},
+    {0, 0, 0, 4469, 1, 0x12},
+    {0, 0, 0, 0, 0, 0x03},
+    {4470, 1, 0, 4470, 1, 0x17},
+    {4471, 1, 0, 4471, 1, 0x17},
+    {2959, 1, 0, 2959, 1, 0x17},
+    {4472, 1, 0, 4472, 1, 0x17},
+    {4473, 1, 0, 4473, 1, 0x17},
+    {4474, 1, 0, 4474, 1, 0x17},
+    {4475, 1, 0, 4475, 1, 0x17},
+    {3013, 1, 0, 3013, 1, 0x17},
+    {4476, 1, 0, 4476, 1, 0x17},
+    {2967, 1, 0, 2967, 1, 0x17},
+    {4477, 1, 0, 4477, 1, 0x17},
+    {4478, 1, 0, 4478, 1, 0x17},
+    {4479, 1, 0, 4479, 1, 0x17},
+    {4480, 1, 0, 4480, 1, 0x17},
+    {4481, 1, 0, 4481, 1, 0x17},
+    {4482, 1, 0, 4482, 1, 0x17},
+    {4483, 1, 0, 4483, 1, 0x17},
+    {4484, 1, 0, 4484, 1, 0x17},
+    {4485, 1, 0, 4485, 1, 0x17},
+    {4486, 1, 0, 4486, 1, 0x17},
+    {4487, 1, 0, 4487, 1, 0x17},
+    {4488, 1, 0, 4488, 1, 0x17},
+    {4489, 1, 0, 4489, 1, 0x17},
+    {4490, 1, 0, 4490, 1, 0x17},
+    {4491, 1, 0, 4491, 1, 0x17},
+    {4492, 1, 0, 4492, 1, 0x17},
+    {4493, 1, 0, 4493, 1, 0x17},
+    {4494, 1, 0, 4494, 1, 0x17},
+    {4495, 1, 0, 4495, 1, 0x17},
+    {4496, 1, 0, 4496, 1, 0x17},
+    {4497, 1, 0, 4497, 1, 0x17},
+    {4498, 1, 0, 4498, 1, 0x17},
+    {4499, 1, 0, 4499, 1, 0x17},
+    {4500, 1, 0, 4500, 1, 0x17},
+    {4501, 1, 0, 4501, 1, 0x17},
+    {4502, 1, 0, 4502, 1, 0x17},
+    {4503, 1, 0, 4503, 1, 0x17},
+    {4504, 1, 0, 4504, 1, 0x17},
+    {4505, 1, 0, 4505, 1, 0x17},
+    {4506, 1, 0, 4506, 1, 0x17},
+    {4507, 1, 0, 4507, 1, 0x17},
+    {4508, 1, 0, 4508, 1, 0x17},
+    {4509, 1, 0, 4509, 1, 0x17},
+    {4510, 1, 0, 4510, 1, 0x17},
+    {4511, 1, 0, 4511, 1, 0x17},
+    {4512, 1, 0, 4512, 1, 0x17},
+    {4513, 1, 0, 4513, 1, 0x17},
+    {4514, 1, 0, 4514, 1, 0x17},
+    {4515, 1, 0, 4515, 1, 0x17},
+    {4516, 1, 0, 4516, 1, 0x17},
+    {4517, 1, 0, 4517, 1, 0x17},
+    {2925, 1, 0, 2925, 1, 0x17},
+    {4518, 1, 0, 4518, 1, 0x17},
+    {4519, 1, 0, 4519, 1, 0x17},
+    {4520, 1, 0, 4520, 1, 0x17},
+    {4521, 1, 0, 4521, 1, 0x17},
+    {4522, 1, 0, 4522, 1, 0x17},
+    {4523, 1, 0, 4523, 1, 0x17},
+    {4524, 1, 0, 4524, 1, 0x17},
+    {4525, 1, 0, 4525, 1, 0x17},
+    {4526, 1, 0, 4526, 1, 0x17},
+    {4527, 1, 0, 4527, 1, 0x17},
+    {4528, 1, 0, 4528, 1, 0x17},
+    {2998, 1, 0, 2998, 1, 0x17},
+    {4529, 1, 0, 4529, 1, 0x17},
+    {4530, 1, 0, 4530, 1, 0x17},
+    {4531, 1, 0, 4531, 1, 0x17},
+    {4532, 1, 0, 4532, 1, 0x17},
+    {4533, 1, 0, 4533, 1, 0x17},
+    {4534, 1, 0, 4534, 1, 0x17},
+    {4535, 1, 0, 4535, 1, 0x17},
+    {4536, 1, 0, 4536, 1, 0x17},
+    {4537, 1, 0, 4537, 1, 0x17},
+    {4538, 1, 0, 4538, 1, 0x17},
+    {4539, 1, 0, 4539, 1, 0x17},
+    {4540, 1, 0, 4540, 1, 0x17},
+    {4541, 1, 0, 4541, 1, 0x17},
+    {4542, 1, 0, 4542, 1, 0x17},
+    {4543, 1, 0, 4543, 1, 0x17},
+    {4544, 1, 0, 4544, 1, 0x17},
+    {4545, 1, 0, 4545, 1, 0x17},
+    {4546, 1, 0, 4546, 1, 0x17},
+    {4547, 1, 0, 4547, 1, 0x17},
+    {4548, 1, 0, 4548, 1, 0x17},
+    {4549, 1, 0, 4549, 1, 0x17},
+    {4550, 1, 0, 4550, 1, 0x17},
+    {4551, 1, 0, 4551, 1, 0x17},
+    {4552, 1, 0, 4552, 1, 0x17},
+    {4553, 1, 0, 4553, 1, 0x17},
+    {4554, 1, 0, 4554, 1, 0x17},
+    {4555, 1, 0, 4555, 1, 0x17},
+    {4556, 1, 0, 4556, 1, 0x17},
+    {4557, 1, 0, 4557, 1, 0x17},
+    {4558, 1, 0, 4558, 1, 0x17},
+    {4559, 1, 0, 4559, 1, 0x17},
+    {4560, 1, 0, 4560, 1, 0x17},
+    {4561, 1, 0, 4561, 1, 0x17},
+    {4562, 1, 0, 4562, 1, 0x17},
+    {4563, 1, 0, 4563, 1, 0x17},
+    {4564, 1, 0, 4564, 1, 0x17},
+    {4565, 1, 0, 4565, 1, 0x17},
+    {4566, 1, 0, 4566, 1, 0x17},
+    {4567, 1, 0, 4567, 1, 0x17},
+    {4568, 1, 0, 4568, 1, 0x17},
+    {4569, 1, 0, 4569, 1, 0x17},
+    {4570, 1, 0, 4570, 1, 0x17},
+    {4571, 1, 0, 4571, 1, 0x17},
+    {4572, 1, 0, 4572, 1, 0x17},
+    {4573, 1, 0, 4573, 1, 0x17},
+    {4574, 1, 0, 4574, 1, 0x17},
+    {4575, 1, 0, 4575, 1, 0x17},
+    {2961, 1, 0, 2961, 1, 0x17},
+    {4576, 1, 0, 4576, 1, 0x17},
+    {4577, 1, 0, 4577, 1, 0x17},
+    {4578, 1, 0, 4578, 1, 0x17},
+    {4579, 1, 0, 4579, 1, 0x17},
+    {4580, 1, 0, 4580, 1, 0x17},
+    {4581, 1, 0, 4581, 1, 0x17},
+    {4582, 1, 0, 4582, 1, 0x17},
+    {4583, 1, 0, 4583, 1, 0x17},
+    {4584, 1, 0, 4584, 1, 0x17},
+    {4585, 1, 0, 4585, 1, 0x17},
+    {4586, 1, 0, 4586, 1, 0x17},
+    {4587, 1, 0, 4587, 1, 0x17},
+    {4588, 1, 0, 4588, 1, 0x17},
+    {4589, 1, 0, 4589, 1, 0x17},
+    {4590, 1, 0, 4590, 1, 0x17},
+    {2838, 1, 0, 2838, 1, 0x17},
+    {4591, 1, 0, 4591, 1, 0x17},
+    {4592, 1, 0, 4592, 1, 0x17},
+    {4593, 1, 0, 4593, 1, 0x17},
+    {4594, 1, 0, 4594, 1, 0x17},
+    {4595, 1, 0, 4595, 1, 0x17},
+    {4596, 1, 0, 4596, 1, 0x17},
+    {4597, 1, 0, 4597, 1, 0x17},
+    {4598, 1, 0, 4598, 1, 0x17},
+    {2819, 1, 0, 2819, 1, 0x17},
+    {4599, 1, 0, 4599, 1, 0x17},
+    {4600, 1, 0, 4600, 1, 0x17},
+    {4601, 1, 0, 4601, 1, 0x17},
+    {4602, 1, 0, 4602, 1, 0x17},
+    {4603, 1, 0, 4603, 1, 0x17},
+    {4604, 1, 0, 4604, 1, 0x17},
+    {4605, 1, 0, 4605, 1, 0x17},
+    {4606, 1, 0, 4606, 1, 0x17},
+    {4607, 1, 0, 4607, 1, 0x17},
+    {4608, 1, 0, 4608, 1, 0x17},
+    {4609, 1, 0, 4609, 1, 0x17},
+    {4610, 1, 0, 4610, 1, 0x17},
+    {4611, 1, 0, 4611, 1, 0x17},
+    {4612, 1, 0, 4612, 1, 0x17},
+    {4613, 1, 0, 4613, 1, 0x17},
+    {4614, 1, 0, 4614, 1, 0x17},
+    {4615, 1, 0, 4615, 1, 0x17},
+    {4616, 1, 0, 4616, 1, 0x17},
+    {4617, 1, 0, 4617, 1, 0x17},
+    {4618, 1, 0, 4618, 1, 0x17},
+    {4619, 1, 0, 4619, 1, 0x17},
+    {4620, 1, 0, 4620, 1, 0x17},
+    {4621, 1, 0, 4621, 1, 0x17},
+    {4622, 1, 0, 4622, 1, 0x17},
+    {4623, 1, 0, 4623, 1, 0x17},
+    {4624, 1, 0, 4624, 1, 0x17},
+    {4625, 1, 0, 4625, 1, 0x17},
+    {4626, 1, 0, 4626, 1, 0x17},
+    {4627, 1, 0, 4627, 1, 0x17},
+    {4628, 1, 0, 4628, 1, 0x17},
+    {4629, 1, 0, 4629, 1, 0x17},
+    {4630, 1, 0, 4630, 1, 0x17},
+    {4631, 1, 0, 4631, 1, 0x17},
+    {4632, 1, 0, 4632, 1, 0x17},
+    {4633, 1, 0, 4633, 1, 0x17},
+    {4634, 1, 0, 4634, 1, 0x17},
+    {4635, 1, 0, 4635, 1, 0x17},
+    {4636, 1, 0, 4636, 1, 0x17},
+    {4637, 1, 0, 4637, 1, 0x17},
+    {4638, 1, 0, 4638, 1, 0x17},
+    {4639, 1, 0, 4639, 1, 0x17},
+    {4640, 1, 0, 4640, 1, 0x17},
+    {4641, 1, 0, 4641, 1, 0x17},
+    {4642, 1, 0, 4642, 1, 0x17},
+    {4643, 1, 0, 4643, 1, 0x17},
+    {4644, 1, 0, 4644, 1, 0x17},
+    {4645, 1, 0, 4645, 1, 0x17},
+    {4646, 1, 0, 4646, 1, 0x17},
+    {4647, 1, 0, 4647, 1, 0x17},
+    {4648, 1, 0, 4648, 1, 0x17},
+    {4649, 1, 0, 4649, 1, 0x17},
+    {4650, 1, 0, 4650, 1, 0x17},
+    {4651, 1, 0, 4651, 1, 0x17},
+    {4652, 1, 0, 4652, 1, 0x17},
+    {3012, 1, 0, 3012, 1, 0x17},
+    {4653, 1, 0, 4653, 1, 0x17},
+    {4654, 1, 0, 4654, 1, 0x17},
+    {4655, 1, 0, 4655, 1, 0x17},
+    {4656, 1, 0, 4656, 1, 0x17},
+    {4657, 1, 0, 4657, 1, 0x17},
+    {4658, 1, 0, 4658, 1, 0x17},
+    {4659, 1, 0, 4659, 1, 0x17},
+    {4660, 1, 0, 4660, 1, 0x17},
+    {4661, 1, 0, 4661, 1, 0x17},
+    {4662, 1, 0, 4662, 1, 0x17},
+    {4663, 1, 0, 4663, 1, 0x17},
+    {4664, 1, 0, 4664, 1, 0x17},
+    {3545, 1, 0, 3545, 1, 0x17},
+    {4665, 1, 0, 4665, 1, 0x17},
+    {4666, 1, 0, 4666, 1, 0x17},
+    {4667, 1, 0, 4667, 1, 0x17},
+    {4668, 1, 0, 4668, 1, 0x17},
+    {4669, 1, 0, 4669, 1, 0x17},
+    {4670, 1, 0, 4670, 1, 0x17},
+    {4671, 1, 0, 4671, 1, 0x17},
+    {4672, 1, 0, 4672, 1, 0x17},
+    {4673, 1, 0, 4673, 1, 0x17},
+    {4674, 1, 0, 4674, 1, 0x17},
+    {4675, 1, 0, 4675, 1, 0x17},
+    {4676, 1, 0, 4676, 1, 0x17},
+    {4677, 1, 0, 4677, 1, 0x17},
+    {4678, 1, 0, 4678, 1, 0x17},
+    {4679, 1, 0, 4679, 1, 0x17},
+    {4680, 1, 0, 4680, 1, 0x17},
+    {4681, 1, 0, 4681, 1, 0x17},
+    {4682, 1, 0, 4682, 1, 0x17},
+    {4683, 1, 0, 4683, 1, 0x17},
+    {4684, 1, 0, 4684, 1, 0x17},
+    {4685, 1, 0, 4685, 1, 0x17},
+    {4686, 1, 0, 4686, 1, 0x17},
+    {2966, 1, 0, 2966, 1, 0x17},
+    {4687, 1, 0, 4687, 1, 0x17},
+    {4688, 1, 0, 4688, 1, 0x17},
+    {4689, 1, 0, 4689, 1, 0x17},
+    {4690, 1, 0, 4690, 1, 0x17},
+    {4691, 1, 0, 4691, 1, 0x17},
+    {4692, 1, 0, 4692, 1, 0x17},
+    {4693, 1, 0, 4693, 1, 0x17},
+    {4694, 1, 0, 4694, 1, 0x17},
+    {4695, 1, 0, 4695, 1, 0x17},
+    {4696, 1, 0, 4696, 1, 0x17},
+    {4697, 1, 0, 4697, 1, 0x17},
+    {4698, 1, 0, 4698, 1, 0x17},
+    {4699, 1, 0, 4699, 1, 0x17},
+    {2917, 1, 0, 2917, 1, 0x17},
+    {4700, 1, 0, 4700, 1, 0x17},
+    {4701, 1, 0, 4701, 1, 0x17},
+    {4702, 1, 0, 4702, 1, 0x17},
+    {4703, 1, 0, 4703, 1, 0x17},
+    {4704, 1, 0, 4704, 1, 0x17},
+    {4705, 1, 0, 4705, 1, 0x17},
+    {4706, 1, 0, 4706, 1, 0x17},
+    {4707, 1, 0, 4707, 1, 0x17},
+    {4708, 1, 0, 4708, 1, 0x17},
+    {4709, 1, 0, 4709, 1, 0x17},
+    {4710, 1, 0, 4710, 1, 0x17},
+    {4711, 1, 0, 4711, 1, 0x17},
+    {4712, 1, 0, 4712, 1, 0x17},
+    {4713, 1, 0, 4713, 1, 0x17},
+    {4714, 1, 0, 4714, 1, 0x17},
+    {4715, 1, 0, 4715, 1, 0x17},
+    {2944, 1, 0, 2944, 1, 0x17},
+    {4716, 1, 0, 4716, 1, 0x17},
+    {2947, 1, 0, 2947, 1, 0x17},
+    {4717, 1, 0, 4717, 1, 0x17},
+    {4718, 1, 0, 4718, 1, 0x17},
+    {4719, 1, 0, 4719, 1, 0x17},
+    {4720, 1, 0, 4720, 1, 0x17},
+    {4721, 1, 0, 4721, 1, 0x17},
+    {4722, 1, 0, 4722, 1, 0x17},
+    {4723, 1, 0, 4723, 1, 0x17},
+    {4724, 1, 0, 4724, 1, 0x17},
+    {4725, 1, 0, 4725, 1, 0x17},
+    {4726, 1, 0, 4726, 1, 0x17},
+    {4727, 1, 0, 4727, 1, 0x17},
+    {4728, 1, 0, 4728, 1, 0x17},
+    {4729, 1, 0, 4729, 1, 0x17},
+    {4730, 1, 0, 4730, 1, 0x17},
+    {2924, 1, 0, 2924, 1, 0x17},
+    {4731, 1, 0, 4731, 1, 0x17},
+    {4732, 1, 0, 4732, 1, 0x17},
+    {4733, 1, 0, 4733, 1, 0x17},
+    {4734, 1, 0, 4734, 1, 0x17},
+    {4735, 1, 0, 4735, 1, 0x17},
+    {4736, 1, 0, 4736, 1, 0x17},
+    {4737, 1, 0, 4737, 1, 0x17},
+    {4738, 1, 0, 4738, 1, 0x17},
+    {4739, 1, 0, 4739, 1, 0x17},
+    {4740, 1, 0, 4740, 1, 0x17},
+    {4741, 1, 0, 4741, 1, 0x17},
+    {4742, 1, 0, 4742, 1, 0x17},
+    {4743, 1, 0, 4743, 1, 0x17},
+    {4744, 1, 0, 4744, 1, 0x17},
+    {4745, 1, 0, 4745, 1, 0x17},
+    {4746, 1, 0, 4746, 1, 0x17},
+    {4747, 1, 0, 4747, 1, 0x17},
+    {4748, 1, 0, 4748, 1, 0x17},
+    {4749, 1, 0, 4749, 1, 0x17},
+    {4750, 1, 0, 4750, 1, 0x17},
+    {4751, 1, 0, 4751, 1, 0x17},
+    {4752, 1, 0, 4752, 1, 0x17},
+    {2845, 1, 0, 2845, 1, 0x17},
+    {4753, 1, 0, 4753, 1, 0x17},
+    {4754, 1, 0, 4754, 1, 0x17},
+    {4755, 1, 0, 4755, 1, 0x17},
+    {4756, 1, 0, 4756, 1, 0x17},
+    {4757, 1, 0, 4757, 1, 0x17},
+    {4758, 1, 0, 4758, 1, 0x17},
+    {4759, 1, 0, 4759, 1, 0x17},
+    {4760, 1, 0, 4760, 1, 0x17},
+    {4761, 1, 0, 4761, 1, 0x17},
+    {4762, 1, 0, 4762, 1, 0x17},
+    {4763, 1, 0, 4763, 1, 0x17},
+    {4764, 1, 0, 4764, 1, 0x17},
+    {4765, 1, 0, 4765, 1, 0x17},
+    {4766, 1, 0, 4766, 1, 0x17},
+    {4767, 1, 0, 4767, 1, 0x17},
+    {3550, 1, 0, 3550, 1, 0x17},
+    {4768, 1, 0, 4768, 1, 0x17},
+    {4769, 1, 0, 4769, 1, 0x17},
+    {4770, 1, 0, 4770, 1, 0x17},
+    {4771, 1, 0, 4771, 1, 0x17},
+    {3554, 1, 0, 3554, 1, 0x17},
+    {4772, 1, 0, 4772, 1, 0x17},
+    {4773, 1, 0, 4773, 1, 0x17},
+    {4774, 1, 0, 4774, 1, 0x17},
+    {4775, 1, 0, 4775, 1, 0x17},
+    {4776, 1, 0, 4776, 1, 0x17},
+    {4777, 1, 0, 4777, 1, 0x17},
+    {4778, 1, 0, 4778, 1, 0x17},
+    {4779, 1, 0, 4779, 1, 0x17},
+    {4780, 1, 0, 4780, 1, 0x17},
+    {4781, 1, 0, 4781, 1, 0x17},
+    {4782, 1, 0, 4782, 1, 0x17},
+    {4783, 1, 0, 4783, 1, 0x17},
+    {4784, 1, 0, 4784, 1, 0x17},
+    {4785, 1, 0, 4785, 1, 0x17},
+    {4786, 1, 0, 4786, 1, 0x17},
+    {4787, 1, 0, 4787, 1, 0x17},
+    {4788, 1, 0, 4788, 1, 0x17},
+    {4789, 1, 0, 4789, 1, 0x17},
+    {4790, 1, 0, 4790, 1, 0x17},
+    {4791, 1, 0, 4791, 1, 0x17},
+    {4792, 1, 0, 4792, 1, 0x17},
+    {4793, 1, 0, 4793, 1, 0x17},
+    {4794, 1, 0, 4794, 1, 0x17},
+    {4795, 1, 0, 4795, 1, 0x17},
+    {4796, 1, 0, 4796, 1, 0x17},
+    {4797, 1, 0, 4797, 1, 0x17},
+    {4798, 1, 0, 4798, 1, 0x17},
+    {4799, 1, 0, 4799, 1, 0x17},
+    {4800, 1, 0, 4800, 1, 0x17},
+    {4801, 1, 0, 4801, 1, 0x17},
+    {4802, 1, 0, 4802, 1, 0x17},
+    {4803, 1, 0, 4803, 1, 0x17},
+    {4804, 1, 0, 4804, 1, 0x17},
+    {4805, 1, 0, 4805, 1, 0x17},
+    {4806, 1, 0, 4806, 1, 0x17},
+    {4807, 1, 0, 4807, 1, 0x17},
+    {4808, 1, 0, 4808, 1, 0x17},
+    {4809, 1, 0, 4809, 1, 0x17},
+    {4810, 1, 0, 4810, 1, 0x17},
+    {4811, 1, 0, 4811, 1, 0x17},
+    {4812, 1, 0, 4812, 1, 0x17},
+    {4813, 1, 0, 4813, 1, 0x17},
+    {4814, 1, 0, 4814, 1, 0x17},
+    {4815, 1, 0, 4815, 1, 0x17},
+    {4816, 1, 0, 4816, 1, 0x17},
+    {4817, 1, 0, 4817, 1, 0x17},
+    {4818, 1, 0, 4818, 1, 0x17},
+    {4819, 1, 0, 4819, 1, 0x17},
+    {4820, 1, 0, 4820, 1, 0x17},
+    {4821, 1, 0, 4821, 1, 0x17},
+    {4822, 1, 0, 4822, 1, 0x17},
+    {4823, 1, 0, 4823, 1, 0x17},
+    {4824, 1, 0, 4824, 1, 0x17},
+    {4825, 1, 0, 4825, 1, 0x17},
+    {4826, 1, 0, 4826, 1, 0x17},
+    {4827, 1, 0, 4827, 1, 0x17},
+    {2878, 1, 0, 2878, 1, 0x17},
+    {4828, 1, 0, 4828, 1, 0x17},
+    {4829, 1, 0, 4829, 1, 0x17},
+    {4830, 1, 0, 4830, 1, 0x17},
+    {4831, 1, 0, 4831, 1, 0x17},
+    {4832, 1, 0, 4832, 1, 0x17},
+    {4833, 1, 0, 4833, 1, 0x17},
+    {4834, 1, 0, 4834, 1, 0x17},
+    {4835, 1, 0, 4835, 1, 0x17},
+    {4836, 1, 0, 4836, 1, 0x17},
+    {4837, 1, 0, 4837, 1, 0x17},
+    {4838, 1, 0, 4838, 1, 0x17},
+    {4839, 1, 0, 4839, 1, 0x17},
+    {4840, 1, 0, 4840, 1, 0x17},
+    {4841, 1, 0, 4841, 1, 0x17},
+    {4842, 1, 0, 4842, 1, 0x17},
+    {4843, 1, 0, 4843, 1, 0x17},
+    {4844, 1, 0, 4844, 1, 0x17},
+    {4845, 1, 0, 4845, 1, 0x17},
+    {4846, 1, 0, 4846, 1, 0x17},
+    {4847, 1, 0, 4847, 1, 0x17},
+    {4848, 1, 0, 4848, 1, 0x17},
+    {4849, 1, 0, 4849, 1, 0x17},
+    {4850, 1, 0, 4850, 1, 0x17},
+    {4851, 1, 0, 4851, 1, 0x17},
+    {4852, 1, 0, 4852, 1, 0x17},
+    {4853, 1, 0, 4853, 1, 0x17},
+    {4854, 1, 0, 4854, 1, 0x17},
+    {4855, 1, 0, 4855, 1, 0x17},
+    {4856, 1, 0, 4856, 1, 0x17},
+    {4857, 1, 0, 4857, 1, 0x17},
+    {4858, 1, 0, 4858, 1, 0x17},
+    {4859, 1, 0, 4859, 1, 0x17},
+    {4860, 1, 0, 4860, 1, 0x17},
+    {4861, 1, 0, 4861, 1, 0x17},
+    {4862, 1, 0, 4862, 1, 0x17},
+    {4863, 1, 0, 4863, 1, 0x17},
+    {4864, 1, 0, 4864, 1, 0x17},
+    {4865, 1, 0, 4865, 1, 0x17},
+    {4866, 1, 0, 4866, 1, 0x17},
+    {4867, 1, 0, 4867, 1, 0x17},
+    {4868, 1, 0, 4868, 1, 0x17},
+    {4869, 1, 0, 4869, 1, 0x17},
+    {4870, 1, 0, 4870, 1, 0x17},
+    {4871, 1, 0, 4871, 1, 0x17},
+    {4872, 1, 0, 4872, 1, 0x17},
+    {4873, 1, 0, 4873, 1, 0x17},
+    {4874, 1, 0, 4874, 1, 0x17},
+    {4875, 1, 0, 4875, 1, 0x17},
+    {0, 0, 0, 4876, 2, 0x12},
+    {0, 0, 0, 4878, 2, 0x12},
+    {0, 0, 0, 4880, 2, 0x12},
+    {0, 0, 0, 4882, 3, 0x12},
+    {0, 0, 0, 4885, 3, 0x12},
+    {0, 0, 0, 4888, 2, 0x12},
+    {0, 0, 0, 4890, 2, 0x12},
+    {0, 0, 0, 4892, 2, 0x12},
+    {0, 0, 0, 4894, 2, 0x12},
+    {0, 0, 0, 4896, 2, 0x12},
+    {0, 0, 0, 4898, 2, 0x12},
+    {4900, 2, 0, 4900, 2, 0x17},
+    {0, 0, 26, 0, 0, 0x00},
+    {4902, 2, 0, 4902, 2, 0x17},
+    {0, 0, 0, 4904, 1, 0x12},
+    {0, 0, 0, 4905, 1, 0x12},
+    {0, 0, 0, 4906, 1, 0x12},
+    {0, 0, 0, 4907, 1, 0x12},
+    {0, 0, 0, 4908, 1, 0x12},
+    {0, 0, 0, 4909, 1, 0x12},
+    {0, 0, 0, 4910, 1, 0x12},
+    {4911, 2, 0, 4911, 2, 0x17},
+    {4913, 2, 0, 4913, 2, 0x17},
+    {4915, 3, 0, 4915, 3, 0x17},
+    {4918, 3, 0, 4918, 3, 0x17},
+    {4921, 2, 0, 4921, 2, 0x17},
+    {4923, 2, 0, 4923, 2, 0x17},
+    {4925, 2, 0, 4925, 2, 0x17},
+    {4927, 2, 0, 4927, 2, 0x17},
+    {4929, 2, 0, 4929, 2, 0x17},
+    {4931, 2, 0, 4931, 2, 0x17},
+    {4933, 2, 0, 4933, 2, 0x17},
+    {4935, 2, 0, 4935, 2, 0x17},
+    {4937, 2, 0, 4937, 2, 0x17},
+    {4939, 2, 0, 4939, 2, 0x17},
+    {4941, 2, 0, 4941, 2, 0x17},
+    {4943, 2, 0, 4943, 2, 0x17},
+    {4945, 2, 0, 4945, 2, 0x17},
+    {4947, 2, 0, 4947, 2, 0x17},
+    {4949, 2, 0, 4949, 2, 0x17},
+    {4951, 2, 0, 4951, 2, 0x17},
+    {4953, 2, 0, 4953, 2, 0x17},
+    {4955, 2, 0, 4955, 2, 0x17},
+    {4957, 2, 0, 4957, 2, 0x17},
+    {4959, 2, 0, 4959, 2, 0x17},
+    {4961, 2, 0, 4961, 2, 0x17},
+    {4963, 2, 0, 4963, 2, 0x17},
+    {4965, 2, 0, 4965, 2, 0x17},
+    {4967, 2, 0, 4967, 2, 0x17},
+    {4969, 2, 0, 4969, 2, 0x17},
+    {4971, 2, 0, 4971, 2, 0x17},
+    {4973, 2, 0, 4973, 2, 0x17},
+    {4975, 2, 0, 4975, 2, 0x17},
+    {0, 0, 0, 4977, 2, 0x12},
+    {0, 0, 0, 4979, 1, 0x12},
+    {0, 0, 0, 4980, 1, 0x12},
+    {0, 0, 0, 4981, 1, 0x12},
+    {0, 0, 0, 4982, 1, 0x12},
+    {0, 0, 0, 4983, 1, 0x12},
+    {0, 0, 0, 4984, 1, 0x12},
+    {0, 0, 0, 4985, 1, 0x12},
+    {0, 0, 0, 4986, 1, 0x12},
+    {0, 0, 0, 4987, 1, 0x12},
+    {0, 0, 0, 4988, 1, 0x12},
+    {0, 0, 0, 4989, 1, 0x12},
+    {0, 0, 0, 4990, 1, 0x12},
+    {0, 0, 0, 4991, 1, 0x12},
+    {0, 0, 0, 4992, 1, 0x12},
+    {0, 0, 0, 4993, 1, 0x12},
+    {0, 0, 0, 4994, 1, 0x12},
+    {0, 0, 0, 4995, 1, 0x12},
+    {0, 0, 0, 4996, 1, 0x12},
+    {0, 0, 0, 4997, 1, 0x12},
+    {0, 0, 0, 4998, 1, 0x12},
+    {0, 0, 0, 4999, 1, 0x12},
+    {0, 0, 0, 5000, 1, 0x12},
+    {0, 0, 0, 5001, 1, 0x12},
+    {0, 0, 0, 5002, 1, 0x12},
+    {0, 0, 0, 5003, 1, 0x12},
+    {0, 0, 0, 809, 2, 0x12},
+    {0, 0, 0, 5004, 1, 0x12},
+    {0, 0, 0, 5005, 1, 0x12},
+    {0, 0, 0, 5006, 1, 0x12},
+    {0, 0, 0, 813, 2, 0x12},
+    {0, 0, 0, 5007, 1, 0x12},
+    {0, 0, 0, 5008, 1, 0x12},
+    {0, 0, 0, 5009, 1, 0x12},
+    {0, 0, 0, 5010, 1, 0x12},
+    {0, 0, 0, 5011, 1, 0x12},
+    {0, 0, 0, 5012, 1, 0x12},
+    {0, 0, 0, 5013, 1, 0x12},
+    {0, 0, 0, 5014, 1, 0x12},
+    {0, 0, 0, 5015, 1, 0x12},
+    {0, 0, 0, 5016, 3, 0x12},
+    {0, 0, 0, 5019, 3, 0x12},
+    {0, 0, 0, 5022, 3, 0x12},
+    {0, 0, 0, 5025, 3, 0x12},
+    {0, 0, 0, 5028, 3, 0x12},
+    {0, 0, 0, 5031, 3, 0x12},
+    {0, 0, 0, 5034, 3, 0x12},
+    {0, 0, 0, 5037, 3, 0x12},
+    {0, 0, 0, 5040, 1, 0x12},
+    {0, 0, 0, 5041, 3, 0x12},
+    {0, 0, 0, 5044, 3, 0x12},
+    {0, 0, 0, 5047, 3, 0x12},
+    {0, 0, 0, 5050, 3, 0x12},
+    {0, 0, 0, 5053, 2, 0x12},
+    {0, 0, 0, 5055, 2, 0x12},
+    {0, 0, 0, 5057, 2, 0x12},
+    {0, 0, 0, 5059, 2, 0x12},
+    {0, 0, 0, 5061, 2, 0x12},
+    {0, 0, 0, 5063, 2, 0x12},
+    {0, 0, 0, 5065, 2, 0x12},
+    {0, 0, 0, 5067, 2, 0x12},
+    {0, 0, 0, 5069, 2, 0x12},
+    {0, 0, 0, 5071, 2, 0x12},
+    {0, 0, 0, 5073, 2, 0x12},
+    {0, 0, 0, 5075, 2, 0x12},
+    {0, 0, 0, 5077, 2, 0x12},
+    {0, 0, 0, 5079, 2, 0x12},
+    {0, 0, 0, 5081, 2, 0x12},
+    {0, 0, 0, 5083, 2, 0x12},
+    {0, 0, 0, 5085, 2, 0x12},
+    {0, 0, 0, 5087, 2, 0x12},
+    {0, 0, 0, 5089, 2, 0x12},
+    {0, 0, 0, 5091, 2, 0x12},
+    {0, 0, 0, 5093, 2, 0x12},
+    {0, 0, 0, 5095, 2, 0x12},
+    {0, 0, 0, 5097, 2, 0x12},
+    {0, 0, 0, 5099, 2, 0x12},
+    {0, 0, 0, 5101, 2, 0x12},
+    {0, 0, 0, 5103, 2, 0x12},
+    {0, 0, 0, 5105, 2, 0x12},
+    {0, 0, 0, 5107, 2, 0x12},
+    {0, 0, 0, 5109, 2, 0x12},
+    {0, 0, 0, 5111, 2, 0x12},
+    {0, 0, 0, 5113, 2, 0x12},
+    {0, 0, 0, 5115, 2, 0x12},
+    {0, 0, 0, 5117, 2, 0x12},
+    {0, 0, 0, 5119, 2, 0x12},
+    {0, 0, 0, 5121, 2, 0x12},
+    {0, 0, 0, 5123, 2, 0x12},
+    {0, 0, 0, 5125, 2, 0x12},
+    {0, 0, 0, 5127, 2, 0x12},
+    {0, 0, 0, 5129, 2, 0x12},
+    {0, 0, 0, 5131, 2, 0x12},
+    {0, 0, 0, 5133, 2, 0x12},
+    {0, 0, 0, 5135, 2, 0x12},
+    {0, 0, 0, 5137, 2, 0x12},
+    {0, 0, 0, 5139, 2, 0x12},
+    {0, 0, 0, 5141, 2, 0x12},
+    {0, 0, 0, 5143, 2, 0x12},
+    {0, 0, 0, 5145, 2, 0x12},
+    {0, 0, 0, 5147, 2, 0x12},
+    {0, 0, 0, 5149, 2, 0x12},
+    {0, 0, 0, 5151, 2, 0x12},
+    {0, 0, 0, 5153, 2, 0x12},
+    {0, 0, 0, 5155, 2, 0x12},
+    {0, 0, 0, 5157, 2, 0x12},
+    {0, 0, 0, 5159, 2, 0x12},
+    {0, 0, 0, 5161, 2, 0x12},
+    {0, 0, 0, 5163, 2, 0x12},
+    {0, 0, 0, 5165, 2, 0x12},
+    {0, 0, 0, 5167, 2, 0x12},
+    {0, 0, 0, 5169, 2, 0x12},
+    {0, 0, 0, 5171, 2, 0x12},
+    {0, 0, 0, 5173, 2, 0x12},
+    {0, 0, 0, 5175, 2, 0x12},
+    {0, 0, 0, 5177, 2, 0x12},
+    {0, 0, 0, 5179, 2, 0x12},
+    {0, 0, 0, 5181, 2, 0x12},
+    {0, 0, 0, 5183, 2, 0x12},
+    {0, 0, 0, 5185, 2, 0x12},
+    {0, 0, 0, 5187, 2, 0x12},
+    {0, 0, 0, 5189, 2, 0x12},
+    {0, 0, 0, 5191, 2, 0x12},
+    {0, 0, 0, 5193, 2, 0x12},
+    {0, 0, 0, 5195, 2, 0x12},
+    {0, 0, 0, 5197, 2, 0x12},
+    {0, 0, 0, 5199, 2, 0x12},
+    {0, 0, 0, 5201, 2, 0x12},
+    {0, 0, 0, 5203, 2, 0x12},
+    {0, 0, 0, 5205, 2, 0x12},
+    {0, 0, 0, 5207, 2, 0x12},
+    {0, 0, 0, 5209, 2, 0x12},
+    {0, 0, 0, 5211, 2, 0x12},
+    {0, 0, 0, 5213, 2, 0x12},
+    {0, 0, 0, 5215, 2, 0x12},
+    {0, 0, 0, 5217, 2, 0x12},
+    {0, 0, 0, 5219, 2, 0x12},
+    {0, 0, 0, 5221, 2, 0x12},
+    {0, 0, 0, 5223, 2, 0x12},
+    {0, 0, 0, 5225, 2, 0x12},
+    {0, 0, 0, 5227, 2, 0x12},
+    {0, 0, 0, 5229, 2, 0x12},
+    {0, 0, 0, 5231, 3, 0x12},
+    {0, 0, 0, 5234, 3, 0x12},
+    {0, 0, 0, 5237, 3, 0x12},
+    {0, 0, 0, 5240, 3, 0x12},
+    {0, 0, 0, 5243, 3, 0x12},
+    {0, 0, 0, 5246, 3, 0x12},
+    {0, 0, 0, 5249, 3, 0x12},
+    {0, 0, 0, 5252, 3, 0x12},
+    {0, 0, 0, 5255, 3, 0x12},
+    {0, 0, 0, 5258, 2, 0x12},
+    {0, 0, 0, 5260, 2, 0x12},
+    {0, 0, 0, 5262, 2, 0x12},
+    {0, 0, 0, 5264, 2, 0x12},
+    {0, 0, 0, 5266, 2, 0x12},
+    {0, 0, 0, 5268, 2, 0x12},
+    {0, 0, 0, 5270, 2, 0x12},
+    {0, 0, 0, 5272, 2, 0x12},
+    {0, 0, 0, 5274, 2, 0x12},
+    {0, 0, 0, 5276, 2, 0x12},
+    {0, 0, 0, 5278, 2, 0x12},
+    {0, 0, 0, 5280, 2, 0x12},
+    {0, 0, 0, 5282, 2, 0x12},
+    {0, 0, 0, 5284, 2, 0x12},
+    {0, 0, 0, 5286, 2, 0x12},
+    {0, 0, 0, 5288, 2, 0x12},
+    {0, 0, 0, 5290, 3, 0x12},
+    {0, 0, 0, 5293, 3, 0x12},
+    {0, 0, 0, 5296, 2, 0x12},
+    {0, 0, 0, 5298, 2, 0x12},
+    {0, 0, 0, 5300, 2, 0x12},
+    {0, 0, 0, 5302, 2, 0x12},
+    {0, 0, 0, 5304, 2, 0x12},
+    {0, 0, 0, 5306, 2, 0x12},
+    {0, 0, 0, 5308, 2, 0x12},
+    {0, 0, 0, 5310, 2, 0x12},
+    {0, 0, 0, 5312, 2, 0x12},
+    {0, 0, 0, 5314, 2, 0x12},
+    {0, 0, 0, 5316, 2, 0x12},
+    {0, 0, 0, 5318, 3, 0x12},
+    {0, 0, 0, 5321, 3, 0x12},
+    {0, 0, 0, 5324, 3, 0x12},
+    {0, 0, 0, 5327, 2, 0x12},
+    {0, 0, 0, 5329, 2, 0x12},
+    {0, 0, 0, 5331, 2, 0x12},
+    {0, 0, 0, 5333, 2, 0x12},
+    {0, 0, 0, 5335, 2, 0x12},
+    {0, 0, 0, 5337, 2, 0x12},
+    {0, 0, 0, 5339, 2, 0x12},
+    {0, 0, 0, 5341, 2, 0x12},
+    {0, 0, 0, 5343, 2, 0x12},
+    {0, 0, 0, 5345, 2, 0x12},
+    {0, 0, 0, 5347, 2, 0x12},
+    {0, 0, 0, 5349, 2, 0x12},
+    {0, 0, 0, 5351, 2, 0x12},
+    {0, 0, 0, 5353, 2, 0x12},
+    {0, 0, 0, 5355, 2, 0x12},
+    {0, 0, 0, 5357, 2, 0x12},
+    {0, 0, 0, 5359, 2, 0x12},
+    {0, 0, 0, 5361, 2, 0x12},
+    {0, 0, 0, 5363, 2, 0x12},
+    {0, 0, 0, 5365, 2, 0x12},
+    {0, 0, 0, 5367, 2, 0x12},
+    {0, 0, 0, 5369, 2, 0x12},
+    {0, 0, 0, 5371, 2, 0x12},
+    {0, 0, 0, 5373, 2, 0x12},
+    {0, 0, 0, 5375, 2, 0x12},
+    {0, 0, 0, 5377, 2, 0x12},
+    {0, 0, 0, 5379, 2, 0x12},
+    {0, 0, 0, 5381, 2, 0x12},
+    {0, 0, 0, 5383, 3, 0x12},
+    {0, 0, 0, 5386, 3, 0x12},
+    {0, 0, 0, 5389, 3, 0x12},
+    {0, 0, 0, 5392, 3, 0x12},
+    {0, 0, 0, 5395, 3, 0x12},
+    {0, 0, 0, 5398, 3, 0x12},
+    {0, 0, 0, 5401, 3, 0x12},
+    {0, 0, 0, 5404, 3, 0x12},
+    {0, 0, 0, 5407, 3, 0x12},
+    {0, 0, 0, 5410, 3, 0x12},
+    {0, 0, 0, 5413, 3, 0x12},
+    {0, 0, 0, 5416, 3, 0x12},
+    {0, 0, 0, 5419, 3, 0x12},
+    {0, 0, 0, 5422, 3, 0x12},
+    {0, 0, 0, 5425, 3, 0x12},
+    {0, 0, 0, 5428, 3, 0x12},
+    {0, 0, 0, 5431, 3, 0x12},
+    {0, 0, 0, 5434, 3, 0x12},
+    {0, 0, 0, 5437, 3, 0x12},
+    {0, 0, 0, 5440, 3, 0x12},
+    {0, 0, 0, 5443, 3, 0x12},
+    {0, 0, 0, 5446, 3, 0x12},
+    {0, 0, 0, 5449, 3, 0x12},
+    {0, 0, 0, 5452, 3, 0x12},
+    {0, 0, 0, 5455, 3, 0x12},
+    {0, 0, 0, 5458, 3, 0x12},
+    {0, 0, 0, 5461, 3, 0x12},
+    {0, 0, 0, 5464, 3, 0x12},
+    {0, 0, 0, 5467, 3, 0x12},
+    {0, 0, 0, 5470, 3, 0x12},
+    {0, 0, 0, 5473, 3, 0x12},
+    {0, 0, 0, 5476, 3, 0x12},
+    {0, 0, 0, 5479, 3, 0x12},
+    {0, 0, 0, 5482, 3, 0x12},
+    {0, 0, 0, 5485, 3, 0x12},
+    {0, 0, 0, 5488, 3, 0x12},
+    {0, 0, 0, 5491, 3, 0x12},
+    {0, 0, 0, 5494, 3, 0x12},
+    {0, 0, 0, 5497, 3, 0x12},
+    {0, 0, 0, 5500, 3, 0x12},
+    {0, 0, 0, 5503, 3, 0x12},
+    {0, 0, 0, 5506, 3, 0x12},
+    {0, 0, 0, 5509, 3, 0x12},
+    {0, 0, 0, 5512, 3, 0x12},
+    {0, 0, 0, 5515, 3, 0x12},
+    {0, 0, 0, 5518, 3, 0x12},
+    {0, 0, 0, 5521, 3, 0x12},
+    {0, 0, 0, 5524, 3, 0x12},
+    {0, 0, 0, 5527, 3, 0x12},
+    {0, 0, 0, 5530, 3, 0x12},
+    {0, 0, 0, 5533, 3, 0x12},
+    {0, 0, 0, 5536, 3, 0x12},
+    {0, 0, 0, 5539, 3, 0x12},
+    {0, 0, 0, 5542, 3, 0x12},
+    {0, 0, 0, 5545, 3, 0x12},
+    {0, 0, 0, 5548, 3, 0x12},
+    {0, 0, 0, 5551, 3, 0x12},
+    {0, 0, 0, 5554, 3, 0x12},
+    {0, 0, 0, 5557, 3, 0x12},
+    {0, 0, 0, 5560, 3, 0x12},
+    {0, 0, 0, 5563, 3, 0x12},
+    {0, 0, 0, 5566, 3, 0x12},
+    {0, 0, 0, 5569, 3, 0x12},
+    {0, 0, 0, 5572, 3, 0x12},
+    {0, 0, 0, 5575, 3, 0x12},
+    {0, 0, 0, 5578, 3, 0x12},
+    {0, 0, 0, 5581, 3, 0x12},
+    {0, 0, 0, 5584, 3, 0x12},
+    {0, 0, 0, 5587, 3, 0x12},
+    {0, 0, 0, 5590, 3, 0x12},
+    {0, 0, 0, 5593, 3, 0x12},
+    {0, 0, 0, 5596, 3, 0x12},
+    {0, 0, 0, 5599, 3, 0x12},
+    {0, 0, 0, 5602, 3, 0x12},
+    {0, 0, 0, 5605, 3, 0x12},
+    {0, 0, 0, 5608, 3, 0x12},
+    {0, 0, 0, 5611, 3, 0x12},
+    {0, 0, 0, 5614, 3, 0x12},
+    {0, 0, 0, 5617, 3, 0x12},
+    {0, 0, 0, 5620, 3, 0x12},
+    {0, 0, 0, 5623, 3, 0x12},
+    {0, 0, 0, 5626, 3, 0x12},
+    {0, 0, 0, 5629, 3, 0x12},
+    {0, 0, 0, 5632, 3, 0x12},
+    {0, 0, 0, 5635, 3, 0x12},
+    {0, 0, 0, 5638, 3, 0x12},
+    {0, 0, 0, 5641, 3, 0x12},
+    {0, 0, 0, 5644, 3, 0x12},
+    {0, 0, 0, 5647, 3, 0x12},
+    {0, 0, 0, 5650, 3, 0x12},
+    {0, 0, 0, 5653, 3, 0x12},
+    {0, 0, 0, 5656, 3, 0x12},
+    {0, 0, 0, 5659, 3, 0x12},
+    {0, 0, 0, 5662, 3, 0x12},
+    {0, 0, 0, 5665, 3, 0x12},
+    {0, 0, 0, 5668, 3, 0x12},
+    {0, 0, 0, 5671, 4, 0x12},
+    {0, 0, 0, 5675, 4, 0x12},
+    {0, 0, 0, 5679, 4, 0x12},
+    {0, 0, 0, 5683, 4, 0x12},
+    {0, 0, 0, 5687, 4, 0x12},
+    {0, 0, 0, 5691, 4, 0x12},
+    {0, 0, 0, 5695, 4, 0x12},
+    {0, 0, 0, 5699, 3, 0x12},
+    {0, 0, 0, 5702, 18, 0x12},
+    {0, 0, 0, 5720, 8, 0x12},
+    {0, 0, 0, 5728, 4, 0x12},
+    {0, 0, 0, 5732, 1, 0x12},
+    {0, 0, 0, 5733, 1, 0x12},
+    {0, 0, 0, 5734, 1, 0x12},
+    {0, 0, 0, 5735, 1, 0x12},
+    {0, 0, 0, 621, 1, 0x12},
+    {0, 0, 0, 5736, 1, 0x12},
+    {0, 0, 0, 5737, 1, 0x12},
+    {0, 0, 0, 5738, 1, 0x12},
+    {0, 0, 0, 5739, 1, 0x12},
+    {0, 0, 0, 5740, 1, 0x12},
+    {0, 0, 0, 5741, 1, 0x12},
+    {0, 0, 0, 5742, 1, 0x12},
+    {0, 0, 0, 5743, 1, 0x12},
+    {0, 0, 0, 5744, 1, 0x12},
+    {0, 0, 0, 5745, 1, 0x12},
+    {0, 0, 0, 5746, 1, 0x12},
+    {0, 0, 0, 5747, 1, 0x12},
+    {0, 0, 0, 5748, 1, 0x12},
+    {0, 0, 0, 5749, 1, 0x12},
+    {0, 0, 0, 5750, 1, 0x12},
+    {0, 0, 0, 2557, 1, 0x12},
+    {0, 0, 0, 2558, 1, 0x12},
+    {0, 0, 0, 5751, 1, 0x12},
+    {0, 0, 0, 5752, 1, 0x12},
+    {0, 0, 0, 5753, 1, 0x12},
+    {0, 0, 0, 5754, 1, 0x12},
+    {0, 0, 0, 5755, 1, 0x12},
+    {0, 0, 0, 5756, 1, 0x12},
+    {0, 0, 0, 5757, 1, 0x12},
+    {0, 0, 0, 5758, 1, 0x12},
+    {0, 0, 0, 5759, 1, 0x12},
+    {0, 0, 0, 5760, 1, 0x12},
+    {0, 0, 0, 5761, 1, 0x12},
+    {0, 0, 0, 5762, 1, 0x12},
+    {0, 0, 0, 5763, 1, 0x12},
+    {0, 0, 0, 5764, 1, 0x12},
+    {0, 0, 0, 5765, 1, 0x12},
+    {0, 0, 0, 5766, 1, 0x12},
+    {0, 0, 0, 5767, 2, 0x12},
+    {0, 0, 0, 5769, 2, 0x12},
+    {0, 0, 0, 5771, 2, 0x12},
+    {0, 0, 0, 5773, 2, 0x12},
+    {0, 0, 0, 5775, 2, 0x12},
+    {0, 0, 0, 5777, 2, 0x12},
+    {0, 0, 0, 5779, 2, 0x12},
+    {0, 0, 0, 5781, 2, 0x12},
+    {0, 0, 0, 5783, 2, 0x12},
+    {0, 0, 0, 5785, 2, 0x12},
+    {0, 0, 0, 5787, 2, 0x12},
+    {0, 0, 0, 5789, 2, 0x12},
+    {0, 0, 0, 5791, 2, 0x12},
+    {0, 0, 0, 5793, 2, 0x12},
+    {0, 0, 0, 5795, 1, 0x12},
+    {0, 0, 0, 791, 2, 0x12},
+    {0, 0, 0, 793, 2, 0x12},
+    {0, 0, 0, 795, 2, 0x12},
+    {0, 0, 0, 797, 2, 0x12},
+    {0, 0, 0, 799, 2, 0x12},
+    {0, 0, 0, 5796, 1, 0x12},
+    {0, 0, 0, 5797, 1, 0x12},
+    {0, 0, 0, 5798, 1, 0x12},
+    {0, 0, 0, 5799, 1, 0x12},
+    {0, 0, 0, 5800, 1, 0x12},
+    {0, 0, 0, 5801, 1, 0x12},
+    {0, 0, 0, 5802, 1, 0x12},
+    {0, 0, 0, 5803, 1, 0x12},
+    {0, 0, 0, 5804, 1, 0x12},
+    {0, 0, 0, 5805, 1, 0x12},
+    {0, 0, 0, 5806, 1, 0x12},
+    {0, 0, 0, 5807, 1, 0x12},
+    {0, 0, 0, 5808, 1, 0x12},
+    {0, 0, 0, 5809, 1, 0x12},
+    {0, 0, 0, 5810, 1, 0x12},
+    {0, 0, 0, 5811, 1, 0x12},
+    {0, 0, 0, 5812, 1, 0x12},
+    {0, 0, 0, 5813, 1, 0x12},
+    {0, 0, 0, 5814, 1, 0x12},
+    {0, 0, 0, 5815, 1, 0x12},
+    {0, 0, 0, 5816, 1, 0x12},
+    {0, 0, 0, 5817, 1, 0x12},
+    {0, 0, 0, 5818, 1, 0x12},
+    {0, 0, 0, 5819, 1, 0x12},
+    {0, 0, 0, 5820, 1, 0x12},
+    {0, 0, 0, 5821, 1, 0x12},
+    {0, 0, 0, 5822, 1, 0x12},
+    {0, 0, 0, 5823, 1, 0x12},
+    {0, 0, 0, 5824, 1, 0x12},
+    {0, 0, 0, 5825, 3, 0x12},
+    {0, 0, 0, 5828, 3, 0x12},
+    {0, 0, 0, 5831, 3, 0x12},
+    {0, 0, 0, 5834, 2, 0x12},
+    {0, 0, 0, 5836, 1, 0x12},
+    {0, 0, 0, 5837, 1, 0x12},
+    {0, 0, 0, 5838, 1, 0x12},
+    {0, 0, 0, 5839, 1, 0x12},
+    {0, 0, 0, 2245, 1, 0x12},
+    {0, 0, 0, 5840, 1, 0x12},
+    {0, 0, 0, 5841, 1, 0x12},
+    {0, 0, 0, 5842, 1, 0x12},
+    {0, 0, 0, 5843, 1, 0x12},
+    {0, 0, 0, 5844, 1, 0x12},
+    {0, 0, 0, 5845, 1, 0x12},
+    {0, 0, 0, 5846, 1, 0x12},
+    {0, 0, 0, 5847, 1, 0x12},
+    {0, 0, 0, 5848, 1, 0x12},
+    {0, 0, 0, 5849, 1, 0x12},
+    {0, 0, 0, 5850, 1, 0x12},
+    {0, 0, 0, 5851, 1, 0x12},
+    {0, 0, 0, 5852, 1, 0x12},
+    {0, 0, 0, 5853, 1, 0x12},
+    {0, 0, 0, 5854, 1, 0x12},
+    {0, 0, 0, 5855, 1, 0x12},
+    {0, 0, 0, 5856, 1, 0x12},
+    {0, 0, 0, 5857, 1, 0x12},
+    {0, 0, 0, 5858, 1, 0x12},
+    {0, 0, 0, 5859, 1, 0x12},
+    {0, 0, 0, 5860, 1, 0x12},
+    {0, 0, 0, 5861, 1, 0x12},
+    {0, 0, 0, 5862, 1, 0x12},
+    {0, 0, 0, 5863, 1, 0x12},
+    {0, 0, 0, 5864, 1, 0x12},
+    {0, 0, 0, 5865, 1, 0x12},
+    {0, 0, 0, 5866, 1, 0x12},
+    {0, 0, 0, 5867, 1, 0x12},
+    {0, 0, 0, 5868, 1, 0x12},
+    {0, 0, 0, 5869, 1, 0x12},
+    {0, 0, 0, 5870, 1, 0x12},
+    {0, 0, 0, 5871, 1, 0x12},
+    {0, 0, 0, 5872, 1, 0x12},
+    {0, 0, 0, 5873, 1, 0x12},
+    {0, 0, 0, 5874, 1, 0x12},
+    {0, 0, 0, 5875, 1, 0x12},
+    {0, 0, 0, 5876, 1, 0x12},
+    {0, 0, 0, 5877, 1, 0x12},
+    {0, 0, 0, 5878, 1, 0x12},
+    {0, 0, 0, 5879, 1, 0x12},
+    {0, 0, 0, 5880, 1, 0x12},
+    {0, 0, 0, 5881, 1, 0x12},
+    {0, 0, 0, 5882, 1, 0x12},
+    {0, 0, 0, 5883, 1, 0x12},
+    {0, 0, 0, 5884, 1, 0x12},
+    {0, 0, 0, 5885, 1, 0x12},
+    {0, 0, 0, 5886, 1, 0x12},
+    {0, 0, 0, 5887, 1, 0x12},
+    {0, 0, 0, 5888, 1, 0x12},
+    {0, 0, 0, 5889, 1, 0x12},
+    {0, 0, 0, 5890, 1, 0x12},
+    {0, 0, 0, 5891, 1, 0x12},
+    {0, 0, 0, 5892, 1, 0x12},
+    {0, 0, 0, 5893, 1, 0x12},
+    {0, 0, 0, 5894, 1, 0x12},
+    {0, 0, 0, 5895, 1, 0x12},
+    {0, 0, 0, 5896, 1, 0x12},
+    {0, 0, 0, 5897, 1, 0x12},
+    {0, 0, 0, 5898, 1, 0x12},
+    {0, 0, 0, 5899, 1, 0x12},
+    {0, 0, 0, 5900, 1, 0x12},
+    {0, 0, 0, 5901, 1, 0x12},
+    {0, 0, 0, 5902, 1, 0x12},
+    {0, 0, 0, 5903, 1, 0x12},
+    {0, 0, 0, 5904, 1, 0x12},
+    {0, 0, 0, 5905, 1, 0x12},
+    {0, 0, 0, 5906, 1, 0x12},
+    {0, 0, 0, 5907, 1, 0x12},
+    {0, 0, 0, 5908, 1, 0x12},
+    {0, 0, 0, 5909, 1, 0x12},
+    {0, 0, 0, 5910, 1, 0x12},
+    {0, 0, 0, 5911, 1, 0x12},
+    {0, 0, 0, 5912, 1, 0x12},
+    {0, 0, 0, 5913, 1, 0x12},
+    {0, 0, 0, 5914, 1, 0x12},
+    {0, 0, 0, 5915, 1, 0x12},
+    {0, 0, 0, 5916, 1, 0x12},
+    {0, 0, 0, 5917, 1, 0x12},
+    {0, 0, 0, 5918, 1, 0x12},
+    {0, 0, 0, 5919, 1, 0x12},
+    {0, 0, 0, 5920, 1, 0x12},
+    {0, 0, 0, 5921, 1, 0x12},
+    {0, 0, 0, 5922, 1, 0x12},
+    {0, 0, 0, 5923, 1, 0x12},
+    {0, 0, 0, 5924, 1, 0x12},
+    {5925, 2, 0, 5925, 2, 0x03},
+    {5927, 2, 0, 5927, 2, 0x03},
+    {5929, 2, 0, 5929, 2, 0x03},
+    {5931, 2, 0, 5931, 2, 0x03},
+    {5933, 2, 0, 5933, 2, 0x03},
+    {5935, 2, 0, 5935, 2, 0x03},
+    {5937, 2, 0, 5937, 2, 0x03},
+    {5939, 2, 0, 5939, 2, 0x03},
+    {5941, 2, 0, 5941, 2, 0x03},
+    {5943, 2, 0, 5943, 2, 0x03},
+    {5945, 2, 0, 5945, 2, 0x03},
+    {5947, 2, 0, 5947, 2, 0x03},
+    {5949, 2, 0, 5949, 2, 0x03},
+    {0, 0, 6, 0, 0, 0x00},
+    {5951, 2, 0, 5951, 2, 0x17},
+    {5953, 2, 0, 5953, 2, 0x17},
+    {5955, 3, 0, 5955, 3, 0x17},
+    {5958, 3, 0, 5958, 3, 0x17},
+    {5961, 3, 0, 5961, 3, 0x17},
+    {5964, 3, 0, 5964, 3, 0x17},
+    {5967, 3, 0, 5967, 3, 0x17},
+    {0, 0, 226, 0, 0, 0x00},
+    {5970, 2, 0, 5970, 2, 0x17},
+    {5972, 2, 0, 5972, 2, 0x17},
+    {5974, 3, 0, 5974, 3, 0x17},
+    {5977, 3, 0, 5977, 3, 0x17},
+    {5980, 3, 0, 5980, 3, 0x17},
+    {5983, 3, 0, 5983, 3, 0x17},
+    {0, 0, 0, 5986, 1, 0x12},
+    {0, 0, 0, 5987, 1, 0x12},
+    {0, 0, 0, 5988, 1, 0x12},
+    {0, 0, 0, 5989, 1, 0x12},
+    {0, 0, 0, 5990, 1, 0x12},
+    {0, 0, 0, 5991, 1, 0x12},
+    {0, 0, 0, 5992, 1, 0x12},
+    {0, 0, 0, 5993, 1, 0x12},
+    {0, 0, 0, 5994, 1, 0x12},
+    {0, 0, 0, 5995, 1, 0x12},
+    {0, 0, 0, 5996, 1, 0x12},
+    {0, 0, 0, 5997, 1, 0x12},
+    {0, 0, 0, 5998, 1, 0x12},
+    {0, 0, 0, 5999, 1, 0x12},
+    {0, 0, 0, 6000, 1, 0x12},
+    {0, 0, 0, 6001, 1, 0x12},
+    {0, 0, 0, 6002, 1, 0x12},
+    {0, 0, 0, 6003, 1, 0x12},
+    {0, 0, 0, 6004, 1, 0x12},
+    {0, 0, 0, 6005, 1, 0x12},
+    {0, 0, 0, 2348, 1, 0x12},
+    {0, 0, 0, 6006, 1, 0x12},
+    {0, 0, 0, 6007, 1, 0x12},
+    {0, 0, 0, 6008, 1, 0x12},
+    {0, 0, 0, 6009, 1, 0x12},
+    {0, 0, 0, 2141, 1, 0x12},
+    {0, 0, 0, 6010, 1, 0x12},
+    {0, 0, 0, 6011, 1, 0x12},
+    {0, 0, 0, 6012, 1, 0x12},
+    {0, 0, 0, 6013, 1, 0x12},
+    {0, 0, 0, 6014, 1, 0x12},
+    {0, 0, 0, 6015, 1, 0x12},
+    {0, 0, 0, 6016, 1, 0x12},
+    {0, 0, 0, 6017, 1, 0x12},
+    {0, 0, 0, 6018, 1, 0x12},
+    {0, 0, 0, 6019, 1, 0x12},
+    {0, 0, 0, 6020, 1, 0x12},
+    {0, 0, 0, 6021, 1, 0x12},
+    {0, 0, 0, 6022, 1, 0x12},
+    {0, 0, 0, 6023, 1, 0x12},
+    {0, 0, 0, 6024, 1, 0x12},
+    {0, 0, 0, 6025, 1, 0x12},
+    {0, 0, 0, 6026, 1, 0x12},
+    {0, 0, 0, 6027, 1, 0x12},
+    {0, 0, 0, 6028, 1, 0x12},
+    {0, 0, 0, 6029, 1, 0x12},
+    {0, 0, 0, 6030, 1, 0x12},
+    {0, 0, 0, 6031, 1, 0x12},
+    {0, 0, 0, 6032, 1, 0x12},
+    {0, 0, 0, 6033, 1, 0x12},
+    {0, 0, 0, 6034, 1, 0x12},
+    {0, 0, 0, 6035, 1, 0x12},
+    {0, 0, 0, 6036, 1, 0x12},
+    {0, 0, 0, 6037, 1, 0x12},
+    {0, 0, 0, 6038, 1, 0x12},
+    {0, 0, 0, 6039, 1, 0x12},
+    {0, 0, 0, 6040, 1, 0x12},
+    {0, 0, 0, 6041, 1, 0x12},
+    {0, 0, 0, 6042, 1, 0x12},
+    {0, 0, 0, 6043, 1, 0x12},
+    {0, 0, 0, 6044, 1, 0x12},
+    {0, 0, 0, 6045, 1, 0x12},
+    {0, 0, 0, 6046, 1, 0x12},
+    {0, 0, 0, 6047, 1, 0x12},
+    {0, 0, 0, 6048, 1, 0x12},
+    {0, 0, 0, 6049, 1, 0x12},
+    {0, 0, 0, 6050, 1, 0x12},
+    {0, 0, 0, 6051, 1, 0x12},
+    {0, 0, 0, 6052, 1, 0x12},
+    {0, 0, 0, 6053, 1, 0x12},
+    {0, 0, 0, 6054, 1, 0x12},
+    {0, 0, 0, 6055, 1, 0x12},
+    {0, 0, 0, 6056, 1, 0x12},
+    {0, 0, 0, 6057, 1, 0x12},
+    {0, 0, 0, 6058, 1, 0x12},
+    {0, 0, 0, 6059, 1, 0x12},
+    {0, 0, 0, 6060, 1, 0x12},
+    {0, 0, 0, 6061, 1, 0x12},
+    {0, 0, 0, 6062, 1, 0x12},
+    {0, 0, 0, 6063, 1, 0x12},
+    {0, 0, 0, 6064, 2, 0x12},
+    {0, 0, 0, 6066, 2, 0x12},
+    {0, 0, 0, 6068, 2, 0x12},
+    {0, 0, 0, 6070, 2, 0x12},
+    {0, 0, 0, 6072, 2, 0x12},
+    {0, 0, 0, 6074, 2, 0x12},
+    {0, 0, 0, 6076, 2, 0x12},
+    {0, 0, 0, 6078, 2, 0x12},
+    {0, 0, 0, 6080, 2, 0x12},
+    {0, 0, 0, 6082, 2, 0x12},
+    {0, 0, 0, 6084, 2, 0x12},
+    {0, 0, 0, 6086, 3, 0x12},
+    {0, 0, 0, 6089, 3, 0x12},
+    {0, 0, 0, 6092, 3, 0x12},
+    {0, 0, 0, 6095, 3, 0x12},
+    {0, 0, 0, 6098, 3, 0x12},
+    {0, 0, 0, 6101, 3, 0x12},
+    {0, 0, 0, 6104, 3, 0x12},
+    {0, 0, 0, 6107, 3, 0x12},
+    {0, 0, 0, 6110, 3, 0x12},
+    {0, 0, 0, 6113, 3, 0x12},
+    {0, 0, 0, 6116, 3, 0x12},
+    {0, 0, 0, 6119, 3, 0x12},
+    {0, 0, 0, 6122, 3, 0x12},
+    {0, 0, 0, 6125, 3, 0x12},
+    {0, 0, 0, 6128, 3, 0x12},
+    {0, 0, 0, 6131, 3, 0x12},
+    {0, 0, 0, 6134, 3, 0x12},
+    {0, 0, 0, 6137, 3, 0x12},
+    {0, 0, 0, 6140, 3, 0x12},
+    {0, 0, 0, 6143, 3, 0x12},
+    {0, 0, 0, 6146, 3, 0x12},
+    {0, 0, 0, 6149, 3, 0x12},
+    {0, 0, 0, 6152, 3, 0x12},
+    {0, 0, 0, 6155, 3, 0x12},
+    {0, 0, 0, 6158, 3, 0x12},
+    {0, 0, 0, 6161, 3, 0x12},
+    {0, 0, 0, 6164, 3, 0x12},
+    {0, 0, 0, 6167, 2, 0x12},
+    {0, 0, 0, 6169, 2, 0x12},
+    {0, 0, 0, 6171, 2, 0x12},
+    {0, 0, 0, 6173, 2, 0x12},
+    {0, 0, 0, 6175, 2, 0x12},
+    {0, 0, 0, 6177, 3, 0x12},
+    {0, 0, 0, 6180, 2, 0x12},
+    {0, 0, 0, 6182, 2, 0x12},
+    {0, 0, 0, 6184, 2, 0x12},
+    {0, 0, 0, 6186, 2, 0x12},
+    {0, 0, 0, 6188, 2, 0x12},
+    {0, 0, 0, 6190, 2, 0x12},
+    {0, 0, 0, 6192, 2, 0x12},
+    {0, 0, 0, 6194, 1, 0x12},
+    {0, 0, 0, 6195, 1, 0x12},
+    {0, 0, 0, 3104, 2, 0x12},
+    {0, 0, 0, 6196, 1, 0x12},
+    {0, 0, 0, 6197, 1, 0x12},
+    {0, 0, 0, 6198, 1, 0x12},
+    {0, 0, 0, 6199, 1, 0x12},
+    {0, 0, 0, 6200, 1, 0x12},
+    {0, 0, 0, 4648, 1, 0x12},
+    {0, 0, 0, 6201, 1, 0x12},
+    {0, 0, 0, 6202, 1, 0x12},
+    {0, 0, 0, 6203, 1, 0x12},
+    {0, 0, 0, 6204, 1, 0x12},
+    {0, 0, 0, 6205, 1, 0x12},
+    {0, 0, 0, 6206, 1, 0x12},
+    {0, 0, 0, 6207, 1, 0x12},
+    {0, 0, 0, 6208, 1, 0x12},
+    {0, 0, 0, 6209, 1, 0x12},
+    {0, 0, 0, 6210, 1, 0x12},
+    {0, 0, 0, 6211, 1, 0x12},
+    {0, 0, 0, 6212, 1, 0x12},
+    {0, 0, 0, 6213, 1, 0x12},
+    {0, 0, 0, 6214, 1, 0x12},
+    {0, 0, 0, 6215, 1, 0x12},
+    {0, 0, 0, 6216, 1, 0x12},
+    {0, 0, 0, 6217, 1, 0x12},
+    {0, 0, 0, 6218, 1, 0x12},
+    {0, 0, 0, 6219, 1, 0x12},
+    {0, 0, 0, 6220, 1, 0x12},
+    {0, 0, 0, 6221, 1, 0x12},
+    {0, 0, 0, 6222, 1, 0x12},
+    {0, 0, 0, 6223, 1, 0x12},
+    {0, 0, 0, 6224, 3, 0x12},
+    {0, 0, 0, 6227, 3, 0x12},
+    {0, 0, 0, 6230, 3, 0x12},
+    {0, 0, 0, 6233, 3, 0x12},
+    {0, 0, 0, 6236, 3, 0x12},
+    {0, 0, 0, 6239, 3, 0x12},
+    {0, 0, 0, 6242, 3, 0x12},
+    {0, 0, 0, 6245, 3, 0x12},
+    {0, 0, 0, 6248, 3, 0x12},
+    {0, 0, 0, 6251, 1, 0x12},
+    {0, 0, 0, 6252, 1, 0x12},
+    {6253, 1, 0, 6253, 1, 0x17},
+    {6254, 1, 0, 6254, 1, 0x17},
+    {6255, 1, 0, 6255, 1, 0x17},
+    {6256, 1, 0, 6256, 1, 0x17},
+    {6257, 1, 0, 6257, 1, 0x17},
+    {6258, 1, 0, 6258, 1, 0x17},
+    {6259, 1, 0, 6259, 1, 0x17},
+    {6260, 1, 0, 6260, 1, 0x17},
+    {6261, 1, 0, 6261, 1, 0x17},
+    {6262, 1, 0, 6262, 1, 0x17},
+    {6263, 1, 0, 6263, 1, 0x17},
+    {6264, 1, 0, 6264, 1, 0x17},
+    {6265, 1, 0, 6265, 1, 0x17},
+    {6266, 1, 0, 6266, 1, 0x17},
+    {6267, 1, 0, 6267, 1, 0x17},
+    {6268, 1, 0, 6268, 1, 0x17},
+    {6269, 1, 0, 6269, 1, 0x17},
+    {6270, 1, 0, 6270, 1, 0x17},
+    {6203, 1, 0, 6203, 1, 0x17},
+    {6271, 1, 0, 6271, 1, 0x17},
+    {6272, 1, 0, 6272, 1, 0x17},
+    {6273, 1, 0, 6273, 1, 0x17},
+    {6274, 1, 0, 6274, 1, 0x17},
+    {6275, 1, 0, 6275, 1, 0x17},
+    {6276, 1, 0, 6276, 1, 0x17},
+    {2817, 1, 0, 2817, 1, 0x17},
+    {6277, 1, 0, 6277, 1, 0x17},
+    {6278, 1, 0, 6278, 1, 0x17},
+    {6279, 1, 0, 6279, 1, 0x17},
+    {6280, 1, 0, 6280, 1, 0x17},
+    {6221, 1, 0, 6221, 1, 0x17},
+    {6281, 1, 0, 6281, 1, 0x17},
+    {6282, 1, 0, 6282, 1, 0x17},
+    {6283, 1, 0, 6283, 1, 0x17},
+    {6284, 1, 0, 6284, 1, 0x17},
+    {6285, 1, 0, 6285, 1, 0x17},
+    {6286, 1, 0, 6286, 1, 0x17},
+    {6287, 1, 0, 6287, 1, 0x17},
+    {6288, 1, 0, 6288, 1, 0x17},
+    {6289, 1, 0, 6289, 1, 0x17},
+    {6290, 1, 0, 6290, 1, 0x17},
+    {6291, 1, 0, 6291, 1, 0x17},
+    {6292, 1, 0, 6292, 1, 0x17},
+    {6293, 1, 0, 6293, 1, 0x17},
+    {6294, 1, 0, 6294, 1, 0x17},
+    {6295, 1, 0, 6295, 1, 0x17},
+    {6296, 1, 0, 6296, 1, 0x17},
+    {6297, 1, 0, 6297, 1, 0x17},
+    {6298, 1, 0, 6298, 1, 0x17},
+    {6299, 1, 0, 6299, 1, 0x17},
+    {6300, 1, 0, 6300, 1, 0x17},
+    {6301, 1, 0, 6301, 1, 0x17},
+    {6302, 1, 0, 6302, 1, 0x17},
+    {6303, 1, 0, 6303, 1, 0x17},
+    {6304, 1, 0, 6304, 1, 0x17},
+    {6305, 1, 0, 6305, 1, 0x17},
+    {6306, 1, 0, 6306, 1, 0x17},
+    {6307, 1, 0, 6307, 1, 0x17},
+    {6308, 1, 0, 6308, 1, 0x17},
+    {6309, 1, 0, 6309, 1, 0x17},
+    {6310, 1, 0, 6310, 1, 0x17},
+    {6311, 1, 0, 6311, 1, 0x17},
+    {6312, 1, 0, 6312, 1, 0x17},
+    {6313, 1, 0, 6313, 1, 0x17},
+    {6314, 1, 0, 6314, 1, 0x17},
+    {6315, 1, 0, 6315, 1, 0x17},
+    {6316, 1, 0, 6316, 1, 0x17},
+    {6317, 1, 0, 6317, 1, 0x17},
+    {6318, 1, 0, 6318, 1, 0x17},
+    {6319, 1, 0, 6319, 1, 0x17},
+    {6320, 1, 0, 6320, 1, 0x17},
+    {6321, 1, 0, 6321, 1, 0x17},
+    {6322, 1, 0, 6322, 1, 0x17},
+    {6323, 1, 0, 6323, 1, 0x17},
+    {6324, 1, 0, 6324, 1, 0x17},
+    {6325, 1, 0, 6325, 1, 0x17},
+    {6326, 1, 0, 6326, 1, 0x17},
+    {6196, 1, 0, 6196, 1, 0x17},
+    {6327, 1, 0, 6327, 1, 0x17},
+    {6328, 1, 0, 6328, 1, 0x17},
+    {6329, 1, 0, 6329, 1, 0x17},
+    {6330, 1, 0, 6330, 1, 0x17},
+    {6331, 1, 0, 6331, 1, 0x17},
+    {6332, 1, 0, 6332, 1, 0x17},
+    {6333, 1, 0, 6333, 1, 0x17},
+    {6334, 1, 0, 6334, 1, 0x17},
+    {6335, 1, 0, 6335, 1, 0x17},
+    {6336, 1, 0, 6336, 1, 0x17},
+    {6337, 1, 0, 6337, 1, 0x17},
+    {6338, 1, 0, 6338, 1, 0x17},
+    {6339, 1, 0, 6339, 1, 0x17},
+    {6340, 1, 0, 6340, 1, 0x17},
+    {6341, 1, 0, 6341, 1, 0x17},
+    {6342, 1, 0, 6342, 1, 0x17},
+    {6343, 1, 0, 6343, 1, 0x17},
+    {6344, 1, 0, 6344, 1, 0x17},
+    {6345, 1, 0, 6345, 1, 0x17},
+    {6346, 1, 0, 6346, 1, 0x17},
+    {6347, 1, 0, 6347, 1, 0x17},
+    {2843, 1, 0, 2843, 1, 0x17},
+    {6348, 1, 0, 6348, 1, 0x17},
+    {6349, 1, 0, 6349, 1, 0x17},
+    {6350, 1, 0, 6350, 1, 0x17},
+    {6351, 1, 0, 6351, 1, 0x17},
+    {6352, 1, 0, 6352, 1, 0x17},
+    {6353, 1, 0, 6353, 1, 0x17},
+    {6354, 1, 0, 6354, 1, 0x17},
+    {6355, 1, 0, 6355, 1, 0x17},
+    {6356, 1, 0, 6356, 1, 0x17},
+    {6357, 1, 0, 6357, 1, 0x17},
+    {6358, 1, 0, 6358, 1, 0x17},
+    {6359, 1, 0, 6359, 1, 0x17},
+    {6360, 1, 0, 6360, 1, 0x17},
+    {6361, 1, 0, 6361, 1, 0x17},
+    {6362, 1, 0, 6362, 1, 0x17},
+    {6363, 1, 0, 6363, 1, 0x17},
+    {6364, 1, 0, 6364, 1, 0x17},
+    {6365, 1, 0, 6365, 1, 0x17},
+    {6366, 1, 0, 6366, 1, 0x17},
+    {6367, 1, 0, 6367, 1, 0x17},
+    {6368, 1, 0, 6368, 1, 0x17},
+    {6369, 1, 0, 6369, 1, 0x17},
+    {6370, 1, 0, 6370, 1, 0x17},
+    {6371, 1, 0, 6371, 1, 0x17},
+    {2855, 1, 0, 2855, 1, 0x17},
+    {6372, 1, 0, 6372, 1, 0x17},
+    {6373, 1, 0, 6373, 1, 0x17},
+    {6374, 1, 0, 6374, 1, 0x17},
+    {6375, 1, 0, 6375, 1, 0x17},
+    {6376, 1, 0, 6376, 1, 0x17},
+    {6377, 1, 0, 6377, 1, 0x17},
+    {6378, 1, 0, 6378, 1, 0x17},
+    {6379, 1, 0, 6379, 1, 0x17},
+    {6380, 1, 0, 6380, 1, 0x17},
+    {6381, 1, 0, 6381, 1, 0x17},
+    {6382, 1, 0, 6382, 1, 0x17},
+    {6383, 1, 0, 6383, 1, 0x17},
+    {6384, 1, 0, 6384, 1, 0x17},
+    {6385, 1, 0, 6385, 1, 0x17},
+    {6386, 1, 0, 6386, 1, 0x17},
+    {6387, 1, 0, 6387, 1, 0x17},
+    {6388, 1, 0, 6388, 1, 0x17},
+    {6389, 1, 0, 6389, 1, 0x17},
+    {6390, 1, 0, 6390, 1, 0x17},
+    {6391, 1, 0, 6391, 1, 0x17},
+    {6392, 1, 0, 6392, 1, 0x17},
+    {6393, 1, 0, 6393, 1, 0x17},
+    {6394, 1, 0, 6394, 1, 0x17},
+    {6395, 1, 0, 6395, 1, 0x17},
+    {6396, 1, 0, 6396, 1, 0x17},
+    {6397, 1, 0, 6397, 1, 0x17},
+    {6398, 1, 0, 6398, 1, 0x17},
+    {6399, 1, 0, 6399, 1, 0x17},
+    {6400, 1, 0, 6400, 1, 0x17},
+    {6401, 1, 0, 6401, 1, 0x17},
+    {6402, 1, 0, 6402, 1, 0x17},
+    {6403, 1, 0, 6403, 1, 0x17},
+    {6404, 1, 0, 6404, 1, 0x17},
+    {6405, 1, 0, 6405, 1, 0x17},
+    {6406, 1, 0, 6406, 1, 0x17},
+    {6407, 1, 0, 6407, 1, 0x17},
+    {6408, 1, 0, 6408, 1, 0x17},
+    {6409, 1, 0, 6409, 1, 0x17},
+    {6410, 1, 0, 6410, 1, 0x17},
+    {6411, 1, 0, 6411, 1, 0x17},
+    {6412, 1, 0, 6412, 1, 0x17},
+    {6413, 1, 0, 6413, 1, 0x17},
+    {6414, 1, 0, 6414, 1, 0x17},
+    {6415, 1, 0, 6415, 1, 0x17},
+    {6416, 1, 0, 6416, 1, 0x17},
+    {6417, 1, 0, 6417, 1, 0x17},
+    {6418, 1, 0, 6418, 1, 0x17},
+    {6419, 1, 0, 6419, 1, 0x17},
+    {6420, 1, 0, 6420, 1, 0x17},
+    {6421, 1, 0, 6421, 1, 0x17},
+    {6422, 1, 0, 6422, 1, 0x17},
+    {6423, 1, 0, 6423, 1, 0x17},
+    {6424, 1, 0, 6424, 1, 0x17},
+    {6425, 1, 0, 6425, 1, 0x17},
+    {6426, 1, 0, 6426, 1, 0x17},
+    {6427, 1, 0, 6427, 1, 0x17},
+    {6428, 1, 0, 6428, 1, 0x17},
+    {6429, 1, 0, 6429, 1, 0x17},
+    {6430, 1, 0, 6430, 1, 0x17},
+    {6431, 1, 0, 6431, 1, 0x17},
+    {6432, 1, 0, 6432, 1, 0x17},
+    {6433, 1, 0, 6433, 1, 0x17},
+    {6434, 1, 0, 6434, 1, 0x17},
+    {6435, 1, 0, 6435, 1, 0x17},
+    {6436, 1, 0, 6436, 1, 0x17},
+    {6437, 1, 0, 6437, 1, 0x17},
+    {6438, 1, 0, 6438, 1, 0x17},
+    {6439, 1, 0, 6439, 1, 0x17},
+    {6440, 1, 0, 6440, 1, 0x17},
+    {6441, 1, 0, 6441, 1, 0x17},
+    {6442, 1, 0, 6442, 1, 0x17},
+    {6443, 1, 0, 6443, 1, 0x17},
+    {6444, 1, 0, 6444, 1, 0x17},
+    {6445, 1, 0, 6445, 1, 0x17},
+    {6446, 1, 0, 6446, 1, 0x17},
+    {6447, 1, 0, 6447, 1, 0x17},
+    {6448, 1, 0, 6448, 1, 0x17},
+    {6449, 1, 0, 6449, 1, 0x17},
+    {6450, 1, 0, 6450, 1, 0x17},
+    {6451, 1, 0, 6451, 1, 0x17},
+    {6452, 1, 0, 6452, 1, 0x17},
+    {6453, 1, 0, 6453, 1, 0x17},
+    {6454, 1, 0, 6454, 1, 0x17},
+    {6455, 1, 0, 6455, 1, 0x17},
+    {6456, 1, 0, 6456, 1, 0x17},
+    {6457, 1, 0, 6457, 1, 0x17},
+    {6458, 1, 0, 6458, 1, 0x17},
+    {6459, 1, 0, 6459, 1, 0x17},
+    {6460, 1, 0, 6460, 1, 0x17},
+    {6461, 1, 0, 6461, 1, 0x17},
+    {6462, 1, 0, 6462, 1, 0x17},
+    {6463, 1, 0, 6463, 1, 0x17},
+    {6464, 1, 0, 6464, 1, 0x17},
+    {6465, 1, 0, 6465, 1, 0x17},
+    {6466, 1, 0, 6466, 1, 0x17},
+    {6467, 1, 0, 6467, 1, 0x17},
+    {6468, 1, 0, 6468, 1, 0x17},
+    {6469, 1, 0, 6469, 1, 0x17},
+    {6470, 1, 0, 6470, 1, 0x17},
+    {6471, 1, 0, 6471, 1, 0x17},
+    {6472, 1, 0, 6472, 1, 0x17},
+    {6473, 1, 0, 6473, 1, 0x17},
+    {6474, 1, 0, 6474, 1, 0x17},
+    {6475, 1, 0, 6475, 1, 0x17},
+    {6476, 1, 0, 6476, 1, 0x17},
+    {6477, 1, 0, 6477, 1, 0x17},
+    {6478, 1, 0, 6478, 1, 0x17},
+    {6479, 1, 0, 6479, 1, 0x17},
+    {6480, 1, 0, 6480, 1, 0x17},
+    {6481, 1, 0, 6481, 1, 0x17},
+    {6482, 1, 0, 6482, 1, 0x17},
+    {6483, 1, 0, 6483, 1, 0x17},
+    {6484, 1, 0, 6484, 1, 0x17},
+    {6485, 1, 0, 6485, 1, 0x17},
+    {6486, 1, 0, 6486, 1, 0x17},
+    {6487, 1, 0, 6487, 1, 0x17},
+    {6488, 1, 0, 6488, 1, 0x17},
+    {6489, 1, 0, 6489, 1, 0x17},
+    {6490, 1, 0, 6490, 1, 0x17},
+    {6491, 1, 0, 6491, 1, 0x17},
+    {6492, 1, 0, 6492, 1, 0x17},
+    {6493, 1, 0, 6493, 1, 0x17},
+    {6494, 1, 0, 6494, 1, 0x17},
+    {6495, 1, 0, 6495, 1, 0x17},
+    {6496, 1, 0, 6496, 1, 0x17},
+    {6497, 1, 0, 6497, 1, 0x17},
+    {6498, 1, 0, 6498, 1, 0x17},
+    {6499, 1, 0, 6499, 1, 0x17},
+    {6500, 1, 0, 6500, 1, 0x17},
+    {6501, 1, 0, 6501, 1, 0x17},
+    {6502, 1, 0, 6502, 1, 0x17},
+    {6503, 1, 0, 6503, 1, 0x17},
+    {6504, 1, 0, 6504, 1, 0x17},
+    {6505, 1, 0, 6505, 1, 0x17},
+    {6506, 1, 0, 6506, 1, 0x17},
+    {6507, 1, 0, 6507, 1, 0x17},
+    {6508, 1, 0, 6508, 1, 0x17},
+    {6509, 1, 0, 6509, 1, 0x17},
+    {6510, 1, 0, 6510, 1, 0x17},
+    {6511, 1, 0, 6511, 1, 0x17},
+    {6512, 1, 0, 6512, 1, 0x17},
+    {6513, 1, 0, 6513, 1, 0x17},
+    {6514, 1, 0, 6514, 1, 0x17},
+    {6515, 1, 0, 6515, 1, 0x17},
+    {6516, 1, 0, 6516, 1, 0x17},
+    {6517, 1, 0, 6517, 1, 0x17},
+    {6518, 1, 0, 6518, 1, 0x17},
+    {6519, 1, 0, 6519, 1, 0x17},
+    {6520, 1, 0, 6520, 1, 0x17},
+    {6521, 1, 0, 6521, 1, 0x17},
+    {6522, 1, 0, 6522, 1, 0x17},
+    {6523, 1, 0, 6523, 1, 0x17},
+    {6524, 1, 0, 6524, 1, 0x17},
+    {6525, 1, 0, 6525, 1, 0x17},
+    {6526, 1, 0, 6526, 1, 0x17},
+    {6527, 1, 0, 6527, 1, 0x17},
+    {6528, 1, 0, 6528, 1, 0x17},
+    {6529, 1, 0, 6529, 1, 0x17},
+    {6530, 1, 0, 6530, 1, 0x17},
+    {6531, 1, 0, 6531, 1, 0x17},
+    {6532, 1, 0, 6532, 1, 0x17},
+    {6533, 1, 0, 6533, 1, 0x17},
+    {6534, 1, 0, 6534, 1, 0x17},
+    {6535, 1, 0, 6535, 1, 0x17},
+    {6536, 1, 0, 6536, 1, 0x17},
+    {6537, 1, 0, 6537, 1, 0x17},
+    {6538, 1, 0, 6538, 1, 0x17},
+    {6539, 1, 0, 6539, 1, 0x17},
+    {6540, 1, 0, 6540, 1, 0x17},
+    {6541, 1, 0, 6541, 1, 0x17},
+    {6542, 1, 0, 6542, 1, 0x17},
+    {6543, 1, 0, 6543, 1, 0x17},
+    {6544, 1, 0, 6544, 1, 0x17},
+    {6545, 1, 0, 6545, 1, 0x17},
+    {6546, 1, 0, 6546, 1, 0x17},
+    {6547, 1, 0, 6547, 1, 0x17},
+    {6548, 1, 0, 6548, 1, 0x17},
+    {6549, 1, 0, 6549, 1, 0x17},
+    {6550, 1, 0, 6550, 1, 0x17},
+    {6551, 1, 0, 6551, 1, 0x17},
+    {6552, 1, 0, 6552, 1, 0x17},
+    {6553, 1, 0, 6553, 1, 0x17},
+    {6554, 1, 0, 6554, 1, 0x17},
+    {6555, 1, 0, 6555, 1, 0x17},
+    {6556, 1, 0, 6556, 1, 0x17},
+    {6557, 1, 0, 6557, 1, 0x17},
+    {6558, 1, 0, 6558, 1, 0x17},
+    {6559, 1, 0, 6559, 1, 0x17},
+    {6560, 1, 0, 6560, 1, 0x17},
+    {6561, 1, 0, 6561, 1, 0x17},
+    {6562, 1, 0, 6562, 1, 0x17},
+    {6563, 1, 0, 6563, 1, 0x17},
+    {6564, 1, 0, 6564, 1, 0x17},
+    {6565, 1, 0, 6565, 1, 0x17},
+    {6566, 1, 0, 6566, 1, 0x17},
+    {6567, 1, 0, 6567, 1, 0x17},
+    {6568, 1, 0, 6568, 1, 0x17},
+    {6569, 1, 0, 6569, 1, 0x17},
+    {6570, 1, 0, 6570, 1, 0x17},
+    {6571, 1, 0, 6571, 1, 0x17},
+    {6572, 1, 0, 6572, 1, 0x17},
+    {6573, 1, 0, 6573, 1, 0x17},
+    {6574, 1, 0, 6574, 1, 0x17},
+    {6575, 1, 0, 6575, 1, 0x17},
+    {6576, 1, 0, 6576, 1, 0x17},
+    {6577, 1, 0, 6577, 1, 0x17},
+    {6578, 1, 0, 6578, 1, 0x17},
+    {6579, 1, 0, 6579, 1, 0x17},
+    {6580, 1, 0, 6580, 1, 0x17},
+    {6581, 1, 0, 6581, 1, 0x17},
+    {6582, 1, 0, 6582, 1, 0x17},
+    {6583, 1, 0, 6583, 1, 0x17},
+    {6584, 1, 0, 6584, 1, 0x17},
+    {6585, 1, 0, 6585, 1, 0x17},
+    {6586, 1, 0, 6586, 1, 0x17},
+    {6587, 1, 0, 6587, 1, 0x17},
+    {6588, 1, 0, 6588, 1, 0x17},
+    {6589, 1, 0, 6589, 1, 0x17},
+    {6590, 1, 0, 6590, 1, 0x17},
+    {6591, 1, 0, 6591, 1, 0x17},
+    {6592, 1, 0, 6592, 1, 0x17},
+    {6593, 1, 0, 6593, 1, 0x17},
+    {6594, 1, 0, 6594, 1, 0x17},
+    {6595, 1, 0, 6595, 1, 0x17},
+    {6596, 1, 0, 6596, 1, 0x17},
+    {6597, 1, 0, 6597, 1, 0x17},
+    {6598, 1, 0, 6598, 1, 0x17},
+    {6599, 1, 0, 6599, 1, 0x17},
+    {6600, 1, 0, 6600, 1, 0x17},
+    {6601, 1, 0, 6601, 1, 0x17},
+    {6602, 1, 0, 6602, 1, 0x17},
+    {6603, 1, 0, 6603, 1, 0x17},
+    {6604, 1, 0, 6604, 1, 0x17},
+    {6605, 1, 0, 6605, 1, 0x17},
+    {6606, 1, 0, 6606, 1, 0x17},
+    {6607, 1, 0, 6607, 1, 0x17},
+    {6608, 1, 0, 6608, 1, 0x17},
+    {6609, 1, 0, 6609, 1, 0x17},
+    {6610, 1, 0, 6610, 1, 0x17},
+    {6611, 1, 0, 6611, 1, 0x17},
+    {6612, 1, 0, 6612, 1, 0x17},
+    {6613, 1, 0, 6613, 1, 0x17},
+    {6614, 1, 0, 6614, 1, 0x17},
+    {6615, 1, 0, 6615, 1, 0x17},
+    {6616, 1, 0, 6616, 1, 0x17},
+    {6617, 1, 0, 6617, 1, 0x17},
+    {6618, 1, 0, 6618, 1, 0x17},
+    {6619, 1, 0, 6619, 1, 0x17},
+    {6620, 1, 0, 6620, 1, 0x17},
+    {6621, 1, 0, 6621, 1, 0x17},
+    {6622, 1, 0, 6622, 1, 0x17},
+    {6623, 1, 0, 6623, 1, 0x17},
+    {6624, 1, 0, 6624, 1, 0x17},
+    {6625, 1, 0, 6625, 1, 0x17},
+    {6626, 1, 0, 6626, 1, 0x17},
+    {6627, 1, 0, 6627, 1, 0x17},
+    {6628, 1, 0, 6628, 1, 0x17},
+    {6629, 1, 0, 6629, 1, 0x17},
+    {6630, 1, 0, 6630, 1, 0x17},
+    {6631, 1, 0, 6631, 1, 0x17},
+    {6632, 1, 0, 6632, 1, 0x17},
+    {6633, 1, 0, 6633, 1, 0x17},
+    {6634, 1, 0, 6634, 1, 0x17},
+    {6635, 1, 0, 6635, 1, 0x17},
+    {6636, 1, 0, 6636, 1, 0x17},
+    {6637, 1, 0, 6637, 1, 0x17},
+    {6638, 1, 0, 6638, 1, 0x17},
+    {6639, 1, 0, 6639, 1, 0x17},
+    {2945, 1, 0, 2945, 1, 0x17},
+    {6640, 1, 0, 6640, 1, 0x17},
+    {6641, 1, 0, 6641, 1, 0x17},
+    {6642, 1, 0, 6642, 1, 0x17},
+    {6643, 1, 0, 6643, 1, 0x17},
+    {6644, 1, 0, 6644, 1, 0x17},
+    {6645, 1, 0, 6645, 1, 0x17},
+    {6646, 1, 0, 6646, 1, 0x17},
+    {6647, 1, 0, 6647, 1, 0x17},
+    {6648, 1, 0, 6648, 1, 0x17},
+    {6649, 1, 0, 6649, 1, 0x17},
+    {6650, 1, 0, 6650, 1, 0x17},
+    {2952, 1, 0, 2952, 1, 0x17},
+    {6651, 1, 0, 6651, 1, 0x17},
+    {6652, 1, 0, 6652, 1, 0x17},
+    {6653, 1, 0, 6653, 1, 0x17},
+    {6654, 1, 0, 6654, 1, 0x17},
+    {6655, 1, 0, 6655, 1, 0x17},
+    {6656, 1, 0, 6656, 1, 0x17},
+    {6657, 1, 0, 6657, 1, 0x17},
+    {6658, 1, 0, 6658, 1, 0x17},
+    {6659, 1, 0, 6659, 1, 0x17},
+    {6660, 1, 0, 6660, 1, 0x17},
+    {6661, 1, 0, 6661, 1, 0x17},
+    {6662, 1, 0, 6662, 1, 0x17},
+    {6663, 1, 0, 6663, 1, 0x17},
+    {6664, 1, 0, 6664, 1, 0x17},
+    {6665, 1, 0, 6665, 1, 0x17},
+    {6666, 1, 0, 6666, 1, 0x17},
+    {6667, 1, 0, 6667, 1, 0x17},
+    {6668, 1, 0, 6668, 1, 0x17},
+    {6669, 1, 0, 6669, 1, 0x17},
+    {6670, 1, 0, 6670, 1, 0x17},
+    {6671, 1, 0, 6671, 1, 0x17},
+    {6672, 1, 0, 6672, 1, 0x17},
+    {6673, 1, 0, 6673, 1, 0x17},
+    {6674, 1, 0, 6674, 1, 0x17},
+    {6675, 1, 0, 6675, 1, 0x17},
+    {6676, 1, 0, 6676, 1, 0x17},
+    {6677, 1, 0, 6677, 1, 0x17},
+    {6678, 1, 0, 6678, 1, 0x17},
+    {6679, 1, 0, 6679, 1, 0x17},
+    {6680, 1, 0, 6680, 1, 0x17},
+    {6681, 1, 0, 6681, 1, 0x17},
+    {6682, 1, 0, 6682, 1, 0x17},
+    {6683, 1, 0, 6683, 1, 0x17},
+    {6684, 1, 0, 6684, 1, 0x17},
+    {6685, 1, 0, 6685, 1, 0x17},
+    {6686, 1, 0, 6686, 1, 0x17},
+    {6687, 1, 0, 6687, 1, 0x17},
+    {6688, 1, 0, 6688, 1, 0x17},
+    {6689, 1, 0, 6689, 1, 0x17},
+    {6690, 1, 0, 6690, 1, 0x17},
+    {6691, 1, 0, 6691, 1, 0x17},
+    {6692, 1, 0, 6692, 1, 0x17},
+    {6693, 1, 0, 6693, 1, 0x17},
+    {6694, 1, 0, 6694, 1, 0x17},
+    {6695, 1, 0, 6695, 1, 0x17},
+    {6696, 1, 0, 6696, 1, 0x17},
+    {6697, 1, 0, 6697, 1, 0x17},
+    {6698, 1, 0, 6698, 1, 0x17},
+    {6699, 1, 0, 6699, 1, 0x17},
+    {6700, 1, 0, 6700, 1, 0x17},
+    {6701, 1, 0, 6701, 1, 0x17},
+    {6702, 1, 0, 6702, 1, 0x17},
+    {6703, 1, 0, 6703, 1, 0x17},
+    {6704, 1, 0, 6704, 1, 0x17},
+    {6705, 1, 0, 6705, 1, 0x17},
+    {6706, 1, 0, 6706, 1, 0x17},
+    {6707, 1, 0, 6707, 1, 0x17},
+    {6708, 1, 0, 6708, 1, 0x17},
+    {6709, 1, 0, 6709, 1, 0x17},
+    {6710, 1, 0, 6710, 1, 0x17},
+    {6711, 1, 0, 6711, 1, 0x17},
+    {6712, 1, 0, 6712, 1, 0x17},
+    {3000, 1, 0, 3000, 1, 0x17},
+    {6713, 1, 0, 6713, 1, 0x17},
+    {3004, 1, 0, 3004, 1, 0x17},
+    {6714, 1, 0, 6714, 1, 0x17},
+    {6715, 1, 0, 6715, 1, 0x17},
+    {6716, 1, 0, 6716, 1, 0x17},
+    {6717, 1, 0, 6717, 1, 0x17},
+    {3009, 1, 0, 3009, 1, 0x17},
+    {6718, 1, 0, 6718, 1, 0x17},
+};
+
+const uint32_t utf8_normal_decomp[6719] = {
+    0x00020, 0x00020, 0x00308, 0x00061, 0x00020, 0x00304, 0x00032, 0x00033,
+    0x00020, 0x00301, 0x003BC, 0x00020, 0x00327, 0x00031, 0x0006F, 0x00031,
+    0x02044, 0x00034, 0x00031, 0x02044, 0x00032, 0x00033, 0x02044, 0x00034,
+    0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302, 0x00041, 0x00303,
+    0x00041, 0x00308, 0x00041, 0x0030A, 0x00043, 0x00327, 0x00045, 0x00300,
+    0x00045, 0x00301, 0x00045, 0x00302, 0x00045, 0x00308, 0x00049, 0x00300,
+    0x00049, 0x00301, 0x00049, 0x00302, 0x00049, 0x00308, 0x0004E, 0x00303,
+    0x0004F, 0x00300, 0x0004F, 0x00301, 0x0004F, 0x00302, 0x0004F, 0x00303,
+    0x0004F, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301, 0x00055, 0x00302,
+    0x00055, 0x00308, 0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301,
+    0x00061, 0x00302, 0x00061, 0x00303, 0x00061, 0x00308, 0x00061, 0x0030A,
+    0x00063, 0x00327, 0x00065, 0x00300, 0x00065, 0x00301, 0x00065, 0x00302,
+    0x00065, 0x00308, 0x00069, 0x00300, 0x00069, 0x00301, 0x00069, 0x00302,
+    0x00069, 0x00308, 0x0006E, 0x00303, 0x0006F, 0x00300, 0x0006F, 0x00301,
+    0x0006F, 0x00302, 0x0006F, 0x00303, 0x0006F, 0x00308, 0x00075, 0x00300,
+    0x00075, 0x00301, 0x00075, 0x00302, 0x00075, 0x00308, 0x00079, 0x00301,
+    0x00079, 0x00308, 0x00041, 0x00304, 0x00061, 0x00304, 0x00041, 0x00306,
+    0x00061, 0x00306, 0x00041, 0x00328, 0x00061, 0x00328, 0x00043, 0x00301,
+    0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302, 0x00043, 0x00307,
+    0x00063, 0x00307, 0x00043, 0x0030C, 0x00063, 0x0030C, 0x00044, 0x0030C,
+    0x00064, 0x0030C, 0x00045, 0x00304, 0x00065, 0x00304, 0x00045, 0x00306,
+    0x00065, 0x00306, 0x00045, 0x00307, 0x00065, 0x00307, 0x00045, 0x00328,
+    0x00065, 0x00328, 0x00045, 0x0030C, 0x00065, 0x0030C, 0x00047, 0x00302,
+    0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306, 0x00047, 0x00307,
+    0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302,
+    0x00068, 0x00302, 0x00049, 0x00303, 0x00069, 0x00303, 0x00049, 0x00304,
+    0x00069, 0x00304, 0x00049, 0x00306, 0x00069, 0x00306, 0x00049, 0x00328,
+    0x00069, 0x00328, 0x00049, 0x00307, 0x00049, 0x0004A, 0x00069, 0x0006A,
+    0x0004A, 0x00302, 0x0006A, 0x00302, 0x0004B, 0x00327, 0x0006B, 0x00327,
+    0x0004C, 0x00301, 0x0006C, 0x00301, 0x0004C, 0x00327, 0x0006C, 0x00327,
+    0x0004C, 0x0030C, 0x0006C, 0x0030C, 0x0004C, 0x000B7, 0x0006C, 0x000B7,
+    0x0004E, 0x00301, 0x0006E, 0x00301, 0x0004E, 0x00327, 0x0006E, 0x00327,
+    0x0004E, 0x0030C, 0x0006E, 0x0030C, 0x002BC, 0x0006E, 0x0004F, 0x00304,
+    0x0006F, 0x00304, 0x0004F, 0x00306, 0x0006F, 0x00306, 0x0004F, 0x0030B,
+    0x0006F, 0x0030B, 0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327,
+    0x00072, 0x00327, 0x00052, 0x0030C, 0x00072, 0x0030C, 0x00053, 0x00301,
+    0x00073, 0x00301, 0x00053, 0x00302, 0x00073, 0x00302, 0x00053, 0x00327,
+    0x00073, 0x00327, 0x00053, 0x0030C, 0x00073, 0x0030C, 0x00054, 0x00327,
+    0x00074, 0x00327, 0x00054, 0x0030C, 0x00074, 0x0030C, 0x00055, 0x00303,
+    0x00075, 0x00303, 0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306,
+    0x00075, 0x00306, 0x00055, 0x0030A, 0x00075, 0x0030A, 0x00055, 0x0030B,
+    0x00075, 0x0030B, 0x00055, 0x00328, 0x00075, 0x00328, 0x00057, 0x00302,
+    0x00077, 0x00302, 0x00059, 0x00302, 0x00079, 0x00302, 0x00059, 0x00308,
+    0x0005A, 0x00301, 0x0007A, 0x00301, 0x0005A, 0x00307, 0x0007A, 0x00307,
+    0x0005A, 0x0030C, 0x0007A, 0x0030C, 0x00073, 0x0004F, 0x0031B, 0x0006F,
+    0x0031B, 0x00055, 0x0031B, 0x00075, 0x0031B, 0x00044, 0x0005A, 0x0030C,
+    0x00044, 0x0007A, 0x0030C, 0x00064, 0x0007A, 0x0030C, 0x0004C, 0x0004A,
+    0x0004C, 0x0006A, 0x0006C, 0x0006A, 0x0004E, 0x0004A, 0x0004E, 0x0006A,
+    0x0006E, 0x0006A, 0x00041, 0x0030C, 0x00061, 0x0030C, 0x00049, 0x0030C,
+    0x00069, 0x0030C, 0x0004F, 0x0030C, 0x0006F, 0x0030C, 0x00055, 0x0030C,
+    0x00075, 0x0030C, 0x00055, 0x00308, 0x00304, 0x00075, 0x00308, 0x00304,
+    0x00055, 0x00308, 0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308,
+    0x0030C, 0x00075, 0x00308, 0x0030C, 0x00055, 0x00308, 0x00300, 0x00075,
+    0x00308, 0x00300, 0x00041, 0x00308, 0x00304, 0x00061, 0x00308, 0x00304,
+    0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304, 0x000C6, 0x00304,
+    0x000E6, 0x00304, 0x00047, 0x0030C, 0x00067, 0x0030C, 0x0004B, 0x0030C,
+    0x0006B, 0x0030C, 0x0004F, 0x00328, 0x0006F, 0x00328, 0x0004F, 0x00328,
+    0x00304, 0x0006F, 0x00328, 0x00304, 0x001B7, 0x0030C, 0x00292, 0x0030C,
+    0x0006A, 0x0030C, 0x00044, 0x0005A, 0x00044, 0x0007A, 0x00064, 0x0007A,
+    0x00047, 0x00301, 0x00067, 0x00301, 0x0004E, 0x00300, 0x0006E, 0x00300,
+    0x00041, 0x0030A, 0x00301, 0x00061, 0x0030A, 0x00301, 0x000C6, 0x00301,
+    0x000E6, 0x00301, 0x000D8, 0x00301, 0x000F8, 0x00301, 0x00041, 0x0030F,
+    0x00061, 0x0030F, 0x00041, 0x00311, 0x00061, 0x00311, 0x00045, 0x0030F,
+    0x00065, 0x0030F, 0x00045, 0x00311, 0x00065, 0x00311, 0x00049, 0x0030F,
+    0x00069, 0x0030F, 0x00049, 0x00311, 0x00069, 0x00311, 0x0004F, 0x0030F,
+    0x0006F, 0x0030F, 0x0004F, 0x00311, 0x0006F, 0x00311, 0x00052, 0x0030F,
+    0x00072, 0x0030F, 0x00052, 0x00311, 0x00072, 0x00311, 0x00055, 0x0030F,
+    0x00075, 0x0030F, 0x00055, 0x00311, 0x00075, 0x00311, 0x00053, 0x00326,
+    0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326, 0x00048, 0x0030C,
+    0x00068, 0x0030C, 0x00041, 0x00307, 0x00061, 0x00307, 0x00045, 0x00327,
+    0x00065, 0x00327, 0x0004F, 0x00308, 0x00304, 0x0006F, 0x00308, 0x00304,
+    0x0004F, 0x00303, 0x00304, 0x0006F, 0x00303, 0x00304, 0x0004F, 0x00307,
+    0x0006F, 0x00307, 0x0004F, 0x00307, 0x00304, 0x0006F, 0x00307, 0x00304,
+    0x00059, 0x00304, 0x00079, 0x00304, 0x00068, 0x00266, 0x0006A, 0x00072,
+    0x00279, 0x0027B, 0x00281, 0x00077, 0x00079, 0x00020, 0x00306, 0x00020,
+    0x00307, 0x00020, 0x0030A, 0x00020, 0x00328, 0x00020, 0x00303, 0x00020,
+    0x0030B, 0x00263, 0x0006C, 0x00078, 0x00295, 0x00300, 0x00301, 0x00313,
+    0x00308, 0x00301, 0x002B9, 0x00020, 0x00345, 0x0003B, 0x000A8, 0x00301,
+    0x00020, 0x00308, 0x00301, 0x00391, 0x00301, 0x000B7, 0x00395, 0x00301,
+    0x00397, 0x00301, 0x00399, 0x00301, 0x0039F, 0x00301, 0x003A5, 0x00301,
+    0x003A9, 0x00301, 0x003B9, 0x00308, 0x00301, 0x00399, 0x00308, 0x003A5,
+    0x00308, 0x003B1, 0x00301, 0x003B5, 0x00301, 0x003B7, 0x00301, 0x003B9,
+    0x00301, 0x003C5, 0x00308, 0x00301, 0x003B9, 0x00308, 0x003C5, 0x00308,
+    0x003BF, 0x00301, 0x003C5, 0x00301, 0x003C9, 0x00301, 0x003B2, 0x003B8,
+    0x003A5, 0x003D2, 0x00301, 0x003D2, 0x00308, 0x003C6, 0x003C0, 0x003BA,
+    0x003C1, 0x003C2, 0x00398, 0x003B5, 0x003A3, 0x00415, 0x00300, 0x00415,
+    0x00308, 0x00413, 0x00301, 0x00406, 0x00308, 0x0041A, 0x00301, 0x00418,
+    0x00300, 0x00423, 0x00306, 0x00418, 0x00306, 0x00438, 0x00306, 0x00435,
+    0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456, 0x00308, 0x0043A,
+    0x00301, 0x00438, 0x00300, 0x00443, 0x00306, 0x00474, 0x0030F, 0x00475,
+    0x0030F, 0x00416, 0x00306, 0x00436, 0x00306, 0x00410, 0x00306, 0x00430,
+    0x00306, 0x00410, 0x00308, 0x00430, 0x00308, 0x00415, 0x00306, 0x00435,
+    0x00306, 0x004D8, 0x00308, 0x004D9, 0x00308, 0x00416, 0x00308, 0x00436,
+    0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418, 0x00304, 0x00438,
+    0x00304, 0x00418, 0x00308, 0x00438, 0x00308, 0x0041E, 0x00308, 0x0043E,
+    0x00308, 0x004E8, 0x00308, 0x004E9, 0x00308, 0x0042D, 0x00308, 0x0044D,
+    0x00308, 0x00423, 0x00304, 0x00443, 0x00304, 0x00423, 0x00308, 0x00443,
+    0x00308, 0x00423, 0x0030B, 0x00443, 0x0030B, 0x00427, 0x00308, 0x00447,
+    0x00308, 0x0042B, 0x00308, 0x0044B, 0x00308, 0x00565, 0x00582, 0x00627,
+    0x00653, 0x00627, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064A,
+    0x00654, 0x00627, 0x00674, 0x00648, 0x00674, 0x006C7, 0x00674, 0x0064A,
+    0x00674, 0x006D5, 0x00654, 0x006C1, 0x00654, 0x006D2, 0x00654, 0x00928,
+    0x0093C, 0x00930, 0x0093C, 0x00933, 0x0093C, 0x00915, 0x0093C, 0x00916,
+    0x0093C, 0x00917, 0x0093C, 0x0091C, 0x0093C, 0x00921, 0x0093C, 0x00922,
+    0x0093C, 0x0092B, 0x0093C, 0x0092F, 0x0093C, 0x009C7, 0x009BE, 0x009C7,
+    0x009D7, 0x009A1, 0x009BC, 0x009A2, 0x009BC, 0x009AF, 0x009BC, 0x00A32,
+    0x00A3C, 0x00A38, 0x00A3C, 0x00A16, 0x00A3C, 0x00A17, 0x00A3C, 0x00A1C,
+    0x00A3C, 0x00A2B, 0x00A3C, 0x00B47, 0x00B56, 0x00B47, 0x00B3E, 0x00B47,
+    0x00B57, 0x00B21, 0x00B3C, 0x00B22, 0x00B3C, 0x00B92, 0x00BD7, 0x00BC6,
+    0x00BBE, 0x00BC7, 0x00BBE, 0x00BC6, 0x00BD7, 0x00C46, 0x00C56, 0x00CBF,
+    0x00CD5, 0x00CC6, 0x00CD5, 0x00CC6, 0x00CD6, 0x00CC6, 0x00CC2, 0x00CC6,
+    0x00CC2, 0x00CD5, 0x00D46, 0x00D3E, 0x00D47, 0x00D3E, 0x00D46, 0x00D57,
+    0x00DD9, 0x00DCA, 0x00DD9, 0x00DCF, 0x00DD9, 0x00DCF, 0x00DCA, 0x00DD9,
+    0x00DDF, 0x00E4D, 0x00E32, 0x00ECD, 0x00EB2, 0x00EAB, 0x00E99, 0x00EAB,
+    0x00EA1, 0x00F0B, 0x00F42, 0x00FB7, 0x00F4C, 0x00FB7, 0x00F51, 0x00FB7,
+    0x00F56, 0x00FB7, 0x00F5B, 0x00FB7, 0x00F40, 0x00FB5, 0x00F71, 0x00F72,
+    0x00F71, 0x00F74, 0x00FB2, 0x00F80, 0x00FB2, 0x00F71, 0x00F80, 0x00FB3,
+    0x00F80, 0x00FB3, 0x00F71, 0x00F80, 0x00F71, 0x00F80, 0x00F92, 0x00FB7,
+    0x00F9C, 0x00FB7, 0x00FA1, 0x00FB7, 0x00FA6, 0x00FB7, 0x00FAB, 0x00FB7,
+    0x00F90, 0x00FB5, 0x01025, 0x0102E, 0x010DC, 0x01B05, 0x01B35, 0x01B07,
+    0x01B35, 0x01B09, 0x01B35, 0x01B0B, 0x01B35, 0x01B0D, 0x01B35, 0x01B11,
+    0x01B35, 0x01B3A, 0x01B35, 0x01B3C, 0x01B35, 0x01B3E, 0x01B35, 0x01B3F,
+    0x01B35, 0x01B42, 0x01B35, 0x00041, 0x000C6, 0x00042, 0x00044, 0x00045,
+    0x0018E, 0x00047, 0x00048, 0x00049, 0x0004A, 0x0004B, 0x0004C, 0x0004D,
+    0x0004E, 0x0004F, 0x00222, 0x00050, 0x00052, 0x00054, 0x00055, 0x00057,
+    0x00250, 0x00251, 0x01D02, 0x00062, 0x00064, 0x00065, 0x00259, 0x0025B,
+    0x0025C, 0x00067, 0x0006B, 0x0006D, 0x0014B, 0x00254, 0x01D16, 0x01D17,
+    0x00070, 0x00074, 0x00075, 0x01D1D, 0x0026F, 0x00076, 0x01D25, 0x003B3,
+    0x003B4, 0x003C7, 0x00069, 0x0043D, 0x00252, 0x00063, 0x00255, 0x000F0,
+    0x00066, 0x0025F, 0x00261, 0x00265, 0x00268, 0x00269, 0x0026A, 0x01D7B,
+    0x0029D, 0x0026D, 0x01D85, 0x0029F, 0x00271, 0x00270, 0x00272, 0x00273,
+    0x00274, 0x00275, 0x00278, 0x00282, 0x00283, 0x001AB, 0x00289, 0x0028A,
+    0x01D1C, 0x0028B, 0x0028C, 0x0007A, 0x00290, 0x00291, 0x00292, 0x00041,
+    0x00325, 0x00061, 0x00325, 0x00042, 0x00307, 0x00062, 0x00307, 0x00042,
+    0x00323, 0x00062, 0x00323, 0x00042, 0x00331, 0x00062, 0x00331, 0x00043,
+    0x00327, 0x00301, 0x00063, 0x00327, 0x00301, 0x00044, 0x00307, 0x00064,
+    0x00307, 0x00044, 0x00323, 0x00064, 0x00323, 0x00044, 0x00331, 0x00064,
+    0x00331, 0x00044, 0x00327, 0x00064, 0x00327, 0x00044, 0x0032D, 0x00064,
+    0x0032D, 0x00045, 0x00304, 0x00300, 0x00065, 0x00304, 0x00300, 0x00045,
+    0x00304, 0x00301, 0x00065, 0x00304, 0x00301, 0x00045, 0x0032D, 0x00065,
+    0x0032D, 0x00045, 0x00330, 0x00065, 0x00330, 0x00045, 0x00327, 0x00306,
+    0x00065, 0x00327, 0x00306, 0x00046, 0x00307, 0x00066, 0x00307, 0x00047,
+    0x00304, 0x00067, 0x00304, 0x00048, 0x00307, 0x00068, 0x00307, 0x00048,
+    0x00323, 0x00068, 0x00323, 0x00048, 0x00308, 0x00068, 0x00308, 0x00048,
+    0x00327, 0x00068, 0x00327, 0x00048, 0x0032E, 0x00068, 0x0032E, 0x00049,
+    0x00330, 0x00069, 0x00330, 0x00049, 0x00308, 0x00301, 0x00069, 0x00308,
+    0x00301, 0x0004B, 0x00301, 0x0006B, 0x00301, 0x0004B, 0x00323, 0x0006B,
+    0x00323, 0x0004B, 0x00331, 0x0006B, 0x00331, 0x0004C, 0x00323, 0x0006C,
+    0x00323, 0x0004C, 0x00323, 0x00304, 0x0006C, 0x00323, 0x00304, 0x0004C,
+    0x00331, 0x0006C, 0x00331, 0x0004C, 0x0032D, 0x0006C, 0x0032D, 0x0004D,
+    0x00301, 0x0006D, 0x00301, 0x0004D, 0x00307, 0x0006D, 0x00307, 0x0004D,
+    0x00323, 0x0006D, 0x00323, 0x0004E, 0x00307, 0x0006E, 0x00307, 0x0004E,
+    0x00323, 0x0006E, 0x00323, 0x0004E, 0x00331, 0x0006E, 0x00331, 0x0004E,
+    0x0032D, 0x0006E, 0x0032D, 0x0004F, 0x00303, 0x00301, 0x0006F, 0x00303,
+    0x00301, 0x0004F, 0x00303, 0x00308, 0x0006F, 0x00303, 0x00308, 0x0004F,
+    0x00304, 0x00300, 0x0006F, 0x00304, 0x00300, 0x0004F, 0x00304, 0x00301,
+    0x0006F, 0x00304, 0x00301, 0x00050, 0x00301, 0x00070, 0x00301, 0x00050,
+    0x00307, 0x00070, 0x00307, 0x00052, 0x00307, 0x00072, 0x00307, 0x00052,
+    0x00323, 0x00072, 0x00323, 0x00052, 0x00323, 0x00304, 0x00072, 0x00323,
+    0x00304, 0x00052, 0x00331, 0x00072, 0x00331, 0x00053, 0x00307, 0x00073,
+    0x00307, 0x00053, 0x00323, 0x00073, 0x00323, 0x00053, 0x00301, 0x00307,
+    0x00073, 0x00301, 0x00307, 0x00053, 0x0030C, 0x00307, 0x00073, 0x0030C,
+    0x00307, 0x00053, 0x00323, 0x00307, 0x00073, 0x00323, 0x00307, 0x00054,
+    0x00307, 0x00074, 0x00307, 0x00054, 0x00323, 0x00074, 0x00323, 0x00054,
+    0x00331, 0x00074, 0x00331, 0x00054, 0x0032D, 0x00074, 0x0032D, 0x00055,
+    0x00324, 0x00075, 0x00324, 0x00055, 0x00330, 0x00075, 0x00330, 0x00055,
+    0x0032D, 0x00075, 0x0032D, 0x00055, 0x00303, 0x00301, 0x00075, 0x00303,
+    0x00301, 0x00055, 0x00304, 0x00308, 0x00075, 0x00304, 0x00308, 0x00056,
+    0x00303, 0x00076, 0x00303, 0x00056, 0x00323, 0x00076, 0x00323, 0x00057,
+    0x00300, 0x00077, 0x00300, 0x00057, 0x00301, 0x00077, 0x00301, 0x00057,
+    0x00308, 0x00077, 0x00308, 0x00057, 0x00307, 0x00077, 0x00307, 0x00057,
+    0x00323, 0x00077, 0x00323, 0x00058, 0x00307, 0x00078, 0x00307, 0x00058,
+    0x00308, 0x00078, 0x00308, 0x00059, 0x00307, 0x00079, 0x00307, 0x0005A,
+    0x00302, 0x0007A, 0x00302, 0x0005A, 0x00323, 0x0007A, 0x00323, 0x0005A,
+    0x00331, 0x0007A, 0x00331, 0x00068, 0x00331, 0x00074, 0x00308, 0x00077,
+    0x0030A, 0x00079, 0x0030A, 0x00061, 0x002BE, 0x0017F, 0x00307, 0x00041,
+    0x00323, 0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309, 0x00041,
+    0x00302, 0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302, 0x00300,
+    0x00061, 0x00302, 0x00300, 0x00041, 0x00302, 0x00309, 0x00061, 0x00302,
+    0x00309, 0x00041, 0x00302, 0x00303, 0x00061, 0x00302, 0x00303, 0x00041,
+    0x00323, 0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306, 0x00301,
+    0x00061, 0x00306, 0x00301, 0x00041, 0x00306, 0x00300, 0x00061, 0x00306,
+    0x00300, 0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309, 0x00041,
+    0x00306, 0x00303, 0x00061, 0x00306, 0x00303, 0x00041, 0x00323, 0x00306,
+    0x00061, 0x00323, 0x00306, 0x00045, 0x00323, 0x00065, 0x00323, 0x00045,
+    0x00309, 0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303, 0x00045,
+    0x00302, 0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302, 0x00300,
+    0x00065, 0x00302, 0x00300, 0x00045, 0x00302, 0x00309, 0x00065, 0x00302,
+    0x00309, 0x00045, 0x00302, 0x00303, 0x00065, 0x00302, 0x00303, 0x00045,
+    0x00323, 0x00302, 0x00065, 0x00323, 0x00302, 0x00049, 0x00309, 0x00069,
+    0x00309, 0x00049, 0x00323, 0x00069, 0x00323, 0x0004F, 0x00323, 0x0006F,
+    0x00323, 0x0004F, 0x00309, 0x0006F, 0x00309, 0x0004F, 0x00302, 0x00301,
+    0x0006F, 0x00302, 0x00301, 0x0004F, 0x00302, 0x00300, 0x0006F, 0x00302,
+    0x00300, 0x0004F, 0x00302, 0x00309, 0x0006F, 0x00302, 0x00309, 0x0004F,
+    0x00302, 0x00303, 0x0006F, 0x00302, 0x00303, 0x0004F, 0x00323, 0x00302,
+    0x0006F, 0x00323, 0x00302, 0x0004F, 0x0031B, 0x00301, 0x0006F, 0x0031B,
+    0x00301, 0x0004F, 0x0031B, 0x00300, 0x0006F, 0x0031B, 0x00300, 0x0004F,
+    0x0031B, 0x00309, 0x0006F, 0x0031B, 0x00309, 0x0004F, 0x0031B, 0x00303,
+    0x0006F, 0x0031B, 0x00303, 0x0004F, 0x0031B, 0x00323, 0x0006F, 0x0031B,
+    0x00323, 0x00055, 0x00323, 0x00075, 0x00323, 0x00055, 0x00309, 0x00075,
+    0x00309, 0x00055, 0x0031B, 0x00301, 0x00075, 0x0031B, 0x00301, 0x00055,
+    0x0031B, 0x00300, 0x00075, 0x0031B, 0x00300, 0x00055, 0x0031B, 0x00309,
+    0x00075, 0x0031B, 0x00309, 0x00055, 0x0031B, 0x00303, 0x00075, 0x0031B,
+    0x00303, 0x00055, 0x0031B, 0x00323, 0x00075, 0x0031B, 0x00323, 0x00059,
+    0x00300, 0x00079, 0x00300, 0x00059, 0x00323, 0x00079, 0x00323, 0x00059,
+    0x00309, 0x00079, 0x00309, 0x00059, 0x00303, 0x00079, 0x00303, 0x003B1,
+    0x00313, 0x003B1, 0x00314, 0x003B1, 0x00313, 0x00300, 0x003B1, 0x00314,
+    0x00300, 0x003B1, 0x00313, 0x00301, 0x003B1, 0x00314, 0x00301, 0x003B1,
+    0x00313, 0x00342, 0x003B1, 0x00314, 0x00342, 0x00391, 0x00313, 0x00391,
+    0x00314, 0x00391, 0x00313, 0x00300, 0x00391, 0x00314, 0x00300, 0x00391,
+    0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391, 0x00313, 0x00342,
+    0x00391, 0x00314, 0x00342, 0x003B5, 0x00313, 0x003B5, 0x00314, 0x003B5,
+    0x00313, 0x00300, 0x003B5, 0x00314, 0x00300, 0x003B5, 0x00313, 0x00301,
+    0x003B5, 0x00314, 0x00301, 0x00395, 0x00313, 0x00395, 0x00314, 0x00395,
+    0x00313, 0x00300, 0x00395, 0x00314, 0x00300, 0x00395, 0x00313, 0x00301,
+    0x00395, 0x00314, 0x00301, 0x003B7, 0x00313, 0x003B7, 0x00314, 0x003B7,
+    0x00313, 0x00300, 0x003B7, 0x00314, 0x00300, 0x003B7, 0x00313, 0x00301,
+    0x003B7, 0x00314, 0x00301, 0x003B7, 0x00313, 0x00342, 0x003B7, 0x00314,
+    0x00342, 0x00397, 0x00313, 0x00397, 0x00314, 0x00397, 0x00313, 0x00300,
+    0x00397, 0x00314, 0x00300, 0x00397, 0x00313, 0x00301, 0x00397, 0x00314,
+    0x00301, 0x00397, 0x00313, 0x00342, 0x00397, 0x00314, 0x00342, 0x003B9,
+    0x00313, 0x003B9, 0x00314, 0x003B9, 0x00313, 0x00300, 0x003B9, 0x00314,
+    0x00300, 0x003B9, 0x00313, 0x00301, 0x003B9, 0x00314, 0x00301, 0x003B9,
+    0x00313, 0x00342, 0x003B9, 0x00314, 0x00342, 0x00399, 0x00313, 0x00399,
+    0x00314, 0x00399, 0x00313, 0x00300, 0x00399, 0x00314, 0x00300, 0x00399,
+    0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399, 0x00313, 0x00342,
+    0x00399, 0x00314, 0x00342, 0x003BF, 0x00313, 0x003BF, 0x00314, 0x003BF,
+    0x00313, 0x00300, 0x003BF, 0x00314, 0x00300, 0x003BF, 0x00313, 0x00301,
+    0x003BF, 0x00314, 0x00301, 0x0039F, 0x00313, 0x0039F, 0x00314, 0x0039F,
+    0x00313, 0x00300, 0x0039F, 0x00314, 0x00300, 0x0039F, 0x00313, 0x00301,
+    0x0039F, 0x00314, 0x00301, 0x003C5, 0x00313, 0x003C5, 0x00314, 0x003C5,
+    0x00313, 0x00300, 0x003C5, 0x00314, 0x00300, 0x003C5, 0x00313, 0x00301,
+    0x003C5, 0x00314, 0x00301, 0x003C5, 0x00313, 0x00342, 0x003C5, 0x00314,
+    0x00342, 0x003A5, 0x00314, 0x003A5, 0x00314, 0x00300, 0x003A5, 0x00314,
+    0x00301, 0x003A5, 0x00314, 0x00342, 0x003C9, 0x00313, 0x003C9, 0x00314,
+    0x003C9, 0x00313, 0x00300, 0x003C9, 0x00314, 0x00300, 0x003C9, 0x00313,
+    0x00301, 0x003C9, 0x00314, 0x00301, 0x003C9, 0x00313, 0x00342, 0x003C9,
+    0x00314, 0x00342, 0x003A9, 0x00313, 0x003A9, 0x00314, 0x003A9, 0x00313,
+    0x00300, 0x003A9, 0x00314, 0x00300, 0x003A9, 0x00313, 0x00301, 0x003A9,
+    0x00314, 0x00301, 0x003A9, 0x00313, 0x00342, 0x003A9, 0x00314, 0x00342,
+    0x003B1, 0x00300, 0x003B5, 0x00300, 0x003B7, 0x00300, 0x003B9, 0x00300,
+    0x003BF, 0x00300, 0x003C5, 0x00300, 0x003C9, 0x00300, 0x003B1, 0x00313,
+    0x00345, 0x003B1, 0x00314, 0x00345, 0x003B1, 0x00313, 0x00300, 0x00345,
+    0x003B1, 0x00314, 0x00300, 0x00345, 0x003B1, 0x00313, 0x00301, 0x00345,
+    0x003B1, 0x00314, 0x00301, 0x00345, 0x003B1, 0x00313, 0x00342, 0x00345,
+    0x003B1, 0x00314, 0x00342, 0x00345, 0x00391, 0x00313, 0x00345, 0x00391,
+    0x00314, 0x00345, 0x00391, 0x00313, 0x00300, 0x00345, 0x00391, 0x00314,
+    0x00300, 0x00345, 0x00391, 0x00313, 0x00301, 0x00345, 0x00391, 0x00314,
+    0x00301, 0x00345, 0x00391, 0x00313, 0x00342, 0x00345, 0x00391, 0x00314,
+    0x00342, 0x00345, 0x003B7, 0x00313, 0x00345, 0x003B7, 0x00314, 0x00345,
+    0x003B7, 0x00313, 0x00300, 0x00345, 0x003B7, 0x00314, 0x00300, 0x00345,
+    0x003B7, 0x00313, 0x00301, 0x00345, 0x003B7, 0x00314, 0x00301, 0x00345,
+    0x003B7, 0x00313, 0x00342, 0x00345, 0x003B7, 0x00314, 0x00342, 0x00345,
+    0x00397, 0x00313, 0x00345, 0x00397, 0x00314, 0x00345, 0x00397, 0x00313,
+    0x00300, 0x00345, 0x00397, 0x00314, 0x00300, 0x00345, 0x00397, 0x00313,
+    0x00301, 0x00345, 0x00397, 0x00314, 0x00301, 0x00345, 0x00397, 0x00313,
+    0x00342, 0x00345, 0x00397, 0x00314, 0x00342, 0x00345, 0x003C9, 0x00313,
+    0x00345, 0x003C9, 0x00314, 0x00345, 0x003C9, 0x00313, 0x00300, 0x00345,
+    0x003C9, 0x00314, 0x00300, 0x00345, 0x003C9, 0x00313, 0x00301, 0x00345,
+    0x003C9, 0x00314, 0x00301, 0x00345, 0x003C9, 0x00313, 0x00342, 0x00345,
+    0x003C9, 0x00314, 0x00342, 0x00345, 0x003A9, 0x00313, 0x00345, 0x003A9,
+    0x00314, 0x00345, 0x003A9, 0x00313, 0x00300, 0x00345, 0x003A9, 0x00314,
+    0x00300, 0x00345, 0x003A9, 0x00313, 0x00301, 0x00345, 0x003A9, 0x00314,
+    0x00301, 0x00345, 0x003A9, 0x00313, 0x00342, 0x00345, 0x003A9, 0x00314,
+    0x00342, 0x00345, 0x003B1, 0x00306, 0x003B1, 0x00304, 0x003B1, 0x00300,
+    0x00345, 0x003B1, 0x00345, 0x003B1, 0x00301, 0x00345, 0x003B1, 0x00342,
+    0x003B1, 0x00342, 0x00345, 0x00391, 0x00306, 0x00391, 0x00304, 0x00391,
+    0x00300, 0x00391, 0x00345, 0x00020, 0x00313, 0x003B9, 0x00020, 0x00342,
+    0x000A8, 0x00342, 0x00020, 0x00308, 0x00342, 0x003B7, 0x00300, 0x00345,
+    0x003B7, 0x00345, 0x003B7, 0x00301, 0x00345, 0x003B7, 0x00342, 0x003B7,
+    0x00342, 0x00345, 0x00395, 0x00300, 0x00397, 0x00300, 0x00397, 0x00345,
+    0x01FBF, 0x00300, 0x00020, 0x00313, 0x00300, 0x01FBF, 0x00301, 0x00020,
+    0x00313, 0x00301, 0x01FBF, 0x00342, 0x00020, 0x00313, 0x00342, 0x003B9,
+    0x00306, 0x003B9, 0x00304, 0x003B9, 0x00308, 0x00300, 0x003B9, 0x00342,
+    0x003B9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304, 0x00399,
+    0x00300, 0x01FFE, 0x00300, 0x00020, 0x00314, 0x00300, 0x01FFE, 0x00301,
+    0x00020, 0x00314, 0x00301, 0x01FFE, 0x00342, 0x00020, 0x00314, 0x00342,
+    0x003C5, 0x00306, 0x003C5, 0x00304, 0x003C5, 0x00308, 0x00300, 0x003C1,
+    0x00313, 0x003C1, 0x00314, 0x003C5, 0x00342, 0x003C5, 0x00308, 0x00342,
+    0x003A5, 0x00306, 0x003A5, 0x00304, 0x003A5, 0x00300, 0x003A1, 0x00314,
+    0x000A8, 0x00300, 0x00020, 0x00308, 0x00300, 0x00060, 0x003C9, 0x00300,
+    0x00345, 0x003C9, 0x00345, 0x003C9, 0x00301, 0x00345, 0x003C9, 0x00342,
+    0x003C9, 0x00342, 0x00345, 0x0039F, 0x00300, 0x003A9, 0x00300, 0x003A9,
+    0x00345, 0x000B4, 0x00020, 0x00314, 0x02002, 0x02003, 0x02010, 0x00020,
+    0x00333, 0x0002E, 0x0002E, 0x0002E, 0x0002E, 0x0002E, 0x0002E, 0x02032,
+    0x02032, 0x02032, 0x02032, 0x02032, 0x02035, 0x02035, 0x02035, 0x02035,
+    0x02035, 0x00021, 0x00021, 0x00020, 0x00305, 0x0003F, 0x0003F, 0x0003F,
+    0x00021, 0x00021, 0x0003F, 0x02032, 0x02032, 0x02032, 0x02032, 0x00030,
+    0x00034, 0x00035, 0x00036, 0x00037, 0x00038, 0x00039, 0x0002B, 0x02212,
+    0x0003D, 0x00028, 0x00029, 0x0006E, 0x00052, 0x00073, 0x00061, 0x0002F,
+    0x00063, 0x00061, 0x0002F, 0x00073, 0x00043, 0x000B0, 0x00043, 0x00063,
+    0x0002F, 0x0006F, 0x00063, 0x0002F, 0x00075, 0x00190, 0x000B0, 0x00046,
+    0x00127, 0x0004E, 0x0006F, 0x00051, 0x00053, 0x0004D, 0x00054, 0x00045,
+    0x0004C, 0x00054, 0x0004D, 0x0005A, 0x003A9, 0x00046, 0x005D0, 0x005D1,
+    0x005D2, 0x005D3, 0x00046, 0x00041, 0x00058, 0x00393, 0x003A0, 0x02211,
+    0x00031, 0x02044, 0x00037, 0x00031, 0x02044, 0x00039, 0x00031, 0x02044,
+    0x00031, 0x00030, 0x00031, 0x02044, 0x00033, 0x00032, 0x02044, 0x00033,
+    0x00031, 0x02044, 0x00035, 0x00032, 0x02044, 0x00035, 0x00033, 0x02044,
+    0x00035, 0x00034, 0x02044, 0x00035, 0x00031, 0x02044, 0x00036, 0x00035,
+    0x02044, 0x00036, 0x00031, 0x02044, 0x00038, 0x00033, 0x02044, 0x00038,
+    0x00035, 0x02044, 0x00038, 0x00037, 0x02044, 0x00038, 0x00031, 0x02044,
+    0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00049, 0x00056, 0x00056,
+    0x00056, 0x00049, 0x00056, 0x00049, 0x00049, 0x00056, 0x00049, 0x00049,
+    0x00049, 0x00049, 0x00058, 0x00058, 0x00058, 0x00049, 0x00058, 0x00049,
+    0x00049, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00069, 0x00076,
+    0x00076, 0x00069, 0x00076, 0x00069, 0x00069, 0x00076, 0x00069, 0x00069,
+    0x00069, 0x00069, 0x00078, 0x00078, 0x00069, 0x00078, 0x00069, 0x00069,
+    0x00030, 0x02044, 0x00033, 0x02190, 0x00338, 0x02192, 0x00338, 0x02194,
+    0x00338, 0x021D0, 0x00338, 0x021D4, 0x00338, 0x021D2, 0x00338, 0x02203,
+    0x00338, 0x02208, 0x00338, 0x0220B, 0x00338, 0x02223, 0x00338, 0x02225,
+    0x00338, 0x0222B, 0x0222B, 0x0222B, 0x0222B, 0x0222B, 0x0222E, 0x0222E,
+    0x0222E, 0x0222E, 0x0222E, 0x0223C, 0x00338, 0x02243, 0x00338, 0x02245,
+    0x00338, 0x02248, 0x00338, 0x0003D, 0x00338, 0x02261, 0x00338, 0x0224D,
+    0x00338, 0x0003C, 0x00338, 0x0003E, 0x00338, 0x02264, 0x00338, 0x02265,
+    0x00338, 0x02272, 0x00338, 0x02273, 0x00338, 0x02276, 0x00338, 0x02277,
+    0x00338, 0x0227A, 0x00338, 0x0227B, 0x00338, 0x02282, 0x00338, 0x02283,
+    0x00338, 0x02286, 0x00338, 0x02287, 0x00338, 0x022A2, 0x00338, 0x022A8,
+    0x00338, 0x022A9, 0x00338, 0x022AB, 0x00338, 0x0227C, 0x00338, 0x0227D,
+    0x00338, 0x02291, 0x00338, 0x02292, 0x00338, 0x022B2, 0x00338, 0x022B3,
+    0x00338, 0x022B4, 0x00338, 0x022B5, 0x00338, 0x03008, 0x03009, 0x00031,
+    0x00030, 0x00031, 0x00031, 0x00031, 0x00032, 0x00031, 0x00033, 0x00031,
+    0x00034, 0x00031, 0x00035, 0x00031, 0x00036, 0x00031, 0x00037, 0x00031,
+    0x00038, 0x00031, 0x00039, 0x00032, 0x00030, 0x00028, 0x00031, 0x00029,
+    0x00028, 0x00032, 0x00029, 0x00028, 0x00033, 0x00029, 0x00028, 0x00034,
+    0x00029, 0x00028, 0x00035, 0x00029, 0x00028, 0x00036, 0x00029, 0x00028,
+    0x00037, 0x00029, 0x00028, 0x00038, 0x00029, 0x00028, 0x00039, 0x00029,
+    0x00028, 0x00031, 0x00030, 0x00029, 0x00028, 0x00031, 0x00031, 0x00029,
+    0x00028, 0x00031, 0x00032, 0x00029, 0x00028, 0x00031, 0x00033, 0x00029,
+    0x00028, 0x00031, 0x00034, 0x00029, 0x00028, 0x00031, 0x00035, 0x00029,
+    0x00028, 0x00031, 0x00036, 0x00029, 0x00028, 0x00031, 0x00037, 0x00029,
+    0x00028, 0x00031, 0x00038, 0x00029, 0x00028, 0x00031, 0x00039, 0x00029,
+    0x00028, 0x00032, 0x00030, 0x00029, 0x00031, 0x0002E, 0x00032, 0x0002E,
+    0x00033, 0x0002E, 0x00034, 0x0002E, 0x00035, 0x0002E, 0x00036, 0x0002E,
+    0x00037, 0x0002E, 0x00038, 0x0002E, 0x00039, 0x0002E, 0x00031, 0x00030,
+    0x0002E, 0x00031, 0x00031, 0x0002E, 0x00031, 0x00032, 0x0002E, 0x00031,
+    0x00033, 0x0002E, 0x00031, 0x00034, 0x0002E, 0x00031, 0x00035, 0x0002E,
+    0x00031, 0x00036, 0x0002E, 0x00031, 0x00037, 0x0002E, 0x00031, 0x00038,
+    0x0002E, 0x00031, 0x00039, 0x0002E, 0x00032, 0x00030, 0x0002E, 0x00028,
+    0x00061, 0x00029, 0x00028, 0x00062, 0x00029, 0x00028, 0x00063, 0x00029,
+    0x00028, 0x00064, 0x00029, 0x00028, 0x00065, 0x00029, 0x00028, 0x00066,
+    0x00029, 0x00028, 0x00067, 0x00029, 0x00028, 0x00068, 0x00029, 0x00028,
+    0x00069, 0x00029, 0x00028, 0x0006A, 0x00029, 0x00028, 0x0006B, 0x00029,
+    0x00028, 0x0006C, 0x00029, 0x00028, 0x0006D, 0x00029, 0x00028, 0x0006E,
+    0x00029, 0x00028, 0x0006F, 0x00029, 0x00028, 0x00070, 0x00029, 0x00028,
+    0x00071, 0x00029, 0x00028, 0x00072, 0x00029, 0x00028, 0x00073, 0x00029,
+    0x00028, 0x00074, 0x00029, 0x00028, 0x00075, 0x00029, 0x00028, 0x00076,
+    0x00029, 0x00028, 0x00077, 0x00029, 0x00028, 0x00078, 0x00029, 0x00028,
+    0x00079, 0x00029, 0x00028, 0x0007A, 0x00029, 0x00053, 0x00059, 0x00071,
+    0x0222B, 0x0222B, 0x0222B, 0x0222B, 0x0003A, 0x0003A, 0x0003D, 0x0003D,
+    0x0003D, 0x0003D, 0x0003D, 0x0003D, 0x02ADD, 0x00338, 0x02D61, 0x06BCD,
+    0x09F9F, 0x04E00, 0x04E28, 0x04E36, 0x04E3F, 0x04E59, 0x04E85, 0x04E8C,
+    0x04EA0, 0x04EBA, 0x0513F, 0x05165, 0x0516B, 0x05182, 0x05196, 0x051AB,
+    0x051E0, 0x051F5, 0x05200, 0x0529B, 0x052F9, 0x05315, 0x0531A, 0x05338,
+    0x05341, 0x0535C, 0x05369, 0x05382, 0x053B6, 0x053C8, 0x053E3, 0x056D7,
+    0x0571F, 0x058EB, 0x05902, 0x0590A, 0x05915, 0x05927, 0x05973, 0x05B50,
+    0x05B80, 0x05BF8, 0x05C0F, 0x05C22, 0x05C38, 0x05C6E, 0x05C71, 0x05DDB,
+    0x05DE5, 0x05DF1, 0x05DFE, 0x05E72, 0x05E7A, 0x05E7F, 0x05EF4, 0x05EFE,
+    0x05F0B, 0x05F13, 0x05F50, 0x05F61, 0x05F73, 0x05FC3, 0x06208, 0x06236,
+    0x0624B, 0x0652F, 0x06534, 0x06587, 0x06597, 0x065A4, 0x065B9, 0x065E0,
+    0x065E5, 0x066F0, 0x06708, 0x06728, 0x06B20, 0x06B62, 0x06B79, 0x06BB3,
+    0x06BCB, 0x06BD4, 0x06BDB, 0x06C0F, 0x06C14, 0x06C34, 0x0706B, 0x0722A,
+    0x07236, 0x0723B, 0x0723F, 0x07247, 0x07259, 0x0725B, 0x072AC, 0x07384,
+    0x07389, 0x074DC, 0x074E6, 0x07518, 0x0751F, 0x07528, 0x07530, 0x0758B,
+    0x07592, 0x07676, 0x0767D, 0x076AE, 0x076BF, 0x076EE, 0x077DB, 0x077E2,
+    0x077F3, 0x0793A, 0x079B8, 0x079BE, 0x07A74, 0x07ACB, 0x07AF9, 0x07C73,
+    0x07CF8, 0x07F36, 0x07F51, 0x07F8A, 0x07FBD, 0x08001, 0x0800C, 0x08012,
+    0x08033, 0x0807F, 0x08089, 0x081E3, 0x081EA, 0x081F3, 0x081FC, 0x0820C,
+    0x0821B, 0x0821F, 0x0826E, 0x08272, 0x08278, 0x0864D, 0x0866B, 0x08840,
+    0x0884C, 0x08863, 0x0897E, 0x0898B, 0x089D2, 0x08A00, 0x08C37, 0x08C46,
+    0x08C55, 0x08C78, 0x08C9D, 0x08D64, 0x08D70, 0x08DB3, 0x08EAB, 0x08ECA,
+    0x08F9B, 0x08FB0, 0x08FB5, 0x09091, 0x09149, 0x091C6, 0x091CC, 0x091D1,
+    0x09577, 0x09580, 0x0961C, 0x096B6, 0x096B9, 0x096E8, 0x09751, 0x0975E,
+    0x09762, 0x09769, 0x097CB, 0x097ED, 0x097F3, 0x09801, 0x098A8, 0x098DB,
+    0x098DF, 0x09996, 0x09999, 0x099AC, 0x09AA8, 0x09AD8, 0x09ADF, 0x09B25,
+    0x09B2F, 0x09B32, 0x09B3C, 0x09B5A, 0x09CE5, 0x09E75, 0x09E7F, 0x09EA5,
+    0x09EBB, 0x09EC3, 0x09ECD, 0x09ED1, 0x09EF9, 0x09EFD, 0x09F0E, 0x09F13,
+    0x09F20, 0x09F3B, 0x09F4A, 0x09F52, 0x09F8D, 0x09F9C, 0x09FA0, 0x03012,
+    0x05344, 0x05345, 0x0304B, 0x03099, 0x0304D, 0x03099, 0x0304F, 0x03099,
+    0x03051, 0x03099, 0x03053, 0x03099, 0x03055, 0x03099, 0x03057, 0x03099,
+    0x03059, 0x03099, 0x0305B, 0x03099, 0x0305D, 0x03099, 0x0305F, 0x03099,
+    0x03061, 0x03099, 0x03064, 0x03099, 0x03066, 0x03099, 0x03068, 0x03099,
+    0x0306F, 0x03099, 0x0306F, 0x0309A, 0x03072, 0x03099, 0x03072, 0x0309A,
+    0x03075, 0x03099, 0x03075, 0x0309A, 0x03078, 0x03099, 0x03078, 0x0309A,
+    0x0307B, 0x03099, 0x0307B, 0x0309A, 0x03046, 0x03099, 0x00020, 0x03099,
+    0x00020, 0x0309A, 0x0309D, 0x03099, 0x03088, 0x0308A, 0x030AB, 0x03099,
+    0x030AD, 0x03099, 0x030AF, 0x03099, 0x030B1, 0x03099, 0x030B3, 0x03099,
+    0x030B5, 0x03099, 0x030B7, 0x03099, 0x030B9, 0x03099, 0x030BB, 0x03099,
+    0x030BD, 0x03099, 0x030BF, 0x03099, 0x030C1, 0x03099, 0x030C4, 0x03099,
+    0x030C6, 0x03099, 0x030C8, 0x03099, 0x030CF, 0x03099, 0x030CF, 0x0309A,
+    0x030D2, 0x03099, 0x030D2, 0x0309A, 0x030D5, 0x03099, 0x030D5, 0x0309A,
+    0x030D8, 0x03099, 0x030D8, 0x0309A, 0x030DB, 0x03099, 0x030DB, 0x0309A,
+    0x030A6, 0x03099, 0x030EF, 0x03099, 0x030F0, 0x03099, 0x030F1, 0x03099,
+    0x030F2, 0x03099, 0x030FD, 0x03099, 0x030B3, 0x030C8, 0x01100, 0x01101,
+    0x011AA, 0x01102, 0x011AC, 0x011AD, 0x01103, 0x01104, 0x01105, 0x011B0,
+    0x011B1, 0x011B2, 0x011B3, 0x011B4, 0x011B5, 0x0111A, 0x01106, 0x01107,
+    0x01108, 0x01121, 0x01109, 0x0110A, 0x0110B, 0x0110C, 0x0110D, 0x0110E,
+    0x0110F, 0x01110, 0x01111, 0x01112, 0x01161, 0x01162, 0x01163, 0x01164,
+    0x01165, 0x01166, 0x01167, 0x01168, 0x01169, 0x0116A, 0x0116B, 0x0116C,
+    0x0116D, 0x0116E, 0x0116F, 0x01170, 0x01171, 0x01172, 0x01173, 0x01174,
+    0x01175, 0x01160, 0x01114, 0x01115, 0x011C7, 0x011C8, 0x011CC, 0x011CE,
+    0x011D3, 0x011D7, 0x011D9, 0x0111C, 0x011DD, 0x011DF, 0x0111D, 0x0111E,
+    0x01120, 0x01122, 0x01123, 0x01127, 0x01129, 0x0112B, 0x0112C, 0x0112D,
+    0x0112E, 0x0112F, 0x01132, 0x01136, 0x01140, 0x01147, 0x0114C, 0x011F1,
+    0x011F2, 0x01157, 0x01158, 0x01159, 0x01184, 0x01185, 0x01188, 0x01191,
+    0x01192, 0x01194, 0x0119E, 0x011A1, 0x04E09, 0x056DB, 0x04E0A, 0x04E2D,
+    0x04E0B, 0x07532, 0x04E19, 0x04E01, 0x05929, 0x05730, 0x00028, 0x01100,
+    0x00029, 0x00028, 0x01102, 0x00029, 0x00028, 0x01103, 0x00029, 0x00028,
+    0x01105, 0x00029, 0x00028, 0x01106, 0x00029, 0x00028, 0x01107, 0x00029,
+    0x00028, 0x01109, 0x00029, 0x00028, 0x0110B, 0x00029, 0x00028, 0x0110C,
+    0x00029, 0x00028, 0x0110E, 0x00029, 0x00028, 0x0110F, 0x00029, 0x00028,
+    0x01110, 0x00029, 0x00028, 0x01111, 0x00029, 0x00028, 0x01112, 0x00029,
+    0x00028, 0x01100, 0x01161, 0x00029, 0x00028, 0x01102, 0x01161, 0x00029,
+    0x00028, 0x01103, 0x01161, 0x00029, 0x00028, 0x01105, 0x01161, 0x00029,
+    0x00028, 0x01106, 0x01161, 0x00029, 0x00028, 0x01107, 0x01161, 0x00029,
+    0x00028, 0x01109, 0x01161, 0x00029, 0x00028, 0x0110B, 0x01161, 0x00029,
+    0x00028, 0x0110C, 0x01161, 0x00029, 0x00028, 0x0110E, 0x01161, 0x00029,
+    0x00028, 0x0110F, 0x01161, 0x00029, 0x00028, 0x01110, 0x01161, 0x00029,
+    0x00028, 0x01111, 0x01161, 0x00029, 0x00028, 0x01112, 0x01161, 0x00029,
+    0x00028, 0x0110C, 0x0116E, 0x00029, 0x00028, 0x0110B, 0x01169, 0x0110C,
+    0x01165, 0x011AB, 0x00029, 0x00028, 0x0110B, 0x01169, 0x01112, 0x0116E,
+    0x00029, 0x00028, 0x04E00, 0x00029, 0x00028, 0x04E8C, 0x00029, 0x00028,
+    0x04E09, 0x00029, 0x00028, 0x056DB, 0x00029, 0x00028, 0x04E94, 0x00029,
+    0x00028, 0x0516D, 0x00029, 0x00028, 0x04E03, 0x00029, 0x00028, 0x0516B,
+    0x00029, 0x00028, 0x04E5D, 0x00029, 0x00028, 0x05341, 0x00029, 0x00028,
+    0x06708, 0x00029, 0x00028, 0x0706B, 0x00029, 0x00028, 0x06C34, 0x00029,
+    0x00028, 0x06728, 0x00029, 0x00028, 0x091D1, 0x00029, 0x00028, 0x0571F,
+    0x00029, 0x00028, 0x065E5, 0x00029, 0x00028, 0x0682A, 0x00029, 0x00028,
+    0x06709, 0x00029, 0x00028, 0x0793E, 0x00029, 0x00028, 0x0540D, 0x00029,
+    0x00028, 0x07279, 0x00029, 0x00028, 0x08CA1, 0x00029, 0x00028, 0x0795D,
+    0x00029, 0x00028, 0x052B4, 0x00029, 0x00028, 0x04EE3, 0x00029, 0x00028,
+    0x0547C, 0x00029, 0x00028, 0x05B66, 0x00029, 0x00028, 0x076E3, 0x00029,
+    0x00028, 0x04F01, 0x00029, 0x00028, 0x08CC7, 0x00029, 0x00028, 0x05354,
+    0x00029, 0x00028, 0x0796D, 0x00029, 0x00028, 0x04F11, 0x00029, 0x00028,
+    0x081EA, 0x00029, 0x00028, 0x081F3, 0x00029, 0x0554F, 0x05E7C, 0x07B8F,
+    0x00050, 0x00054, 0x00045, 0x00032, 0x00031, 0x00032, 0x00032, 0x00032,
+    0x00033, 0x00032, 0x00034, 0x00032, 0x00035, 0x00032, 0x00036, 0x00032,
+    0x00037, 0x00032, 0x00038, 0x00032, 0x00039, 0x00033, 0x00030, 0x00033,
+    0x00031, 0x00033, 0x00032, 0x00033, 0x00033, 0x00033, 0x00034, 0x00033,
+    0x00035, 0x01100, 0x01161, 0x01102, 0x01161, 0x01103, 0x01161, 0x01105,
+    0x01161, 0x01106, 0x01161, 0x01107, 0x01161, 0x01109, 0x01161, 0x0110B,
+    0x01161, 0x0110C, 0x01161, 0x0110E, 0x01161, 0x0110F, 0x01161, 0x01110,
+    0x01161, 0x01111, 0x01161, 0x01112, 0x01161, 0x0110E, 0x01161, 0x011B7,
+    0x01100, 0x01169, 0x0110C, 0x0116E, 0x0110B, 0x01174, 0x0110B, 0x0116E,
+    0x04E94, 0x0516D, 0x04E03, 0x04E5D, 0x0682A, 0x06709, 0x0793E, 0x0540D,
+    0x07279, 0x08CA1, 0x0795D, 0x052B4, 0x079D8, 0x07537, 0x09069, 0x0512A,
+    0x05370, 0x06CE8, 0x09805, 0x04F11, 0x05199, 0x06B63, 0x05DE6, 0x053F3,
+    0x0533B, 0x05B97, 0x05B66, 0x076E3, 0x04F01, 0x08CC7, 0x05354, 0x0591C,
+    0x00033, 0x00036, 0x00033, 0x00037, 0x00033, 0x00038, 0x00033, 0x00039,
+    0x00034, 0x00030, 0x00034, 0x00031, 0x00034, 0x00032, 0x00034, 0x00033,
+    0x00034, 0x00034, 0x00034, 0x00035, 0x00034, 0x00036, 0x00034, 0x00037,
+    0x00034, 0x00038, 0x00034, 0x00039, 0x00035, 0x00030, 0x00031, 0x06708,
+    0x00032, 0x06708, 0x00033, 0x06708, 0x00034, 0x06708, 0x00035, 0x06708,
+    0x00036, 0x06708, 0x00037, 0x06708, 0x00038, 0x06708, 0x00039, 0x06708,
+    0x00031, 0x00030, 0x06708, 0x00031, 0x00031, 0x06708, 0x00031, 0x00032,
+    0x06708, 0x00048, 0x00067, 0x00065, 0x00072, 0x00067, 0x00065, 0x00056,
+    0x0004C, 0x00054, 0x00044, 0x030A2, 0x030A4, 0x030A6, 0x030A8, 0x030AA,
+    0x030AB, 0x030AD, 0x030AF, 0x030B1, 0x030B3, 0x030B5, 0x030B7, 0x030B9,
+    0x030BB, 0x030BD, 0x030BF, 0x030C1, 0x030C4, 0x030C6, 0x030C8, 0x030CA,
+    0x030CB, 0x030CC, 0x030CD, 0x030CE, 0x030CF, 0x030D2, 0x030D5, 0x030D8,
+    0x030DB, 0x030DE, 0x030DF, 0x030E0, 0x030E1, 0x030E2, 0x030E4, 0x030E6,
+    0x030E8, 0x030E9, 0x030EA, 0x030EB, 0x030EC, 0x030ED, 0x030EF, 0x030F0,
+    0x030F1, 0x030F2, 0x04EE4, 0x0548C, 0x030A2, 0x030CF, 0x0309A, 0x030FC,
+    0x030C8, 0x030A2, 0x030EB, 0x030D5, 0x030A1, 0x030A2, 0x030F3, 0x030D8,
+    0x0309A, 0x030A2, 0x030A2, 0x030FC, 0x030EB, 0x030A4, 0x030CB, 0x030F3,
+    0x030AF, 0x03099, 0x030A4, 0x030F3, 0x030C1, 0x030A6, 0x030A9, 0x030F3,
+    0x030A8, 0x030B9, 0x030AF, 0x030FC, 0x030C8, 0x03099, 0x030A8, 0x030FC,
+    0x030AB, 0x030FC, 0x030AA, 0x030F3, 0x030B9, 0x030AA, 0x030FC, 0x030E0,
+    0x030AB, 0x030A4, 0x030EA, 0x030AB, 0x030E9, 0x030C3, 0x030C8, 0x030AB,
+    0x030ED, 0x030EA, 0x030FC, 0x030AB, 0x03099, 0x030ED, 0x030F3, 0x030AB,
+    0x03099, 0x030F3, 0x030DE, 0x030AD, 0x03099, 0x030AB, 0x03099, 0x030AD,
+    0x03099, 0x030CB, 0x030FC, 0x030AD, 0x030E5, 0x030EA, 0x030FC, 0x030AD,
+    0x03099, 0x030EB, 0x030BF, 0x03099, 0x030FC, 0x030AD, 0x030ED, 0x030AD,
+    0x030ED, 0x030AF, 0x03099, 0x030E9, 0x030E0, 0x030AD, 0x030ED, 0x030E1,
+    0x030FC, 0x030C8, 0x030EB, 0x030AD, 0x030ED, 0x030EF, 0x030C3, 0x030C8,
+    0x030AF, 0x03099, 0x030E9, 0x030E0, 0x030AF, 0x03099, 0x030E9, 0x030E0,
+    0x030C8, 0x030F3, 0x030AF, 0x030EB, 0x030BB, 0x03099, 0x030A4, 0x030ED,
+    0x030AF, 0x030ED, 0x030FC, 0x030CD, 0x030B1, 0x030FC, 0x030B9, 0x030B3,
+    0x030EB, 0x030CA, 0x030B3, 0x030FC, 0x030DB, 0x0309A, 0x030B5, 0x030A4,
+    0x030AF, 0x030EB, 0x030B5, 0x030F3, 0x030C1, 0x030FC, 0x030E0, 0x030B7,
+    0x030EA, 0x030F3, 0x030AF, 0x03099, 0x030BB, 0x030F3, 0x030C1, 0x030BB,
+    0x030F3, 0x030C8, 0x030BF, 0x03099, 0x030FC, 0x030B9, 0x030C6, 0x03099,
+    0x030B7, 0x030C8, 0x03099, 0x030EB, 0x030C8, 0x030F3, 0x030CA, 0x030CE,
+    0x030CE, 0x030C3, 0x030C8, 0x030CF, 0x030A4, 0x030C4, 0x030CF, 0x0309A,
+    0x030FC, 0x030BB, 0x030F3, 0x030C8, 0x030CF, 0x0309A, 0x030FC, 0x030C4,
+    0x030CF, 0x03099, 0x030FC, 0x030EC, 0x030EB, 0x030D2, 0x0309A, 0x030A2,
+    0x030B9, 0x030C8, 0x030EB, 0x030D2, 0x0309A, 0x030AF, 0x030EB, 0x030D2,
+    0x0309A, 0x030B3, 0x030D2, 0x03099, 0x030EB, 0x030D5, 0x030A1, 0x030E9,
+    0x030C3, 0x030C8, 0x03099, 0x030D5, 0x030A3, 0x030FC, 0x030C8, 0x030D5,
+    0x03099, 0x030C3, 0x030B7, 0x030A7, 0x030EB, 0x030D5, 0x030E9, 0x030F3,
+    0x030D8, 0x030AF, 0x030BF, 0x030FC, 0x030EB, 0x030D8, 0x0309A, 0x030BD,
+    0x030D8, 0x0309A, 0x030CB, 0x030D2, 0x030D8, 0x030EB, 0x030C4, 0x030D8,
+    0x0309A, 0x030F3, 0x030B9, 0x030D8, 0x0309A, 0x030FC, 0x030B7, 0x03099,
+    0x030D8, 0x03099, 0x030FC, 0x030BF, 0x030DB, 0x0309A, 0x030A4, 0x030F3,
+    0x030C8, 0x030DB, 0x03099, 0x030EB, 0x030C8, 0x030DB, 0x030F3, 0x030DB,
+    0x0309A, 0x030F3, 0x030C8, 0x03099, 0x030DB, 0x030FC, 0x030EB, 0x030DB,
+    0x030FC, 0x030F3, 0x030DE, 0x030A4, 0x030AF, 0x030ED, 0x030DE, 0x030A4,
+    0x030EB, 0x030DE, 0x030C3, 0x030CF, 0x030DE, 0x030EB, 0x030AF, 0x030DE,
+    0x030F3, 0x030B7, 0x030E7, 0x030F3, 0x030DF, 0x030AF, 0x030ED, 0x030F3,
+    0x030DF, 0x030EA, 0x030DF, 0x030EA, 0x030CF, 0x03099, 0x030FC, 0x030EB,
+    0x030E1, 0x030AB, 0x03099, 0x030E1, 0x030AB, 0x03099, 0x030C8, 0x030F3,
+    0x030E1, 0x030FC, 0x030C8, 0x030EB, 0x030E4, 0x030FC, 0x030C8, 0x03099,
+    0x030E4, 0x030FC, 0x030EB, 0x030E6, 0x030A2, 0x030F3, 0x030EA, 0x030C3,
+    0x030C8, 0x030EB, 0x030EA, 0x030E9, 0x030EB, 0x030D2, 0x0309A, 0x030FC,
+    0x030EB, 0x030FC, 0x030D5, 0x03099, 0x030EB, 0x030EC, 0x030E0, 0x030EC,
+    0x030F3, 0x030C8, 0x030B1, 0x03099, 0x030F3, 0x030EF, 0x030C3, 0x030C8,
+    0x00030, 0x070B9, 0x00031, 0x070B9, 0x00032, 0x070B9, 0x00033, 0x070B9,
+    0x00034, 0x070B9, 0x00035, 0x070B9, 0x00036, 0x070B9, 0x00037, 0x070B9,
+    0x00038, 0x070B9, 0x00039, 0x070B9, 0x00031, 0x00030, 0x070B9, 0x00031,
+    0x00031, 0x070B9, 0x00031, 0x00032, 0x070B9, 0x00031, 0x00033, 0x070B9,
+    0x00031, 0x00034, 0x070B9, 0x00031, 0x00035, 0x070B9, 0x00031, 0x00036,
+    0x070B9, 0x00031, 0x00037, 0x070B9, 0x00031, 0x00038, 0x070B9, 0x00031,
+    0x00039, 0x070B9, 0x00032, 0x00030, 0x070B9, 0x00032, 0x00031, 0x070B9,
+    0x00032, 0x00032, 0x070B9, 0x00032, 0x00033, 0x070B9, 0x00032, 0x00034,
+    0x070B9, 0x00068, 0x00050, 0x00061, 0x00064, 0x00061, 0x00041, 0x00055,
+    0x00062, 0x00061, 0x00072, 0x0006F, 0x00056, 0x00070, 0x00063, 0x00064,
+    0x0006D, 0x00064, 0x0006D, 0x00032, 0x00064, 0x0006D, 0x00033, 0x00049,
+    0x00055, 0x05E73, 0x06210, 0x0662D, 0x0548C, 0x05927, 0x06B63, 0x0660E,
+    0x06CBB, 0x0682A, 0x05F0F, 0x04F1A, 0x0793E, 0x00070, 0x00041, 0x0006E,
+    0x00041, 0x003BC, 0x00041, 0x0006D, 0x00041, 0x0006B, 0x00041, 0x0004B,
+    0x00042, 0x0004D, 0x00042, 0x00047, 0x00042, 0x00063, 0x00061, 0x0006C,
+    0x0006B, 0x00063, 0x00061, 0x0006C, 0x00070, 0x00046, 0x0006E, 0x00046,
+    0x003BC, 0x00046, 0x003BC, 0x00067, 0x0006D, 0x00067, 0x0006B, 0x00067,
+    0x00048, 0x0007A, 0x0006B, 0x00048, 0x0007A, 0x0004D, 0x00048, 0x0007A,
+    0x00047, 0x00048, 0x0007A, 0x00054, 0x00048, 0x0007A, 0x003BC, 0x0006C,
+    0x0006D, 0x0006C, 0x00064, 0x0006C, 0x0006B, 0x0006C, 0x00066, 0x0006D,
+    0x0006E, 0x0006D, 0x003BC, 0x0006D, 0x0006D, 0x0006D, 0x00063, 0x0006D,
+    0x0006B, 0x0006D, 0x0006D, 0x0006D, 0x00032, 0x00063, 0x0006D, 0x00032,
+    0x0006D, 0x00032, 0x0006B, 0x0006D, 0x00032, 0x0006D, 0x0006D, 0x00033,
+    0x00063, 0x0006D, 0x00033, 0x0006D, 0x00033, 0x0006B, 0x0006D, 0x00033,
+    0x0006D, 0x02215, 0x00073, 0x0006D, 0x02215, 0x00073, 0x00032, 0x00050,
+    0x00061, 0x0006B, 0x00050, 0x00061, 0x0004D, 0x00050, 0x00061, 0x00047,
+    0x00050, 0x00061, 0x00072, 0x00061, 0x00064, 0x00072, 0x00061, 0x00064,
+    0x02215, 0x00073, 0x00072, 0x00061, 0x00064, 0x02215, 0x00073, 0x00032,
+    0x00070, 0x00073, 0x0006E, 0x00073, 0x003BC, 0x00073, 0x0006D, 0x00073,
+    0x00070, 0x00056, 0x0006E, 0x00056, 0x003BC, 0x00056, 0x0006D, 0x00056,
+    0x0006B, 0x00056, 0x0004D, 0x00056, 0x00070, 0x00057, 0x0006E, 0x00057,
+    0x003BC, 0x00057, 0x0006D, 0x00057, 0x0006B, 0x00057, 0x0004D, 0x00057,
+    0x0006B, 0x003A9, 0x0004D, 0x003A9, 0x00061, 0x0002E, 0x0006D, 0x0002E,
+    0x00042, 0x00071, 0x00063, 0x00063, 0x00063, 0x00064, 0x00043, 0x02215,
+    0x0006B, 0x00067, 0x00043, 0x0006F, 0x0002E, 0x00064, 0x00042, 0x00047,
+    0x00079, 0x00068, 0x00061, 0x00048, 0x00050, 0x00069, 0x0006E, 0x0004B,
+    0x0004B, 0x0004B, 0x0004D, 0x0006B, 0x00074, 0x0006C, 0x0006D, 0x0006C,
+    0x0006E, 0x0006C, 0x0006F, 0x00067, 0x0006C, 0x00078, 0x0006D, 0x00062,
+    0x0006D, 0x00069, 0x0006C, 0x0006D, 0x0006F, 0x0006C, 0x00050, 0x00048,
+    0x00070, 0x0002E, 0x0006D, 0x0002E, 0x00050, 0x00050, 0x0004D, 0x00050,
+    0x00052, 0x00073, 0x00072, 0x00053, 0x00076, 0x00057, 0x00062, 0x00056,
+    0x02215, 0x0006D, 0x00041, 0x02215, 0x0006D, 0x00031, 0x065E5, 0x00032,
+    0x065E5, 0x00033, 0x065E5, 0x00034, 0x065E5, 0x00035, 0x065E5, 0x00036,
+    0x065E5, 0x00037, 0x065E5, 0x00038, 0x065E5, 0x00039, 0x065E5, 0x00031,
+    0x00030, 0x065E5, 0x00031, 0x00031, 0x065E5, 0x00031, 0x00032, 0x065E5,
+    0x00031, 0x00033, 0x065E5, 0x00031, 0x00034, 0x065E5, 0x00031, 0x00035,
+    0x065E5, 0x00031, 0x00036, 0x065E5, 0x00031, 0x00037, 0x065E5, 0x00031,
+    0x00038, 0x065E5, 0x00031, 0x00039, 0x065E5, 0x00032, 0x00030, 0x065E5,
+    0x00032, 0x00031, 0x065E5, 0x00032, 0x00032, 0x065E5, 0x00032, 0x00033,
+    0x065E5, 0x00032, 0x00034, 0x065E5, 0x00032, 0x00035, 0x065E5, 0x00032,
+    0x00036, 0x065E5, 0x00032, 0x00037, 0x065E5, 0x00032, 0x00038, 0x065E5,
+    0x00032, 0x00039, 0x065E5, 0x00033, 0x00030, 0x065E5, 0x00033, 0x00031,
+    0x065E5, 0x00067, 0x00061, 0x0006C, 0x0044A, 0x0044C, 0x0A76F, 0x00126,
+    0x00153, 0x0A727, 0x0AB37, 0x0026B, 0x0AB52, 0x0028D, 0x08C48, 0x066F4,
+    0x08CC8, 0x06ED1, 0x04E32, 0x053E5, 0x05951, 0x05587, 0x05948, 0x061F6,
+    0x07669, 0x07F85, 0x0863F, 0x087BA, 0x088F8, 0x0908F, 0x06A02, 0x06D1B,
+    0x070D9, 0x073DE, 0x0843D, 0x0916A, 0x099F1, 0x04E82, 0x05375, 0x06B04,
+    0x0721B, 0x0862D, 0x09E1E, 0x05D50, 0x06FEB, 0x085CD, 0x08964, 0x062C9,
+    0x081D8, 0x0881F, 0x05ECA, 0x06717, 0x06D6A, 0x072FC, 0x090CE, 0x04F86,
+    0x051B7, 0x052DE, 0x064C4, 0x06AD3, 0x07210, 0x076E7, 0x08606, 0x0865C,
+    0x08DEF, 0x09732, 0x09B6F, 0x09DFA, 0x0788C, 0x0797F, 0x07DA0, 0x083C9,
+    0x09304, 0x08AD6, 0x058DF, 0x05F04, 0x07C60, 0x0807E, 0x07262, 0x078CA,
+    0x08CC2, 0x096F7, 0x058D8, 0x05C62, 0x06A13, 0x06DDA, 0x06F0F, 0x07D2F,
+    0x07E37, 0x0964B, 0x052D2, 0x0808B, 0x051DC, 0x051CC, 0x07A1C, 0x07DBE,
+    0x083F1, 0x09675, 0x08B80, 0x062CF, 0x08AFE, 0x04E39, 0x05BE7, 0x06012,
+    0x07387, 0x07570, 0x05317, 0x078FB, 0x04FBF, 0x05FA9, 0x04E0D, 0x06CCC,
+    0x06578, 0x07D22, 0x053C3, 0x0585E, 0x07701, 0x08449, 0x08AAA, 0x06BBA,
+    0x06C88, 0x062FE, 0x082E5, 0x063A0, 0x07565, 0x04EAE, 0x05169, 0x051C9,
+    0x06881, 0x07CE7, 0x0826F, 0x08AD2, 0x091CF, 0x052F5, 0x05442, 0x05EEC,
+    0x065C5, 0x06FFE, 0x0792A, 0x095AD, 0x09A6A, 0x09E97, 0x09ECE, 0x066C6,
+    0x06B77, 0x08F62, 0x05E74, 0x06190, 0x06200, 0x0649A, 0x06F23, 0x07149,
+    0x07489, 0x079CA, 0x07DF4, 0x0806F, 0x08F26, 0x084EE, 0x09023, 0x0934A,
+    0x05217, 0x052A3, 0x054BD, 0x070C8, 0x088C2, 0x05EC9, 0x05FF5, 0x0637B,
+    0x06BAE, 0x07C3E, 0x07375, 0x04EE4, 0x056F9, 0x05DBA, 0x0601C, 0x073B2,
+    0x07469, 0x07F9A, 0x08046, 0x09234, 0x096F6, 0x09748, 0x09818, 0x04F8B,
+    0x079AE, 0x091B4, 0x096B8, 0x060E1, 0x04E86, 0x050DA, 0x05BEE, 0x05C3F,
+    0x06599, 0x071CE, 0x07642, 0x084FC, 0x0907C, 0x06688, 0x0962E, 0x05289,
+    0x0677B, 0x067F3, 0x06D41, 0x06E9C, 0x07409, 0x07559, 0x0786B, 0x07D10,
+    0x0985E, 0x0622E, 0x09678, 0x0502B, 0x05D19, 0x06DEA, 0x08F2A, 0x05F8B,
+    0x06144, 0x06817, 0x09686, 0x05229, 0x0540F, 0x05C65, 0x06613, 0x0674E,
+    0x068A8, 0x06CE5, 0x07406, 0x075E2, 0x07F79, 0x088CF, 0x088E1, 0x096E2,
+    0x0533F, 0x06EBA, 0x0541D, 0x071D0, 0x07498, 0x085FA, 0x096A3, 0x09C57,
+    0x09E9F, 0x06797, 0x06DCB, 0x081E8, 0x07B20, 0x07C92, 0x072C0, 0x07099,
+    0x08B58, 0x04EC0, 0x08336, 0x0523A, 0x05207, 0x05EA6, 0x062D3, 0x07CD6,
+    0x05B85, 0x06D1E, 0x066B4, 0x08F3B, 0x0964D, 0x05ED3, 0x05140, 0x055C0,
+    0x0585A, 0x06674, 0x051DE, 0x0732A, 0x076CA, 0x0793C, 0x0795E, 0x07965,
+    0x0798F, 0x09756, 0x07CBE, 0x08612, 0x08AF8, 0x09038, 0x090FD, 0x098EF,
+    0x098FC, 0x09928, 0x09DB4, 0x090DE, 0x096B7, 0x04FAE, 0x050E7, 0x0514D,
+    0x052C9, 0x052E4, 0x05351, 0x0559D, 0x05606, 0x05668, 0x05840, 0x058A8,
+    0x05C64, 0x06094, 0x06168, 0x0618E, 0x061F2, 0x0654F, 0x065E2, 0x06691,
+    0x06885, 0x06D77, 0x06E1A, 0x06F22, 0x0716E, 0x0722B, 0x07422, 0x07891,
+    0x07949, 0x07948, 0x07950, 0x07956, 0x0798D, 0x0798E, 0x07A40, 0x07A81,
+    0x07BC0, 0x07E09, 0x07E41, 0x07F72, 0x08005, 0x081ED, 0x08279, 0x08457,
+    0x08910, 0x08996, 0x08B01, 0x08B39, 0x08CD3, 0x08D08, 0x08FB6, 0x096E3,
+    0x097FF, 0x0983B, 0x06075, 0x242EE, 0x08218, 0x04E26, 0x051B5, 0x05168,
+    0x04F80, 0x05145, 0x05180, 0x052C7, 0x052FA, 0x05555, 0x05599, 0x055E2,
+    0x058B3, 0x05944, 0x05954, 0x05A62, 0x05B28, 0x05ED2, 0x05ED9, 0x05F69,
+    0x05FAD, 0x060D8, 0x0614E, 0x06108, 0x06160, 0x06234, 0x063C4, 0x0641C,
+    0x06452, 0x06556, 0x0671B, 0x06756, 0x06EDB, 0x06ECB, 0x0701E, 0x077A7,
+    0x07235, 0x072AF, 0x07471, 0x07506, 0x0753B, 0x0761D, 0x0761F, 0x076DB,
+    0x076F4, 0x0774A, 0x07740, 0x078CC, 0x07AB1, 0x07C7B, 0x07D5B, 0x07F3E,
+    0x08352, 0x083EF, 0x08779, 0x08941, 0x08986, 0x08ABF, 0x08ACB, 0x08AED,
+    0x08B8A, 0x08F38, 0x09072, 0x09199, 0x09276, 0x0967C, 0x097DB, 0x0980B,
+    0x09B12, 0x2284A, 0x22844, 0x233D5, 0x03B9D, 0x04018, 0x04039, 0x25249,
+    0x25CD0, 0x27ED3, 0x09F43, 0x09F8E, 0x00066, 0x00066, 0x00066, 0x00069,
+    0x00066, 0x0006C, 0x00066, 0x00066, 0x00069, 0x00066, 0x00066, 0x0006C,
+    0x00073, 0x00074, 0x00574, 0x00576, 0x00574, 0x00565, 0x00574, 0x0056B,
+    0x0057E, 0x00576, 0x00574, 0x0056D, 0x005D9, 0x005B4, 0x005F2, 0x005B7,
+    0x005E2, 0x005D4, 0x005DB, 0x005DC, 0x005DD, 0x005E8, 0x005EA, 0x005E9,
+    0x005C1, 0x005E9, 0x005C2, 0x005E9, 0x005BC, 0x005C1, 0x005E9, 0x005BC,
+    0x005C2, 0x005D0, 0x005B7, 0x005D0, 0x005B8, 0x005D0, 0x005BC, 0x005D1,
+    0x005BC, 0x005D2, 0x005BC, 0x005D3, 0x005BC, 0x005D4, 0x005BC, 0x005D5,
+    0x005BC, 0x005D6, 0x005BC, 0x005D8, 0x005BC, 0x005D9, 0x005BC, 0x005DA,
+    0x005BC, 0x005DB, 0x005BC, 0x005DC, 0x005BC, 0x005DE, 0x005BC, 0x005E0,
+    0x005BC, 0x005E1, 0x005BC, 0x005E3, 0x005BC, 0x005E4, 0x005BC, 0x005E6,
+    0x005BC, 0x005E7, 0x005BC, 0x005E8, 0x005BC, 0x005E9, 0x005BC, 0x005EA,
+    0x005BC, 0x005D5, 0x005B9, 0x005D1, 0x005BF, 0x005DB, 0x005BF, 0x005E4,
+    0x005BF, 0x005D0, 0x005DC, 0x00671, 0x0067B, 0x0067E, 0x00680, 0x0067A,
+    0x0067F, 0x00679, 0x006A4, 0x006A6, 0x00684, 0x00683, 0x00686, 0x00687,
+    0x0068D, 0x0068C, 0x0068E, 0x00688, 0x00698, 0x00691, 0x006A9, 0x006AF,
+    0x006B3, 0x006B1, 0x006BA, 0x006BB, 0x006C1, 0x006BE, 0x006D2, 0x006AD,
+    0x006C7, 0x006C6, 0x006C8, 0x006CB, 0x006C5, 0x006C9, 0x006D0, 0x00649,
+    0x0064A, 0x00654, 0x00627, 0x0064A, 0x00654, 0x006D5, 0x0064A, 0x00654,
+    0x00648, 0x0064A, 0x00654, 0x006C7, 0x0064A, 0x00654, 0x006C6, 0x0064A,
+    0x00654, 0x006C8, 0x0064A, 0x00654, 0x006D0, 0x0064A, 0x00654, 0x00649,
+    0x006CC, 0x0064A, 0x00654, 0x0062C, 0x0064A, 0x00654, 0x0062D, 0x0064A,
+    0x00654, 0x00645, 0x0064A, 0x00654, 0x0064A, 0x00628, 0x0062C, 0x00628,
+    0x0062D, 0x00628, 0x0062E, 0x00628, 0x00645, 0x00628, 0x00649, 0x00628,
+    0x0064A, 0x0062A, 0x0062C, 0x0062A, 0x0062D, 0x0062A, 0x0062E, 0x0062A,
+    0x00645, 0x0062A, 0x00649, 0x0062A, 0x0064A, 0x0062B, 0x0062C, 0x0062B,
+    0x00645, 0x0062B, 0x00649, 0x0062B, 0x0064A, 0x0062C, 0x0062D, 0x0062C,
+    0x00645, 0x0062D, 0x0062C, 0x0062D, 0x00645, 0x0062E, 0x0062C, 0x0062E,
+    0x0062D, 0x0062E, 0x00645, 0x00633, 0x0062C, 0x00633, 0x0062D, 0x00633,
+    0x0062E, 0x00633, 0x00645, 0x00635, 0x0062D, 0x00635, 0x00645, 0x00636,
+    0x0062C, 0x00636, 0x0062D, 0x00636, 0x0062E, 0x00636, 0x00645, 0x00637,
+    0x0062D, 0x00637, 0x00645, 0x00638, 0x00645, 0x00639, 0x0062C, 0x00639,
+    0x00645, 0x0063A, 0x0062C, 0x0063A, 0x00645, 0x00641, 0x0062C, 0x00641,
+    0x0062D, 0x00641, 0x0062E, 0x00641, 0x00645, 0x00641, 0x00649, 0x00641,
+    0x0064A, 0x00642, 0x0062D, 0x00642, 0x00645, 0x00642, 0x00649, 0x00642,
+    0x0064A, 0x00643, 0x00627, 0x00643, 0x0062C, 0x00643, 0x0062D, 0x00643,
+    0x0062E, 0x00643, 0x00644, 0x00643, 0x00645, 0x00643, 0x00649, 0x00643,
+    0x0064A, 0x00644, 0x0062C, 0x00644, 0x0062D, 0x00644, 0x0062E, 0x00644,
+    0x00645, 0x00644, 0x00649, 0x00644, 0x0064A, 0x00645, 0x0062C, 0x00645,
+    0x0062D, 0x00645, 0x0062E, 0x00645, 0x00645, 0x00645, 0x00649, 0x00645,
+    0x0064A, 0x00646, 0x0062C, 0x00646, 0x0062D, 0x00646, 0x0062E, 0x00646,
+    0x00645, 0x00646, 0x00649, 0x00646, 0x0064A, 0x00647, 0x0062C, 0x00647,
+    0x00645, 0x00647, 0x00649, 0x00647, 0x0064A, 0x0064A, 0x0062C, 0x0064A,
+    0x0062D, 0x0064A, 0x0062E, 0x0064A, 0x00645, 0x0064A, 0x00649, 0x0064A,
+    0x0064A, 0x00630, 0x00670, 0x00631, 0x00670, 0x00649, 0x00670, 0x00020,
+    0x0064C, 0x00651, 0x00020, 0x0064D, 0x00651, 0x00020, 0x0064E, 0x00651,
+    0x00020, 0x0064F, 0x00651, 0x00020, 0x00650, 0x00651, 0x00020, 0x00651,
+    0x00670, 0x0064A, 0x00654, 0x00631, 0x0064A, 0x00654, 0x00632, 0x0064A,
+    0x00654, 0x00646, 0x00628, 0x00631, 0x00628, 0x00632, 0x00628, 0x00646,
+    0x0062A, 0x00631, 0x0062A, 0x00632, 0x0062A, 0x00646, 0x0062B, 0x00631,
+    0x0062B, 0x00632, 0x0062B, 0x00646, 0x00645, 0x00627, 0x00646, 0x00631,
+    0x00646, 0x00632, 0x00646, 0x00646, 0x0064A, 0x00631, 0x0064A, 0x00632,
+    0x0064A, 0x00646, 0x0064A, 0x00654, 0x0062E, 0x0064A, 0x00654, 0x00647,
+    0x00628, 0x00647, 0x0062A, 0x00647, 0x00635, 0x0062E, 0x00644, 0x00647,
+    0x00646, 0x00647, 0x00647, 0x00670, 0x0064A, 0x00647, 0x0062B, 0x00647,
+    0x00633, 0x00647, 0x00634, 0x00645, 0x00634, 0x00647, 0x00640, 0x0064E,
+    0x00651, 0x00640, 0x0064F, 0x00651, 0x00640, 0x00650, 0x00651, 0x00637,
+    0x00649, 0x00637, 0x0064A, 0x00639, 0x00649, 0x00639, 0x0064A, 0x0063A,
+    0x00649, 0x0063A, 0x0064A, 0x00633, 0x00649, 0x00633, 0x0064A, 0x00634,
+    0x00649, 0x00634, 0x0064A, 0x0062D, 0x00649, 0x0062D, 0x0064A, 0x0062C,
+    0x00649, 0x0062C, 0x0064A, 0x0062E, 0x00649, 0x0062E, 0x0064A, 0x00635,
+    0x00649, 0x00635, 0x0064A, 0x00636, 0x00649, 0x00636, 0x0064A, 0x00634,
+    0x0062C, 0x00634, 0x0062D, 0x00634, 0x0062E, 0x00634, 0x00631, 0x00633,
+    0x00631, 0x00635, 0x00631, 0x00636, 0x00631, 0x00627, 0x0064B, 0x0062A,
+    0x0062C, 0x00645, 0x0062A, 0x0062D, 0x0062C, 0x0062A, 0x0062D, 0x00645,
+    0x0062A, 0x0062E, 0x00645, 0x0062A, 0x00645, 0x0062C, 0x0062A, 0x00645,
+    0x0062D, 0x0062A, 0x00645, 0x0062E, 0x0062C, 0x00645, 0x0062D, 0x0062D,
+    0x00645, 0x0064A, 0x0062D, 0x00645, 0x00649, 0x00633, 0x0062D, 0x0062C,
+    0x00633, 0x0062C, 0x0062D, 0x00633, 0x0062C, 0x00649, 0x00633, 0x00645,
+    0x0062D, 0x00633, 0x00645, 0x0062C, 0x00633, 0x00645, 0x00645, 0x00635,
+    0x0062D, 0x0062D, 0x00635, 0x00645, 0x00645, 0x00634, 0x0062D, 0x00645,
+    0x00634, 0x0062C, 0x0064A, 0x00634, 0x00645, 0x0062E, 0x00634, 0x00645,
+    0x00645, 0x00636, 0x0062D, 0x00649, 0x00636, 0x0062E, 0x00645, 0x00637,
+    0x00645, 0x0062D, 0x00637, 0x00645, 0x00645, 0x00637, 0x00645, 0x0064A,
+    0x00639, 0x0062C, 0x00645, 0x00639, 0x00645, 0x00645, 0x00639, 0x00645,
+    0x00649, 0x0063A, 0x00645, 0x00645, 0x0063A, 0x00645, 0x0064A, 0x0063A,
+    0x00645, 0x00649, 0x00641, 0x0062E, 0x00645, 0x00642, 0x00645, 0x0062D,
+    0x00642, 0x00645, 0x00645, 0x00644, 0x0062D, 0x00645, 0x00644, 0x0062D,
+    0x0064A, 0x00644, 0x0062D, 0x00649, 0x00644, 0x0062C, 0x0062C, 0x00644,
+    0x0062E, 0x00645, 0x00644, 0x00645, 0x0062D, 0x00645, 0x0062D, 0x0062C,
+    0x00645, 0x0062D, 0x00645, 0x00645, 0x0062D, 0x0064A, 0x00645, 0x0062C,
+    0x0062D, 0x00645, 0x0062C, 0x00645, 0x00645, 0x0062E, 0x0062C, 0x00645,
+    0x0062E, 0x00645, 0x00645, 0x0062C, 0x0062E, 0x00647, 0x00645, 0x0062C,
+    0x00647, 0x00645, 0x00645, 0x00646, 0x0062D, 0x00645, 0x00646, 0x0062D,
+    0x00649, 0x00646, 0x0062C, 0x00645, 0x00646, 0x0062C, 0x00649, 0x00646,
+    0x00645, 0x0064A, 0x00646, 0x00645, 0x00649, 0x0064A, 0x00645, 0x00645,
+    0x00628, 0x0062E, 0x0064A, 0x0062A, 0x0062C, 0x0064A, 0x0062A, 0x0062C,
+    0x00649, 0x0062A, 0x0062E, 0x0064A, 0x0062A, 0x0062E, 0x00649, 0x0062A,
+    0x00645, 0x0064A, 0x0062A, 0x00645, 0x00649, 0x0062C, 0x00645, 0x0064A,
+    0x0062C, 0x0062D, 0x00649, 0x0062C, 0x00645, 0x00649, 0x00633, 0x0062E,
+    0x00649, 0x00635, 0x0062D, 0x0064A, 0x00634, 0x0062D, 0x0064A, 0x00636,
+    0x0062D, 0x0064A, 0x00644, 0x0062C, 0x0064A, 0x00644, 0x00645, 0x0064A,
+    0x0064A, 0x0062D, 0x0064A, 0x0064A, 0x0062C, 0x0064A, 0x0064A, 0x00645,
+    0x0064A, 0x00645, 0x00645, 0x0064A, 0x00642, 0x00645, 0x0064A, 0x00646,
+    0x0062D, 0x0064A, 0x00639, 0x00645, 0x0064A, 0x00643, 0x00645, 0x0064A,
+    0x00646, 0x0062C, 0x0062D, 0x00645, 0x0062E, 0x0064A, 0x00644, 0x0062C,
+    0x00645, 0x00643, 0x00645, 0x00645, 0x0062C, 0x0062D, 0x0064A, 0x0062D,
+    0x0062C, 0x0064A, 0x00645, 0x0062C, 0x0064A, 0x00641, 0x00645, 0x0064A,
+    0x00628, 0x0062D, 0x0064A, 0x00633, 0x0062E, 0x0064A, 0x00646, 0x0062C,
+    0x0064A, 0x00635, 0x00644, 0x006D2, 0x00642, 0x00644, 0x006D2, 0x00627,
+    0x00644, 0x00644, 0x00647, 0x00627, 0x00643, 0x00628, 0x00631, 0x00645,
+    0x0062D, 0x00645, 0x0062F, 0x00635, 0x00644, 0x00639, 0x00645, 0x00631,
+    0x00633, 0x00648, 0x00644, 0x00639, 0x00644, 0x0064A, 0x00647, 0x00648,
+    0x00633, 0x00644, 0x00645, 0x00635, 0x00644, 0x00649, 0x00635, 0x00644,
+    0x00649, 0x00020, 0x00627, 0x00644, 0x00644, 0x00647, 0x00020, 0x00639,
+    0x00644, 0x0064A, 0x00647, 0x00020, 0x00648, 0x00633, 0x00644, 0x00645,
+    0x0062C, 0x00644, 0x00020, 0x0062C, 0x00644, 0x00627, 0x00644, 0x00647,
+    0x00631, 0x006CC, 0x00627, 0x00644, 0x0002C, 0x03001, 0x03002, 0x0003A,
+    0x00021, 0x0003F, 0x03016, 0x03017, 0x02014, 0x02013, 0x0005F, 0x0007B,
+    0x0007D, 0x03014, 0x03015, 0x03010, 0x03011, 0x0300A, 0x0300B, 0x0300C,
+    0x0300D, 0x0300E, 0x0300F, 0x0005B, 0x0005D, 0x00023, 0x00026, 0x0002A,
+    0x0002D, 0x0003C, 0x0003E, 0x0005C, 0x00024, 0x00025, 0x00040, 0x00020,
+    0x0064B, 0x00640, 0x0064B, 0x00020, 0x0064C, 0x00020, 0x0064D, 0x00020,
+    0x0064E, 0x00640, 0x0064E, 0x00020, 0x0064F, 0x00640, 0x0064F, 0x00020,
+    0x00650, 0x00640, 0x00650, 0x00020, 0x00651, 0x00640, 0x00651, 0x00020,
+    0x00652, 0x00640, 0x00652, 0x00621, 0x00627, 0x00628, 0x00629, 0x0062A,
+    0x0062B, 0x0062C, 0x0062D, 0x0062E, 0x0062F, 0x00630, 0x00631, 0x00632,
+    0x00633, 0x00634, 0x00635, 0x00636, 0x00637, 0x00638, 0x00639, 0x0063A,
+    0x00641, 0x00642, 0x00643, 0x00644, 0x00645, 0x00646, 0x00647, 0x00648,
+    0x0064A, 0x00644, 0x00627, 0x00653, 0x00644, 0x00627, 0x00654, 0x00644,
+    0x00627, 0x00655, 0x00644, 0x00627, 0x00022, 0x00027, 0x0002F, 0x0005E,
+    0x0007C, 0x0007E, 0x02985, 0x02986, 0x030FB, 0x030A1, 0x030A3, 0x030A5,
+    0x030A7, 0x030A9, 0x030E3, 0x030E5, 0x030E7, 0x030C3, 0x030FC, 0x030F3,
+    0x03099, 0x0309A, 0x000A2, 0x000A3, 0x000AC, 0x000A6, 0x000A5, 0x020A9,
+    0x02502, 0x02190, 0x02191, 0x02192, 0x02193, 0x025A0, 0x025CB, 0x002D0,
+    0x002D1, 0x000E6, 0x00299, 0x00253, 0x002A3, 0x0AB66, 0x002A5, 0x002A4,
+    0x00256, 0x00257, 0x01D91, 0x00258, 0x0025E, 0x002A9, 0x00264, 0x00262,
+    0x00260, 0x0029B, 0x0029C, 0x00267, 0x00284, 0x002AA, 0x002AB, 0x0026C,
+    0x1DF04, 0x0A78E, 0x0026E, 0x1DF05, 0x0028E, 0x1DF06, 0x000F8, 0x00276,
+    0x00277, 0x0027A, 0x1DF08, 0x0027D, 0x0027E, 0x00280, 0x002A8, 0x002A6,
+    0x0AB67, 0x002A7, 0x00288, 0x02C71, 0x0028F, 0x002A1, 0x002A2, 0x00298,
+    0x001C0, 0x001C1, 0x001C2, 0x1DF0A, 0x1DF1E, 0x11099, 0x110BA, 0x1109B,
+    0x110BA, 0x110A5, 0x110BA, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347,
+    0x1133E, 0x11347, 0x11357, 0x114B9, 0x114BA, 0x114B9, 0x114B0, 0x114B9,
+    0x114BD, 0x115B8, 0x115AF, 0x115B9, 0x115AF, 0x11935, 0x11930, 0x1D157,
+    0x1D165, 0x1D158, 0x1D165, 0x1D158, 0x1D165, 0x1D16E, 0x1D158, 0x1D165,
+    0x1D16F, 0x1D158, 0x1D165, 0x1D170, 0x1D158, 0x1D165, 0x1D171, 0x1D158,
+    0x1D165, 0x1D172, 0x1D1B9, 0x1D165, 0x1D1BA, 0x1D165, 0x1D1B9, 0x1D165,
+    0x1D16E, 0x1D1BA, 0x1D165, 0x1D16E, 0x1D1B9, 0x1D165, 0x1D16F, 0x1D1BA,
+    0x1D165, 0x1D16F, 0x00131, 0x00237, 0x00391, 0x00392, 0x00394, 0x00395,
+    0x00396, 0x00397, 0x00399, 0x0039A, 0x0039B, 0x0039C, 0x0039D, 0x0039E,
+    0x0039F, 0x003A1, 0x003A4, 0x003A6, 0x003A7, 0x003A8, 0x02207, 0x003B1,
+    0x003B6, 0x003B7, 0x003BB, 0x003BD, 0x003BE, 0x003BF, 0x003C3, 0x003C4,
+    0x003C5, 0x003C8, 0x003C9, 0x02202, 0x003DC, 0x003DD, 0x00430, 0x00431,
+    0x00432, 0x00433, 0x00434, 0x00435, 0x00436, 0x00437, 0x00438, 0x0043A,
+    0x0043B, 0x0043C, 0x0043E, 0x0043F, 0x00440, 0x00441, 0x00442, 0x00443,
+    0x00444, 0x00445, 0x00446, 0x00447, 0x00448, 0x0044B, 0x0044D, 0x0044E,
+    0x0A689, 0x004D9, 0x00456, 0x00458, 0x004E9, 0x004AF, 0x004CF, 0x00491,
+    0x00455, 0x0045F, 0x004AB, 0x0A651, 0x004B1, 0x0066E, 0x006A1, 0x0066F,
+    0x00030, 0x0002E, 0x00030, 0x0002C, 0x00031, 0x0002C, 0x00032, 0x0002C,
+    0x00033, 0x0002C, 0x00034, 0x0002C, 0x00035, 0x0002C, 0x00036, 0x0002C,
+    0x00037, 0x0002C, 0x00038, 0x0002C, 0x00039, 0x0002C, 0x00028, 0x00041,
+    0x00029, 0x00028, 0x00042, 0x00029, 0x00028, 0x00043, 0x00029, 0x00028,
+    0x00044, 0x00029, 0x00028, 0x00045, 0x00029, 0x00028, 0x00046, 0x00029,
+    0x00028, 0x00047, 0x00029, 0x00028, 0x00048, 0x00029, 0x00028, 0x00049,
+    0x00029, 0x00028, 0x0004A, 0x00029, 0x00028, 0x0004B, 0x00029, 0x00028,
+    0x0004C, 0x00029, 0x00028, 0x0004D, 0x00029, 0x00028, 0x0004E, 0x00029,
+    0x00028, 0x0004F, 0x00029, 0x00028, 0x00050, 0x00029, 0x00028, 0x00051,
+    0x00029, 0x00028, 0x00052, 0x00029, 0x00028, 0x00053, 0x00029, 0x00028,
+    0x00054, 0x00029, 0x00028, 0x00055, 0x00029, 0x00028, 0x00056, 0x00029,
+    0x00028, 0x00057, 0x00029, 0x00028, 0x00058, 0x00029, 0x00028, 0x00059,
+    0x00029, 0x00028, 0x0005A, 0x00029, 0x03014, 0x00053, 0x03015, 0x00043,
+    0x00044, 0x00057, 0x0005A, 0x00048, 0x00056, 0x00053, 0x00044, 0x00053,
+    0x00053, 0x00050, 0x00050, 0x00056, 0x00057, 0x00043, 0x0004D, 0x00043,
+    0x0004D, 0x00044, 0x0004D, 0x00052, 0x00044, 0x0004A, 0x0307B, 0x0304B,
+    0x030B3, 0x030B3, 0x05B57, 0x053CC, 0x0591A, 0x089E3, 0x04EA4, 0x06620,
+    0x07121, 0x0524D, 0x05F8C, 0x0518D, 0x065B0, 0x0521D, 0x07D42, 0x08CA9,
+    0x058F0, 0x05439, 0x06F14, 0x06295, 0x06355, 0x0904A, 0x06307, 0x06253,
+    0x07981, 0x07A7A, 0x05408, 0x06E80, 0x07533, 0x05272, 0x055B6, 0x0914D,
+    0x03014, 0x0672C, 0x03015, 0x03014, 0x04E09, 0x03015, 0x03014, 0x04E8C,
+    0x03015, 0x03014, 0x05B89, 0x03015, 0x03014, 0x070B9, 0x03015, 0x03014,
+    0x06253, 0x03015, 0x03014, 0x076D7, 0x03015, 0x03014, 0x052DD, 0x03015,
+    0x03014, 0x06557, 0x03015, 0x05F97, 0x053EF, 0x04E3D, 0x04E38, 0x04E41,
+    0x20122, 0x04F60, 0x04FBB, 0x05002, 0x0507A, 0x05099, 0x050CF, 0x0349E,
+    0x2063A, 0x05154, 0x05164, 0x05177, 0x2051C, 0x034B9, 0x05167, 0x2054B,
+    0x05197, 0x051A4, 0x04ECC, 0x051AC, 0x291DF, 0x05203, 0x034DF, 0x0523B,
+    0x05246, 0x05277, 0x03515, 0x05305, 0x05306, 0x05349, 0x0535A, 0x05373,
+    0x0537D, 0x0537F, 0x20A2C, 0x07070, 0x053CA, 0x053DF, 0x20B63, 0x053EB,
+    0x053F1, 0x05406, 0x0549E, 0x05438, 0x05448, 0x05468, 0x054A2, 0x054F6,
+    0x05510, 0x05553, 0x05563, 0x05584, 0x055AB, 0x055B3, 0x055C2, 0x05716,
+    0x05717, 0x05651, 0x05674, 0x058EE, 0x057CE, 0x057F4, 0x0580D, 0x0578B,
+    0x05832, 0x05831, 0x058AC, 0x214E4, 0x058F2, 0x058F7, 0x05906, 0x05922,
+    0x05962, 0x216A8, 0x216EA, 0x059EC, 0x05A1B, 0x05A27, 0x059D8, 0x05A66,
+    0x036EE, 0x036FC, 0x05B08, 0x05B3E, 0x219C8, 0x05BC3, 0x05BD8, 0x05BF3,
+    0x21B18, 0x05BFF, 0x05C06, 0x05F53, 0x03781, 0x05C60, 0x05CC0, 0x05C8D,
+    0x21DE4, 0x05D43, 0x21DE6, 0x05D6E, 0x05D6B, 0x05D7C, 0x05DE1, 0x05DE2,
+    0x0382F, 0x05DFD, 0x05E28, 0x05E3D, 0x05E69, 0x03862, 0x22183, 0x0387C,
+    0x05EB0, 0x05EB3, 0x05EB6, 0x2A392, 0x22331, 0x08201, 0x05F22, 0x038C7,
+    0x232B8, 0x261DA, 0x05F62, 0x05F6B, 0x038E3, 0x05F9A, 0x05FCD, 0x05FD7,
+    0x05FF9, 0x06081, 0x0393A, 0x0391C, 0x226D4, 0x060C7, 0x06148, 0x0614C,
+    0x0617A, 0x061B2, 0x061A4, 0x061AF, 0x061DE, 0x06210, 0x0621B, 0x0625D,
+    0x062B1, 0x062D4, 0x06350, 0x22B0C, 0x0633D, 0x062FC, 0x06368, 0x06383,
+    0x063E4, 0x22BF1, 0x06422, 0x063C5, 0x063A9, 0x03A2E, 0x06469, 0x0647E,
+    0x0649D, 0x06477, 0x03A6C, 0x0656C, 0x2300A, 0x065E3, 0x066F8, 0x06649,
+    0x03B19, 0x03B08, 0x03AE4, 0x05192, 0x05195, 0x06700, 0x0669C, 0x080AD,
+    0x043D9, 0x06721, 0x0675E, 0x06753, 0x233C3, 0x03B49, 0x067FA, 0x06785,
+    0x06852, 0x2346D, 0x0688E, 0x0681F, 0x06914, 0x06942, 0x069A3, 0x069EA,
+    0x06AA8, 0x236A3, 0x06ADB, 0x03C18, 0x06B21, 0x238A7, 0x06B54, 0x03C4E,
+    0x06B72, 0x06B9F, 0x06BBB, 0x23A8D, 0x21D0B, 0x23AFA, 0x06C4E, 0x23CBC,
+    0x06CBF, 0x06CCD, 0x06C67, 0x06D16, 0x06D3E, 0x06D69, 0x06D78, 0x06D85,
+    0x23D1E, 0x06D34, 0x06E2F, 0x06E6E, 0x03D33, 0x06EC7, 0x23ED1, 0x06DF9,
+    0x06F6E, 0x23F5E, 0x23F8E, 0x06FC6, 0x07039, 0x0701B, 0x03D96, 0x0704A,
+    0x0707D, 0x07077, 0x070AD, 0x20525, 0x07145, 0x24263, 0x0719C, 0x243AB,
+    0x07228, 0x07250, 0x24608, 0x07280, 0x07295, 0x24735, 0x24814, 0x0737A,
+    0x0738B, 0x03EAC, 0x073A5, 0x03EB8, 0x07447, 0x0745C, 0x07485, 0x074CA,
+    0x03F1B, 0x07524, 0x24C36, 0x0753E, 0x24C92, 0x2219F, 0x07610, 0x24FA1,
+    0x24FB8, 0x25044, 0x03FFC, 0x04008, 0x250F3, 0x250F2, 0x25119, 0x25133,
+    0x0771E, 0x0771F, 0x0778B, 0x04046, 0x04096, 0x2541D, 0x0784E, 0x040E3,
+    0x25626, 0x2569A, 0x256C5, 0x079EB, 0x0412F, 0x07A4A, 0x07A4F, 0x2597C,
+    0x25AA7, 0x07AEE, 0x04202, 0x25BAB, 0x07BC6, 0x07BC9, 0x04227, 0x25C80,
+    0x07CD2, 0x042A0, 0x07CE8, 0x07CE3, 0x07D00, 0x25F86, 0x07D63, 0x04301,
+    0x07DC7, 0x07E02, 0x07E45, 0x04334, 0x26228, 0x26247, 0x04359, 0x262D9,
+    0x07F7A, 0x2633E, 0x07F95, 0x07FFA, 0x264DA, 0x26523, 0x08060, 0x265A8,
+    0x08070, 0x2335F, 0x043D5, 0x080B2, 0x08103, 0x0440B, 0x0813E, 0x05AB5,
+    0x267A7, 0x267B5, 0x23393, 0x2339C, 0x08204, 0x08F9E, 0x0446B, 0x08291,
+    0x0828B, 0x0829D, 0x052B3, 0x082B1, 0x082B3, 0x082BD, 0x082E6, 0x26B3C,
+    0x0831D, 0x08363, 0x083AD, 0x08323, 0x083BD, 0x083E7, 0x08353, 0x083CA,
+    0x083CC, 0x083DC, 0x26C36, 0x26D6B, 0x26CD5, 0x0452B, 0x084F1, 0x084F3,
+    0x08516, 0x273CA, 0x08564, 0x26F2C, 0x0455D, 0x04561, 0x26FB1, 0x270D2,
+    0x0456B, 0x08650, 0x08667, 0x08669, 0x086A9, 0x08688, 0x0870E, 0x086E2,
+    0x08728, 0x0876B, 0x08786, 0x045D7, 0x087E1, 0x08801, 0x045F9, 0x08860,
+    0x27667, 0x088D7, 0x088DE, 0x04635, 0x088FA, 0x034BB, 0x278AE, 0x27966,
+    0x046BE, 0x046C7, 0x08AA0, 0x27CA8, 0x08CAB, 0x08CC1, 0x08D1B, 0x08D77,
+    0x27F2F, 0x20804, 0x08DCB, 0x08DBC, 0x08DF0, 0x208DE, 0x08ED4, 0x285D2,
+    0x285ED, 0x09094, 0x090F1, 0x09111, 0x2872E, 0x0911B, 0x09238, 0x092D7,
+    0x092D8, 0x0927C, 0x093F9, 0x09415, 0x28BFA, 0x0958B, 0x04995, 0x095B7,
+    0x28D77, 0x049E6, 0x096C3, 0x05DB2, 0x09723, 0x29145, 0x2921A, 0x04A6E,
+    0x04A76, 0x097E0, 0x2940A, 0x04AB2, 0x29496, 0x09829, 0x295B6, 0x098E2,
+    0x04B33, 0x09929, 0x099A7, 0x099C2, 0x099FE, 0x04BCE, 0x29B30, 0x09C40,
+    0x09CFD, 0x04CCE, 0x04CED, 0x09D67, 0x2A0CE, 0x04CF8, 0x2A105, 0x2A20E,
+    0x2A291, 0x04D56, 0x09EFE, 0x09F05, 0x09F0F, 0x09F16, 0x2A600,
+};
+
+const UTF8NormalPair utf8_normal_pairs[941] = {
+    {0x0003C, 0x00338, 0x0226E},
+    {0x0003D, 0x00338, 0x02260},
+    {0x0003E, 0x00338, 0x0226F},
+    {0x00041, 0x00300, 0x000C0},
+    {0x00041, 0x00301, 0x000C1},
+    {0x00041, 0x00302, 0x000C2},
+    {0x00041, 0x00303, 0x000C3},
+    {0x00041, 0x00304, 0x00100},
+    {0x00041, 0x00306, 0x00102},
+    {0x00041, 0x00307, 0x00226},
+    {0x00041, 0x00308, 0x000C4},
+    {0x00041, 0x00309, 0x01EA2},
+    {0x00041, 0x0030A, 0x000C5},
+    {0x00041, 0x0030C, 0x001CD},
+    {0x00041, 0x0030F, 0x00200},
+    {0x00041, 0x00311, 0x00202},
+    {0x00041, 0x00323, 0x01EA0},
+    {0x00041, 0x00325, 0x01E00},
+    {0x00041, 0x00328, 0x00104},
+    {0x00042, 0x00307, 0x01E02},
+    {0x00042, 0x00323, 0x01E04},
+    {0x00042, 0x00331, 0x01E06},
+    {0x00043, 0x00301, 0x00106},
+    {0x00043, 0x00302, 0x00108},
+    {0x00043, 0x00307, 0x0010A},
+    {0x00043, 0x0030C, 0x0010C},
+    {0x00043, 0x00327, 0x000C7},
+    {0x00044, 0x00307, 0x01E0A},
+    {0x00044, 0x0030C, 0x0010E},
+    {0x00044, 0x00323, 0x01E0C},
+    {0x00044, 0x00327, 0x01E10},
+    {0x00044, 0x0032D, 0x01E12},
+    {0x00044, 0x00331, 0x01E0E},
+    {0x00045, 0x00300, 0x000C8},
+    {0x00045, 0x00301, 0x000C9},
+    {0x00045, 0x00302, 0x000CA},
+    {0x00045, 0x00303, 0x01EBC},
+    {0x00045, 0x00304, 0x00112},
+    {0x00045, 0x00306, 0x00114},
+    {0x00045, 0x00307, 0x00116},
+    {0x00045, 0x00308, 0x000CB},
+    {0x00045, 0x00309, 0x01EBA},
+    {0x00045, 0x0030C, 0x0011A},
+    {0x00045, 0x0030F, 0x00204},
+    {0x00045, 0x00311, 0x00206},
+    {0x00045, 0x00323, 0x01EB8},
+    {0x00045, 0x00327, 0x00228},
+    {0x00045, 0x00328, 0x00118},
+    {0x00045, 0x0032D, 0x01E18},
+    {0x00045, 0x00330, 0x01E1A},
+    {0x00046, 0x00307, 0x01E1E},
+    {0x00047, 0x00301, 0x001F4},
+    {0x00047, 0x00302, 0x0011C},
+    {0x00047, 0x00304, 0x01E20},
+    {0x00047, 0x00306, 0x0011E},
+    {0x00047, 0x00307, 0x00120},
+    {0x00047, 0x0030C, 0x001E6},
+    {0x00047, 0x00327, 0x00122},
+    {0x00048, 0x00302, 0x00124},
+    {0x00048, 0x00307, 0x01E22},
+    {0x00048, 0x00308, 0x01E26},
+    {0x00048, 0x0030C, 0x0021E},
+    {0x00048, 0x00323, 0x01E24},
+    {0x00048, 0x00327, 0x01E28},
+    {0x00048, 0x0032E, 0x01E2A},
+    {0x00049, 0x00300, 0x000CC},
+    {0x00049, 0x00301, 0x000CD},
+    {0x00049, 0x00302, 0x000CE},
+    {0x00049, 0x00303, 0x00128},
+    {0x00049, 0x00304, 0x0012A},
+    {0x00049, 0x00306, 0x0012C},
+    {0x00049, 0x00307, 0x00130},
+    {0x00049, 0x00308, 0x000CF},
+    {0x00049, 0x00309, 0x01EC8},
+    {0x00049, 0x0030C, 0x001CF},
+    {0x00049, 0x0030F, 0x00208},
+    {0x00049, 0x00311, 0x0020A},
+    {0x00049, 0x00323, 0x01ECA},
+    {0x00049, 0x00328, 0x0012E},
+    {0x00049, 0x00330, 0x01E2C},
+    {0x0004A, 0x00302, 0x00134},
+    {0x0004B, 0x00301, 0x01E30},
+    {0x0004B, 0x0030C, 0x001E8},
+    {0x0004B, 0x00323, 0x01E32},
+    {0x0004B, 0x00327, 0x00136},
+    {0x0004B, 0x00331, 0x01E34},
+    {0x0004C, 0x00301, 0x00139},
+    {0x0004C, 0x0030C, 0x0013D},
+    {0x0004C, 0x00323, 0x01E36},
+    {0x0004C, 0x00327, 0x0013B},
+    {0x0004C, 0x0032D, 0x01E3C},
+    {0x0004C, 0x00331, 0x01E3A},
+    {0x0004D, 0x00301, 0x01E3E},
+    {0x0004D, 0x00307, 0x01E40},
+    {0x0004D, 0x00323, 0x01E42},
+    {0x0004E, 0x00300, 0x001F8},
+    {0x0004E, 0x00301, 0x00143},
+    {0x0004E, 0x00303, 0x000D1},
+    {0x0004E, 0x00307, 0x01E44},
+    {0x0004E, 0x0030C, 0x00147},
+    {0x0004E, 0x00323, 0x01E46},
+    {0x0004E, 0x00327, 0x00145},
+    {0x0004E, 0x0032D, 0x01E4A},
+    {0x0004E, 0x00331, 0x01E48},
+    {0x0004F, 0x00300, 0x000D2},
+    {0x0004F, 0x00301, 0x000D3},
+    {0x0004F, 0x00302, 0x000D4},
+    {0x0004F, 0x00303, 0x000D5},
+    {0x0004F, 0x00304, 0x0014C},
+    {0x0004F, 0x00306, 0x0014E},
+    {0x0004F, 0x00307, 0x0022E},
+    {0x0004F, 0x00308, 0x000D6},
+    {0x0004F, 0x00309, 0x01ECE},
+    {0x0004F, 0x0030B, 0x00150},
+    {0x0004F, 0x0030C, 0x001D1},
+    {0x0004F, 0x0030F, 0x0020C},
+    {0x0004F, 0x00311, 0x0020E},
+    {0x0004F, 0x0031B, 0x001A0},
+    {0x0004F, 0x00323, 0x01ECC},
+    {0x0004F, 0x00328, 0x001EA},
+    {0x00050, 0x00301, 0x01E54},
+    {0x00050, 0x00307, 0x01E56},
+    {0x00052, 0x00301, 0x00154},
+    {0x00052, 0x00307, 0x01E58},
+    {0x00052, 0x0030C, 0x00158},
+    {0x00052, 0x0030F, 0x00210},
+    {0x00052, 0x00311, 0x00212},
+    {0x00052, 0x00323, 0x01E5A},
+    {0x00052, 0x00327, 0x00156},
+    {0x00052, 0x00331, 0x01E5E},
+    {0x00053, 0x00301, 0x0015A},
+    {0x00053, 0x00302, 0x0015C},
+    {0x00053, 0x00307, 0x01E60},
+    {0x00053, 0x0030C, 0x00160},
+    {0x00053, 0x00323, 0x01E62},
+    {0x00053, 0x00326, 0x00218},
+    {0x00053, 0x00327, 0x0015E},
+    {0x00054, 0x00307, 0x01E6A},
+    {0x00054, 0x0030C, 0x00164},
+    {0x00054, 0x00323, 0x01E6C},
+    {0x00054, 0x00326, 0x0021A},
+    {0x00054, 0x00327, 0x00162},
+    {0x00054, 0x0032D, 0x01E70},
+    {0x00054, 0x00331, 0x01E6E},
+    {0x00055, 0x00300, 0x000D9},
+    {0x00055, 0x00301, 0x000DA},
+    {0x00055, 0x00302, 0x000DB},
+    {0x00055, 0x00303, 0x00168},
+    {0x00055, 0x00304, 0x0016A},
+    {0x00055, 0x00306, 0x0016C},
+    {0x00055, 0x00308, 0x000DC},
+    {0x00055, 0x00309, 0x01EE6},
+    {0x00055, 0x0030A, 0x0016E},
+    {0x00055, 0x0030B, 0x00170},
+    {0x00055, 0x0030C, 0x001D3},
+    {0x00055, 0x0030F, 0x00214},
+    {0x00055, 0x00311, 0x00216},
+    {0x00055, 0x0031B, 0x001AF},
+    {0x00055, 0x00323, 0x01EE4},
+    {0x00055, 0x00324, 0x01E72},
+    {0x00055, 0x00328, 0x00172},
+    {0x00055, 0x0032D, 0x01E76},
+    {0x00055, 0x00330, 0x01E74},
+    {0x00056, 0x00303, 0x01E7C},
+    {0x00056, 0x00323, 0x01E7E},
+    {0x00057, 0x00300, 0x01E80},
+    {0x00057, 0x00301, 0x01E82},
+    {0x00057, 0x00302, 0x00174},
+    {0x00057, 0x00307, 0x01E86},
+    {0x00057, 0x00308, 0x01E84},
+    {0x00057, 0x00323, 0x01E88},
+    {0x00058, 0x00307, 0x01E8A},
+    {0x00058, 0x00308, 0x01E8C},
+    {0x00059, 0x00300, 0x01EF2},
+    {0x00059, 0x00301, 0x000DD},
+    {0x00059, 0x00302, 0x00176},
+    {0x00059, 0x00303, 0x01EF8},
+    {0x00059, 0x00304, 0x00232},
+    {0x00059, 0x00307, 0x01E8E},
+    {0x00059, 0x00308, 0x00178},
+    {0x00059, 0x00309, 0x01EF6},
+    {0x00059, 0x00323, 0x01EF4},
+    {0x0005A, 0x00301, 0x00179},
+    {0x0005A, 0x00302, 0x01E90},
+    {0x0005A, 0x00307, 0x0017B},
+    {0x0005A, 0x0030C, 0x0017D},
+    {0x0005A, 0x00323, 0x01E92},
+    {0x0005A, 0x00331, 0x01E94},
+    {0x00061, 0x00300, 0x000E0},
+    {0x00061, 0x00301, 0x000E1},
+    {0x00061, 0x00302, 0x000E2},
+    {0x00061, 0x00303, 0x000E3},
+    {0x00061, 0x00304, 0x00101},
+    {0x00061, 0x00306, 0x00103},
+    {0x00061, 0x00307, 0x00227},
+    {0x00061, 0x00308, 0x000E4},
+    {0x00061, 0x00309, 0x01EA3},
+    {0x00061, 0x0030A, 0x000E5},
+    {0x00061, 0x0030C, 0x001CE},
+    {0x00061, 0x0030F, 0x00201},
+    {0x00061, 0x00311, 0x00203},
+    {0x00061, 0x00323, 0x01EA1},
+    {0x00061, 0x00325, 0x01E01},
+    {0x00061, 0x00328, 0x00105},
+    {0x00062, 0x00307, 0x01E03},
+    {0x00062, 0x00323, 0x01E05},
+    {0x00062, 0x00331, 0x01E07},
+    {0x00063, 0x00301, 0x00107},
+    {0x00063, 0x00302, 0x00109},
+    {0x00063, 0x00307, 0x0010B},
+    {0x00063, 0x0030C, 0x0010D},
+    {0x00063, 0x00327, 0x000E7},
+    {0x00064, 0x00307, 0x01E0B},
+    {0x00064, 0x0030C, 0x0010F},
+    {0x00064, 0x00323, 0x01E0D},
+    {0x00064, 0x00327, 0x01E11},
+    {0x00064, 0x0032D, 0x01E13},
+    {0x00064, 0x00331, 0x01E0F},
+    {0x00065, 0x00300, 0x000E8},
+    {0x00065, 0x00301, 0x000E9},
+    {0x00065, 0x00302, 0x000EA},
+    {0x00065, 0x00303, 0x01EBD},
+    {0x00065, 0x00304, 0x00113},
+    {0x00065, 0x00306, 0x00115},
+    {0x00065, 0x00307, 0x00117},
+    {0x00065, 0x00308, 0x000EB},
+    {0x00065, 0x00309, 0x01EBB},
+    {0x00065, 0x0030C, 0x0011B},
+    {0x00065, 0x0030F, 0x00205},
+    {0x00065, 0x00311, 0x00207},
+    {0x00065, 0x00323, 0x01EB9},
+    {0x00065, 0x00327, 0x00229},
+    {0x00065, 0x00328, 0x00119},
+    {0x00065, 0x0032D, 0x01E19},
+    {0x00065, 0x00330, 0x01E1B},
+    {0x00066, 0x00307, 0x01E1F},
+    {0x00067, 0x00301, 0x001F5},
+    {0x00067, 0x00302, 0x0011D},
+    {0x00067, 0x00304, 0x01E21},
+    {0x00067, 0x00306, 0x0011F},
+    {0x00067, 0x00307, 0x00121},
+    {0x00067, 0x0030C, 0x001E7},
+    {0x00067, 0x00327, 0x00123},
+    {0x00068, 0x00302, 0x00125},
+    {0x00068, 0x00307, 0x01E23},
+    {0x00068, 0x00308, 0x01E27},
+    {0x00068, 0x0030C, 0x0021F},
+    {0x00068, 0x00323, 0x01E25},
+    {0x00068, 0x00327, 0x01E29},
+    {0x00068, 0x0032E, 0x01E2B},
+    {0x00068, 0x00331, 0x01E96},
+    {0x00069, 0x00300, 0x000EC},
+    {0x00069, 0x00301, 0x000ED},
+    {0x00069, 0x00302, 0x000EE},
+    {0x00069, 0x00303, 0x00129},
+    {0x00069, 0x00304, 0x0012B},
+    {0x00069, 0x00306, 0x0012D},
+    {0x00069, 0x00308, 0x000EF},
+    {0x00069, 0x00309, 0x01EC9},
+    {0x00069, 0x0030C, 0x001D0},
+    {0x00069, 0x0030F, 0x00209},
+    {0x00069, 0x00311, 0x0020B},
+    {0x00069, 0x00323, 0x01ECB},
+    {0x00069, 0x00328, 0x0012F},
+    {0x00069, 0x00330, 0x01E2D},
+    {0x0006A, 0x00302, 0x00135},
+    {0x0006A, 0x0030C, 0x001F0},
+    {0x0006B, 0x00301, 0x01E31},
+    {0x0006B, 0x0030C, 0x001E9},
+    {0x0006B, 0x00323, 0x01E33},
+    {0x0006B, 0x00327, 0x00137},
+    {0x0006B, 0x00331, 0x01E35},
+    {0x0006C, 0x00301, 0x0013A},
+    {0x0006C, 0x0030C, 0x0013E},
+    {0x0006C, 0x00323, 0x01E37},
+    {0x0006C, 0x00327, 0x0013C},
+    {0x0006C, 0x0032D, 0x01E3D},
+    {0x0006C, 0x00331, 0x01E3B},
+    {0x0006D, 0x00301, 0x01E3F},
+    {0x0006D, 0x00307, 0x01E41},
+    {0x0006D, 0x00323, 0x01E43},
+    {0x0006E, 0x00300, 0x001F9},
+    {0x0006E, 0x00301, 0x00144},
+    {0x0006E, 0x00303, 0x000F1},
+    {0x0006E, 0x00307, 0x01E45},
+    {0x0006E, 0x0030C, 0x00148},
+    {0x0006E, 0x00323, 0x01E47},
+    {0x0006E, 0x00327, 0x00146},
+    {0x0006E, 0x0032D, 0x01E4B},
+    {0x0006E, 0x00331, 0x01E49},
+    {0x0006F, 0x00300, 0x000F2},
+    {0x0006F, 0x00301, 0x000F3},
+    {0x0006F, 0x00302, 0x000F4},
+    {0x0006F, 0x00303, 0x000F5},
+    {0x0006F, 0x00304, 0x0014D},
+    {0x0006F, 0x00306, 0x0014F},
+    {0x0006F, 0x00307, 0x0022F},
+    {0x0006F, 0x00308, 0x000F6},
+    {0x0006F, 0x00309, 0x01ECF},
+    {0x0006F, 0x0030B, 0x00151},
+    {0x0006F, 0x0030C, 0x001D2},
+    {0x0006F, 0x0030F, 0x0020D},
+    {0x0006F, 0x00311, 0x0020F},
+    {0x0006F, 0x0031B, 0x001A1},
+    {0x0006F, 0x00323, 0x01ECD},
+    {0x0006F, 0x00328, 0x001EB},
+    {0x00070, 0x00301, 0x01E55},
+    {0x00070, 0x00307, 0x01E57},
+    {0x00072, 0x00301, 0x00155},
+    {0x00072, 0x00307, 0x01E59},
+    {0x00072, 0x0030C, 0x00159},
+    {0x00072, 0x0030F, 0x00211},
+    {0x00072, 0x00311, 0x00213},
+    {0x00072, 0x00323, 0x01E5B},
+    {0x00072, 0x00327, 0x00157},
+    {0x00072, 0x00331, 0x01E5F},
+    {0x00073, 0x00301, 0x0015B},
+    {0x00073, 0x00302, 0x0015D},
+    {0x00073, 0x00307, 0x01E61},
+    {0x00073, 0x0030C, 0x00161},
+    {0x00073, 0x00323, 0x01E63},
+    {0x00073, 0x00326, 0x00219},
+    {0x00073, 0x00327, 0x0015F},
+    {0x00074, 0x00307, 0x01E6B},
+    {0x00074, 0x00308, 0x01E97},
+    {0x00074, 0x0030C, 0x00165},
+    {0x00074, 0x00323, 0x01E6D},
+    {0x00074, 0x00326, 0x0021B},
+    {0x00074, 0x00327, 0x00163},
+    {0x00074, 0x0032D, 0x01E71},
+    {0x00074, 0x00331, 0x01E6F},
+    {0x00075, 0x00300, 0x000F9},
+    {0x00075, 0x00301, 0x000FA},
+    {0x00075, 0x00302, 0x000FB},
+    {0x00075, 0x00303, 0x00169},
+    {0x00075, 0x00304, 0x0016B},
+    {0x00075, 0x00306, 0x0016D},
+    {0x00075, 0x00308, 0x000FC},
+    {0x00075, 0x00309, 0x01EE7},
+    {0x00075, 0x0030A, 0x0016F},
+    {0x00075, 0x0030B, 0x00171},
+    {0x00075, 0x0030C, 0x001D4},
+    {0x00075, 0x0030F, 0x00215},
+    {0x00075, 0x00311, 0x00217},
+    {0x00075, 0x0031B, 0x001B0},
+    {0x00075, 0x00323, 0x01EE5},
+    {0x00075, 0x00324, 0x01E73},
+    {0x00075, 0x00328, 0x00173},
+    {0x00075, 0x0032D, 0x01E77},
+    {0x00075, 0x00330, 0x01E75},
+    {0x00076, 0x00303, 0x01E7D},
+    {0x00076, 0x00323, 0x01E7F},
+    {0x00077, 0x00300, 0x01E81},
+    {0x00077, 0x00301, 0x01E83},
+    {0x00077, 0x00302, 0x00175},
+    {0x00077, 0x00307, 0x01E87},
+    {0x00077, 0x00308, 0x01E85},
+    {0x00077, 0x0030A, 0x01E98},
+    {0x00077, 0x00323, 0x01E89},
+    {0x00078, 0x00307, 0x01E8B},
+    {0x00078, 0x00308, 0x01E8D},
+    {0x00079, 0x00300, 0x01EF3},
+    {0x00079, 0x00301, 0x000FD},
+    {0x00079, 0x00302, 0x00177},
+    {0x00079, 0x00303, 0x01EF9},
+    {0x00079, 0x00304, 0x00233},
+    {0x00079, 0x00307, 0x01E8F},
+    {0x00079, 0x00308, 0x000FF},
+    {0x00079, 0x00309, 0x01EF7},
+    {0x00079, 0x0030A, 0x01E99},
+    {0x00079, 0x00323, 0x01EF5},
+    {0x0007A, 0x00301, 0x0017A},
+    {0x0007A, 0x00302, 0x01E91},
+    {0x0007A, 0x00307, 0x0017C},
+    {0x0007A, 0x0030C, 0x0017E},
+    {0x0007A, 0x00323, 0x01E93},
+    {0x0007A, 0x00331, 0x01E95},
+    {0x000A8, 0x00300, 0x01FED},
+    {0x000A8, 0x00301, 0x00385},
+    {0x000A8, 0x00342, 0x01FC1},
+    {0x000C2, 0x00300, 0x01EA6},
+    {0x000C2, 0x00301, 0x01EA4},
+    {0x000C2, 0x00303, 0x01EAA},
+    {0x000C2, 0x00309, 0x01EA8},
+    {0x000C4, 0x00304, 0x001DE},
+    {0x000C5, 0x00301, 0x001FA},
+    {0x000C6, 0x00301, 0x001FC},
+    {0x000C6, 0x00304, 0x001E2},
+    {0x000C7, 0x00301, 0x01E08},
+    {0x000CA, 0x00300, 0x01EC0},
+    {0x000CA, 0x00301, 0x01EBE},
+    {0x000CA, 0x00303, 0x01EC4},
+    {0x000CA, 0x00309, 0x01EC2},
+    {0x000CF, 0x00301, 0x01E2E},
+    {0x000D4, 0x00300, 0x01ED2},
+    {0x000D4, 0x00301, 0x01ED0},
+    {0x000D4, 0x00303, 0x01ED6},
+    {0x000D4, 0x00309, 0x01ED4},
+    {0x000D5, 0x00301, 0x01E4C},
+    {0x000D5, 0x00304, 0x0022C},
+    {0x000D5, 0x00308, 0x01E4E},
+    {0x000D6, 0x00304, 0x0022A},
+    {0x000D8, 0x00301, 0x001FE},
+    {0x000DC, 0x00300, 0x001DB},
+    {0x000DC, 0x00301, 0x001D7},
+    {0x000DC, 0x00304, 0x001D5},
+    {0x000DC, 0x0030C, 0x001D9},
+    {0x000E2, 0x00300, 0x01EA7},
+    {0x000E2, 0x00301, 0x01EA5},
+    {0x000E2, 0x00303, 0x01EAB},
+    {0x000E2, 0x00309, 0x01EA9},
+    {0x000E4, 0x00304, 0x001DF},
+    {0x000E5, 0x00301, 0x001FB},
+    {0x000E6, 0x00301, 0x001FD},
+    {0x000E6, 0x00304, 0x001E3},
+    {0x000E7, 0x00301, 0x01E09},
+    {0x000EA, 0x00300, 0x01EC1},
+    {0x000EA, 0x00301, 0x01EBF},
+    {0x000EA, 0x00303, 0x01EC5},
+    {0x000EA, 0x00309, 0x01EC3},
+    {0x000EF, 0x00301, 0x01E2F},
+    {0x000F4, 0x00300, 0x01ED3},
+    {0x000F4, 0x00301, 0x01ED1},
+    {0x000F4, 0x00303, 0x01ED7},
+    {0x000F4, 0x00309, 0x01ED5},
+    {0x000F5, 0x00301, 0x01E4D},
+    {0x000F5, 0x00304, 0x0022D},
+    {0x000F5, 0x00308, 0x01E4F},
+    {0x000F6, 0x00304, 0x0022B},
+    {0x000F8, 0x00301, 0x001FF},
+    {0x000FC, 0x00300, 0x001DC},
+    {0x000FC, 0x00301, 0x001D8},
+    {0x000FC, 0x00304, 0x001D6},
+    {0x000FC, 0x0030C, 0x001DA},
+    {0x00102, 0x00300, 0x01EB0},
+    {0x00102, 0x00301, 0x01EAE},
+    {0x00102, 0x00303, 0x01EB4},
+    {0x00102, 0x00309, 0x01EB2},
+    {0x00103, 0x00300, 0x01EB1},
+    {0x00103, 0x00301, 0x01EAF},
+    {0x00103, 0x00303, 0x01EB5},
+    {0x00103, 0x00309, 0x01EB3},
+    {0x00112, 0x00300, 0x01E14},
+    {0x00112, 0x00301, 0x01E16},
+    {0x00113, 0x00300, 0x01E15},
+    {0x00113, 0x00301, 0x01E17},
+    {0x0014C, 0x00300, 0x01E50},
+    {0x0014C, 0x00301, 0x01E52},
+    {0x0014D, 0x00300, 0x01E51},
+    {0x0014D, 0x00301, 0x01E53},
+    {0x0015A, 0x00307, 0x01E64},
+    {0x0015B, 0x00307, 0x01E65},
+    {0x00160, 0x00307, 0x01E66},
+    {0x00161, 0x00307, 0x01E67},
+    {0x00168, 0x00301, 0x01E78},
+    {0x00169, 0x00301, 0x01E79},
+    {0x0016A, 0x00308, 0x01E7A},
+    {0x0016B, 0x00308, 0x01E7B},
+    {0x0017F, 0x00307, 0x01E9B},
+    {0x001A0, 0x00300, 0x01EDC},
+    {0x001A0, 0x00301, 0x01EDA},
+    {0x001A0, 0x00303, 0x01EE0},
+    {0x001A0, 0x00309, 0x01EDE},
+    {0x001A0, 0x00323, 0x01EE2},
+    {0x001A1, 0x00300, 0x01EDD},
+    {0x001A1, 0x00301, 0x01EDB},
+    {0x001A1, 0x00303, 0x01EE1},
+    {0x001A1, 0x00309, 0x01EDF},
+    {0x001A1, 0x00323, 0x01EE3},
+    {0x001AF, 0x00300, 0x01EEA},
+    {0x001AF, 0x00301, 0x01EE8},
+    {0x001AF, 0x00303, 0x01EEE},
+    {0x001AF, 0x00309, 0x01EEC},
+    {0x001AF, 0x00323, 0x01EF0},
+    {0x001B0, 0x00300, 0x01EEB},
+    {0x001B0, 0x00301, 0x01EE9},
+    {0x001B0, 0x00303, 0x01EEF},
+    {0x001B0, 0x00309, 0x01EED},
+    {0x001B0, 0x00323, 0x01EF1},
+    {0x001B7, 0x0030C, 0x001EE},
+    {0x001EA, 0x00304, 0x001EC},
+    {0x001EB, 0x00304, 0x001ED},
+    {0x00226, 0x00304, 0x001E0},
+    {0x00227, 0x00304, 0x001E1},
+    {0x00228, 0x00306, 0x01E1C},
+    {0x00229, 0x00306, 0x01E1D},
+    {0x0022E, 0x00304, 0x00230},
+    {0x0022F, 0x00304, 0x00231},
+    {0x00292, 0x0030C, 0x001EF},
+    {0x00391, 0x00300, 0x01FBA},
+    {0x00391, 0x00301, 0x00386},
+    {0x00391, 0x00304, 0x01FB9},
+    {0x00391, 0x00306, 0x01FB8},
+    {0x00391, 0x00313, 0x01F08},
+    {0x00391, 0x00314, 0x01F09},
+    {0x00391, 0x00345, 0x01FBC},
+    {0x00395, 0x00300, 0x01FC8},
+    {0x00395, 0x00301, 0x00388},
+    {0x00395, 0x00313, 0x01F18},
+    {0x00395, 0x00314, 0x01F19},
+    {0x00397, 0x00300, 0x01FCA},
+    {0x00397, 0x00301, 0x00389},
+    {0x00397, 0x00313, 0x01F28},
+    {0x00397, 0x00314, 0x01F29},
+    {0x00397, 0x00345, 0x01FCC},
+    {0x00399, 0x00300, 0x01FDA},
+    {0x00399, 0x00301, 0x0038A},
+    {0x00399, 0x00304, 0x01FD9},
+    {0x00399, 0x00306, 0x01FD8},
+    {0x00399, 0x00308, 0x003AA},
+    {0x00399, 0x00313, 0x01F38},
+    {0x00399, 0x00314, 0x01F39},
+    {0x0039F, 0x00300, 0x01FF8},
+    {0x0039F, 0x00301, 0x0038C},
+    {0x0039F, 0x00313, 0x01F48},
+    {0x0039F, 0x00314, 0x01F49},
+    {0x003A1, 0x00314, 0x01FEC},
+    {0x003A5, 0x00300, 0x01FEA},
+    {0x003A5, 0x00301, 0x0038E},
+    {0x003A5, 0x00304, 0x01FE9},
+    {0x003A5, 0x00306, 0x01FE8},
+    {0x003A5, 0x00308, 0x003AB},
+    {0x003A5, 0x00314, 0x01F59},
+    {0x003A9, 0x00300, 0x01FFA},
+    {0x003A9, 0x00301, 0x0038F},
+    {0x003A9, 0x00313, 0x01F68},
+    {0x003A9, 0x00314, 0x01F69},
+    {0x003A9, 0x00345, 0x01FFC},
+    {0x003AC, 0x00345, 0x01FB4},
+    {0x003AE, 0x00345, 0x01FC4},
+    {0x003B1, 0x00300, 0x01F70},
+    {0x003B1, 0x00301, 0x003AC},
+    {0x003B1, 0x00304, 0x01FB1},
+    {0x003B1, 0x00306, 0x01FB0},
+    {0x003B1, 0x00313, 0x01F00},
+    {0x003B1, 0x00314, 0x01F01},
+    {0x003B1, 0x00342, 0x01FB6},
+    {0x003B1, 0x00345, 0x01FB3},
+    {0x003B5, 0x00300, 0x01F72},
+    {0x003B5, 0x00301, 0x003AD},
+    {0x003B5, 0x00313, 0x01F10},
+    {0x003B5, 0x00314, 0x01F11},
+    {0x003B7, 0x00300, 0x01F74},
+    {0x003B7, 0x00301, 0x003AE},
+    {0x003B7, 0x00313, 0x01F20},
+    {0x003B7, 0x00314, 0x01F21},
+    {0x003B7, 0x00342, 0x01FC6},
+    {0x003B7, 0x00345, 0x01FC3},
+    {0x003B9, 0x00300, 0x01F76},
+    {0x003B9, 0x00301, 0x003AF},
+    {0x003B9, 0x00304, 0x01FD1},
+    {0x003B9, 0x00306, 0x01FD0},
+    {0x003B9, 0x00308, 0x003CA},
+    {0x003B9, 0x00313, 0x01F30},
+    {0x003B9, 0x00314, 0x01F31},
+    {0x003B9, 0x00342, 0x01FD6},
+    {0x003BF, 0x00300, 0x01F78},
+    {0x003BF, 0x00301, 0x003CC},
+    {0x003BF, 0x00313, 0x01F40},
+    {0x003BF, 0x00314, 0x01F41},
+    {0x003C1, 0x00313, 0x01FE4},
+    {0x003C1, 0x00314, 0x01FE5},
+    {0x003C5, 0x00300, 0x01F7A},
+    {0x003C5, 0x00301, 0x003CD},
+    {0x003C5, 0x00304, 0x01FE1},
+    {0x003C5, 0x00306, 0x01FE0},
+    {0x003C5, 0x00308, 0x003CB},
+    {0x003C5, 0x00313, 0x01F50},
+    {0x003C5, 0x00314, 0x01F51},
+    {0x003C5, 0x00342, 0x01FE6},
+    {0x003C9, 0x00300, 0x01F7C},
+    {0x003C9, 0x00301, 0x003CE},
+    {0x003C9, 0x00313, 0x01F60},
+    {0x003C9, 0x00314, 0x01F61},
+    {0x003C9, 0x00342, 0x01FF6},
+    {0x003C9, 0x00345, 0x01FF3},
+    {0x003CA, 0x00300, 0x01FD2},
+    {0x003CA, 0x00301, 0x00390},
+    {0x003CA, 0x00342, 0x01FD7},
+    {0x003CB, 0x00300, 0x01FE2},
+    {0x003CB, 0x00301, 0x003B0},
+    {0x003CB, 0x00342, 0x01FE7},
+    {0x003CE, 0x00345, 0x01FF4},
+    {0x003D2, 0x00301, 0x003D3},
+    {0x003D2, 0x00308, 0x003D4},
+    {0x00406, 0x00308, 0x00407},
+    {0x00410, 0x00306, 0x004D0},
+    {0x00410, 0x00308, 0x004D2},
+    {0x00413, 0x00301, 0x00403},
+    {0x00415, 0x00300, 0x00400},
+    {0x00415, 0x00306, 0x004D6},
+    {0x00415, 0x00308, 0x00401},
+    {0x00416, 0x00306, 0x004C1},
+    {0x00416, 0x00308, 0x004DC},
+    {0x00417, 0x00308, 0x004DE},
+    {0x00418, 0x00300, 0x0040D},
+    {0x00418, 0x00304, 0x004E2},
+    {0x00418, 0x00306, 0x00419},
+    {0x00418, 0x00308, 0x004E4},
+    {0x0041A, 0x00301, 0x0040C},
+    {0x0041E, 0x00308, 0x004E6},
+    {0x00423, 0x00304, 0x004EE},
+    {0x00423, 0x00306, 0x0040E},
+    {0x00423, 0x00308, 0x004F0},
+    {0x00423, 0x0030B, 0x004F2},
+    {0x00427, 0x00308, 0x004F4},
+    {0x0042B, 0x00308, 0x004F8},
+    {0x0042D, 0x00308, 0x004EC},
+    {0x00430, 0x00306, 0x004D1},
+    {0x00430, 0x00308, 0x004D3},
+    {0x00433, 0x00301, 0x00453},
+    {0x00435, 0x00300, 0x00450},
+    {0x00435, 0x00306, 0x004D7},
+    {0x00435, 0x00308, 0x00451},
+    {0x00436, 0x00306, 0x004C2},
+    {0x00436, 0x00308, 0x004DD},
+    {0x00437, 0x00308, 0x004DF},
+    {0x00438, 0x00300, 0x0045D},
+    {0x00438, 0x00304, 0x004E3},
+    {0x00438, 0x00306, 0x00439},
+    {0x00438, 0x00308, 0x004E5},
+    {0x0043A, 0x00301, 0x0045C},
+    {0x0043E, 0x00308, 0x004E7},
+    {0x00443, 0x00304, 0x004EF},
+    {0x00443, 0x00306, 0x0045E},
+    {0x00443, 0x00308, 0x004F1},
+    {0x00443, 0x0030B, 0x004F3},
+    {0x00447, 0x00308, 0x004F5},
+    {0x0044B, 0x00308, 0x004F9},
+    {0x0044D, 0x00308, 0x004ED},
+    {0x00456, 0x00308, 0x00457},
+    {0x00474, 0x0030F, 0x00476},
+    {0x00475, 0x0030F, 0x00477},
+    {0x004D8, 0x00308, 0x004DA},
+    {0x004D9, 0x00308, 0x004DB},
+    {0x004E8, 0x00308, 0x004EA},
+    {0x004E9, 0x00308, 0x004EB},
+    {0x00627, 0x00653, 0x00622},
+    {0x00627, 0x00654, 0x00623},
+    {0x00627, 0x00655, 0x00625},
+    {0x00648, 0x00654, 0x00624},
+    {0x0064A, 0x00654, 0x00626},
+    {0x006C1, 0x00654, 0x006C2},
+    {0x006D2, 0x00654, 0x006D3},
+    {0x006D5, 0x00654, 0x006C0},
+    {0x00928, 0x0093C, 0x00929},
+    {0x00930, 0x0093C, 0x00931},
+    {0x00933, 0x0093C, 0x00934},
+    {0x009C7, 0x009BE, 0x009CB},
+    {0x009C7, 0x009D7, 0x009CC},
+    {0x00B47, 0x00B3E, 0x00B4B},
+    {0x00B47, 0x00B56, 0x00B48},
+    {0x00B47, 0x00B57, 0x00B4C},
+    {0x00B92, 0x00BD7, 0x00B94},
+    {0x00BC6, 0x00BBE, 0x00BCA},
+    {0x00BC6, 0x00BD7, 0x00BCC},
+    {0x00BC7, 0x00BBE, 0x00BCB},
+    {0x00C46, 0x00C56, 0x00C48},
+    {0x00CBF, 0x00CD5, 0x00CC0},
+    {0x00CC6, 0x00CC2, 0x00CCA},
+    {0x00CC6, 0x00CD5, 0x00CC7},
+    {0x00CC6, 0x00CD6, 0x00CC8},
+    {0x00CCA, 0x00CD5, 0x00CCB},
+    {0x00D46, 0x00D3E, 0x00D4A},
+    {0x00D46, 0x00D57, 0x00D4C},
+    {0x00D47, 0x00D3E, 0x00D4B},
+    {0x00DD9, 0x00DCA, 0x00DDA},
+    {0x00DD9, 0x00DCF, 0x00DDC},
+    {0x00DD9, 0x00DDF, 0x00DDE},
+    {0x00DDC, 0x00DCA, 0x00DDD},
+    {0x01025, 0x0102E, 0x01026},
+    {0x01B05, 0x01B35, 0x01B06},
+    {0x01B07, 0x01B35, 0x01B08},
+    {0x01B09, 0x01B35, 0x01B0A},
+    {0x01B0B, 0x01B35, 0x01B0C},
+    {0x01B0D, 0x01B35, 0x01B0E},
+    {0x01B11, 0x01B35, 0x01B12},
+    {0x01B3A, 0x01B35, 0x01B3B},
+    {0x01B3C, 0x01B35, 0x01B3D},
+    {0x01B3E, 0x01B35, 0x01B40},
+    {0x01B3F, 0x01B35, 0x01B41},
+    {0x01B42, 0x01B35, 0x01B43},
+    {0x01E36, 0x00304, 0x01E38},
+    {0x01E37, 0x00304, 0x01E39},
+    {0x01E5A, 0x00304, 0x01E5C},
+    {0x01E5B, 0x00304, 0x01E5D},
+    {0x01E62, 0x00307, 0x01E68},
+    {0x01E63, 0x00307, 0x01E69},
+    {0x01EA0, 0x00302, 0x01EAC},
+    {0x01EA0, 0x00306, 0x01EB6},
+    {0x01EA1, 0x00302, 0x01EAD},
+    {0x01EA1, 0x00306, 0x01EB7},
+    {0x01EB8, 0x00302, 0x01EC6},
+    {0x01EB9, 0x00302, 0x01EC7},
+    {0x01ECC, 0x00302, 0x01ED8},
+    {0x01ECD, 0x00302, 0x01ED9},
+    {0x01F00, 0x00300, 0x01F02},
+    {0x01F00, 0x00301, 0x01F04},
+    {0x01F00, 0x00342, 0x01F06},
+    {0x01F00, 0x00345, 0x01F80},
+    {0x01F01, 0x00300, 0x01F03},
+    {0x01F01, 0x00301, 0x01F05},
+    {0x01F01, 0x00342, 0x01F07},
+    {0x01F01, 0x00345, 0x01F81},
+    {0x01F02, 0x00345, 0x01F82},
+    {0x01F03, 0x00345, 0x01F83},
+    {0x01F04, 0x00345, 0x01F84},
+    {0x01F05, 0x00345, 0x01F85},
+    {0x01F06, 0x00345, 0x01F86},
+    {0x01F07, 0x00345, 0x01F87},
+    {0x01F08, 0x00300, 0x01F0A},
+    {0x01F08, 0x00301, 0x01F0C},
+    {0x01F08, 0x00342, 0x01F0E},
+    {0x01F08, 0x00345, 0x01F88},
+    {0x01F09, 0x00300, 0x01F0B},
+    {0x01F09, 0x00301, 0x01F0D},
+    {0x01F09, 0x00342, 0x01F0F},
+    {0x01F09, 0x00345, 0x01F89},
+    {0x01F0A, 0x00345, 0x01F8A},
+    {0x01F0B, 0x00345, 0x01F8B},
+    {0x01F0C, 0x00345, 0x01F8C},
+    {0x01F0D, 0x00345, 0x01F8D},
+    {0x01F0E, 0x00345, 0x01F8E},
+    {0x01F0F, 0x00345, 0x01F8F},
+    {0x01F10, 0x00300, 0x01F12},
+    {0x01F10, 0x00301, 0x01F14},
+    {0x01F11, 0x00300, 0x01F13},
+    {0x01F11, 0x00301, 0x01F15},
+    {0x01F18, 0x00300, 0x01F1A},
+    {0x01F18, 0x00301, 0x01F1C},
+    {0x01F19, 0x00300, 0x01F1B},
+    {0x01F19, 0x00301, 0x01F1D},
+    {0x01F20, 0x00300, 0x01F22},
+    {0x01F20, 0x00301, 0x01F24},
+    {0x01F20, 0x00342, 0x01F26},
+    {0x01F20, 0x00345, 0x01F90},
+    {0x01F21, 0x00300, 0x01F23},
+    {0x01F21, 0x00301, 0x01F25},
+    {0x01F21, 0x00342, 0x01F27},
+    {0x01F21, 0x00345, 0x01F91},
+    {0x01F22, 0x00345, 0x01F92},
+    {0x01F23, 0x00345, 0x01F93},
+    {0x01F24, 0x00345, 0x01F94},
+    {0x01F25, 0x00345, 0x01F95},
+    {0x01F26, 0x00345, 0x01F96},
+    {0x01F27, 0x00345, 0x01F97},
+    {0x01F28, 0x00300, 0x01F2A},
+    {0x01F28, 0x00301, 0x01F2C},
+    {0x01F28, 0x00342, 0x01F2E},
+    {0x01F28, 0x00345, 0x01F98},
+    {0x01F29, 0x00300, 0x01F2B},
+    {0x01F29, 0x00301, 0x01F2D},
+    {0x01F29, 0x00342, 0x01F2F},
+    {0x01F29, 0x00345, 0x01F99},
+    {0x01F2A, 0x00345, 0x01F9A},
+    {0x01F2B, 0x00345, 0x01F9B},
+    {0x01F2C, 0x00345, 0x01F9C},
+    {0x01F2D, 0x00345, 0x01F9D},
+    {0x01F2E, 0x00345, 0x01F9E},
+    {0x01F2F, 0x00345, 0x01F9F},
+    {0x01F30, 0x00300, 0x01F32},
+    {0x01F30, 0x00301, 0x01F34},
+    {0x01F30, 0x00342, 0x01F36},
+    {0x01F31, 0x00300, 0x01F33},
+    {0x01F31, 0x00301, 0x01F35},
+    {0x01F31, 0x00342, 0x01F37},
+    {0x01F38, 0x00300, 0x01F3A},
+    {0x01F38, 0x00301, 0x01F3C},
+    {0x01F38, 0x00342, 0x01F3E},
+    {0x01F39, 0x00300, 0x01F3B},
+    {0x01F39, 0x00301, 0x01F3D},
+    {0x01F39, 0x00342, 0x01F3F},
+    {0x01F40, 0x00300, 0x01F42},
+    {0x01F40, 0x00301, 0x01F44},
+    {0x01F41, 0x00300, 0x01F43},
+    {0x01F41, 0x00301, 0x01F45},
+    {0x01F48, 0x00300, 0x01F4A},
+    {0x01F48, 0x00301, 0x01F4C},
+    {0x01F49, 0x00300, 0x01F4B},
+    {0x01F49, 0x00301, 0x01F4D},
+    {0x01F50, 0x00300, 0x01F52},
+    {0x01F50, 0x00301, 0x01F54},
+    {0x01F50, 0x00342, 0x01F56},
+    {0x01F51, 0x00300, 0x01F53},
+    {0x01F51, 0x00301, 0x01F55},
+    {0x01F51, 0x00342, 0x01F57},
+    {0x01F59, 0x00300, 0x01F5B},
+    {0x01F59, 0x00301, 0x01F5D},
+    {0x01F59, 0x00342, 0x01F5F},
+    {0x01F60, 0x00300, 0x01F62},
+    {0x01F60, 0x00301, 0x01F64},
+    {0x01F60, 0x00342, 0x01F66},
+    {0x01F60, 0x00345, 0x01FA0},
+    {0x01F61, 0x00300, 0x01F63},
+    {0x01F61, 0x00301, 0x01F65},
+    {0x01F61, 0x00342, 0x01F67},
+    {0x01F61, 0x00345, 0x01FA1},
+    {0x01F62, 0x00345, 0x01FA2},
+    {0x01F63, 0x00345, 0x01FA3},
+    {0x01F64, 0x00345, 0x01FA4},
+    {0x01F65, 0x00345, 0x01FA5},
+    {0x01F66, 0x00345, 0x01FA6},
+    {0x01F67, 0x00345, 0x01FA7},
+    {0x01F68, 0x00300, 0x01F6A},
+    {0x01F68, 0x00301, 0x01F6C},
+    {0x01F68, 0x00342, 0x01F6E},
+    {0x01F68, 0x00345, 0x01FA8},
+    {0x01F69, 0x00300, 0x01F6B},
+    {0x01F69, 0x00301, 0x01F6D},
+    {0x01F69, 0x00342, 0x01F6F},
+    {0x01F69, 0x00345, 0x01FA9},
+    {0x01F6A, 0x00345, 0x01FAA},
+    {0x01F6B, 0x00345, 0x01FAB},
+    {0x01F6C, 0x00345, 0x01FAC},
+    {0x01F6D, 0x00345, 0x01FAD},
+    {0x01F6E, 0x00345, 0x01FAE},
+    {0x01F6F, 0x00345, 0x01FAF},
+    {0x01F70, 0x00345, 0x01FB2},
+    {0x01F74, 0x00345, 0x01FC2},
+    {0x01F7C, 0x00345, 0x01FF2},
+    {0x01FB6, 0x00345, 0x01FB7},
+    {0x01FBF, 0x00300, 0x01FCD},
+    {0x01FBF, 0x00301, 0x01FCE},
+    {0x01FBF, 0x00342, 0x01FCF},
+    {0x01FC6, 0x00345, 0x01FC7},
+    {0x01FF6, 0x00345, 0x01FF7},
+    {0x01FFE, 0x00300, 0x01FDD},
+    {0x01FFE, 0x00301, 0x01FDE},
+    {0x01FFE, 0x00342, 0x01FDF},
+    {0x02190, 0x00338, 0x0219A},
+    {0x02192, 0x00338, 0x0219B},
+    {0x02194, 0x00338, 0x021AE},
+    {0x021D0, 0x00338, 0x021CD},
+    {0x021D2, 0x00338, 0x021CF},
+    {0x021D4, 0x00338, 0x021CE},
+    {0x02203, 0x00338, 0x02204},
+    {0x02208, 0x00338, 0x02209},
+    {0x0220B, 0x00338, 0x0220C},
+    {0x02223, 0x00338, 0x02224},
+    {0x02225, 0x00338, 0x02226},
+    {0x0223C, 0x00338, 0x02241},
+    {0x02243, 0x00338, 0x02244},
+    {0x02245, 0x00338, 0x02247},
+    {0x02248, 0x00338, 0x02249},
+    {0x0224D, 0x00338, 0x0226D},
+    {0x02261, 0x00338, 0x02262},
+    {0x02264, 0x00338, 0x02270},
+    {0x02265, 0x00338, 0x02271},
+    {0x02272, 0x00338, 0x02274},
+    {0x02273, 0x00338, 0x02275},
+    {0x02276, 0x00338, 0x02278},
+    {0x02277, 0x00338, 0x02279},
+    {0x0227A, 0x00338, 0x02280},
+    {0x0227B, 0x00338, 0x02281},
+    {0x0227C, 0x00338, 0x022E0},
+    {0x0227D, 0x00338, 0x022E1},
+    {0x02282, 0x00338, 0x02284},
+    {0x02283, 0x00338, 0x02285},
+    {0x02286, 0x00338, 0x02288},
+    {0x02287, 0x00338, 0x02289},
+    {0x02291, 0x00338, 0x022E2},
+    {0x02292, 0x00338, 0x022E3},
+    {0x022A2, 0x00338, 0x022AC},
+    {0x022A8, 0x00338, 0x022AD},
+    {0x022A9, 0x00338, 0x022AE},
+    {0x022AB, 0x00338, 0x022AF},
+    {0x022B2, 0x00338, 0x022EA},
+    {0x022B3, 0x00338, 0x022EB},
+    {0x022B4, 0x00338, 0x022EC},
+    {0x022B5, 0x00338, 0x022ED},
+    {0x03046, 0x03099, 0x03094},
+    {0x0304B, 0x03099, 0x0304C},
+    {0x0304D, 0x03099, 0x0304E},
+    {0x0304F, 0x03099, 0x03050},
+    {0x03051, 0x03099, 0x03052},
+    {0x03053, 0x03099, 0x03054},
+    {0x03055, 0x03099, 0x03056},
+    {0x03057, 0x03099, 0x03058},
+    {0x03059, 0x03099, 0x0305A},
+    {0x0305B, 0x03099, 0x0305C},
+    {0x0305D, 0x03099, 0x0305E},
+    {0x0305F, 0x03099, 0x03060},
+    {0x03061, 0x03099, 0x03062},
+    {0x03064, 0x03099, 0x03065},
+    {0x03066, 0x03099, 0x03067},
+    {0x03068, 0x03099, 0x03069},
+    {0x0306F, 0x03099, 0x03070},
+    {0x0306F, 0x0309A, 0x03071},
+    {0x03072, 0x03099, 0x03073},
+    {0x03072, 0x0309A, 0x03074},
+    {0x03075, 0x03099, 0x03076},
+    {0x03075, 0x0309A, 0x03077},
+    {0x03078, 0x03099, 0x03079},
+    {0x03078, 0x0309A, 0x0307A},
+    {0x0307B, 0x03099, 0x0307C},
+    {0x0307B, 0x0309A, 0x0307D},
+    {0x0309D, 0x03099, 0x0309E},
+    {0x030A6, 0x03099, 0x030F4},
+    {0x030AB, 0x03099, 0x030AC},
+    {0x030AD, 0x03099, 0x030AE},
+    {0x030AF, 0x03099, 0x030B0},
+    {0x030B1, 0x03099, 0x030B2},
+    {0x030B3, 0x03099, 0x030B4},
+    {0x030B5, 0x03099, 0x030B6},
+    {0x030B7, 0x03099, 0x030B8},
+    {0x030B9, 0x03099, 0x030BA},
+    {0x030BB, 0x03099, 0x030BC},
+    {0x030BD, 0x03099, 0x030BE},
+    {0x030BF, 0x03099, 0x030C0},
+    {0x030C1, 0x03099, 0x030C2},
+    {0x030C4, 0x03099, 0x030C5},
+    {0x030C6, 0x03099, 0x030C7},
+    {0x030C8, 0x03099, 0x030C9},
+    {0x030CF, 0x03099, 0x030D0},
+    {0x030CF, 0x0309A, 0x030D1},
+    {0x030D2, 0x03099, 0x030D3},
+    {0x030D2, 0x0309A, 0x030D4},
+    {0x030D5, 0x03099, 0x030D6},
+    {0x030D5, 0x0309A, 0x030D7},
+    {0x030D8, 0x03099, 0x030D9},
+    {0x030D8, 0x0309A, 0x030DA},
+    {0x030DB, 0x03099, 0x030DC},
+    {0x030DB, 0x0309A, 0x030DD},
+    {0x030EF, 0x03099, 0x030F7},
+    {0x030F0, 0x03099, 0x030F8},
+    {0x030F1, 0x03099, 0x030F9},
+    {0x030F2, 0x03099, 0x030FA},
+    {0x030FD, 0x03099, 0x030FE},
+    {0x11099, 0x110BA, 0x1109A},
+    {0x1109B, 0x110BA, 0x1109C},
+    {0x110A5, 0x110BA, 0x110AB},
+    {0x11131, 0x11127, 0x1112E},
+    {0x11132, 0x11127, 0x1112F},
+    {0x11347, 0x1133E, 0x1134B},
+    {0x11347, 0x11357, 0x1134C},
+    {0x114B9, 0x114B0, 0x114BC},
+    {0x114B9, 0x114BA, 0x114BB},
+    {0x114B9, 0x114BD, 0x114BE},
+    {0x115B8, 0x115AF, 0x115BA},
+    {0x115B9, 0x115AF, 0x115BB},
+    {0x11935, 0x11930, 0x11938},
+};
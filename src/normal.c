@@ -0,0 +1,686 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/normal.c
+ * @brief Unicode normalization forms (NFC, NFD, NFKC, NFKD).
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "simd.h"
+#include "codepoint.h"
+#include "validate.h"
+#include "normal.h"
+
+// --- Normalization Tables ---
+
+#define UTF8_HANGUL_S 0xAC00
+#define UTF8_HANGUL_L 0x1100
+#define UTF8_HANGUL_V 0x1161
+#define UTF8_HANGUL_T 0x11A7
+#define UTF8_HANGUL_V_COUNT 21
+#define UTF8_HANGUL_T_COUNT 28
+#define UTF8_HANGUL_N (UTF8_HANGUL_V_COUNT * UTF8_HANGUL_T_COUNT)
+#define UTF8_HANGUL_S_COUNT 11172
+
+#define UTF8_NORMAL_CP 0x1FFFFF  // Segment entries carry the ccc above the codepoint
+
+// Indexed by UTF8NormalForm
+static const uint8_t utf8_normal_no[4] = {
+    UTF8_NORMAL_NFC_NO, UTF8_NORMAL_NFD_NO, UTF8_NORMAL_NFKC_NO, UTF8_NORMAL_NFKD_NO
+};
+static const uint8_t utf8_normal_maybe[4] = {UTF8_NORMAL_NFC_MAYBE, 0, UTF8_NORMAL_NFKC_MAYBE, 0};
+static const uint32_t utf8_normal_min[4] = {
+    UTF8_NORMAL_NFC_MIN, UTF8_NORMAL_NFD_MIN, UTF8_NORMAL_NFKC_MIN, UTF8_NORMAL_NFKD_MIN
+};
+
+static inline const UTF8NormalRecord* utf8_normal_record(uint32_t cp) {
+    if (cp > 0x10FFFF) {
+        return &utf8_normal_records[0];
+    }
+
+    uint32_t block = utf8_normal_stage1[cp >> UTF8_NORMAL_SHIFT];
+    uint32_t mask = (1u << UTF8_NORMAL_SHIFT) - 1;
+    return &utf8_normal_records[utf8_normal_stage2[(block << UTF8_NORMAL_SHIFT) | (cp & mask)]];
+}
+
+uint8_t utf8_normal_ccc(uint32_t cp) {
+    return utf8_normal_record(cp)->ccc;
+}
+
+static inline bool utf8_normal_composes(UTF8NormalForm form) {
+    return form == UTF8_NFC || form == UTF8_NFKC;
+}
+
+// Decodes one sequence from input already known to be valid.
+static inline size_t utf8_normal_decode(const uint8_t* s, uint32_t* cp) {
+    uint8_t lead = s[0];
+    if (lead < 0x80) {
+        *cp = lead;
+        return 1;
+    } else if (lead < 0xE0) {
+        *cp = ((uint32_t) (lead & 0x1F) << 6) | (s[1] & 0x3F);
+        return 2;
+    } else if (lead < 0xF0) {
+        *cp = ((uint32_t) (lead & 0x0F) << 12) | ((uint32_t) (s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        return 3;
+    }
+
+    *cp = ((uint32_t) (lead & 0x07) << 18) | ((uint32_t) (s[1] & 0x3F) << 12)
+          | ((uint32_t) (s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+    return 4;
+}
+
+// --- Quick Check ---
+
+/**
+ * @note Every codepoint below utf8_normal_min[form] is a quick-check Yes starter, and
+ *       its bytes (lead and continuation alike) are all below the lead byte of that
+ *       minimum. The kernels find the first byte at or above the threshold, which is
+ *       always a lead byte, so skipping never leaves a codepoint boundary.
+ */
+static inline uint8_t utf8_normal_threshold(UTF8NormalForm form) {
+    uint32_t min = utf8_normal_min[form];
+    if (min < 0x80) {
+        return (uint8_t) min;
+    } else if (min < 0x800) {
+        return (uint8_t) (0xC0 | (min >> 6));
+    } else if (min < 0x10000) {
+        return (uint8_t) (0xE0 | (min >> 12));
+    }
+    return (uint8_t) (0xF0 | (min >> 18));
+}
+
+static size_t utf8_normal_skip_scalar(const uint8_t* s, size_t len, uint8_t threshold) {
+    const uint64_t ones = 0x0101010101010101ULL;
+    // The thresholds are never ASCII: a byte is >= threshold when its high bit is set
+    // and its low 7 bits, plus 0x80 - (threshold & 0x7F), carry into bit 7.
+    const uint64_t bias = ones * (uint8_t) (0x80 - (threshold & 0x7F));
+
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) {
+        uint64_t word;
+        memcpy(&word, s + i, sizeof(word));
+        uint64_t mask = ((word & (ones * 0x7F)) + bias) & word & (ones * 0x80);
+        if (mask) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+            return i + (size_t) __builtin_clzll(mask) / 8;
+#else
+            return i + (size_t) __builtin_ctzll(mask) / 8;
+#endif
+        }
+    }
+    while (i < len && s[i] < threshold) {
+        i++;
+    }
+    return i;
+}
+
+#if UTF8_SIMD_X86
+__attribute__((target("sse2")))
+static size_t utf8_normal_skip_sse2(const uint8_t* s, size_t len, uint8_t threshold) {
+    const __m128i t = _mm_set1_epi8((char) threshold);
+    size_t i = 0;
+    for (; i + 16 <= len; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*) (s + i));
+        // v >= t (unsigned) exactly where max(v, t) == v
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, t), v));
+        if (mask) {
+            return i + (size_t) __builtin_ctz((unsigned) mask);
+        }
+    }
+    while (i < len && s[i] < threshold) {
+        i++;
+    }
+    return i;
+}
+
+__attribute__((target("avx2")))
+static size_t utf8_normal_skip_avx2(const uint8_t* s, size_t len, uint8_t threshold) {
+    const __m256i t = _mm256_set1_epi8((char) threshold);
+    size_t i = 0;
+    for (; i + 32 <= len; i += 32) {
+        __m256i v = _mm256_loadu_si256((const __m256i*) (s + i));
+        int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(v, t), v));
+        if (mask) {
+            return i + (size_t) __builtin_ctz((unsigned) mask);
+        }
+    }
+    return i + utf8_normal_skip_sse2(s + i, len - i, threshold);
+}
+#endif  // UTF8_SIMD_X86
+
+// Length of the prefix of s made of codepoints below utf8_normal_min[form].
+static size_t utf8_normal_skip(const uint8_t* s, size_t len, UTF8NormalForm form) {
+    uint8_t threshold = utf8_normal_threshold(form);
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+        case UTF8_SIMD_AVX2:
+            return utf8_normal_skip_avx2(s, len, threshold);
+        case UTF8_SIMD_SSSE3:
+        case UTF8_SIMD_SSE2:
+            return utf8_normal_skip_sse2(s, len, threshold);
+#endif
+        default:
+            return utf8_normal_skip_scalar(s, len, threshold);
+    }
+}
+
+UTF8NormalCheck utf8_normal_quick_check(UTF8View src, UTF8NormalForm form) {
+    if (!src.ptr || form > UTF8_NFKD || utf8_validate(src).error != UTF8_ERROR_NONE) {
+        return UTF8_NORMAL_NO;
+    }
+
+    UTF8NormalCheck result = UTF8_NORMAL_YES;
+    uint8_t last = 0;
+    size_t i = 0;
+    while (i < src.len) {
+        size_t skip = utf8_normal_skip(src.ptr + i, src.len - i, form);
+        if (skip) {
+            i += skip;
+            last = 0;
+            if (i >= src.len) {
+                break;
+            }
+        }
+
+        uint32_t cp;
+        i += utf8_normal_decode(src.ptr + i, &cp);
+        const UTF8NormalRecord* record = utf8_normal_record(cp);
+        if (record->ccc && last > record->ccc) {
+            return UTF8_NORMAL_NO;
+        }
+        if (record->flags & utf8_normal_no[form]) {
+            return UTF8_NORMAL_NO;
+        }
+        if (record->flags & utf8_normal_maybe[form]) {
+            result = UTF8_NORMAL_MAYBE;
+        }
+        last = record->ccc;
+    }
+
+    return result;
+}
+
+UTF8NormalCheck utf8_nfc_quick_check(UTF8View src) {
+    return utf8_normal_quick_check(src, UTF8_NFC);
+}
+
+// --- Segments ---
+
+static inline bool utf8_normal_is_boundary(const UTF8NormalRecord* record, UTF8NormalForm form) {
+    uint8_t flags = utf8_normal_no[form] | utf8_normal_maybe[form];
+    return record->ccc == 0 && !(record->flags & flags);
+}
+
+/**
+ * @brief Length of the prefix of valid s that can be copied verbatim.
+ *
+ * The prefix is quick-check Yes throughout and ends just before a boundary starter:
+ * the last starter ahead of the first codepoint that needs normalizing may still
+ * compose with it, and so must go through the slow path. Unless final, the same
+ * holds for the last starter of s, since the next chunk may continue its segment.
+ * Returns 0 if s does not begin with a boundary starter.
+ */
+static size_t utf8_normal_span(const uint8_t* s, size_t len, UTF8NormalForm form, bool final) {
+    size_t starter = 0;  // Start of the last boundary starter
+    uint8_t last = 0;
+    size_t i = 0;
+    while (i < len) {
+        size_t skip = utf8_normal_skip(s + i, len - i, form);
+        if (skip) {
+            i += skip;
+            last = 0;
+            starter = i - 1;
+            while (starter > 0 && (s[starter] & 0xC0) == 0x80) {
+                starter--;
+            }
+            if (i >= len) {
+                break;
+            }
+        }
+
+        uint32_t cp;
+        size_t width = utf8_normal_decode(s + i, &cp);
+        const UTF8NormalRecord* record = utf8_normal_record(cp);
+        bool ordered = !record->ccc || last <= record->ccc;
+        if (!ordered || (record->flags & (utf8_normal_no[form] | utf8_normal_maybe[form]))) {
+            return starter;
+        }
+        if (record->ccc == 0) {
+            starter = i;
+        } else if (i == 0) {
+            return 0;  // A non-starter belongs to the segment before it
+        }
+        last = record->ccc;
+        i += width;
+    }
+
+    return final ? len : starter;
+}
+
+// --- Normalizer ---
+
+static inline uint32_t* utf8_normal_segment(UTF8Normalizer* normalizer) {
+    return normalizer->segment ? normalizer->segment : normalizer->local;
+}
+
+// Makes room for n more output bytes; only a streaming normalizer owns (and grows) its output.
+static bool utf8_normal_reserve(UTF8Normalizer* normalizer, size_t n) {
+    if (!normalizer->emit || normalizer->out_len + n <= normalizer->out_capacity) {
+        return true;
+    }
+
+    size_t capacity = normalizer->out_capacity * 2;
+    if (capacity < normalizer->out_len + n) {
+        capacity = normalizer->out_len + n;
+    }
+    uint8_t* out = realloc(normalizer->out, capacity);
+    if (!out) {
+        return false;
+    }
+
+    normalizer->out = out;
+    normalizer->out_capacity = capacity;
+    return true;
+}
+
+// Writes (or, without an output buffer, counts) one codepoint.
+static inline void utf8_normal_write(UTF8Normalizer* normalizer, uint32_t cp) {
+    if (!normalizer->out) {
+        normalizer->out_len += 1 + (cp >= 0x80) + (cp >= 0x800) + (cp >= 0x10000);
+        return;
+    }
+
+    normalizer->out_len += (size_t) utf8_cp_encode((int32_t) cp, normalizer->out + normalizer->out_len);
+}
+
+static bool utf8_normal_copy(UTF8Normalizer* normalizer, const uint8_t* s, size_t len) {
+    if (!utf8_normal_reserve(normalizer, len)) {
+        return false;
+    }
+    if (normalizer->out) {
+        memcpy(normalizer->out + normalizer->out_len, s, len);
+    }
+    normalizer->out_len += len;
+    return true;
+}
+
+static uint32_t utf8_normal_compose_pair(uint32_t first, uint32_t second) {
+    // Hangul: L + V -> LV, then LV + T -> LVT
+    if (first - UTF8_HANGUL_L < 19 && second - UTF8_HANGUL_V < UTF8_HANGUL_V_COUNT) {
+        uint32_t l = first - UTF8_HANGUL_L;
+        uint32_t v = second - UTF8_HANGUL_V;
+        return UTF8_HANGUL_S + (l * UTF8_HANGUL_V_COUNT + v) * UTF8_HANGUL_T_COUNT;
+    }
+    uint32_t s = first - UTF8_HANGUL_S;
+    if (s < UTF8_HANGUL_S_COUNT && s % UTF8_HANGUL_T_COUNT == 0
+        && second - UTF8_HANGUL_T - 1 < UTF8_HANGUL_T_COUNT - 1) {
+        return first + (second - UTF8_HANGUL_T);
+    }
+
+    // Every second element of a primary composite is quick-check Maybe
+    if (!(utf8_normal_record(second)->flags & UTF8_NORMAL_NFC_MAYBE)) {
+        return 0;
+    }
+
+    size_t lo = 0;
+    size_t hi = sizeof(utf8_normal_pairs) / sizeof(UTF8NormalPair);
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        const UTF8NormalPair* pair = &utf8_normal_pairs[mid];
+        if (pair->first < first || (pair->first == first && pair->second < second)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo < sizeof(utf8_normal_pairs) / sizeof(UTF8NormalPair)
+        && utf8_normal_pairs[lo].first == first && utf8_normal_pairs[lo].second == second) {
+        return utf8_normal_pairs[lo].composite;
+    }
+
+    return 0;
+}
+
+/**
+ * @note Canonical ordering is a stable insertion sort of each run of non-starters
+ *       by ccc (runs are short). Composition then joins each codepoint with the last
+ *       starter unless a codepoint of the same or higher ccc sits between them.
+ */
+static bool utf8_normal_flush(UTF8Normalizer* normalizer) {
+    uint32_t* segment = utf8_normal_segment(normalizer);
+    size_t count = normalizer->count;
+
+    for (size_t i = 1; i < count; i++) {
+        uint32_t entry = segment[i];
+        size_t j = i;
+        while (j > 0 && (segment[j - 1] >> 24) > (entry >> 24) && (entry >> 24)) {
+            segment[j] = segment[j - 1];
+            j--;
+        }
+        segment[j] = entry;
+    }
+
+    if (utf8_normal_composes(normalizer->form)) {
+        size_t w = 0;
+        size_t starter = SIZE_MAX;
+        uint32_t last = 0;
+        for (size_t i = 0; i < count; i++) {
+            uint32_t entry = segment[i];
+            uint32_t ccc = entry >> 24;
+            if (starter != SIZE_MAX && (w == starter + 1 || last < ccc)) {
+                uint32_t composite = utf8_normal_compose_pair(
+                    segment[starter] & UTF8_NORMAL_CP, entry & UTF8_NORMAL_CP
+                );
+                if (composite) {
+                    segment[starter] = ((uint32_t) utf8_normal_ccc(composite) << 24) | composite;
+                    continue;
+                }
+            }
+            if (ccc == 0) {
+                starter = w;
+            }
+            last = ccc;
+            segment[w++] = entry;
+        }
+        count = w;
+    }
+
+    if (!utf8_normal_reserve(normalizer, count * 4)) {
+        return false;
+    }
+    for (size_t i = 0; i < count; i++) {
+        utf8_normal_write(normalizer, segment[i] & UTF8_NORMAL_CP);
+    }
+
+    normalizer->count = 0;
+    return true;
+}
+
+static bool utf8_normal_append(UTF8Normalizer* normalizer, uint32_t cp) {
+    const UTF8NormalRecord* record = utf8_normal_record(cp);
+    if (normalizer->count && utf8_normal_is_boundary(record, normalizer->form)) {
+        if (!utf8_normal_flush(normalizer)) {
+            return false;
+        }
+    }
+
+    if (normalizer->count == normalizer->capacity) {
+        size_t capacity = normalizer->capacity * 2;
+        uint32_t* segment = realloc(normalizer->segment, capacity * sizeof(uint32_t));
+        if (!segment) {
+            return false;
+        }
+        if (!normalizer->segment) {
+            memcpy(segment, normalizer->local, sizeof(normalizer->local));
+        }
+        normalizer->segment = segment;
+        normalizer->capacity = capacity;
+    }
+
+    utf8_normal_segment(normalizer)[normalizer->count++] = ((uint32_t) record->ccc << 24) | cp;
+    return true;
+}
+
+// Decomposes cp fully (canonical or compatibility, by form) into the segment.
+static bool utf8_normal_push(UTF8Normalizer* normalizer, uint32_t cp) {
+    uint32_t s = cp - UTF8_HANGUL_S;
+    if (s < UTF8_HANGUL_S_COUNT) {
+        uint32_t t = s % UTF8_HANGUL_T_COUNT;
+        return utf8_normal_append(normalizer, UTF8_HANGUL_L + s / UTF8_HANGUL_N)
+               && utf8_normal_append(
+                   normalizer, UTF8_HANGUL_V + (s % UTF8_HANGUL_N) / UTF8_HANGUL_T_COUNT
+               )
+               && (!t || utf8_normal_append(normalizer, UTF8_HANGUL_T + t));
+    }
+
+    const UTF8NormalRecord* record = utf8_normal_record(cp);
+    bool compat = normalizer->form == UTF8_NFKC || normalizer->form == UTF8_NFKD;
+    size_t offset = compat ? record->compat : record->canonical;
+    size_t len = compat ? record->compat_len : record->canonical_len;
+    if (!len) {
+        return utf8_normal_append(normalizer, cp);
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        if (!utf8_normal_append(normalizer, utf8_normal_decomp[offset + i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Normalizes valid s, copying already-normalized runs verbatim.
+static bool utf8_normal_run(UTF8Normalizer* normalizer, const uint8_t* s, size_t len, bool final) {
+    UTF8NormalForm form = normalizer->form;
+    size_t i = 0;
+    while (i < len) {
+        size_t span = utf8_normal_span(s + i, len - i, form, final);
+        if (span) {
+            if (normalizer->count && !utf8_normal_flush(normalizer)) {
+                return false;
+            }
+            if (!utf8_normal_copy(normalizer, s + i, span)) {
+                return false;
+            }
+            i += span;
+        }
+
+        // One codepoint at a time up to the next boundary starter
+        while (i < len) {
+            uint32_t cp;
+            i += utf8_normal_decode(s + i, &cp);
+            if (!utf8_normal_push(normalizer, cp)) {
+                return false;
+            }
+            if (i < len) {
+                utf8_normal_decode(s + i, &cp);
+                if (utf8_normal_is_boundary(utf8_normal_record(cp), form)) {
+                    break;
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+static void utf8_normal_init(UTF8Normalizer* normalizer, UTF8NormalForm form) {
+    normalizer->form = form;
+    normalizer->segment = NULL;
+    normalizer->count = 0;
+    normalizer->capacity = UTF8_NORMAL_SEGMENT;
+    normalizer->out = NULL;
+    normalizer->out_len = 0;
+    normalizer->out_capacity = 0;
+    normalizer->carry_len = 0;
+    normalizer->offset = 0;
+    normalizer->status = (UTF8Validation) {UTF8_ERROR_NONE, 0};
+    normalizer->stopped = false;
+    normalizer->emit = NULL;
+    normalizer->ctx = NULL;
+}
+
+// Normalizes (or with dst NULL, measures) the valid prefix of src.
+static UTF8Validation utf8_normal_once(
+    UTF8View src, UTF8NormalForm form, uint8_t* dst, size_t* written, bool* ok
+) {
+    UTF8Validation result = utf8_validate(src);
+
+    UTF8Normalizer normalizer;
+    utf8_normal_init(&normalizer, form);
+    normalizer.out = dst;
+    *ok = utf8_normal_run(&normalizer, src.ptr, result.offset, true)
+          && utf8_normal_flush(&normalizer);
+    free(normalizer.segment);
+
+    *written = normalizer.out_len;
+    return result;
+}
+
+int64_t utf8_normalize_length(UTF8View src, UTF8NormalForm form) {
+    if (!src.ptr || form > UTF8_NFKD) {
+        return -1;
+    }
+
+    size_t n = 0;
+    bool ok = false;
+    if (utf8_normal_once(src, form, NULL, &n, &ok).error != UTF8_ERROR_NONE || !ok) {
+        return -1;
+    }
+
+    return (int64_t) n;
+}
+
+UTF8Validation utf8_normalize(UTF8View src, UTF8NormalForm form, uint8_t* dst, size_t* written) {
+    if (!src.ptr || !dst || !written || form > UTF8_NFKD) {
+        return (UTF8Validation) {UTF8_ERROR_TRUNCATED, 0};
+    }
+
+    bool ok = false;
+    UTF8Validation result = utf8_normal_once(src, form, dst, written, &ok);
+    if (!ok) {
+        // Allocation failure on a run of over UTF8_NORMAL_SEGMENT non-starters
+        return (UTF8Validation) {UTF8_ERROR_TRUNCATED, 0};
+    }
+    return result;
+}
+
+// --- Streaming ---
+
+bool utf8_normalizer_init(
+    UTF8Normalizer* normalizer, UTF8NormalForm form, UTF8NormalCallback emit, void* ctx
+) {
+    if (!normalizer || form > UTF8_NFKD || !emit) {
+        return false;
+    }
+
+    utf8_normal_init(normalizer, form);
+    normalizer->emit = emit;
+    normalizer->ctx = ctx;
+    return true;
+}
+
+void utf8_normalizer_free(UTF8Normalizer* normalizer) {
+    if (!normalizer) {
+        return;
+    }
+
+    free(normalizer->segment);
+    free(normalizer->out);
+    normalizer->segment = NULL;
+    normalizer->out = NULL;
+    normalizer->count = normalizer->out_len = normalizer->out_capacity = 0;
+    normalizer->capacity = UTF8_NORMAL_SEGMENT;
+}
+
+// Hands the pending output to the callback.
+static bool utf8_normal_deliver(UTF8Normalizer* normalizer) {
+    if (normalizer->out_len && !normalizer->stopped) {
+        UTF8View view = utf8_view_n(normalizer->out, normalizer->out_len);
+        normalizer->stopped = !normalizer->emit(view, normalizer->ctx);
+    }
+    normalizer->out_len = 0;
+    return !normalizer->stopped;
+}
+
+// Stops on invalid input at offset: delivers everything before it.
+static bool utf8_normal_fail(UTF8Normalizer* normalizer, UTF8Error error, size_t offset) {
+    normalizer->status = (UTF8Validation) {error, offset};
+    if (utf8_normal_flush(normalizer)) {
+        utf8_normal_deliver(normalizer);
+    }
+    return false;
+}
+
+bool utf8_normalizer_feed(UTF8Normalizer* normalizer, UTF8View chunk) {
+    if (!normalizer || !normalizer->emit || !chunk.ptr) {
+        return false;
+    }
+    if (normalizer->stopped || normalizer->status.error != UTF8_ERROR_NONE) {
+        return false;
+    }
+
+    const uint8_t* s = chunk.ptr;
+    size_t len = chunk.len;
+    size_t start = normalizer->offset;
+    size_t i = 0;
+
+    // Complete a sequence carried over from the previous chunk
+    if (normalizer->carry_len) {
+        size_t carried = normalizer->carry_len;
+        size_t width = (size_t) utf8_cp_width(normalizer->carry);
+        size_t take = width - carried < len ? width - carried : len;
+        memcpy(normalizer->carry + carried, s, take);
+        normalizer->carry_len += take;
+        i = take;
+        if (normalizer->carry_len < width) {
+            normalizer->offset += len;
+            return true;
+        }
+
+        UTF8Validation check = utf8_validate(utf8_view_n(normalizer->carry, width));
+        normalizer->carry_len = 0;
+        if (check.error != UTF8_ERROR_NONE) {
+            return utf8_normal_fail(normalizer, check.error, start - carried);
+        }
+        uint32_t cp;
+        utf8_normal_decode(normalizer->carry, &cp);
+        if (!utf8_normal_push(normalizer, cp)) {
+            return false;
+        }
+    }
+
+    UTF8View rest = utf8_view_n(s + i, len - i);
+    UTF8Validation check = utf8_validate(rest);
+    size_t valid = check.offset;
+    bool failed = false;
+    if (check.error != UTF8_ERROR_NONE) {
+        // A sequence cut off by the end of the chunk is carried, not an error
+        const uint8_t* tail = rest.ptr + valid;
+        size_t tail_len = rest.len - valid;
+        int8_t width = utf8_cp_width(tail);
+        bool incomplete = check.error == UTF8_ERROR_TRUNCATED && width > 0
+                          && (size_t) width > tail_len;
+        for (size_t k = 1; incomplete && k < tail_len; k++) {
+            incomplete = (tail[k] & 0xC0) == 0x80;
+        }
+
+        if (incomplete) {
+            memcpy(normalizer->carry, tail, tail_len);
+            normalizer->carry_len = tail_len;
+        } else {
+            failed = true;
+        }
+    }
+
+    if (!utf8_normal_run(normalizer, rest.ptr, valid, failed)) {
+        return false;
+    }
+    normalizer->offset += len;
+    if (failed) {
+        return utf8_normal_fail(normalizer, check.error, start + i + valid);
+    }
+
+    return utf8_normal_deliver(normalizer);
+}
+
+bool utf8_normalizer_finish(UTF8Normalizer* normalizer) {
+    if (!normalizer || !normalizer->emit) {
+        return false;
+    }
+    if (normalizer->stopped || normalizer->status.error != UTF8_ERROR_NONE) {
+        return false;
+    }
+
+    if (normalizer->carry_len) {
+        size_t offset = normalizer->offset - normalizer->carry_len;
+        normalizer->carry_len = 0;
+        return utf8_normal_fail(normalizer, UTF8_ERROR_TRUNCATED, offset);
+    }
+
+    return utf8_normal_flush(normalizer) && utf8_normal_deliver(normalizer);
+}
@@ -0,0 +1,471 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/parallel.c
+ * @brief Multi-threaded join, split and regex search built on OpenMP.
+ */
+
+#include <omp.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "byte.h"
+#include "codepoint.h"
+#include "search.h"
+#include "regex.h"
+#include "parallel.h"
+
+// Resolves the worker count; 1 means run the sequential routine.
+static int utf8_parallel_workers(int threads, size_t bytes) {
+    if (threads == 1) {
+        return 1;
+    }
+
+    if (threads <= 0) {
+        if (bytes < UTF8_PARALLEL_MIN_BYTES) {
+            return 1;
+        }
+        threads = omp_get_max_threads();
+    }
+
+    return threads;
+}
+
+// --- Join ---
+
+uint8_t* utf8_byte_join_view_parallel(
+    const UTF8View* parts, uint64_t count, UTF8View delim, int threads
+) {
+    if (!parts || count == 0) {
+        return NULL;
+    }
+
+    // The output size is unknown until measured; the part table stands in for it
+    int workers = utf8_parallel_workers(threads, count * sizeof(UTF8View));
+    if (workers == 1 || count < (uint64_t) workers) {
+        return utf8_byte_join_view(parts, count, delim);
+    }
+
+    size_t* sums = calloc((size_t) workers + 1, sizeof(size_t));
+    if (!sums) {
+        return NULL;
+    }
+
+    delim.len = delim.ptr ? delim.len : 0;
+    uint8_t* buffer = NULL;
+    size_t total = 0;
+    int invalid = 0;
+
+#pragma omp parallel num_threads(workers)
+    {
+        int t = omp_get_thread_num();
+        int n = omp_get_num_threads();
+        uint64_t lo = count * (uint64_t) t / (uint64_t) n;
+        uint64_t hi = count * (uint64_t) (t + 1) / (uint64_t) n;
+
+        // Bytes produced by this block; a delimiter precedes every part but the first
+        size_t sum = 0;
+        for (uint64_t i = lo; i < hi; i++) {
+            if (!parts[i].ptr) {
+#pragma omp atomic write
+                invalid = 1;
+            }
+            sum += parts[i].len + (i > 0 ? delim.len : 0);
+        }
+        sums[t + 1] = sum;
+
+#pragma omp barrier
+#pragma omp single
+        {
+            // Exclusive prefix sum gives every block its output offset
+            for (int k = 0; k < n; k++) {
+                sums[k + 1] += sums[k];
+            }
+            total = sums[n];
+            buffer = invalid ? NULL : malloc(total + 1);
+        }
+
+        if (buffer) {
+            uint8_t* out = buffer + sums[t];
+            for (uint64_t i = lo; i < hi; i++) {
+                if (i > 0 && delim.len > 0) {
+                    memcpy(out, delim.ptr, delim.len);
+                    out += delim.len;
+                }
+                if (parts[i].len > 0) {
+                    memcpy(out, parts[i].ptr, parts[i].len);
+                    out += parts[i].len;
+                }
+            }
+        }
+    }
+
+    if (buffer) {
+        buffer[total] = '\0';
+    }
+
+    free(sums);
+    return buffer;
+}
+
+uint8_t* utf8_byte_join_parallel(uint8_t** parts, uint64_t count, const uint8_t* delim, int threads) {
+    if (!parts || count == 0) {
+        return NULL;
+    }
+
+    int workers = utf8_parallel_workers(threads, count * sizeof(UTF8View));
+    if (workers == 1) {
+        return utf8_byte_join(parts, count, delim);
+    }
+
+    // Measuring every part is half the work, so it is split across workers too
+    UTF8View* views = malloc(count * sizeof(UTF8View));
+    if (!views) {
+        return NULL;
+    }
+
+#pragma omp parallel for num_threads(workers) schedule(static)
+    for (uint64_t i = 0; i < count; i++) {
+        views[i] = utf8_view(parts[i]);
+    }
+
+    uint8_t* buffer = utf8_byte_join_view_parallel(views, count, utf8_view(delim), workers);
+    free(views);
+    return buffer;
+}
+
+// --- Split ---
+
+typedef struct UTF8ParallelChunk {
+    UTF8SpanList matches;  // Delimiter matches (or codepoints) starting in [lo, hi)
+    size_t lo;
+    size_t hi;
+    size_t start;  // Start of the first field of this chunk
+    size_t base;  // Index of this chunk's first output span
+    bool ok;
+} UTF8ParallelChunk;
+
+typedef struct UTF8ParallelScan {
+    UTF8ParallelChunk* chunk;
+    size_t base;  // Offset of the scanned slice within the source
+    size_t delim_len;
+    bool failed;
+} UTF8ParallelScan;
+
+static bool utf8_parallel_match_emit(size_t offset, void* ctx) {
+    UTF8ParallelScan* scan = (UTF8ParallelScan*) ctx;
+    size_t at = scan->base + offset;
+    if (at >= scan->chunk->hi) {
+        return false;  // Belongs to the next chunk
+    }
+
+    if (!utf8_span_list_push(&scan->chunk->matches, at, scan->delim_len)) {
+        scan->failed = true;
+        return false;
+    }
+    return true;
+}
+
+// Records the non-overlapping matches that start in [from, hi).
+static bool utf8_parallel_scan_chunk(
+    const UTF8Finder* finder, UTF8View src, UTF8ParallelChunk* chunk, size_t from
+) {
+    utf8_span_list_clear(&chunk->matches);
+    if (from >= chunk->hi) {
+        return true;
+    }
+
+    // A match starting before hi may run up to delim_len - 1 bytes past it
+    size_t delim_len = finder->needle.len;
+    size_t limit = chunk->hi + delim_len - 1 < src.len ? chunk->hi + delim_len - 1 : src.len;
+    UTF8View hay = utf8_view_slice(src, from, limit - from);
+
+    UTF8ParallelScan scan = {.chunk = chunk, .base = from, .delim_len = delim_len};
+    utf8_finder_scan(finder, hay, utf8_parallel_match_emit, &scan);
+    return !scan.failed;
+}
+
+bool utf8_byte_split_delim_spans_parallel(
+    UTF8View src, UTF8View delim, UTF8SpanList* out, int threads
+) {
+    if (!src.ptr || !out) {
+        return false;
+    }
+
+    int workers = utf8_parallel_workers(threads, src.len);
+    if (workers == 1 || !delim.ptr || delim.len == 0 || src.len < (size_t) workers) {
+        return utf8_byte_split_delim_spans(src, delim, out);
+    }
+
+    UTF8Finder finder;
+    utf8_finder_init(&finder, delim);
+
+    UTF8ParallelChunk* chunks = calloc((size_t) workers, sizeof(UTF8ParallelChunk));
+    if (!chunks) {
+        return false;
+    }
+
+#pragma omp parallel for num_threads(workers) schedule(static, 1)
+    for (int c = 0; c < workers; c++) {
+        chunks[c].lo = src.len * (size_t) c / (size_t) workers;
+        chunks[c].hi = src.len * (size_t) (c + 1) / (size_t) workers;
+        chunks[c].ok = utf8_parallel_scan_chunk(&finder, src, &chunks[c], chunks[c].lo);
+    }
+
+    // Stitch in order: a chunk whose first match overlaps the previous chunk's last
+    // match was scanned from the wrong phase and is re-scanned from the right one
+    bool ok = true;
+    size_t next = 0;
+    size_t total = 0;
+    for (int c = 0; c < workers && ok; c++) {
+        UTF8ParallelChunk* chunk = &chunks[c];
+        ok = chunk->ok;
+        if (ok && chunk->matches.count > 0 && chunk->matches.spans[0].offset < next) {
+            ok = utf8_parallel_scan_chunk(&finder, src, chunk, next);
+        }
+
+        chunk->start = next;
+        chunk->base = total;
+        total += chunk->matches.count;
+        if (chunk->matches.count > 0) {
+            next = chunk->matches.spans[chunk->matches.count - 1].offset + delim.len;
+        }
+    }
+
+    // Trailing text after the last delimiter (or if no delimiter at all)
+    bool trailing = next < src.len;
+    utf8_span_list_clear(out);
+    ok = ok && utf8_span_list_reserve(out, total + trailing);
+
+    if (ok) {
+#pragma omp parallel for num_threads(workers) schedule(static, 1)
+        for (int c = 0; c < workers; c++) {
+            UTF8Span* dst = out->spans + chunks[c].base;
+            size_t current = chunks[c].start;
+            for (size_t i = 0; i < chunks[c].matches.count; i++) {
+                size_t offset = chunks[c].matches.spans[i].offset;
+                dst[i] = (UTF8Span) {.offset = current, .len = offset - current};
+                current = offset + delim.len;
+            }
+        }
+
+        if (trailing) {
+            out->spans[total] = (UTF8Span) {.offset = next, .len = src.len - next};
+        }
+        out->count = total + trailing;
+    }
+
+    for (int c = 0; c < workers; c++) {
+        utf8_span_list_free(&chunks[c].matches);
+    }
+    free(chunks);
+    return ok;
+}
+
+bool utf8_cp_split_spans_parallel(UTF8View src, UTF8SpanList* out, int threads) {
+    if (!src.ptr || !out) {
+        return false;
+    }
+
+    int workers = utf8_parallel_workers(threads, src.len);
+    if (workers == 1 || src.len < (size_t) workers) {
+        return utf8_cp_split_spans(src, out);
+    }
+
+    UTF8ParallelChunk* chunks = calloc((size_t) workers, sizeof(UTF8ParallelChunk));
+    if (!chunks) {
+        return false;
+    }
+
+    // Cut at lead bytes; a codepoint is at most three continuation bytes long
+    for (int c = 0; c < workers; c++) {
+        size_t lo = c == 0 ? 0 : chunks[c - 1].hi;
+        size_t hi = src.len * (size_t) (c + 1) / (size_t) workers;
+        for (int k = 0; k < 3 && hi < src.len && (src.ptr[hi] & 0xC0) == 0x80; k++) {
+            hi++;
+        }
+        chunks[c].lo = lo;
+        chunks[c].hi = hi < lo ? lo : hi;
+    }
+    chunks[workers - 1].hi = src.len;
+
+#pragma omp parallel for num_threads(workers) schedule(static, 1)
+    for (int c = 0; c < workers; c++) {
+        UTF8ParallelChunk* chunk = &chunks[c];
+        UTF8CpCursor cursor = {src.ptr, src.ptr + chunk->lo, src.ptr + src.len};
+        const uint8_t* hi = src.ptr + chunk->hi;
+        chunk->ok = true;
+        while (cursor.current < hi) {
+            UTF8CpRef ref = utf8_cp_cursor_next(&cursor);
+            size_t pos = (size_t) (ref.ptr - src.ptr);
+            if (ref.width < 1 || !utf8_span_list_push(&chunk->matches, pos, (size_t) ref.width)) {
+                chunk->ok = false;
+                break;
+            }
+        }
+
+        // Landing past hi means the cut was not a real boundary
+        chunk->ok = chunk->ok && cursor.current == hi;
+    }
+
+    bool ok = true;
+    size_t total = 0;
+    for (int c = 0; c < workers; c++) {
+        ok = ok && chunks[c].ok;
+        chunks[c].base = total;
+        total += chunks[c].matches.count;
+    }
+
+    if (ok) {
+        utf8_span_list_clear(out);
+        ok = utf8_span_list_reserve(out, total);
+        if (ok) {
+#pragma omp parallel for num_threads(workers) schedule(static, 1)
+            for (int c = 0; c < workers; c++) {
+                if (chunks[c].matches.count == 0) {
+                    continue;
+                }
+
+                memcpy(
+                    out->spans + chunks[c].base,
+                    chunks[c].matches.spans,
+                    chunks[c].matches.count * sizeof(UTF8Span)
+                );
+            }
+            out->count = total;
+        }
+    } else {
+        // Malformed input: the sequential walk decides (and reports) what happens
+        ok = utf8_cp_split_spans(src, out);
+    }
+
+    for (int c = 0; c < workers; c++) {
+        utf8_span_list_free(&chunks[c].matches);
+    }
+    free(chunks);
+    return ok;
+}
+
+// --- Regex ---
+
+typedef struct UTF8ParallelFind {
+    UTF8RegexMatches rows;  // Private, growable
+    size_t base;  // First output row
+    bool ok;
+} UTF8ParallelFind;
+
+// Collects every match in docs[lo, hi) into block->rows.
+static bool utf8_parallel_find_block(
+    const pcre2_code* code, const UTF8View* docs, size_t lo, size_t hi, UTF8ParallelFind* block
+) {
+    UTF8RegexIter iter = {0};
+    bool ok = utf8_regex_matches_init(&block->rows, code, 0)
+              && utf8_regex_iter_init(&iter, code, utf8_view_n((const uint8_t*) "", 0));
+
+    for (size_t d = lo; d < hi && ok; d++) {
+        if (!docs[d].ptr) {
+            ok = false;
+            break;
+        }
+
+        utf8_regex_iter_reset(&iter, docs[d]);
+        size_t start;
+        size_t end;
+        for (size_t i = 0; ok && utf8_regex_iter_next(&iter, &start, &end); i++) {
+            ok = utf8_regex_matches_push(&block->rows, d, i, pcre2_get_ovector_pointer(iter.match));
+        }
+        ok = ok && iter.error == 0;
+    }
+
+    utf8_regex_iter_free(&iter);
+    return ok;
+}
+
+bool utf8_regex_findall_parallel(
+    const pcre2_code* code,
+    const UTF8View* docs,
+    size_t n,
+    UTF8RegexMatches* out,
+    size_t* total,
+    int threads
+) {
+    if (!code || (!docs && n > 0) || !out || !out->doc || !total) {
+        return false;
+    }
+
+    size_t bytes = 0;
+    for (size_t d = 0; d < n; d++) {
+        bytes += docs[d].len;
+    }
+
+    int workers = utf8_parallel_workers(threads, bytes);
+    if (workers == 1 || n < (size_t) workers) {
+        return utf8_regex_findall(code, docs, n, out, total);
+    }
+
+    out->count = 0;
+    *total = 0;
+
+    uint32_t captures = 0;
+    pcre2_pattern_info(code, PCRE2_INFO_CAPTURECOUNT, &captures);
+    if (out->groups != (size_t) captures + 1) {
+        return false;
+    }
+
+    UTF8ParallelFind* blocks = calloc((size_t) workers, sizeof(UTF8ParallelFind));
+    if (!blocks) {
+        return false;
+    }
+
+#pragma omp parallel for num_threads(workers) schedule(static, 1)
+    for (int b = 0; b < workers; b++) {
+        size_t lo = n * (size_t) b / (size_t) workers;
+        size_t hi = n * (size_t) (b + 1) / (size_t) workers;
+        blocks[b].ok = utf8_parallel_find_block(code, docs, lo, hi, &blocks[b]);
+    }
+
+    // Blocks are in document order, so their rows follow one another
+    bool ok = true;
+    size_t found = 0;
+    for (int b = 0; b < workers; b++) {
+        ok = ok && blocks[b].ok;
+        blocks[b].base = found;
+        found += blocks[b].rows.count;
+    }
+
+    if (ok) {
+#pragma omp parallel for num_threads(workers) schedule(static, 1)
+        for (int b = 0; b < workers; b++) {
+            const UTF8RegexMatches* rows = &blocks[b].rows;
+            size_t base = blocks[b].base;
+            if (base >= out->capacity || rows->count == 0) {
+                continue;
+            }
+
+            size_t m = out->capacity - base < rows->count ? out->capacity - base : rows->count;
+            memcpy(out->doc + base, rows->doc, m * sizeof(size_t));
+            memcpy(out->index + base, rows->index, m * sizeof(size_t));
+            for (size_t g = 0; g < out->groups; g++) {
+                memcpy(
+                    out->starts + g * out->capacity + base,
+                    rows->starts + g * rows->capacity,
+                    m * sizeof(size_t)
+                );
+                memcpy(
+                    out->ends + g * out->capacity + base,
+                    rows->ends + g * rows->capacity,
+                    m * sizeof(size_t)
+                );
+            }
+        }
+
+        out->count = found < out->capacity ? found : out->capacity;
+        *total = found;
+    }
+
+    for (int b = 0; b < workers; b++) {
+        utf8_regex_matches_free(&blocks[b].rows);
+    }
+    free(blocks);
+    return ok;
+}
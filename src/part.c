@@ -0,0 +1,120 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/part.c
+ * @brief Growable list of owned, null-terminated strings.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "part.h"
+
+#define UTF8_PART_LIST_MIN 16
+
+bool utf8_part_list_reserve(UTF8PartList* list, size_t capacity) {
+    if (!list) {
+        return false;
+    }
+
+    if (capacity <= list->capacity) {
+        return true;
+    }
+
+    // Doubling keeps n pushes at O(log n) reallocations of the table
+    size_t rounded = UTF8_PART_LIST_MIN;
+    while (rounded < capacity) {
+        if (rounded > SIZE_MAX / 2 / sizeof(uint8_t*)) {
+            return false;
+        }
+        rounded *= 2;
+    }
+
+    uint8_t** temp = realloc(list->parts, rounded * sizeof(uint8_t*));
+    if (!temp) {
+        return false;
+    }
+
+    list->parts = temp;
+    list->capacity = rounded;
+    return true;
+}
+
+bool utf8_part_list_push(UTF8PartList* list, uint8_t* part) {
+    if (!list || !part) {
+        return false;
+    }
+
+    if (list->count == list->capacity) {
+        if (!utf8_part_list_reserve(list, list->count + 1)) {
+            return false;
+        }
+    }
+
+    list->parts[list->count++] = part;
+    return true;
+}
+
+bool utf8_part_list_push_view(UTF8PartList* list, UTF8View view) {
+    if (!list || !view.ptr) {
+        return false;
+    }
+
+    uint8_t* part = malloc(view.len + 1);
+    if (!part) {
+        return false;
+    }
+
+    if (view.len > 0) {
+        memcpy(part, view.ptr, view.len);
+    }
+    part[view.len] = '\0';
+
+    if (!utf8_part_list_push(list, part)) {
+        free(part);
+        return false;
+    }
+
+    return true;
+}
+
+uint8_t* utf8_part_list_get(const UTF8PartList* list, size_t index) {
+    if (!list || index >= list->count) {
+        return NULL;
+    }
+
+    return list->parts[index];
+}
+
+void utf8_part_list_clear(UTF8PartList* list) {
+    if (list) {
+        for (size_t i = 0; i < list->count; i++) {
+            free(list->parts[i]);
+        }
+        list->count = 0;
+    }
+}
+
+void utf8_part_list_free(UTF8PartList* list) {
+    if (list) {
+        utf8_part_list_clear(list);
+        free(list->parts);
+        *list = (UTF8PartList) {0};
+    }
+}
+
+uint8_t** utf8_part_list_release(UTF8PartList* list, uint64_t* count) {
+    if (!list || !count) {
+        return NULL;
+    }
+
+    // Empty results are still a valid (freeable) array
+    if (!utf8_part_list_reserve(list, 1)) {
+        return NULL;
+    }
+
+    uint8_t** parts = list->parts;
+    *count = list->count;
+    *list = (UTF8PartList) {0};
+    return parts;
+}
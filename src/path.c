@@ -11,6 +11,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 
+#include "part.h"
 #include "path.h"
 
 // PathInfo lifecycle
@@ -224,17 +225,87 @@ PathSplit* path_split(const char* path) {
     split->length = 0;
     split->parts = NULL;
 
-    // Estimate components length and allocate memory
+    // Collect components into a geometrically grown list
+    UTF8PartList list = {0};
     char* temp = strdup(path);
-    char* token = strtok(temp, "/");
-    while (token) {
-        split->parts = realloc(split->parts, (split->length + 1) * sizeof(char*));
-        split->parts[split->length] = strdup(token);
-        split->length += 1;
-        token = strtok(NULL, "/");
+    if (!temp) {
+        free(split);
+        return NULL;
     }
 
+    char* token = strtok(temp, PATH_SEPARATOR_STR);
+    while (token) {
+        char* part = strdup(token);
+        if (!part || !utf8_part_list_push(&list, (uint8_t*) part)) {
+            free(part);
+            utf8_part_list_free(&list);
+            free(temp);
+            free(split);
+            return NULL;
+        }
+        token = strtok(NULL, PATH_SEPARATOR_STR);
+    }
     free(temp);
+
+    if (list.count > 0) {
+        uint64_t length = 0;
+        split->parts = (char**) utf8_part_list_release(&list, &length);
+        split->length = (uint32_t) length;
+    }
+
+    return split;
+}
+
+// Splits a path into components allocated from an arena
+PathSplit* path_split_arena(const char* path, UTF8Arena* arena) {
+    if (!path || *path == '\0' || !arena) {
+        return NULL;
+    }
+
+    // Count components and their bytes so everything is allocated at once
+    uint32_t length = 0;
+    size_t bytes = 0;
+    for (const char* cursor = path; *cursor;) {
+        while (*cursor == PATH_SEPARATOR_CHR) {
+            cursor++;
+        }
+        const char* token = cursor;
+        while (*cursor && *cursor != PATH_SEPARATOR_CHR) {
+            cursor++;
+        }
+        if (cursor > token) {
+            length++;
+            bytes += (size_t) (cursor - token) + 1;
+        }
+    }
+
+    size_t table = sizeof(PathSplit) + length * sizeof(char*);
+    PathSplit* split = utf8_arena_alloc(arena, table + bytes);
+    if (!split) {
+        return NULL;
+    }
+    split->length = length;
+    split->parts = length ? (char**) (split + 1) : NULL;
+
+    char* out = (char*) split + table;
+    uint32_t index = 0;
+    for (const char* cursor = path; *cursor;) {
+        while (*cursor == PATH_SEPARATOR_CHR) {
+            cursor++;
+        }
+        const char* token = cursor;
+        while (*cursor && *cursor != PATH_SEPARATOR_CHR) {
+            cursor++;
+        }
+        if (cursor > token) {
+            size_t token_length = (size_t) (cursor - token);
+            memcpy(out, token, token_length);
+            out[token_length] = '\0';
+            split->parts[index++] = out;
+            out += token_length + 1;
+        }
+    }
+
     return split;
 }
 
@@ -372,7 +443,7 @@ char* path_normalize(const char* path, PathNormalize flags) {
     if (remove_trailing && path_has_trailing_slash(start)) {
         copy_length--; // Exclude trailing slash
     }
-    strncpy(cursor, start, copy_length);
+    memcpy(cursor, start, copy_length);
     cursor += copy_length;
 
     // Add trailing slash if requested
@@ -462,3 +533,31 @@ char* path_join(const char* root_path, const char* sub_path) {
     free(normalized_sub);
     return joined_path;
 }
+
+char* path_join_arena(const char* root_path, const char* sub_path, UTF8Arena* arena) {
+    if (!path_is_valid(root_path) || !path_is_valid(sub_path) || !arena) {
+        return NULL; // Invalid inputs
+    }
+
+    // Same result as path_join: root gains a trailing slash, sub loses its leading slash
+    size_t root_length = strlen(root_path);
+    bool add_slash = !path_has_trailing_slash(root_path);
+    const char* sub = path_has_leading_slash(sub_path) ? sub_path + 1 : sub_path;
+    size_t sub_length = strlen(sub);
+
+    char* joined_path = utf8_arena_alloc(arena, root_length + add_slash + sub_length + 1);
+    if (!joined_path) {
+        return NULL;
+    }
+
+    char* cursor = joined_path;
+    memcpy(cursor, root_path, root_length);
+    cursor += root_length;
+    if (add_slash) {
+        *cursor++ = PATH_SEPARATOR_CHR;
+    }
+    memcpy(cursor, sub, sub_length);
+    cursor[sub_length] = '\0';
+
+    return joined_path;
+}
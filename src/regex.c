@@ -2,6 +2,9 @@
  * @file src/utf8/regex.c
  */
 
+#include <stdlib.h>
+#include <string.h>
+
 #include "regex.h"
 
 bool utf8_regex_compile(const uint8_t* pattern, pcre2_code** code, pcre2_match_data** match) {
@@ -45,3 +48,254 @@ void utf8_regex_free(pcre2_code* code, pcre2_match_data* match) {
         pcre2_code_free(code);
     }
 }
+
+bool utf8_regex_iter_init(UTF8RegexIter* iter, const pcre2_code* code, UTF8View subject) {
+    if (!iter || !code || !subject.ptr) {
+        return false;
+    }
+
+    *iter = (UTF8RegexIter) {.code = code, .subject = subject};
+
+    iter->match = pcre2_match_data_create_from_pattern(code, NULL);
+    if (!iter->match) {
+        return false;
+    }
+
+    uint32_t newline = 0;
+    pcre2_pattern_info(code, PCRE2_INFO_NEWLINE, &newline);
+    iter->crlf = newline == PCRE2_NEWLINE_ANY || newline == PCRE2_NEWLINE_CRLF
+                 || newline == PCRE2_NEWLINE_ANYCRLF;
+
+    return true;
+}
+
+bool utf8_regex_iter_next(UTF8RegexIter* iter, size_t* start, size_t* end) {
+    if (!iter || !iter->match || !start || !end) {
+        return false;
+    }
+
+    const uint8_t* subject = iter->subject.ptr;
+    size_t len = iter->subject.len;
+
+    while (!iter->done) {
+        if (iter->offset > len) {
+            iter->done = true;
+            break;
+        }
+
+        int rc = pcre2_match(
+            iter->code, (PCRE2_SPTR) subject, len, iter->offset, iter->options, iter->match, NULL
+        );
+
+        // The first search validates the whole subject; later ones skip the check
+        uint32_t retry = iter->options & (PCRE2_NOTEMPTY_ATSTART | PCRE2_ANCHORED);
+        iter->options = PCRE2_NO_UTF_CHECK;
+
+        if (rc == PCRE2_ERROR_NOMATCH && retry) {
+            // No non-empty match where the last empty one was: step one character
+            size_t next = iter->offset + 1;
+            if (iter->crlf && next < len && subject[iter->offset] == '\r'
+                && subject[next] == '\n') {
+                next++;
+            }
+            while (next < len && (subject[next] & 0xC0) == 0x80) {
+                next++;
+            }
+            iter->offset = next;
+            continue;
+        }
+
+        if (rc < 0) {
+            iter->error = rc == PCRE2_ERROR_NOMATCH ? 0 : rc;
+            iter->done = true;
+            break;
+        }
+
+        PCRE2_SIZE* ovector = pcre2_get_ovector_pointer(iter->match);
+        if (ovector[1] < ovector[0]) {
+            // \K in a lookaround can report end before start; refuse to loop on it
+            iter->error = PCRE2_ERROR_BADOFFSET;
+            iter->done = true;
+            break;
+        }
+
+        *start = ovector[0];
+        *end = ovector[1];
+        iter->offset = ovector[1];
+        if (ovector[0] == ovector[1]) {
+            iter->options |= PCRE2_NOTEMPTY_ATSTART | PCRE2_ANCHORED;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+void utf8_regex_iter_reset(UTF8RegexIter* iter, UTF8View subject) {
+    if (iter) {
+        iter->subject = subject;
+        iter->offset = 0;
+        iter->options = 0;
+        iter->done = !subject.ptr;
+        iter->error = 0;
+    }
+}
+
+void utf8_regex_iter_free(UTF8RegexIter* iter) {
+    if (iter) {
+        if (iter->match) {
+            pcre2_match_data_free(iter->match);
+        }
+        *iter = (UTF8RegexIter) {0};
+    }
+}
+
+bool utf8_regex_matches_init(UTF8RegexMatches* matches, const pcre2_code* code, size_t capacity) {
+    if (!matches || !code) {
+        return false;
+    }
+
+    uint32_t captures = 0;
+    if (pcre2_pattern_info(code, PCRE2_INFO_CAPTURECOUNT, &captures) != 0) {
+        return false;
+    }
+
+    *matches = (UTF8RegexMatches) {.groups = (size_t) captures + 1};
+    return utf8_regex_matches_reserve(matches, capacity);
+}
+
+bool utf8_regex_matches_reserve(UTF8RegexMatches* matches, size_t capacity) {
+    if (!matches || matches->groups == 0) {
+        return false;
+    }
+    if (capacity <= matches->capacity && matches->doc) {
+        return true;
+    }
+    if (capacity == 0) {
+        capacity = 1;  // Keep every column allocated
+    }
+    if (capacity > SIZE_MAX / sizeof(size_t) / matches->groups) {
+        return false;
+    }
+
+    size_t* doc = malloc(capacity * sizeof(size_t));
+    size_t* index = malloc(capacity * sizeof(size_t));
+    size_t* starts = malloc(capacity * matches->groups * sizeof(size_t));
+    size_t* ends = malloc(capacity * matches->groups * sizeof(size_t));
+    if (!doc || !index || !starts || !ends) {
+        free(doc);
+        free(index);
+        free(starts);
+        free(ends);
+        return false;
+    }
+
+    // Columns are strided by capacity, so each one moves separately
+    size_t count = matches->count;
+    if (count > 0) {
+        memcpy(doc, matches->doc, count * sizeof(size_t));
+        memcpy(index, matches->index, count * sizeof(size_t));
+        for (size_t g = 0; g < matches->groups; g++) {
+            memcpy(starts + g * capacity, matches->starts + g * matches->capacity, count * sizeof(size_t));
+            memcpy(ends + g * capacity, matches->ends + g * matches->capacity, count * sizeof(size_t));
+        }
+    }
+
+    free(matches->doc);
+    free(matches->index);
+    free(matches->starts);
+    free(matches->ends);
+    matches->doc = doc;
+    matches->index = index;
+    matches->starts = starts;
+    matches->ends = ends;
+    matches->capacity = capacity;
+    return true;
+}
+
+// Writes a row at position row, which must be below capacity.
+static void utf8_regex_matches_set(
+    UTF8RegexMatches* matches, size_t row, size_t doc, size_t index, const PCRE2_SIZE* ovector
+) {
+    size_t capacity = matches->capacity;
+    matches->doc[row] = doc;
+    matches->index[row] = index;
+    for (size_t g = 0; g < matches->groups; g++) {
+        matches->starts[g * capacity + row] = ovector[2 * g];
+        matches->ends[g * capacity + row] = ovector[2 * g + 1];
+    }
+}
+
+bool utf8_regex_matches_push(
+    UTF8RegexMatches* matches, size_t doc, size_t index, const PCRE2_SIZE* ovector
+) {
+    if (!matches || !ovector) {
+        return false;
+    }
+
+    if (matches->count == matches->capacity) {
+        if (!utf8_regex_matches_reserve(matches, matches->capacity ? matches->capacity * 2 : 16)) {
+            return false;
+        }
+    }
+
+    utf8_regex_matches_set(matches, matches->count++, doc, index, ovector);
+    return true;
+}
+
+void utf8_regex_matches_free(UTF8RegexMatches* matches) {
+    if (matches) {
+        free(matches->doc);
+        free(matches->index);
+        free(matches->starts);
+        free(matches->ends);
+        *matches = (UTF8RegexMatches) {0};
+    }
+}
+
+bool utf8_regex_findall(
+    const pcre2_code* code, const UTF8View* docs, size_t n, UTF8RegexMatches* out, size_t* total
+) {
+    if (!code || (!docs && n > 0) || !out || !out->doc || !total) {
+        return false;
+    }
+
+    out->count = 0;
+    *total = 0;
+
+    uint32_t captures = 0;
+    pcre2_pattern_info(code, PCRE2_INFO_CAPTURECOUNT, &captures);
+    if (out->groups != (size_t) captures + 1) {
+        return false;
+    }
+
+    UTF8RegexIter iter;
+    if (!utf8_regex_iter_init(&iter, code, utf8_view_n((const uint8_t*) "", 0))) {
+        return false;
+    }
+
+    bool ok = true;
+    size_t found = 0;
+    for (size_t d = 0; d < n && ok; d++) {
+        if (!docs[d].ptr) {
+            ok = false;
+            break;
+        }
+
+        utf8_regex_iter_reset(&iter, docs[d]);
+        size_t start;
+        size_t end;
+        for (size_t i = 0; utf8_regex_iter_next(&iter, &start, &end); i++) {
+            if (found < out->capacity) {
+                utf8_regex_matches_set(out, found, d, i, pcre2_get_ovector_pointer(iter.match));
+            }
+            found++;
+        }
+        ok = iter.error == 0;
+    }
+
+    utf8_regex_iter_free(&iter);
+    out->count = found < out->capacity ? found : out->capacity;
+    *total = found;
+    return ok;
+}
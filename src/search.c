@@ -0,0 +1,509 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/search.c
+ * @brief Byte-oriented substring search engine.
+ *
+ * @ref Crochemore, Perrin. "Two-way string-matching". JACM 38(3), 1991.
+ * @ref Muła. "SIMD-friendly algorithms for substring searching", 2016.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "simd.h"
+#include "builder.h"
+#include "search.h"
+
+// --- Two-Way preprocessing ---
+
+// Returns the critical factorization index of needle and sets its local period.
+static size_t utf8_finder_critical(const uint8_t* needle, size_t len, size_t* period) {
+    size_t suffix;  // SIZE_MAX acts as -1
+    size_t j, k, p;
+
+    // Maximal suffix under the natural byte order
+    suffix = SIZE_MAX;
+    j = 0;
+    k = p = 1;
+    while (j + k < len) {
+        uint8_t a = needle[j + k];
+        uint8_t b = needle[suffix + k];
+        if (a < b) {
+            j += k;
+            k = 1;
+            p = j - suffix;
+        } else if (a == b) {
+            if (k != p) {
+                k++;
+            } else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            suffix = j++;
+            k = p = 1;
+        }
+    }
+    *period = p;
+
+    // Maximal suffix under the reversed byte order
+    size_t suffix_rev = SIZE_MAX;
+    j = 0;
+    k = p = 1;
+    while (j + k < len) {
+        uint8_t a = needle[j + k];
+        uint8_t b = needle[suffix_rev + k];
+        if (b < a) {
+            j += k;
+            k = 1;
+            p = j - suffix_rev;
+        } else if (a == b) {
+            if (k != p) {
+                k++;
+            } else {
+                j += p;
+                k = 1;
+            }
+        } else {
+            suffix_rev = j++;
+            k = p = 1;
+        }
+    }
+
+    // The longer of the two maximal suffixes gives the critical factorization
+    if (suffix_rev + 1 < suffix + 1) {
+        return suffix + 1;
+    }
+
+    *period = p;
+    return suffix_rev + 1;
+}
+
+bool utf8_finder_init(UTF8Finder* finder, UTF8View needle) {
+    if (!finder || !needle.ptr) {
+        return false;
+    }
+
+    finder->needle = needle;
+    finder->critical = 0;
+    finder->period = 0;
+    finder->memory = 0;
+
+    if (needle.len == 0) {
+        finder->kind = UTF8_FIND_EMPTY;
+        return true;
+    }
+    if (needle.len == 1) {
+        finder->kind = UTF8_FIND_BYTE;
+        return true;
+    }
+    if (needle.len <= UTF8_FIND_SHORT_MAX) {
+        finder->kind = UTF8_FIND_SHORT;
+        return true;
+    }
+
+    finder->kind = UTF8_FIND_LONG;
+
+    const uint8_t* n = needle.ptr;
+    size_t len = needle.len;
+
+    // Distance from the last occurrence of each byte to the end of the needle
+    for (size_t i = 0; i < 256; i++) {
+        finder->shift[i] = len;
+    }
+    for (size_t i = 0; i < len; i++) {
+        finder->shift[n[i]] = len - i - 1;
+    }
+
+    size_t period;
+    size_t critical = utf8_finder_critical(n, len, &period);
+    if (memcmp(n, n + period, critical) == 0) {
+        // Periodic needle: remember how much of the period already matched
+        finder->memory = len - period;
+    } else {
+        // The halves are distinct, so any mismatch allows a maximal shift
+        period = (critical > len - critical ? critical : len - critical) + 1;
+    }
+
+    finder->critical = critical;
+    finder->period = period;
+    return true;
+}
+
+// --- Search kernels ---
+
+static int64_t utf8_finder_long(const UTF8Finder* f, const uint8_t* hay, size_t len, size_t pos) {
+    const uint8_t* n = f->needle.ptr;
+    size_t m = f->needle.len;
+    size_t memory = 0;
+
+    while (pos <= len && len - pos >= m) {
+        const uint8_t* h = hay + pos;
+
+        // Check the last byte first; skip ahead on mismatch
+        size_t shift = f->shift[h[m - 1]];
+        if (shift > 0) {
+            if (memory && shift < f->period) {
+                // Periodic needle with a byte out of place in the last period
+                shift = m - f->period;
+            }
+            memory = 0;
+            pos += shift;
+            continue;
+        }
+
+        // Right half (the last byte already matched)
+        size_t i = f->critical > memory ? f->critical : memory;
+        while (i < m - 1 && n[i] == h[i]) {
+            i++;
+        }
+        if (i < m - 1) {
+            pos += i - f->critical + 1;
+            memory = 0;
+            continue;
+        }
+
+        // Left half, stopping at the prefix known to match
+        i = f->critical;
+        while (i > memory && n[i - 1] == h[i - 1]) {
+            i--;
+        }
+        if (i <= memory) {
+            return (int64_t) pos;
+        }
+
+        pos += f->period;
+        memory = f->memory;
+    }
+
+    return -1;
+}
+
+static int64_t utf8_finder_short(const UTF8Finder* f, const uint8_t* hay, size_t len, size_t pos) {
+    const uint8_t* n = f->needle.ptr;
+    size_t m = f->needle.len;
+
+    while (pos <= len && len - pos >= m) {
+        const uint8_t* p = memchr(hay + pos, n[0], len - pos - m + 1);
+        if (!p) {
+            return -1;
+        }
+
+        pos = (size_t) (p - hay);
+        if (p[m - 1] == n[m - 1] && memcmp(p + 1, n + 1, m - 2) == 0) {
+            return (int64_t) pos;
+        }
+        pos++;
+    }
+
+    return -1;
+}
+
+#if UTF8_SIMD_X86
+/**
+ * @note Candidates are positions where both the first and the last needle byte match;
+ *       only those are verified with memcmp. Each step tests one vector of positions,
+ *       and the remaining tail is handed to the scalar kernel.
+ */
+
+__attribute__((target("sse2")))
+static int64_t utf8_finder_short_sse2(const UTF8Finder* f, const uint8_t* hay, size_t len, size_t pos) {
+    const uint8_t* n = f->needle.ptr;
+    size_t m = f->needle.len;
+    const __m128i first = _mm_set1_epi8((char) n[0]);
+    const __m128i last = _mm_set1_epi8((char) n[m - 1]);
+
+    while (pos <= len && len - pos >= m - 1 + 16) {
+        __m128i a = _mm_loadu_si128((const __m128i*) (hay + pos));
+        __m128i b = _mm_loadu_si128((const __m128i*) (hay + pos + m - 1));
+        uint32_t mask = (uint32_t) _mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))
+        );
+        while (mask) {
+            size_t bit = (size_t) __builtin_ctz(mask);
+            if (memcmp(hay + pos + bit + 1, n + 1, m - 2) == 0) {
+                return (int64_t) (pos + bit);
+            }
+            mask &= mask - 1;
+        }
+        pos += 16;
+    }
+
+    return utf8_finder_short(f, hay, len, pos);
+}
+
+__attribute__((target("avx2")))
+static int64_t utf8_finder_short_avx2(const UTF8Finder* f, const uint8_t* hay, size_t len, size_t pos) {
+    const uint8_t* n = f->needle.ptr;
+    size_t m = f->needle.len;
+    const __m256i first = _mm256_set1_epi8((char) n[0]);
+    const __m256i last = _mm256_set1_epi8((char) n[m - 1]);
+
+    while (pos <= len && len - pos >= m - 1 + 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i*) (hay + pos));
+        __m256i b = _mm256_loadu_si256((const __m256i*) (hay + pos + m - 1));
+        uint32_t mask = (uint32_t) _mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))
+        );
+        while (mask) {
+            size_t bit = (size_t) __builtin_ctz(mask);
+            if (memcmp(hay + pos + bit + 1, n + 1, m - 2) == 0) {
+                return (int64_t) (pos + bit);
+            }
+            mask &= mask - 1;
+        }
+        pos += 32;
+    }
+
+    return utf8_finder_short(f, hay, len, pos);
+}
+
+/**
+ * @note The scan kernels report every non-overlapping match in one pass instead of
+ *       restarting the vector loop after each match, which dominates when matches are
+ *       dense (e.g., a delimiter every few bytes). Candidates overlapping the previous
+ *       match (before next) are skipped.
+ */
+
+__attribute__((target("sse2")))
+static bool utf8_finder_scan_sse2(
+    const UTF8Finder* f, const uint8_t* hay, size_t len, UTF8FindCallback emit, void* ctx
+) {
+    const uint8_t* n = f->needle.ptr;
+    size_t m = f->needle.len;
+    const __m128i first = _mm_set1_epi8((char) n[0]);
+    const __m128i last = _mm_set1_epi8((char) n[m - 1]);
+
+    size_t pos = 0;
+    size_t next = 0;
+    while (len >= m - 1 + 16 && len - (m - 1 + 16) >= pos) {
+        __m128i a = _mm_loadu_si128((const __m128i*) (hay + pos));
+        __m128i b = _mm_loadu_si128((const __m128i*) (hay + pos + m - 1));
+        uint32_t mask = (uint32_t) _mm_movemask_epi8(
+            _mm_and_si128(_mm_cmpeq_epi8(a, first), _mm_cmpeq_epi8(b, last))
+        );
+        while (mask) {
+            size_t at = pos + (size_t) __builtin_ctz(mask);
+            if (at >= next && (m == 2 || memcmp(hay + at + 1, n + 1, m - 2) == 0)) {
+                if (!emit(at, ctx)) {
+                    return false;
+                }
+                next = at + m;
+            }
+            mask &= mask - 1;
+        }
+        pos += 16;
+    }
+
+    int64_t match;
+    next = pos > next ? pos : next;
+    while ((match = utf8_finder_short(f, hay, len, next)) >= 0) {
+        if (!emit((size_t) match, ctx)) {
+            return false;
+        }
+        next = (size_t) match + m;
+    }
+
+    return true;
+}
+
+__attribute__((target("avx2")))
+static bool utf8_finder_scan_avx2(
+    const UTF8Finder* f, const uint8_t* hay, size_t len, UTF8FindCallback emit, void* ctx
+) {
+    const uint8_t* n = f->needle.ptr;
+    size_t m = f->needle.len;
+    const __m256i first = _mm256_set1_epi8((char) n[0]);
+    const __m256i last = _mm256_set1_epi8((char) n[m - 1]);
+
+    size_t pos = 0;
+    size_t next = 0;
+    while (len >= m - 1 + 32 && len - (m - 1 + 32) >= pos) {
+        __m256i a = _mm256_loadu_si256((const __m256i*) (hay + pos));
+        __m256i b = _mm256_loadu_si256((const __m256i*) (hay + pos + m - 1));
+        uint32_t mask = (uint32_t) _mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(a, first), _mm256_cmpeq_epi8(b, last))
+        );
+        while (mask) {
+            size_t at = pos + (size_t) __builtin_ctz(mask);
+            if (at >= next && (m == 2 || memcmp(hay + at + 1, n + 1, m - 2) == 0)) {
+                if (!emit(at, ctx)) {
+                    return false;
+                }
+                next = at + m;
+            }
+            mask &= mask - 1;
+        }
+        pos += 32;
+    }
+
+    int64_t match;
+    next = pos > next ? pos : next;
+    while ((match = utf8_finder_short(f, hay, len, next)) >= 0) {
+        if (!emit((size_t) match, ctx)) {
+            return false;
+        }
+        next = (size_t) match + m;
+    }
+
+    return true;
+}
+#endif  // UTF8_SIMD_X86
+
+int64_t utf8_finder_next(const UTF8Finder* finder, UTF8View haystack, size_t from) {
+    if (!finder || !haystack.ptr || from > haystack.len) {
+        return -1;
+    }
+
+    const uint8_t* hay = haystack.ptr;
+    size_t len = haystack.len;
+
+    switch (finder->kind) {
+        case UTF8_FIND_EMPTY:
+            return (int64_t) from;
+        case UTF8_FIND_BYTE: {
+            const uint8_t* p = memchr(hay + from, finder->needle.ptr[0], len - from);
+            return p ? (int64_t) (p - hay) : -1;
+        }
+        case UTF8_FIND_SHORT:
+            switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+                case UTF8_SIMD_AVX512:
+                case UTF8_SIMD_AVX2:
+                    return utf8_finder_short_avx2(finder, hay, len, from);
+                case UTF8_SIMD_SSSE3:
+                case UTF8_SIMD_SSE2:
+                    return utf8_finder_short_sse2(finder, hay, len, from);
+#endif
+                default:
+                    return utf8_finder_short(finder, hay, len, from);
+            }
+        case UTF8_FIND_LONG:
+            return utf8_finder_long(finder, hay, len, from);
+        default:
+            return -1;
+    }
+}
+
+bool utf8_finder_scan(
+    const UTF8Finder* finder, UTF8View haystack, UTF8FindCallback emit, void* ctx
+) {
+    if (!finder || !haystack.ptr || !emit || finder->kind == UTF8_FIND_EMPTY) {
+        return false;
+    }
+
+#if UTF8_SIMD_X86
+    if (finder->kind == UTF8_FIND_SHORT) {
+        switch (utf8_simd_level()) {
+            case UTF8_SIMD_AVX512:
+            case UTF8_SIMD_AVX2:
+                return utf8_finder_scan_avx2(finder, haystack.ptr, haystack.len, emit, ctx);
+            case UTF8_SIMD_SSSE3:
+            case UTF8_SIMD_SSE2:
+                return utf8_finder_scan_sse2(finder, haystack.ptr, haystack.len, emit, ctx);
+            default:
+                break;
+        }
+    }
+#endif
+
+    size_t pos = 0;
+    int64_t match;
+    while ((match = utf8_finder_next(finder, haystack, pos)) >= 0) {
+        if (!emit((size_t) match, ctx)) {
+            return false;
+        }
+        pos = (size_t) match + finder->needle.len;
+    }
+
+    return true;
+}
+
+// --- Search operations ---
+
+typedef struct UTF8FindAll {
+    UTF8SpanList* out;
+    size_t len;
+} UTF8FindAll;
+
+static bool utf8_byte_find_all_emit(size_t offset, void* ctx) {
+    UTF8FindAll* all = (UTF8FindAll*) ctx;
+    return utf8_span_list_push(all->out, offset, all->len);
+}
+
+static bool utf8_byte_find_count_emit(size_t offset, void* ctx) {
+    (void) offset;
+    (*(int64_t*) ctx)++;
+    return true;
+}
+
+int64_t utf8_byte_find(UTF8View haystack, UTF8View needle) {
+    UTF8Finder finder;
+    if (!utf8_finder_init(&finder, needle)) {
+        return -1;
+    }
+
+    return utf8_finder_next(&finder, haystack, 0);
+}
+
+bool utf8_byte_find_all(UTF8View haystack, UTF8View needle, UTF8SpanList* out) {
+    if (!haystack.ptr || !needle.ptr || needle.len == 0 || !out) {
+        return false;
+    }
+
+    UTF8Finder finder;
+    utf8_finder_init(&finder, needle);
+    utf8_span_list_clear(out);
+
+    UTF8FindAll all = {.out = out, .len = needle.len};
+    return utf8_finder_scan(&finder, haystack, utf8_byte_find_all_emit, &all);
+}
+
+int64_t utf8_byte_find_count(UTF8View haystack, UTF8View needle) {
+    if (!haystack.ptr || !needle.ptr || needle.len == 0) {
+        return -1;
+    }
+
+    UTF8Finder finder;
+    utf8_finder_init(&finder, needle);
+
+    int64_t count = 0;
+    utf8_finder_scan(&finder, haystack, utf8_byte_find_count_emit, &count);
+    return count;
+}
+
+uint8_t* utf8_byte_replace_view(UTF8View src, UTF8View from, UTF8View to) {
+    if (!src.ptr || !to.ptr) {
+        return NULL;
+    }
+
+    UTF8SpanList matches = {0};
+    if (!utf8_byte_find_all(src, from, &matches)) {
+        utf8_span_list_free(&matches);
+        return NULL;
+    }
+
+    // Exact output size: every match trades from.len bytes for to.len bytes
+    size_t total = src.len - matches.count * from.len + matches.count * to.len;
+    UTF8Builder builder = {0};
+    if (!utf8_builder_reserve(&builder, total)) {
+        utf8_span_list_free(&matches);
+        return NULL;
+    }
+
+    size_t pos = 0;
+    for (size_t i = 0; i < matches.count; i++) {
+        utf8_builder_append_bytes(&builder, src.ptr + pos, matches.spans[i].offset - pos);
+        utf8_builder_append_view(&builder, to);
+        pos = matches.spans[i].offset + from.len;
+    }
+    utf8_builder_append_bytes(&builder, src.ptr + pos, src.len - pos);
+
+    utf8_span_list_free(&matches);
+    return utf8_builder_finish(&builder, NULL);
+}
+
+uint8_t* utf8_byte_replace(const uint8_t* src, const uint8_t* from, const uint8_t* to) {
+    return utf8_byte_replace_view(utf8_view(src), utf8_view(from), utf8_view(to));
+}
@@ -0,0 +1,62 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/simd.c
+ * @brief Runtime CPU feature detection and SIMD kernel dispatch.
+ */
+
+#include "simd.h"
+
+static UTF8SimdLevel utf8_simd_detected = UTF8_SIMD_NONE;
+static UTF8SimdLevel utf8_simd_active = UTF8_SIMD_NONE;
+
+UTF8SimdLevel utf8_simd_detect(void) {
+#if UTF8_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+        return UTF8_SIMD_AVX512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return UTF8_SIMD_AVX2;
+    }
+    if (__builtin_cpu_supports("ssse3")) {
+        return UTF8_SIMD_SSSE3;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return UTF8_SIMD_SSE2;
+    }
+#endif
+    return UTF8_SIMD_NONE;
+}
+
+// Resolve the kernel level once, before main() runs.
+__attribute__((constructor)) static void utf8_simd_init(void) {
+    utf8_simd_detected = utf8_simd_detect();
+    utf8_simd_active = utf8_simd_detected;
+}
+
+UTF8SimdLevel utf8_simd_level(void) {
+    return utf8_simd_active;
+}
+
+UTF8SimdLevel utf8_simd_set_level(UTF8SimdLevel level) {
+    utf8_simd_active = level > utf8_simd_detected ? utf8_simd_detected : level;
+    return utf8_simd_active;
+}
+
+const char* utf8_simd_name(UTF8SimdLevel level) {
+    switch (level) {
+        case UTF8_SIMD_NONE:
+            return "scalar";
+        case UTF8_SIMD_SSE2:
+            return "sse2";
+        case UTF8_SIMD_SSSE3:
+            return "ssse3";
+        case UTF8_SIMD_AVX2:
+            return "avx2";
+        case UTF8_SIMD_AVX512:
+            return "avx512";
+        default:
+            return "unknown";
+    }
+}
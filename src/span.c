@@ -0,0 +1,153 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/span.c
+ * @brief Zero-copy split results as (offset, length) spans into a source buffer.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "part.h"
+#include "span.h"
+
+bool utf8_span_list_reserve(UTF8SpanList* list, size_t capacity) {
+    if (!list) {
+        return false;
+    }
+
+    if (capacity <= list->capacity) {
+        return true;
+    }
+
+    UTF8Span* temp = realloc(list->spans, capacity * sizeof(UTF8Span));
+    if (!temp) {
+        return false;
+    }
+
+    list->spans = temp;
+    list->capacity = capacity;
+    return true;
+}
+
+bool utf8_span_list_push(UTF8SpanList* list, size_t offset, size_t len) {
+    if (!list) {
+        return false;
+    }
+
+    if (list->count == list->capacity) {
+        size_t capacity = list->capacity ? list->capacity * 2 : 16;
+        if (!utf8_span_list_reserve(list, capacity)) {
+            return false;
+        }
+    }
+
+    list->spans[list->count++] = (UTF8Span) {.offset = offset, .len = len};
+    return true;
+}
+
+void utf8_span_list_clear(UTF8SpanList* list) {
+    if (list) {
+        list->count = 0;
+    }
+}
+
+void utf8_span_list_free(UTF8SpanList* list) {
+    if (list) {
+        free(list->spans);
+        *list = (UTF8SpanList) {0};
+    }
+}
+
+UTF8View utf8_span_view(UTF8View src, UTF8Span span) {
+    return utf8_view_slice(src, span.offset, span.len);
+}
+
+uint8_t** utf8_span_copy(UTF8View src, const UTF8Span* spans, size_t count) {
+    if (!src.ptr || (!spans && count > 0)) {
+        return NULL;
+    }
+
+    UTF8PartList list = {0};
+    if (!utf8_part_list_reserve(&list, count)) {
+        return NULL;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        if (!utf8_part_list_push_view(&list, utf8_span_view(src, spans[i]))) {
+            utf8_part_list_free(&list);
+            return NULL;
+        }
+    }
+
+    uint64_t released = 0;
+    return utf8_part_list_release(&list, &released);
+}
+
+// Bytes needed for the pointer table plus every part and its terminator (0 on error).
+static size_t utf8_span_materialize_size(UTF8View src, const UTF8Span* spans, size_t count) {
+    size_t bytes = (count ? count : 1) * sizeof(uint8_t*);
+    for (size_t i = 0; i < count; i++) {
+        if (spans[i].offset > src.len || spans[i].len > src.len - spans[i].offset) {
+            return 0;  // Span outside of source
+        }
+        bytes += spans[i].len + 1;
+    }
+    return bytes;
+}
+
+// Lays out the pointer table followed by the part bytes in block.
+static uint8_t** utf8_span_materialize_into(
+    UTF8View src, const UTF8Span* spans, size_t count, void* block
+) {
+    uint8_t** parts = block;
+    uint8_t* out = (uint8_t*) parts + (count ? count : 1) * sizeof(uint8_t*);
+    for (size_t i = 0; i < count; i++) {
+        parts[i] = out;
+        if (spans[i].len > 0) {
+            memcpy(out, src.ptr + spans[i].offset, spans[i].len);
+        }
+        out[spans[i].len] = '\0';
+        out += spans[i].len + 1;
+    }
+
+    return parts;
+}
+
+uint8_t** utf8_span_materialize(UTF8View src, const UTF8Span* spans, size_t count) {
+    if (!src.ptr || (!spans && count > 0)) {
+        return NULL;
+    }
+
+    size_t bytes = utf8_span_materialize_size(src, spans, count);
+    if (bytes == 0) {
+        return NULL;
+    }
+
+    void* block = malloc(bytes);
+    if (!block) {
+        return NULL;
+    }
+
+    return utf8_span_materialize_into(src, spans, count, block);
+}
+
+uint8_t** utf8_span_materialize_arena(
+    UTF8View src, const UTF8Span* spans, size_t count, UTF8Arena* arena
+) {
+    if (!src.ptr || (!spans && count > 0) || !arena) {
+        return NULL;
+    }
+
+    size_t bytes = utf8_span_materialize_size(src, spans, count);
+    if (bytes == 0) {
+        return NULL;
+    }
+
+    void* block = utf8_arena_alloc(arena, bytes);
+    if (!block) {
+        return NULL;
+    }
+
+    return utf8_span_materialize_into(src, spans, count, block);
+}
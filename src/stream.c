@@ -0,0 +1,221 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/stream.c
+ * @brief Constant-memory delimiter splitting over chunked input.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "stream.h"
+
+// Longest UTF-8 sequence minus one: bytes a fragment may hold back.
+#define UTF8_STREAM_CP_CARRY 3
+
+bool utf8_stream_split_init(
+    UTF8StreamSplit* split,
+    UTF8View delim,
+    size_t chunk_size,
+    UTF8FieldCallback emit,
+    void* ctx
+) {
+    if (!split || !delim.ptr || delim.len == 0 || !emit) {
+        return false;
+    }
+
+    *split = (UTF8StreamSplit) {0};
+    split->chunk_size = chunk_size ? chunk_size : UTF8_STREAM_CHUNK_SIZE;
+
+    // Room for a chunk plus the carry: a delimiter prefix and an incomplete codepoint.
+    // The delimiter copy lives at the end of the same allocation.
+    size_t capacity = split->chunk_size + delim.len - 1 + UTF8_STREAM_CP_CARRY;
+    split->buffer = malloc(capacity + delim.len);
+    if (!split->buffer) {
+        return false;
+    }
+
+    uint8_t* needle = split->buffer + capacity;
+    memcpy(needle, delim.ptr, delim.len);
+    utf8_finder_init(&split->finder, utf8_view_n(needle, delim.len));
+
+    split->emit = emit;
+    split->ctx = ctx;
+    return true;
+}
+
+void utf8_stream_split_free(UTF8StreamSplit* split) {
+    if (split) {
+        free(split->buffer);
+        *split = (UTF8StreamSplit) {0};
+    }
+}
+
+typedef struct UTF8StreamScan {
+    UTF8StreamSplit* split;
+    size_t current;  // Start of the pending field in the buffer
+} UTF8StreamScan;
+
+// Delimiter match: deliver the end of the pending field
+static bool utf8_stream_split_emit(size_t offset, void* ctx) {
+    UTF8StreamScan* scan = (UTF8StreamScan*) ctx;
+    UTF8StreamSplit* split = scan->split;
+
+    UTF8View field = utf8_view_n(split->buffer + scan->current, offset - scan->current);
+    split->partial = false;
+    split->fields++;
+    scan->current = offset + split->finder.needle.len;
+
+    if (!split->emit(field, false, split->ctx)) {
+        split->stopped = true;
+        return false;
+    }
+    return true;
+}
+
+// Moves cut back to the start of a codepoint that would otherwise end past it.
+static size_t utf8_stream_split_cut(const uint8_t* buffer, size_t from, size_t cut) {
+    size_t lead = cut;
+    while (lead > from && cut - lead < UTF8_STREAM_CP_CARRY + 1) {
+        lead--;
+        if ((buffer[lead] & 0xC0) != 0x80) {
+            break;
+        }
+    }
+    if (lead == cut) {
+        return cut;
+    }
+
+    uint8_t byte = buffer[lead];
+    size_t width = byte < 0xC0 ? 1 : byte < 0xE0 ? 2 : byte < 0xF0 ? 3 : 4;
+    return lead + width > cut ? lead : cut;
+}
+
+// Delivers every complete field in the buffer and carries the rest forward.
+static bool utf8_stream_split_process(UTF8StreamSplit* split, bool eof) {
+    UTF8StreamScan scan = {.split = split, .current = 0};
+    UTF8View buffered = utf8_view_n(split->buffer, split->len);
+    if (!utf8_finder_scan(&split->finder, buffered, utf8_stream_split_emit, &scan)) {
+        return false;
+    }
+
+    size_t current = scan.current;
+    if (eof) {
+        // Final field (or the last fragment of one already started)
+        if (current < split->len || split->partial) {
+            UTF8View field = utf8_view_n(split->buffer + current, split->len - current);
+            split->partial = false;
+            split->fields++;
+            if (!split->emit(field, false, split->ctx)) {
+                split->stopped = true;
+                return false;
+            }
+        }
+        split->len = 0;
+        return true;
+    }
+
+    // Hold back bytes that may begin a delimiter, then any incomplete codepoint
+    size_t hold = split->finder.needle.len - 1;
+    size_t cut = split->len - current > hold ? split->len - hold : current;
+    cut = utf8_stream_split_cut(split->buffer, current, cut);
+
+    if (cut > current) {
+        split->partial = true;
+        if (!split->emit(utf8_view_n(split->buffer + current, cut - current), true, split->ctx)) {
+            split->stopped = true;
+            return false;
+        }
+    }
+
+    split->len -= cut;
+    memmove(split->buffer, split->buffer + cut, split->len);
+    return true;
+}
+
+bool utf8_stream_split_feed(UTF8StreamSplit* split, UTF8View chunk) {
+    if (!split || !split->buffer || !chunk.ptr || split->stopped) {
+        return false;
+    }
+
+    size_t offset = 0;
+    while (offset < chunk.len) {
+        size_t n = chunk.len - offset;
+        if (n > split->chunk_size) {
+            n = split->chunk_size;
+        }
+
+        memcpy(split->buffer + split->len, chunk.ptr + offset, n);
+        split->len += n;
+        offset += n;
+
+        if (!utf8_stream_split_process(split, false)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool utf8_stream_split_finish(UTF8StreamSplit* split) {
+    if (!split || !split->buffer || split->stopped) {
+        return false;
+    }
+
+    return utf8_stream_split_process(split, true);
+}
+
+bool utf8_stream_split_read_fd(UTF8StreamSplit* split, int fd) {
+    if (!split || !split->buffer || fd < 0) {
+        return false;
+    }
+
+    // Read straight into the buffer behind the carried bytes
+    for (;;) {
+        ssize_t n = read(fd, split->buffer + split->len, split->chunk_size);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        if (n == 0) {
+            break;
+        }
+
+        split->len += (size_t) n;
+        if (!utf8_stream_split_process(split, false)) {
+            return false;
+        }
+    }
+
+    return utf8_stream_split_finish(split);
+}
+
+bool utf8_stream_split_read_file(UTF8StreamSplit* split, FILE* file) {
+    if (!split || !split->buffer || !file) {
+        return false;
+    }
+
+    for (;;) {
+        size_t n = fread(split->buffer + split->len, 1, split->chunk_size, file);
+        if (n > 0) {
+            split->len += n;
+            if (!utf8_stream_split_process(split, false)) {
+                return false;
+            }
+        }
+        if (n < split->chunk_size) {
+            if (ferror(file)) {
+                return false;
+            }
+            if (feof(file)) {
+                break;
+            }
+        }
+    }
+
+    return utf8_stream_split_finish(split);
+}
@@ -0,0 +1,767 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/transcode.c
+ * @brief Bulk conversion between UTF-8, UTF-16 and UTF-32.
+ */
+
+#include <string.h>
+
+#include "simd.h"
+#include "codepoint.h"
+#include "validate.h"
+#include "transcode.h"
+
+// --- UTF-8 to UTF-32 ---
+
+// Decodes one sequence from input already known to be valid.
+static inline size_t utf8_transcode_decode(const uint8_t* s, uint32_t* cp) {
+    uint8_t lead = s[0];
+    if (lead < 0x80) {
+        *cp = lead;
+        return 1;
+    } else if (lead < 0xE0) {
+        *cp = ((uint32_t) (lead & 0x1F) << 6) | (s[1] & 0x3F);
+        return 2;
+    } else if (lead < 0xF0) {
+        *cp = ((uint32_t) (lead & 0x0F) << 12) | ((uint32_t) (s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+        return 3;
+    }
+
+    *cp = ((uint32_t) (lead & 0x07) << 18) | ((uint32_t) (s[1] & 0x3F) << 12)
+          | ((uint32_t) (s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+    return 4;
+}
+
+static size_t utf8_to_utf32_scalar(const uint8_t* s, size_t len, uint32_t* dst) {
+    size_t i = 0;
+    size_t n = 0;
+    while (i < len) {
+        // ASCII runs, 8 bytes at a time
+        if (i + 8 <= len) {
+            uint64_t word;
+            memcpy(&word, s + i, sizeof(word));
+            if (!(word & 0x8080808080808080ULL)) {
+                for (int k = 0; k < 8; k++) {
+                    dst[n++] = s[i + k];
+                }
+                i += 8;
+                continue;
+            }
+        }
+
+        i += utf8_transcode_decode(s + i, &dst[n++]);
+    }
+
+    return n;
+}
+
+#if UTF8_SIMD_X86
+/**
+ * @note Loads are 16 bytes and only issued when 16 bytes remain; every store
+ *       writes exactly the codepoints (or bytes) the block produces, so output
+ *       buffers sized by the `_length` functions are never overrun.
+ */
+
+__attribute__((target("ssse3")))
+static size_t utf8_to_utf32_ssse3(const uint8_t* s, size_t len, uint32_t* dst) {
+    const __m128i zero = _mm_setzero_si128();
+    // Four 3-byte sequences, one per 32-bit lane as (byte 2, byte 1, byte 0, 0)
+    const __m128i triples = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+
+    size_t i = 0;
+    size_t n = 0;
+    while (i + 16 <= len) {
+        __m128i v = _mm_loadu_si128((const __m128i*) (s + i));
+        uint32_t high = (uint32_t) _mm_movemask_epi8(v);
+
+        if (high == 0) {
+            __m128i lo = _mm_unpacklo_epi8(v, zero);
+            __m128i hi = _mm_unpackhi_epi8(v, zero);
+            _mm_storeu_si128((__m128i*) (dst + n), _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128((__m128i*) (dst + n + 4), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128((__m128i*) (dst + n + 8), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128((__m128i*) (dst + n + 12), _mm_unpackhi_epi16(hi, zero));
+            i += 16;
+            n += 16;
+            continue;
+        }
+
+        // ASCII before the first multi-byte sequence
+        size_t ascii = (size_t) __builtin_ctz(high);
+        if (ascii > 0) {
+            for (size_t k = 0; k < ascii; k++) {
+                dst[n++] = s[i + k];
+            }
+            i += ascii;
+            continue;
+        }
+
+        // Eight 2-byte sequences: each 16-bit lane is lead | continuation << 8
+        __m128i pairs = _mm_cmpeq_epi16(
+            _mm_and_si128(v, _mm_set1_epi16((short) 0xC0E0)), _mm_set1_epi16((short) 0x80C0)
+        );
+        if (_mm_movemask_epi8(pairs) == 0xFFFF) {
+            __m128i cp = _mm_or_si128(
+                _mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi16(0x1F)), 6),
+                _mm_and_si128(_mm_srli_epi16(v, 8), _mm_set1_epi16(0x3F))
+            );
+            _mm_storeu_si128((__m128i*) (dst + n), _mm_unpacklo_epi16(cp, zero));
+            _mm_storeu_si128((__m128i*) (dst + n + 4), _mm_unpackhi_epi16(cp, zero));
+            i += 16;
+            n += 8;
+            continue;
+        }
+
+        // Four 3-byte sequences in the first 12 bytes
+        __m128i t = _mm_shuffle_epi8(v, triples);
+        __m128i threes = _mm_cmpeq_epi32(
+            _mm_and_si128(t, _mm_set1_epi32(0x00F0C0C0)), _mm_set1_epi32(0x00E08080)
+        );
+        if (_mm_movemask_epi8(threes) == 0xFFFF) {
+            __m128i cp = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_and_si128(t, _mm_set1_epi32(0x3F)),
+                    _mm_and_si128(_mm_srli_epi32(t, 2), _mm_set1_epi32(0x3F << 6))
+                ),
+                _mm_and_si128(_mm_srli_epi32(t, 4), _mm_set1_epi32(0x0F << 12))
+            );
+            _mm_storeu_si128((__m128i*) (dst + n), cp);
+            i += 12;
+            n += 4;
+            continue;
+        }
+
+        // Otherwise decode through the first half of the block before probing again
+        for (size_t end = i + 8; i < end;) {
+            i += utf8_transcode_decode(s + i, &dst[n++]);
+        }
+    }
+
+    return n + utf8_to_utf32_scalar(s + i, len - i, dst + n);
+}
+#endif  // UTF8_SIMD_X86
+
+// Decodes input already known to be valid.
+static size_t utf8_to_utf32_valid(const uint8_t* s, size_t len, uint32_t* dst) {
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+        case UTF8_SIMD_AVX2:
+        case UTF8_SIMD_SSSE3:
+            return utf8_to_utf32_ssse3(s, len, dst);
+#endif
+        default:
+            return utf8_to_utf32_scalar(s, len, dst);
+    }
+}
+
+int64_t utf8_to_utf32_length(UTF8View src) {
+    return utf8_cp_count_view(src);
+}
+
+UTF8Validation utf8_to_utf32(UTF8View src, uint32_t* dst, size_t* written) {
+    if (!src.ptr || !dst || !written) {
+        return (UTF8Validation) {UTF8_ERROR_TRUNCATED, 0};
+    }
+
+    // Validate up front; the decoders then trust their input
+    UTF8Validation result = utf8_validate(src);
+    *written = utf8_to_utf32_valid(src.ptr, result.offset, dst);
+    return result;
+}
+
+// --- UTF-32 to UTF-8 ---
+
+static inline UTF8Error utf8_transcode_check(uint32_t cp) {
+    if (cp > 0x10FFFF) {
+        return UTF8_ERROR_TOO_LARGE;
+    }
+    if (cp >= 0xD800 && cp <= 0xDFFF) {
+        return UTF8_ERROR_SURROGATE;
+    }
+    return UTF8_ERROR_NONE;
+}
+
+int64_t utf32_to_utf8_length(const uint32_t* src, size_t len) {
+    if (!src && len > 0) {
+        return -1;
+    }
+
+    int64_t bytes = 0;
+    bool invalid = false;
+    for (size_t i = 0; i < len; i++) {
+        uint32_t cp = src[i];
+        bytes += 1 + (cp >= 0x80) + (cp >= 0x800) + (cp >= 0x10000);
+        invalid |= cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF);
+    }
+
+    return invalid ? -1 : bytes;
+}
+
+static UTF8Validation utf32_to_utf8_scalar(
+    const uint32_t* src, size_t len, size_t i, uint8_t* dst, size_t* written
+) {
+    size_t n = *written;
+    for (; i < len; i++) {
+        UTF8Error error = utf8_transcode_check(src[i]);
+        if (error != UTF8_ERROR_NONE) {
+            *written = n;
+            return (UTF8Validation) {error, i};
+        }
+        n += (size_t) utf8_cp_encode((int32_t) src[i], dst + n);
+    }
+
+    *written = n;
+    return (UTF8Validation) {UTF8_ERROR_NONE, len};
+}
+
+#if UTF8_SIMD_X86
+// Compacts four 16-bit lanes holding 1- or 2-byte sequences; indexed by the ASCII lane mask.
+static const int8_t utf8_transcode_pack[16][16] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 2, 3, 4, 5, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, 4, 5, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 2, 4, 5, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 2, 3, 4, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, 4, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 2, 4, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 2, 3, 4, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, 4, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 2, 4, 5, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, 3, 4, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 2, 3, 4, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 1, 2, 4, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+    {0, 2, 4, 6, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},
+};
+
+// True if every 32-bit lane of (v & mask) equals value.
+__attribute__((target("ssse3")))
+static inline bool utf8_transcode_all_ssse3(__m128i v, int32_t mask, int32_t value) {
+    __m128i eq = _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(mask)), _mm_set1_epi32(value));
+    return _mm_movemask_epi8(eq) == 0xFFFF;
+}
+
+// True if no 32-bit lane of (v & mask) equals value.
+__attribute__((target("ssse3")))
+static inline bool utf8_transcode_none_ssse3(__m128i v, int32_t mask, int32_t value) {
+    __m128i eq = _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32(mask)), _mm_set1_epi32(value));
+    return _mm_movemask_epi8(eq) == 0;
+}
+
+// True if every 16-bit lane of (v & mask) equals value.
+__attribute__((target("ssse3")))
+static inline bool utf8_transcode_all16_ssse3(__m128i v, int16_t mask, int16_t value) {
+    __m128i eq = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(mask)), _mm_set1_epi16(value));
+    return _mm_movemask_epi8(eq) == 0xFFFF;
+}
+
+// True if no 16-bit lane of (v & mask) equals value.
+__attribute__((target("ssse3")))
+static inline bool utf8_transcode_none16_ssse3(__m128i v, int16_t mask, int16_t value) {
+    __m128i eq = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(mask)), _mm_set1_epi16(value));
+    return _mm_movemask_epi8(eq) == 0;
+}
+
+// Eight codepoints U+0080 through U+07FF in 16-bit lanes; writes 16 bytes.
+__attribute__((target("ssse3")))
+static inline void utf8_transcode_encode2_ssse3(__m128i cp, uint8_t* dst) {
+    __m128i lead = _mm_or_si128(_mm_srli_epi16(cp, 6), _mm_set1_epi16(0xC0));
+    __m128i cont = _mm_or_si128(_mm_and_si128(cp, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+    _mm_storeu_si128((__m128i*) dst, _mm_or_si128(lead, _mm_slli_epi16(cont, 8)));
+}
+
+// True if all four 32-bit lanes are 3-byte codepoints: U+0800 through U+FFFF, minus surrogates.
+__attribute__((target("ssse3")))
+static inline bool utf8_transcode_is3_ssse3(__m128i a) {
+    return utf8_transcode_all_ssse3(a, ~0xFFFF, 0) && utf8_transcode_none_ssse3(a, 0xF800, 0)
+           && utf8_transcode_none_ssse3(a, 0xF800, 0xD800);
+}
+
+// Four 3-byte codepoints in 32-bit lanes; writes exactly 12 bytes.
+__attribute__((target("ssse3")))
+static inline void utf8_transcode_encode3_ssse3(__m128i a, uint8_t* dst) {
+    // Bytes 0-2 of each 32-bit lane, packed into 12 bytes
+    const __m128i triples = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+
+    __m128i lead = _mm_or_si128(_mm_srli_epi32(a, 12), _mm_set1_epi32(0xE0));
+    __m128i mid = _mm_or_si128(
+        _mm_and_si128(_mm_slli_epi32(a, 2), _mm_set1_epi32(0x3F00)), _mm_set1_epi32(0x8000)
+    );
+    __m128i last = _mm_or_si128(
+        _mm_and_si128(_mm_slli_epi32(a, 16), _mm_set1_epi32(0x3F0000)), _mm_set1_epi32(0x800000)
+    );
+    __m128i packed = _mm_or_si128(_mm_or_si128(lead, mid), last);
+
+    uint8_t bytes[16];
+    _mm_storeu_si128((__m128i*) bytes, _mm_shuffle_epi8(packed, triples));
+    memcpy(dst, bytes, 12);
+}
+
+// Four codepoints below U+0800 in 32-bit lanes, mixing 1- and 2-byte sequences.
+// Returns the number of bytes written.
+__attribute__((target("ssse3")))
+static inline size_t utf8_transcode_encode12_ssse3(__m128i a, uint8_t* dst) {
+    __m128i ascii = _mm_cmpeq_epi32(_mm_and_si128(a, _mm_set1_epi32(~0x7F)), _mm_setzero_si128());
+    int mask = _mm_movemask_ps(_mm_castsi128_ps(ascii));
+    __m128i cp = _mm_packs_epi32(a, a);
+    __m128i lead = _mm_or_si128(_mm_srli_epi16(cp, 6), _mm_set1_epi16(0xC0));
+    __m128i cont = _mm_or_si128(_mm_and_si128(cp, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+    __m128i pairs = _mm_or_si128(lead, _mm_slli_epi16(cont, 8));
+    __m128i lanes = _mm_packs_epi32(ascii, ascii);
+    pairs = _mm_or_si128(_mm_and_si128(lanes, cp), _mm_andnot_si128(lanes, pairs));
+    __m128i order = _mm_loadu_si128((const __m128i*) utf8_transcode_pack[mask]);
+
+    uint8_t bytes[16];
+    size_t width = 8 - (size_t) __builtin_popcount((unsigned) mask);
+    _mm_storeu_si128((__m128i*) bytes, _mm_shuffle_epi8(pairs, order));
+    memcpy(dst, bytes, width);
+    return width;
+}
+
+__attribute__((target("ssse3")))
+static UTF8Validation utf32_to_utf8_ssse3(
+    const uint32_t* src, size_t len, uint8_t* dst, size_t* written
+) {
+    size_t i = 0;
+    size_t n = 0;
+    while (i + 8 <= len) {
+        __m128i a = _mm_loadu_si128((const __m128i*) (src + i));
+        __m128i b = _mm_loadu_si128((const __m128i*) (src + i + 4));
+        __m128i both = _mm_or_si128(a, b);
+
+        // Eight ASCII codepoints
+        if (utf8_transcode_all_ssse3(both, ~0x7F, 0)) {
+            __m128i words = _mm_packs_epi32(a, b);
+            _mm_storel_epi64((__m128i*) (dst + n), _mm_packus_epi16(words, words));
+            i += 8;
+            n += 8;
+            continue;
+        }
+
+        // Eight 2-byte codepoints: U+0080 through U+07FF
+        if (utf8_transcode_all_ssse3(both, ~0x7FF, 0) && utf8_transcode_none_ssse3(a, 0x780, 0)
+            && utf8_transcode_none_ssse3(b, 0x780, 0)) {
+            utf8_transcode_encode2_ssse3(_mm_packs_epi32(a, b), dst + n);
+            i += 8;
+            n += 16;
+            continue;
+        }
+
+        // Four 3-byte codepoints
+        if (utf8_transcode_is3_ssse3(a)) {
+            utf8_transcode_encode3_ssse3(a, dst + n);
+            i += 4;
+            n += 12;
+            continue;
+        }
+
+        // Four codepoints below U+0800
+        if (utf8_transcode_all_ssse3(a, ~0x7FF, 0)) {
+            n += utf8_transcode_encode12_ssse3(a, dst + n);
+            i += 4;
+            continue;
+        }
+
+        // Otherwise encode this block one codepoint at a time
+        for (size_t end = i + 4; i < end; i++) {
+            UTF8Error error = utf8_transcode_check(src[i]);
+            if (error != UTF8_ERROR_NONE) {
+                *written = n;
+                return (UTF8Validation) {error, i};
+            }
+            n += (size_t) utf8_cp_encode((int32_t) src[i], dst + n);
+        }
+    }
+
+    *written = n;
+    return utf32_to_utf8_scalar(src, len, i, dst, written);
+}
+#endif  // UTF8_SIMD_X86
+
+UTF8Validation utf32_to_utf8(const uint32_t* src, size_t len, uint8_t* dst, size_t* written) {
+    if ((!src && len > 0) || !dst || !written) {
+        return (UTF8Validation) {UTF8_ERROR_TRUNCATED, 0};
+    }
+
+    *written = 0;
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+        case UTF8_SIMD_AVX2:
+        case UTF8_SIMD_SSSE3:
+            return utf32_to_utf8_ssse3(src, len, dst, written);
+#endif
+        default:
+            return utf32_to_utf8_scalar(src, len, 0, dst, written);
+    }
+}
+
+// --- UTF-8 to UTF-16 ---
+
+// True if units in the requested byte order must be swapped on this host.
+static inline bool utf8_transcode_swap(bool big_endian) {
+    return big_endian != (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__);
+}
+
+static inline uint16_t utf8_transcode_unit(uint16_t unit, bool swap) {
+    return swap ? __builtin_bswap16(unit) : unit;
+}
+
+// Decodes one valid sequence into one or two UTF-16 units; returns the bytes consumed.
+static inline size_t utf8_transcode_decode16(
+    const uint8_t* s, uint16_t* dst, size_t* n, bool swap
+) {
+    if (s[0] >= 0xF0) {
+        // Supplementary planes become a surrogate pair
+        uint32_t cp = (uint32_t) utf8_cp_decode(s) - 0x10000;
+        dst[(*n)++] = utf8_transcode_unit((uint16_t) (0xD800 | (cp >> 10)), swap);
+        dst[(*n)++] = utf8_transcode_unit((uint16_t) (0xDC00 | (cp & 0x3FF)), swap);
+        return 4;
+    }
+
+    uint32_t cp;
+    size_t width = utf8_transcode_decode(s, &cp);
+    dst[(*n)++] = utf8_transcode_unit((uint16_t) cp, swap);
+    return width;
+}
+
+static size_t utf8_to_utf16_scalar(const uint8_t* s, size_t len, uint16_t* dst, bool swap) {
+    size_t i = 0;
+    size_t n = 0;
+    while (i < len) {
+        // ASCII runs, 8 bytes at a time
+        if (i + 8 <= len) {
+            uint64_t word;
+            memcpy(&word, s + i, sizeof(word));
+            if (!(word & 0x8080808080808080ULL)) {
+                for (int k = 0; k < 8; k++) {
+                    dst[n++] = utf8_transcode_unit(s[i + k], swap);
+                }
+                i += 8;
+                continue;
+            }
+        }
+
+        i += utf8_transcode_decode16(s + i, dst, &n, swap);
+    }
+
+    return n;
+}
+
+#if UTF8_SIMD_X86
+// Shuffle that puts 16-bit lanes in the requested byte order.
+__attribute__((target("ssse3")))
+static inline __m128i utf8_transcode_order_ssse3(bool swap) {
+    return swap ? _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)
+                : _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+}
+
+__attribute__((target("ssse3")))
+static size_t utf8_to_utf16_ssse3(const uint8_t* s, size_t len, uint16_t* dst, bool swap) {
+    const __m128i zero = _mm_setzero_si128();
+    // Four 3-byte sequences, one per 32-bit lane as (byte 2, byte 1, byte 0, 0)
+    const __m128i triples = _mm_setr_epi8(2, 1, 0, -1, 5, 4, 3, -1, 8, 7, 6, -1, 11, 10, 9, -1);
+    // Output byte order for 16-bit lanes, and the low halves of four 32-bit lanes
+    const __m128i order = utf8_transcode_order_ssse3(swap);
+    const __m128i halves = _mm_shuffle_epi8(
+        _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1), order
+    );
+
+    size_t i = 0;
+    size_t n = 0;
+    while (i + 16 <= len) {
+        __m128i v = _mm_loadu_si128((const __m128i*) (s + i));
+        uint32_t high = (uint32_t) _mm_movemask_epi8(v);
+
+        if (high == 0) {
+            __m128i lo = _mm_unpacklo_epi8(v, zero);
+            __m128i hi = _mm_unpackhi_epi8(v, zero);
+            _mm_storeu_si128((__m128i*) (dst + n), _mm_shuffle_epi8(lo, order));
+            _mm_storeu_si128((__m128i*) (dst + n + 8), _mm_shuffle_epi8(hi, order));
+            i += 16;
+            n += 16;
+            continue;
+        }
+
+        // ASCII before the first multi-byte sequence
+        size_t ascii = (size_t) __builtin_ctz(high);
+        if (ascii > 0) {
+            for (size_t k = 0; k < ascii; k++) {
+                dst[n++] = utf8_transcode_unit(s[i + k], swap);
+            }
+            i += ascii;
+            continue;
+        }
+
+        // Eight 2-byte sequences: each 16-bit lane is lead | continuation << 8
+        __m128i pairs = _mm_cmpeq_epi16(
+            _mm_and_si128(v, _mm_set1_epi16((short) 0xC0E0)), _mm_set1_epi16((short) 0x80C0)
+        );
+        if (_mm_movemask_epi8(pairs) == 0xFFFF) {
+            __m128i cp = _mm_or_si128(
+                _mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi16(0x1F)), 6),
+                _mm_and_si128(_mm_srli_epi16(v, 8), _mm_set1_epi16(0x3F))
+            );
+            _mm_storeu_si128((__m128i*) (dst + n), _mm_shuffle_epi8(cp, order));
+            i += 16;
+            n += 8;
+            continue;
+        }
+
+        // Four 3-byte sequences in the first 12 bytes
+        __m128i t = _mm_shuffle_epi8(v, triples);
+        __m128i threes = _mm_cmpeq_epi32(
+            _mm_and_si128(t, _mm_set1_epi32(0x00F0C0C0)), _mm_set1_epi32(0x00E08080)
+        );
+        if (_mm_movemask_epi8(threes) == 0xFFFF) {
+            __m128i cp = _mm_or_si128(
+                _mm_or_si128(
+                    _mm_and_si128(t, _mm_set1_epi32(0x3F)),
+                    _mm_and_si128(_mm_srli_epi32(t, 2), _mm_set1_epi32(0x3F << 6))
+                ),
+                _mm_and_si128(_mm_srli_epi32(t, 4), _mm_set1_epi32(0x0F << 12))
+            );
+            _mm_storel_epi64((__m128i*) (dst + n), _mm_shuffle_epi8(cp, halves));
+            i += 12;
+            n += 4;
+            continue;
+        }
+
+        // Otherwise decode through the first half of the block before probing again
+        for (size_t end = i + 8; i < end;) {
+            i += utf8_transcode_decode16(s + i, dst, &n, swap);
+        }
+    }
+
+    return n + utf8_to_utf16_scalar(s + i, len - i, dst + n, swap);
+}
+#endif  // UTF8_SIMD_X86
+
+int64_t utf8_to_utf16_length(UTF8View src) {
+    size_t count = 0;
+    if (!src.ptr || utf8_validate_count(src, &count).error != UTF8_ERROR_NONE) {
+        return -1;
+    }
+
+    // Each 4-byte sequence takes a second unit
+    size_t pairs = 0;
+    for (size_t i = 0; i < src.len; i++) {
+        pairs += src.ptr[i] >= 0xF0;
+    }
+
+    return (int64_t) (count + pairs);
+}
+
+static UTF8Validation utf8_to_utf16(UTF8View src, uint16_t* dst, size_t* written, bool swap) {
+    if (!src.ptr || !dst || !written) {
+        return (UTF8Validation) {UTF8_ERROR_TRUNCATED, 0};
+    }
+
+    UTF8Validation result = utf8_validate(src);
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+        case UTF8_SIMD_AVX2:
+        case UTF8_SIMD_SSSE3:
+            *written = utf8_to_utf16_ssse3(src.ptr, result.offset, dst, swap);
+            break;
+#endif
+        default:
+            *written = utf8_to_utf16_scalar(src.ptr, result.offset, dst, swap);
+            break;
+    }
+
+    return result;
+}
+
+UTF8Validation utf8_to_utf16le(UTF8View src, uint16_t* dst, size_t* written) {
+    return utf8_to_utf16(src, dst, written, utf8_transcode_swap(false));
+}
+
+UTF8Validation utf8_to_utf16be(UTF8View src, uint16_t* dst, size_t* written) {
+    return utf8_to_utf16(src, dst, written, utf8_transcode_swap(true));
+}
+
+// --- UTF-16 to UTF-8 ---
+
+// Reads the codepoint at src[i], joining surrogate pairs; *units is 1 or 2.
+static inline UTF8Error utf8_transcode_read16(
+    const uint16_t* src, size_t len, size_t i, bool swap, uint32_t* cp, size_t* units
+) {
+    uint16_t unit = utf8_transcode_unit(src[i], swap);
+    *cp = unit;
+    *units = 1;
+    if ((unit & 0xF800) != 0xD800) {
+        return UTF8_ERROR_NONE;
+    }
+    if (unit >= 0xDC00) {
+        return UTF8_ERROR_SURROGATE;  // Low surrogate without a high one
+    }
+    if (i + 1 >= len) {
+        return UTF8_ERROR_TRUNCATED;
+    }
+
+    uint16_t low = utf8_transcode_unit(src[i + 1], swap);
+    if ((low & 0xFC00) != 0xDC00) {
+        return UTF8_ERROR_SURROGATE;
+    }
+
+    *cp = 0x10000 + ((uint32_t) (unit - 0xD800) << 10) + (uint32_t) (low - 0xDC00);
+    *units = 2;
+    return UTF8_ERROR_NONE;
+}
+
+static int64_t utf16_to_utf8_length(const uint16_t* src, size_t len, bool swap) {
+    if (!src && len > 0) {
+        return -1;
+    }
+
+    int64_t bytes = 0;
+    for (size_t i = 0; i < len; i++) {
+        uint16_t unit = utf8_transcode_unit(src[i], swap);
+        bytes += 1 + (unit >= 0x80) + (unit >= 0x800);
+        if ((unit & 0xF800) == 0xD800) {
+            // A pair is 4 bytes: one more than counted for the high unit, none for the low
+            uint32_t cp;
+            size_t units;
+            if (utf8_transcode_read16(src, len, i, swap, &cp, &units) != UTF8_ERROR_NONE) {
+                return -1;
+            }
+            bytes++;
+            i++;
+        }
+    }
+
+    return bytes;
+}
+
+int64_t utf16le_to_utf8_length(const uint16_t* src, size_t len) {
+    return utf16_to_utf8_length(src, len, utf8_transcode_swap(false));
+}
+
+int64_t utf16be_to_utf8_length(const uint16_t* src, size_t len) {
+    return utf16_to_utf8_length(src, len, utf8_transcode_swap(true));
+}
+
+static UTF8Validation utf16_to_utf8_scalar(
+    const uint16_t* src, size_t len, size_t i, uint8_t* dst, size_t* written, bool swap
+) {
+    size_t n = *written;
+    while (i < len) {
+        uint32_t cp;
+        size_t units;
+        UTF8Error error = utf8_transcode_read16(src, len, i, swap, &cp, &units);
+        if (error != UTF8_ERROR_NONE) {
+            *written = n;
+            return (UTF8Validation) {error, i};
+        }
+        n += (size_t) utf8_cp_encode((int32_t) cp, dst + n);
+        i += units;
+    }
+
+    *written = n;
+    return (UTF8Validation) {UTF8_ERROR_NONE, len};
+}
+
+#if UTF8_SIMD_X86
+__attribute__((target("ssse3")))
+static UTF8Validation utf16_to_utf8_ssse3(
+    const uint16_t* src, size_t len, uint8_t* dst, size_t* written, bool swap
+) {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i order = utf8_transcode_order_ssse3(swap);
+
+    size_t i = 0;
+    size_t n = 0;
+    while (i + 8 <= len) {
+        __m128i v = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*) (src + i)), order);
+
+        // Eight ASCII units
+        if (utf8_transcode_all16_ssse3(v, ~0x7F, 0)) {
+            _mm_storel_epi64((__m128i*) (dst + n), _mm_packus_epi16(v, v));
+            i += 8;
+            n += 8;
+            continue;
+        }
+
+        // Eight 2-byte units: U+0080 through U+07FF
+        if (utf8_transcode_all16_ssse3(v, ~0x7FF, 0) && utf8_transcode_none16_ssse3(v, 0x780, 0)) {
+            utf8_transcode_encode2_ssse3(v, dst + n);
+            i += 8;
+            n += 16;
+            continue;
+        }
+
+        // Eight 3-byte units: at least U+0800 and no surrogates
+        if (utf8_transcode_none16_ssse3(v, (int16_t) 0xF800, 0)
+            && utf8_transcode_none16_ssse3(v, (int16_t) 0xF800, (int16_t) 0xD800)) {
+            utf8_transcode_encode3_ssse3(_mm_unpacklo_epi16(v, zero), dst + n);
+            utf8_transcode_encode3_ssse3(_mm_unpackhi_epi16(v, zero), dst + n + 12);
+            i += 8;
+            n += 24;
+            continue;
+        }
+
+        // The first four units, as above
+        __m128i a = _mm_unpacklo_epi16(v, zero);
+        if (utf8_transcode_is3_ssse3(a)) {
+            utf8_transcode_encode3_ssse3(a, dst + n);
+            i += 4;
+            n += 12;
+            continue;
+        }
+        if (utf8_transcode_all_ssse3(a, ~0x7FF, 0)) {
+            n += utf8_transcode_encode12_ssse3(a, dst + n);
+            i += 4;
+            continue;
+        }
+
+        // Otherwise encode the first four units one codepoint at a time, joining pairs
+        for (size_t end = i + 4; i < end;) {
+            uint32_t cp;
+            size_t units;
+            UTF8Error error = utf8_transcode_read16(src, len, i, swap, &cp, &units);
+            if (error != UTF8_ERROR_NONE) {
+                *written = n;
+                return (UTF8Validation) {error, i};
+            }
+            n += (size_t) utf8_cp_encode((int32_t) cp, dst + n);
+            i += units;
+        }
+    }
+
+    *written = n;
+    return utf16_to_utf8_scalar(src, len, i, dst, written, swap);
+}
+#endif  // UTF8_SIMD_X86
+
+static UTF8Validation utf16_to_utf8(
+    const uint16_t* src, size_t len, uint8_t* dst, size_t* written, bool swap
+) {
+    if ((!src && len > 0) || !dst || !written) {
+        return (UTF8Validation) {UTF8_ERROR_TRUNCATED, 0};
+    }
+
+    *written = 0;
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+        case UTF8_SIMD_AVX2:
+        case UTF8_SIMD_SSSE3:
+            return utf16_to_utf8_ssse3(src, len, dst, written, swap);
+#endif
+        default:
+            return utf16_to_utf8_scalar(src, len, 0, dst, written, swap);
+    }
+}
+
+UTF8Validation utf16le_to_utf8(const uint16_t* src, size_t len, uint8_t* dst, size_t* written) {
+    return utf16_to_utf8(src, len, dst, written, utf8_transcode_swap(false));
+}
+
+UTF8Validation utf16be_to_utf8(const uint16_t* src, size_t len, uint8_t* dst, size_t* written) {
+    return utf16_to_utf8(src, len, dst, written, utf8_transcode_swap(true));
+}
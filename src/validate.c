@@ -0,0 +1,553 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/validate.c
+ * @brief Vectorized UTF-8 validation with error location.
+ *
+ * The vector kernels use the lookup algorithm of Keiser and Lemire, "Validating
+ * UTF-8 In Less Than One Instruction Per Byte" (2021). Each byte pair (prev1,
+ * input) is classified by three 16-entry tables indexed by the high nibble of
+ * prev1, the low nibble of prev1 and the high nibble of input; an error bit that
+ * survives the AND of all three marks an invalid pair. Third and fourth bytes are
+ * checked by comparing the expected continuation positions (from prev2, prev3)
+ * with the continuation bytes actually seen.
+ */
+
+#include <string.h>
+
+#include "simd.h"
+#include "codepoint.h"
+#include "validate.h"
+
+#define UTF8_VALIDATE_BLOCK 64
+
+// --- Scalar ---
+
+static inline bool utf8_validate_is_continuation(uint8_t byte) {
+    return (byte & 0xC0) == 0x80;
+}
+
+// Validates from offset onward, which must be a codepoint boundary, adding the
+// codepoints it passes over (up to the error, if any) to *count unless count is NULL.
+static UTF8Validation utf8_validate_scalar(
+    const uint8_t* s, size_t len, size_t offset, size_t* count
+) {
+    UTF8Error error = UTF8_ERROR_NONE;
+    size_t i = offset;
+    size_t n = 0;
+    while (i < len) {
+        // ASCII runs, 8 bytes at a time
+        while (i + 8 <= len) {
+            uint64_t word;
+            memcpy(&word, s + i, sizeof(word));
+            if (word & 0x8080808080808080ULL) {
+                break;
+            }
+            i += 8;
+            n += 8;
+        }
+        if (i >= len) {
+            break;
+        }
+
+        uint8_t lead = s[i];
+        if (lead < 0x80) {
+            i++;
+            n++;
+            continue;
+        }
+
+        size_t width = 0;
+        if (lead < 0xC0) {
+            error = UTF8_ERROR_CONTINUATION;
+        } else if (lead < 0xC2) {
+            error = UTF8_ERROR_OVERLONG;
+        } else if (lead < 0xE0) {
+            width = 2;
+        } else if (lead < 0xF0) {
+            width = 3;
+        } else if (lead < 0xF5) {
+            width = 4;
+        } else {
+            error = UTF8_ERROR_TOO_LARGE;
+        }
+
+        for (size_t k = 1; k < width && !error; k++) {
+            if (i + k >= len || !utf8_validate_is_continuation(s[i + k])) {
+                error = UTF8_ERROR_TRUNCATED;
+            }
+        }
+        if (error) {
+            break;
+        }
+
+        // The second byte decides the remaining range errors
+        uint8_t next = s[i + 1];
+        if ((lead == 0xE0 && next < 0xA0) || (lead == 0xF0 && next < 0x90)) {
+            error = UTF8_ERROR_OVERLONG;
+        } else if (lead == 0xED && next >= 0xA0) {
+            error = UTF8_ERROR_SURROGATE;
+        } else if (lead == 0xF4 && next >= 0x90) {
+            error = UTF8_ERROR_TOO_LARGE;
+        }
+        if (error) {
+            break;
+        }
+
+        i += width;
+        n++;
+    }
+
+    if (count) {
+        *count += n;
+    }
+    return (UTF8Validation) {error, error ? i : len};
+}
+
+// --- Vector kernels ---
+
+#if UTF8_SIMD_X86
+// Error bits shared by the three lookup tables
+    #define TOO_SHORT (1 << 0)  // 11______ 0_______ or 11______ 11______
+    #define TOO_LONG (1 << 1)  // 0_______ 10______
+    #define OVERLONG_3 (1 << 2)  // 11100000 100_____
+    #define TOO_LARGE (1 << 3)  // 11110100 1001____, 11110100 101_____, 11110101+ 10______
+    #define SURROGATE (1 << 4)  // 11101101 101_____
+    #define OVERLONG_2 (1 << 5)  // 1100000_ 10______
+    #define TOO_LARGE_1000 (1 << 6)  // 11110101+ 1000____
+    #define OVERLONG_4 (1 << 6)  // 11110000 1000____
+    #define TWO_CONTS (1 << 7)  // 10______ 10______
+    #define CARRY (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+// High nibble of the first byte of each pair
+static const uint8_t utf8_validate_byte_1_high[16] = {
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,  // 0_______ (ASCII)
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,  // 10______ (continuation)
+    TOO_SHORT | OVERLONG_2,  // 1100____
+    TOO_SHORT,  // 1101____
+    TOO_SHORT | OVERLONG_3 | SURROGATE,  // 1110____
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4,  // 1111____
+};
+
+// Low nibble of the first byte of each pair
+static const uint8_t utf8_validate_byte_1_low[16] = {
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,  // ____0000
+    CARRY | OVERLONG_2,  // ____0001
+    CARRY,  // ____001_
+    CARRY,
+    CARRY | TOO_LARGE,  // ____0100
+    CARRY | TOO_LARGE | TOO_LARGE_1000,  // ____0101
+    CARRY | TOO_LARGE | TOO_LARGE_1000,  // ____011_
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,  // ____1___
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,  // ____1101
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+    CARRY | TOO_LARGE | TOO_LARGE_1000,
+};
+
+// High nibble of the second byte of each pair
+static const uint8_t utf8_validate_byte_2_high[16] = {
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,  // 0_______ (ASCII)
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,  // 1000____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,  // 1001____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,  // 101_____
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,  // 11______
+};
+
+    #undef TOO_SHORT
+    #undef TOO_LONG
+    #undef OVERLONG_3
+    #undef TOO_LARGE
+    #undef SURROGATE
+    #undef OVERLONG_2
+    #undef TOO_LARGE_1000
+    #undef OVERLONG_4
+    #undef TWO_CONTS
+    #undef CARRY
+
+// A block ending in these bytes is waiting for continuation bytes (minus one: the
+// saturating subtraction is non-zero only for the lead bytes at those positions)
+    #define FF8 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+static const uint8_t utf8_validate_incomplete[UTF8_VALIDATE_BLOCK] = {
+    FF8, FF8, FF8, FF8, FF8, FF8, FF8,  // 56 bytes
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1,
+};
+    #undef FF8
+
+/**
+ * @note Every kernel returns the offset of the first 64-byte block found invalid,
+ *       or SIZE_MAX if the input is valid. Given a count, a kernel also adds up the
+ *       lead bytes of the blocks it accepts (exact only if the input is valid). The
+ *       final partial block is copied into a zero-padded buffer, so kernels never
+ *       read past the input; the padding also exposes a sequence truncated by the
+ *       end of input.
+ */
+
+__attribute__((target("ssse3")))
+static inline __m128i utf8_validate_check_ssse3(__m128i input, __m128i prev_input) {
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i byte_1_high = _mm_loadu_si128((const __m128i*) utf8_validate_byte_1_high);
+    const __m128i byte_1_low = _mm_loadu_si128((const __m128i*) utf8_validate_byte_1_low);
+    const __m128i byte_2_high = _mm_loadu_si128((const __m128i*) utf8_validate_byte_2_high);
+
+    __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+    __m128i special = _mm_and_si128(
+        _mm_and_si128(
+            _mm_shuffle_epi8(byte_1_high, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble)),
+            _mm_shuffle_epi8(byte_1_low, _mm_and_si128(prev1, nibble))
+        ),
+        _mm_shuffle_epi8(byte_2_high, _mm_and_si128(_mm_srli_epi16(input, 4), nibble))
+    );
+
+    // Third and fourth bytes of 3- and 4-byte sequences must be continuations
+    __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+    __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+    __m128i third = _mm_subs_epu8(prev2, _mm_set1_epi8((char) (0xE0 - 0x80)));
+    __m128i fourth = _mm_subs_epu8(prev3, _mm_set1_epi8((char) (0xF0 - 0x80)));
+    __m128i must23 = _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8((char) 0x80));
+
+    return _mm_xor_si128(must23, special);
+}
+
+__attribute__((target("ssse3")))
+static inline bool utf8_validate_block_ssse3(
+    const uint8_t* block, __m128i* prev_input, __m128i* prev_incomplete, size_t* count
+) {
+    __m128i a = _mm_loadu_si128((const __m128i*) block);
+    __m128i b = _mm_loadu_si128((const __m128i*) (block + 16));
+    __m128i c = _mm_loadu_si128((const __m128i*) (block + 32));
+    __m128i d = _mm_loadu_si128((const __m128i*) (block + 48));
+
+    // A pure ASCII block is only invalid if it cuts off a sequence from the previous one
+    __m128i error = *prev_incomplete;
+    if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)))) {
+        error = utf8_validate_check_ssse3(a, *prev_input);
+        error = _mm_or_si128(error, utf8_validate_check_ssse3(b, a));
+        error = _mm_or_si128(error, utf8_validate_check_ssse3(c, b));
+        error = _mm_or_si128(error, utf8_validate_check_ssse3(d, c));
+        *prev_incomplete = _mm_subs_epu8(
+            d, _mm_loadu_si128((const __m128i*) (utf8_validate_incomplete + 48))
+        );
+        if (count) {
+            const __m128i threshold = _mm_set1_epi8(-65);  // Lead bytes compare greater
+            *count += (size_t) __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(a, threshold)));
+            *count += (size_t) __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(b, threshold)));
+            *count += (size_t) __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(c, threshold)));
+            *count += (size_t) __builtin_popcount(_mm_movemask_epi8(_mm_cmpgt_epi8(d, threshold)));
+        }
+    } else {
+        *prev_incomplete = _mm_setzero_si128();  // ASCII ends every sequence
+        if (count) {
+            *count += UTF8_VALIDATE_BLOCK;
+        }
+    }
+    *prev_input = d;
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+}
+
+__attribute__((target("ssse3")))
+static size_t utf8_validate_ssse3(const uint8_t* s, size_t len, size_t* count) {
+    __m128i prev_input = _mm_setzero_si128();
+    __m128i prev_incomplete = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + UTF8_VALIDATE_BLOCK <= len; i += UTF8_VALIDATE_BLOCK) {
+        if (!utf8_validate_block_ssse3(s + i, &prev_input, &prev_incomplete, count)) {
+            return i;
+        }
+    }
+
+    uint8_t tail[UTF8_VALIDATE_BLOCK] = {0};
+    memcpy(tail, s + i, len - i);
+    if (!utf8_validate_block_ssse3(tail, &prev_input, &prev_incomplete, count)) {
+        return i;
+    }
+    if (count) {
+        *count -= UTF8_VALIDATE_BLOCK - (len - i);  // The zero padding counted as ASCII
+    }
+    return SIZE_MAX;
+}
+
+__attribute__((target("avx2")))
+static inline __m256i utf8_validate_check_avx2(__m256i input, __m256i prev_input) {
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i byte_1_high = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i*) utf8_validate_byte_1_high)
+    );
+    const __m256i byte_1_low = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i*) utf8_validate_byte_1_low)
+    );
+    const __m256i byte_2_high = _mm256_broadcastsi128_si256(
+        _mm_loadu_si128((const __m128i*) utf8_validate_byte_2_high)
+    );
+
+    // alignr works per 128-bit lane; feed it the lane that precedes each one
+    __m256i carry = _mm256_permute2x128_si256(prev_input, input, 0x21);
+    __m256i prev1 = _mm256_alignr_epi8(input, carry, 15);
+    __m256i special = _mm256_and_si256(
+        _mm256_and_si256(
+            _mm256_shuffle_epi8(byte_1_high, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble)),
+            _mm256_shuffle_epi8(byte_1_low, _mm256_and_si256(prev1, nibble))
+        ),
+        _mm256_shuffle_epi8(byte_2_high, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble))
+    );
+
+    __m256i prev2 = _mm256_alignr_epi8(input, carry, 14);
+    __m256i prev3 = _mm256_alignr_epi8(input, carry, 13);
+    __m256i third = _mm256_subs_epu8(prev2, _mm256_set1_epi8((char) (0xE0 - 0x80)));
+    __m256i fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8((char) (0xF0 - 0x80)));
+    __m256i must23 = _mm256_and_si256(
+        _mm256_or_si256(third, fourth), _mm256_set1_epi8((char) 0x80)
+    );
+
+    return _mm256_xor_si256(must23, special);
+}
+
+__attribute__((target("avx2")))
+static inline bool utf8_validate_block_avx2(
+    const uint8_t* block, __m256i* prev_input, __m256i* prev_incomplete, size_t* count
+) {
+    __m256i a = _mm256_loadu_si256((const __m256i*) block);
+    __m256i b = _mm256_loadu_si256((const __m256i*) (block + 32));
+
+    __m256i error = *prev_incomplete;
+    if (_mm256_movemask_epi8(_mm256_or_si256(a, b))) {
+        error = utf8_validate_check_avx2(a, *prev_input);
+        error = _mm256_or_si256(error, utf8_validate_check_avx2(b, a));
+        *prev_incomplete = _mm256_subs_epu8(
+            b, _mm256_loadu_si256((const __m256i*) (utf8_validate_incomplete + 32))
+        );
+        if (count) {
+            const __m256i threshold = _mm256_set1_epi8(-65);
+            *count += (size_t) __builtin_popcount(
+                (uint32_t) _mm256_movemask_epi8(_mm256_cmpgt_epi8(a, threshold))
+            );
+            *count += (size_t) __builtin_popcount(
+                (uint32_t) _mm256_movemask_epi8(_mm256_cmpgt_epi8(b, threshold))
+            );
+        }
+    } else {
+        *prev_incomplete = _mm256_setzero_si256();
+        if (count) {
+            *count += UTF8_VALIDATE_BLOCK;
+        }
+    }
+    *prev_input = b;
+
+    return _mm256_testz_si256(error, error);
+}
+
+__attribute__((target("avx2")))
+static size_t utf8_validate_avx2(const uint8_t* s, size_t len, size_t* count) {
+    __m256i prev_input = _mm256_setzero_si256();
+    __m256i prev_incomplete = _mm256_setzero_si256();
+
+    size_t i = 0;
+    for (; i + UTF8_VALIDATE_BLOCK <= len; i += UTF8_VALIDATE_BLOCK) {
+        if (!utf8_validate_block_avx2(s + i, &prev_input, &prev_incomplete, count)) {
+            return i;
+        }
+    }
+
+    uint8_t tail[UTF8_VALIDATE_BLOCK] = {0};
+    memcpy(tail, s + i, len - i);
+    if (!utf8_validate_block_avx2(tail, &prev_input, &prev_incomplete, count)) {
+        return i;
+    }
+    if (count) {
+        *count -= UTF8_VALIDATE_BLOCK - (len - i);  // The zero padding counted as ASCII
+    }
+    return SIZE_MAX;
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static inline bool utf8_validate_block_avx512(
+    const uint8_t* block, __m512i* prev_input, __m512i* prev_incomplete, size_t* count
+) {
+    __m512i input = _mm512_loadu_si512((const void*) block);
+    __m512i error = *prev_incomplete;
+
+    if (_mm512_movepi8_mask(input)) {
+        const __m512i nibble = _mm512_set1_epi8(0x0F);
+        const __m512i byte_1_high = _mm512_broadcast_i32x4(
+            _mm_loadu_si128((const __m128i*) utf8_validate_byte_1_high)
+        );
+        const __m512i byte_1_low = _mm512_broadcast_i32x4(
+            _mm_loadu_si128((const __m128i*) utf8_validate_byte_1_low)
+        );
+        const __m512i byte_2_high = _mm512_broadcast_i32x4(
+            _mm_loadu_si128((const __m128i*) utf8_validate_byte_2_high)
+        );
+
+        // Lane k of carry is lane k - 1 of the input (lane 3 of the previous block for k = 0)
+        __m512i carry = _mm512_permutex2var_epi64(
+            *prev_input, _mm512_set_epi64(13, 12, 11, 10, 9, 8, 7, 6), input
+        );
+        __m512i prev1 = _mm512_alignr_epi8(input, carry, 15);
+        __m512i special = _mm512_and_si512(
+            _mm512_and_si512(
+                _mm512_shuffle_epi8(byte_1_high, _mm512_and_si512(_mm512_srli_epi16(prev1, 4), nibble)),
+                _mm512_shuffle_epi8(byte_1_low, _mm512_and_si512(prev1, nibble))
+            ),
+            _mm512_shuffle_epi8(byte_2_high, _mm512_and_si512(_mm512_srli_epi16(input, 4), nibble))
+        );
+
+        __m512i prev2 = _mm512_alignr_epi8(input, carry, 14);
+        __m512i prev3 = _mm512_alignr_epi8(input, carry, 13);
+        __m512i third = _mm512_subs_epu8(prev2, _mm512_set1_epi8((char) (0xE0 - 0x80)));
+        __m512i fourth = _mm512_subs_epu8(prev3, _mm512_set1_epi8((char) (0xF0 - 0x80)));
+        __m512i must23 = _mm512_and_si512(
+            _mm512_or_si512(third, fourth), _mm512_set1_epi8((char) 0x80)
+        );
+
+        error = _mm512_xor_si512(must23, special);
+        *prev_incomplete = _mm512_subs_epu8(
+            input, _mm512_loadu_si512((const void*) utf8_validate_incomplete)
+        );
+        if (count) {
+            *count += (size_t) __builtin_popcountll(
+                _mm512_cmpgt_epi8_mask(input, _mm512_set1_epi8(-65))
+            );
+        }
+    } else {
+        *prev_incomplete = _mm512_setzero_si512();
+        if (count) {
+            *count += UTF8_VALIDATE_BLOCK;
+        }
+    }
+    *prev_input = input;
+
+    return _mm512_test_epi8_mask(error, error) == 0;
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static size_t utf8_validate_avx512(const uint8_t* s, size_t len, size_t* count) {
+    __m512i prev_input = _mm512_setzero_si512();
+    __m512i prev_incomplete = _mm512_setzero_si512();
+
+    size_t i = 0;
+    for (; i + UTF8_VALIDATE_BLOCK <= len; i += UTF8_VALIDATE_BLOCK) {
+        if (!utf8_validate_block_avx512(s + i, &prev_input, &prev_incomplete, count)) {
+            return i;
+        }
+    }
+
+    uint8_t tail[UTF8_VALIDATE_BLOCK] = {0};
+    memcpy(tail, s + i, len - i);
+    if (!utf8_validate_block_avx512(tail, &prev_input, &prev_incomplete, count)) {
+        return i;
+    }
+    if (count) {
+        *count -= UTF8_VALIDATE_BLOCK - (len - i);  // The zero padding counted as ASCII
+    }
+    return SIZE_MAX;
+}
+#endif  // UTF8_SIMD_X86
+
+// Returns the offset of the first invalid block, SIZE_MAX if valid, or 0 (a full
+// scalar pass) when no vector kernel applies.
+static size_t utf8_validate_blocks(const uint8_t* s, size_t len, size_t* count) {
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+            return utf8_validate_avx512(s, len, count);
+        case UTF8_SIMD_AVX2:
+            return utf8_validate_avx2(s, len, count);
+        case UTF8_SIMD_SSSE3:
+            return utf8_validate_ssse3(s, len, count);
+#endif
+        default:
+            return 0;
+    }
+}
+
+// Finds the exact error after the vector kernels reject the block at offset block;
+// count (NULL to skip counting) receives the codepoints before the error.
+static UTF8Validation utf8_validate_locate(UTF8View view, size_t block, size_t* count) {
+    // Everything before the block is valid, so the last lead byte before it (at
+    // most three continuation bytes back) is a codepoint boundary
+    size_t start = block;
+    for (size_t back = 0; start > 0 && back < 4; back++) {
+        start--;
+        if (!utf8_validate_is_continuation(view.ptr[start])) {
+            break;
+        }
+    }
+
+    // Only counted for callers that want the count
+    if (count) {
+        *count = (size_t) utf8_cp_count_fast(utf8_view_n(view.ptr, start));
+    }
+    return utf8_validate_scalar(view.ptr, view.len, start, count);
+}
+
+UTF8Validation utf8_validate(UTF8View view) {
+    if (!view.ptr) {
+        return (UTF8Validation) {UTF8_ERROR_TRUNCATED, 0};
+    }
+
+    size_t block = utf8_validate_blocks(view.ptr, view.len, NULL);
+    if (block == SIZE_MAX) {
+        return (UTF8Validation) {UTF8_ERROR_NONE, view.len};
+    }
+
+    return utf8_validate_locate(view, block, NULL);
+}
+
+UTF8Validation utf8_validate_count(UTF8View view, size_t* count) {
+    if (!view.ptr || !count) {
+        return (UTF8Validation) {UTF8_ERROR_TRUNCATED, 0};
+    }
+
+    *count = 0;
+    size_t block = utf8_validate_blocks(view.ptr, view.len, count);
+    if (block == SIZE_MAX) {
+        return (UTF8Validation) {UTF8_ERROR_NONE, view.len};
+    }
+
+    return utf8_validate_locate(view, block, count);
+}
+
+bool utf8_is_valid(UTF8View view) {
+    if (!view.ptr) {
+        return false;
+    }
+
+    switch (utf8_simd_level()) {
+#if UTF8_SIMD_X86
+        case UTF8_SIMD_AVX512:
+        case UTF8_SIMD_AVX2:
+        case UTF8_SIMD_SSSE3:
+            return utf8_validate_blocks(view.ptr, view.len, NULL) == SIZE_MAX;
+#endif
+        default:
+            return utf8_validate_scalar(view.ptr, view.len, 0, NULL).error == UTF8_ERROR_NONE;
+    }
+}
+
+const char* utf8_error_name(UTF8Error error) {
+    switch (error) {
+        case UTF8_ERROR_NONE:
+            return "none";
+        case UTF8_ERROR_TRUNCATED:
+            return "truncated";
+        case UTF8_ERROR_CONTINUATION:
+            return "continuation";
+        case UTF8_ERROR_OVERLONG:
+            return "overlong";
+        case UTF8_ERROR_SURROGATE:
+            return "surrogate";
+        case UTF8_ERROR_TOO_LARGE:
+            return "too-large";
+        default:
+            return "unknown";
+    }
+}
@@ -0,0 +1,53 @@
+/**
+ * Copyright © 2023 Austin Berrio
+ *
+ * @file utf8/src/view.c
+ * @brief Length-carrying, non-owning UTF-8 string slices.
+ */
+
+#include "byte.h"
+#include "view.h"
+
+UTF8View utf8_view(const uint8_t* start) {
+    int64_t len = utf8_byte_count(start);
+    if (len < 0) {
+        return (UTF8View) {0};
+    }
+
+    return (UTF8View) {.ptr = start, .len = (size_t) len};
+}
+
+UTF8View utf8_view_n(const uint8_t* start, size_t len) {
+    if (!start) {
+        return (UTF8View) {0};
+    }
+
+    return (UTF8View) {.ptr = start, .len = len};
+}
+
+UTF8View utf8_view_range(const uint8_t* start, const uint8_t* end) {
+    if (!start || !end || end < start) {
+        return (UTF8View) {0};
+    }
+
+    return (UTF8View) {.ptr = start, .len = (size_t) (end - start)};
+}
+
+UTF8View utf8_view_slice(UTF8View view, size_t offset, size_t len) {
+    if (!view.ptr) {
+        return (UTF8View) {0};
+    }
+
+    if (offset > view.len) {
+        offset = view.len;
+    }
+    if (len > view.len - offset) {
+        len = view.len - offset;
+    }
+
+    return (UTF8View) {.ptr = view.ptr + offset, .len = len};
+}
+
+bool utf8_view_is_valid(UTF8View view) {
+    return view.ptr != NULL;
+}
@@ -5,7 +5,14 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "simd.h"
 #include "byte.h"
+#include "search.h"
+#include "builder.h"
+#include "interner.h"
+#include "stream.h"
+#include "codepoint.h"
+#include "parallel.h"
 #include "test.h"
 
 typedef struct TestUTF8ByteCount {
@@ -61,6 +68,72 @@ int test_suite_utf8_byte_count(void) {
     return test_group_run(&group);
 }
 
+typedef struct TestUTF8ByteCountSimd {
+    const char* label;
+    UTF8SimdLevel level;
+} TestUTF8ByteCountSimd;
+
+// Every alignment and length around the vector and unrolled group widths.
+int test_group_utf8_byte_count_simd(TestUnit* unit) {
+    TestUTF8ByteCountSimd* data = (TestUTF8ByteCountSimd*) unit->data;
+    if (utf8_simd_set_level(data->level) != data->level) {
+        utf8_simd_set_level(utf8_simd_detect());
+        return 0;  // Not supported by this CPU
+    }
+
+    uint8_t buffer[1024];
+    memset(buffer, 'a', sizeof(buffer));
+
+    int result = 0;
+    for (size_t offset = 0; offset < 64 && !result; offset++) {
+        for (size_t len = 0; len < 600 && !result; len++) {
+            buffer[offset + len] = '\0';
+            int64_t actual = utf8_byte_count(buffer + offset);
+            buffer[offset + len] = 'a';
+            if (actual != (int64_t) len) {
+                fprintf(
+                    stderr,
+                    "[TestUTF8ByteCountSimd] Failed: unit=%zu, level=%s, offset=%zu, expected=%zu, "
+                    "got=%ld\n",
+                    unit->index,
+                    data->label,
+                    offset,
+                    len,
+                    actual
+                );
+                result = 1;
+            }
+        }
+    }
+
+    utf8_simd_set_level(utf8_simd_detect());
+    return result;
+}
+
+int test_suite_utf8_byte_count_simd(void) {
+    TestUTF8ByteCountSimd data[] = {
+        {"scalar", UTF8_SIMD_NONE},
+        {"sse2", UTF8_SIMD_SSE2},
+        {"avx2", UTF8_SIMD_AVX2},
+        {"avx512", UTF8_SIMD_AVX512},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8ByteCountSimd);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_byte_count_simd",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_byte_count_simd,
+    };
+
+    return test_group_run(&group);
+}
+
 typedef struct TestUTF8ByteDiff {
     const char* label;
     const uint8_t* src;
@@ -525,15 +598,1068 @@ int test_suite_utf8_byte_cmp(void) {
     return test_group_run(&group);
 }
 
+typedef struct TestUTF8ByteCmpView {
+    const char* label;
+    const uint8_t* a;
+    size_t a_len;
+    const uint8_t* b;
+    size_t b_len;
+    UTF8ByteCompare expected;
+} TestUTF8ByteCmpView;
+
+int test_group_utf8_byte_cmp_view(TestUnit* unit) {
+    TestUTF8ByteCmpView* data = (TestUTF8ByteCmpView*) unit->data;
+    UTF8View a = utf8_view_n(data->a, data->a_len);
+    UTF8View b = utf8_view_n(data->b, data->b_len);
+    UTF8ByteCompare actual = utf8_byte_cmp_view(a, b);
+
+    ASSERT_EQ(
+        actual,
+        data->expected,
+        "[TestUTF8ByteCmpView] Failed: unit=%zu, label=%s, expected=%d, got=%d",
+        unit->index,
+        data->label,
+        data->expected,
+        actual
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_byte_cmp_view(void) {
+    TestUTF8ByteCmpView data[] = {
+        {"Invalid", NULL, 0, NULL, 0, UTF8_COMPARE_INVALID},
+        {"Empty", (uint8_t*) "", 0, (uint8_t*) "", 0, UTF8_COMPARE_EQUAL},
+        {"Equal", (uint8_t*) "abc", 3, (uint8_t*) "abc", 3, UTF8_COMPARE_EQUAL},
+        {"Less", (uint8_t*) "abc", 3, (uint8_t*) "abd", 3, UTF8_COMPARE_LESS},
+        {"Prefix", (uint8_t*) "abc", 2, (uint8_t*) "abc", 3, UTF8_COMPARE_LESS},
+        {"Embedded NUL equal", (uint8_t*) "a\0b", 3, (uint8_t*) "a\0b", 3, UTF8_COMPARE_EQUAL},
+        {"Embedded NUL greater", (uint8_t*) "a\0c", 3, (uint8_t*) "a\0b", 3, UTF8_COMPARE_GREATER},
+        {"Multibyte less", (uint8_t*) "\xC2\xA2", 2, (uint8_t*) "\xE2\x82\xAC", 3, UTF8_COMPARE_LESS},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8ByteCmpView);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_byte_cmp_view",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_byte_cmp_view,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8ByteCmpSimd {
+    const char* label;
+    UTF8SimdLevel level;
+} TestUTF8ByteCmpSimd;
+
+// Mismatches at the edges of every vector width, with independently skewed inputs.
+int test_group_utf8_byte_cmp_simd(TestUnit* unit) {
+    TestUTF8ByteCmpSimd* data = (TestUTF8ByteCmpSimd*) unit->data;
+    if (utf8_simd_set_level(data->level) != data->level) {
+        utf8_simd_set_level(utf8_simd_detect());
+        return 0;  // Not supported by this CPU
+    }
+
+    uint8_t a[512];
+    uint8_t b[512];
+    size_t b_offsets[] = {0, 1, 13, 31};
+
+    int result = 0;
+    for (size_t a_off = 0; a_off < 8 && !result; a_off++) {
+        for (size_t k = 0; k < 4 && !result; k++) {
+            size_t b_off = b_offsets[k];
+            for (size_t len = 0; len < 200 && !result; len++) {
+                // at == len means the strings only differ in length (b is longer)
+                for (size_t at = 0; at <= len && !result; at += (len > 8 ? len / 7 : 1)) {
+                    memset(a, 'x', sizeof(a));
+                    memset(b, 'x', sizeof(b));
+                    a[a_off + len] = '\0';
+                    b[b_off + len + 1] = '\0';
+                    if (at < len) {
+                        b[b_off + at] = 'y';
+                    }
+
+                    UTF8View va = utf8_view_n(a + a_off, len);
+                    UTF8View vb = utf8_view_n(b + b_off, len + 1);
+                    size_t offset = SIZE_MAX;
+                    int8_t cmp = utf8_byte_cmp_mismatch(va, vb, &offset);
+
+                    result |= cmp != UTF8_COMPARE_LESS || offset != at;
+                    result |= utf8_byte_cmp(a + a_off, b + b_off) != UTF8_COMPARE_LESS;
+                    result |= utf8_byte_cmp(b + b_off, a + a_off) != UTF8_COMPARE_GREATER;
+                    result |= utf8_byte_cmp_n(va.ptr, len, vb.ptr, len) != (at < len ? UTF8_COMPARE_LESS : UTF8_COMPARE_EQUAL);
+                    result |= utf8_byte_cmp(a + a_off, a + a_off) != UTF8_COMPARE_EQUAL;
+                    if (result) {
+                        fprintf(
+                            stderr,
+                            "[TestUTF8ByteCmpSimd] Failed: unit=%zu, level=%s, a_off=%zu, b_off=%zu, "
+                            "len=%zu, at=%zu, offset=%zu\n",
+                            unit->index,
+                            data->label,
+                            a_off,
+                            b_off,
+                            len,
+                            at,
+                            offset
+                        );
+                    }
+                }
+            }
+        }
+    }
+
+    utf8_simd_set_level(utf8_simd_detect());
+    return result;
+}
+
+int test_suite_utf8_byte_cmp_simd(void) {
+    TestUTF8ByteCmpSimd data[] = {
+        {"scalar", UTF8_SIMD_NONE},
+        {"sse2", UTF8_SIMD_SSE2},
+        {"avx2", UTF8_SIMD_AVX2},
+        {"avx512", UTF8_SIMD_AVX512},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8ByteCmpSimd);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_byte_cmp_simd",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_byte_cmp_simd,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8ByteAppend {
+    const char* label;
+    size_t count;  // Number of parts appended
+    bool from_list;  // Start from a released part list instead of calloc
+    bool exact;  // Start from a caller array holding exactly the first half, no spare slots
+} TestUTF8ByteAppend;
+
+int test_group_utf8_byte_append(TestUnit* unit) {
+    TestUTF8ByteAppend* data = (TestUTF8ByteAppend*) unit->data;
+
+    // Half the parts go through the list, the rest through append
+    uint64_t count = 0;
+    uint8_t** parts = NULL;
+    size_t first = 0;
+    if (data->from_list) {
+        UTF8PartList list = {0};
+        first = data->count / 2;
+        for (size_t i = 0; i < first; i++) {
+            uint8_t digit = (uint8_t) ('0' + i % 10);
+            utf8_part_list_push_view(&list, utf8_view_n(&digit, 1));
+        }
+        parts = utf8_part_list_release(&list, &count);
+    } else if (data->exact) {
+        first = data->count / 2;
+        parts = malloc((first ? first : 1) * sizeof(uint8_t*));
+        for (size_t i = 0; parts && i < first; i++) {
+            uint8_t digit = (uint8_t) ('0' + i % 10);
+            parts[i] = utf8_byte_copy_n(&digit, 1);
+        }
+        count = first;
+    } else {
+        parts = calloc(1, sizeof(uint8_t*));
+    }
+
+    int result = parts && count == first ? 0 : 1;
+    for (size_t i = first; i < data->count && !result; i++) {
+        uint8_t digit = (uint8_t) ('0' + i % 10);
+        uint8_t** temp = utf8_byte_append_n(&digit, 1, parts, &count);
+        if (!temp) {
+            result = 1;
+            break;
+        }
+        parts = temp;
+    }
+
+    result |= count != data->count;
+    for (size_t i = 0; i < count && !result; i++) {
+        result |= parts[i][0] != (uint8_t) ('0' + i % 10) || parts[i][1] != '\0';
+    }
+    utf8_byte_split_free(parts, count);
+
+    ASSERT_EQ(
+        result,
+        0,
+        "[TestUTF8ByteAppend] Failed: unit=%zu, label=%s, count=%zu",
+        unit->index,
+        data->label,
+        data->count
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_byte_append(void) {
+    TestUTF8ByteAppend data[] = {
+        {"One", 1, false, false},
+        {"Below minimum", 15, false, false},
+        {"Power of two", 16, false, false},
+        {"Past power of two", 17, false, false},
+        {"Many", 10000, false, false},
+        {"Released empty", 1, true, false},
+        {"Released odd", 7, true, false},
+        {"Released many", 4099, true, false},
+        {"Exact-size array", 6, false, true},
+        {"Exact-size array, odd", 7, false, true},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8ByteAppend);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_byte_append",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_byte_append,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8ByteSplitView {
+    const char* label;
+    const uint8_t* src;
+    size_t src_len;
+    const uint8_t* delim;
+    uint64_t expected_count;
+    const uint8_t* expected_join;  // Parts re-joined with "|"
+} TestUTF8ByteSplitView;
+
+int test_group_utf8_byte_split_view(TestUnit* unit) {
+    TestUTF8ByteSplitView* data = (TestUTF8ByteSplitView*) unit->data;
+    UTF8View src = utf8_view_n(data->src, data->src_len);
+
+    uint64_t count = 0;
+    uint8_t** parts = utf8_byte_split_delim_view(src, utf8_view(data->delim), &count);
+    ASSERT(parts, "[TestUTF8ByteSplitView] Failed: unit=%zu, label=%s, got NULL", unit->index, data->label);
+
+    ASSERT_EQ(
+        count,
+        data->expected_count,
+        "[TestUTF8ByteSplitView] Failed: unit=%zu, label=%s, expected count=%lu, got=%lu",
+        unit->index,
+        data->label,
+        data->expected_count,
+        count
+    );
+
+    uint8_t* joined = count > 0 ? utf8_byte_join(parts, count, (const uint8_t*) "|") : NULL;
+    int result = joined ? strcmp((char*) joined, (char*) data->expected_join) : (count != 0);
+    free(joined);
+    utf8_byte_split_free(parts, count);
+
+    ASSERT_EQ(
+        result,
+        0,
+        "[TestUTF8ByteSplitView] Failed: unit=%zu, label=%s, expected='%s'",
+        unit->index,
+        data->label,
+        data->expected_join
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_byte_split_view(void) {
+    TestUTF8ByteSplitView data[] = {
+        {"Empty", (uint8_t*) "", 0, (uint8_t*) ",", 0, (uint8_t*) ""},
+        {"No delim", (uint8_t*) "abc", 3, (uint8_t*) ",", 1, (uint8_t*) "abc"},
+        {"Simple", (uint8_t*) "a,b,c", 5, (uint8_t*) ",", 3, (uint8_t*) "a|b|c"},
+        {"Empty fields", (uint8_t*) ",a,,b", 5, (uint8_t*) ",", 4, (uint8_t*) "|a||b"},
+        {"Multi-byte delim", (uint8_t*) "a\u20ACb\u20ACc", 9, (uint8_t*) "\u20AC", 3, (uint8_t*) "a|b|c"},
+        {"Sliced view", (uint8_t*) "a,b,c,d", 3, (uint8_t*) ",", 2, (uint8_t*) "a|b"},
+        {"Embedded NUL", (uint8_t*) "ab\0cd,ef", 8, (uint8_t*) ",", 2, (uint8_t*) "ab|ef"},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8ByteSplitView);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_byte_split_delim_view",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_byte_split_view,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8ByteSplitSpans {
+    const char* label;
+    const uint8_t* src;
+    const uint8_t* delim;
+    size_t expected_count;
+    UTF8Span expected[4];
+} TestUTF8ByteSplitSpans;
+
+int test_group_utf8_byte_split_spans(TestUnit* unit) {
+    TestUTF8ByteSplitSpans* data = (TestUTF8ByteSplitSpans*) unit->data;
+    UTF8View src = utf8_view(data->src);
+
+    UTF8SpanList list = {0};
+    bool ok = utf8_byte_split_delim_spans(src, utf8_view(data->delim), &list);
+    ASSERT(ok, "[TestUTF8ByteSplitSpans] Failed: unit=%zu, label=%s, returned false", unit->index, data->label);
+    ASSERT_EQ(
+        list.count,
+        data->expected_count,
+        "[TestUTF8ByteSplitSpans] Failed: unit=%zu, label=%s, expected count=%zu, got=%zu",
+        unit->index,
+        data->label,
+        data->expected_count,
+        list.count
+    );
+
+    // Every part is one allocation away from a null-terminated copy
+    uint8_t** parts = utf8_span_materialize(src, list.spans, list.count);
+    int result = parts ? 0 : 1;
+    for (size_t i = 0; i < list.count && !result; i++) {
+        UTF8Span expected = data->expected[i];
+        result |= list.spans[i].offset != expected.offset || list.spans[i].len != expected.len;
+        result |= memcmp(parts[i], data->src + expected.offset, expected.len) != 0;
+        result |= parts[i][expected.len] != '\0';
+    }
+
+    free(parts);
+    utf8_span_list_free(&list);
+
+    ASSERT_EQ(
+        result,
+        0,
+        "[TestUTF8ByteSplitSpans] Failed: unit=%zu, label=%s, span mismatch",
+        unit->index,
+        data->label
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_byte_split_spans(void) {
+    TestUTF8ByteSplitSpans data[] = {
+        {"Empty", (uint8_t*) "", (uint8_t*) ",", 0, {{0}}},
+        {"No delim", (uint8_t*) "abc", (uint8_t*) ",", 1, {{0, 3}}},
+        {"Simple", (uint8_t*) "a,bb,c", (uint8_t*) ",", 3, {{0, 1}, {2, 2}, {5, 1}}},
+        {"Leading", (uint8_t*) ",a", (uint8_t*) ",", 2, {{0, 0}, {1, 1}}},
+        {"Trailing", (uint8_t*) "a,", (uint8_t*) ",", 1, {{0, 1}}},
+        {"Multi-byte", (uint8_t*) "ab||cd", (uint8_t*) "||", 2, {{0, 2}, {4, 2}}},
+        {"Bytes", (uint8_t*) "xyz", (uint8_t*) "", 3, {{0, 1}, {1, 1}, {2, 1}}},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8ByteSplitSpans);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_byte_split_delim_spans",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_byte_split_spans,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8ByteSplitAny {
+    const char* label;
+    const uint8_t* src;
+    const uint8_t* delims[3];  // NULL-terminated
+    uint64_t expected_count;
+    const uint8_t* expected_join;  // Parts re-joined with "|"
+} TestUTF8ByteSplitAny;
+
+int test_group_utf8_byte_split_any(TestUnit* unit) {
+    TestUTF8ByteSplitAny* data = (TestUTF8ByteSplitAny*) unit->data;
+
+    size_t n = 0;
+    while (n < 3 && data->delims[n]) {
+        n++;
+    }
+
+    uint64_t count = 0;
+    uint8_t** parts = utf8_byte_split_any(data->src, data->delims, n, &count);
+    ASSERT(parts, "[TestUTF8ByteSplitAny] Failed: unit=%zu, label=%s, got NULL", unit->index, data->label);
+
+    ASSERT_EQ(
+        count,
+        data->expected_count,
+        "[TestUTF8ByteSplitAny] Failed: unit=%zu, label=%s, expected count=%lu, got=%lu",
+        unit->index,
+        data->label,
+        data->expected_count,
+        count
+    );
+
+    uint8_t* joined = count > 0 ? utf8_byte_join(parts, count, (const uint8_t*) "|") : NULL;
+    int result = joined ? strcmp((char*) joined, (char*) data->expected_join) : (count != 0);
+    free(joined);
+    utf8_byte_split_free(parts, count);
+
+    ASSERT_EQ(
+        result,
+        0,
+        "[TestUTF8ByteSplitAny] Failed: unit=%zu, label=%s, expected='%s'",
+        unit->index,
+        data->label,
+        data->expected_join
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_byte_split_any(void) {
+    TestUTF8ByteSplitAny data[] = {
+        {"Empty", (uint8_t*) "", {(uint8_t*) ","}, 0, (uint8_t*) ""},
+        {"No delim", (uint8_t*) "abc", {(uint8_t*) ",", (uint8_t*) ";"}, 1, (uint8_t*) "abc"},
+        {"Mixed", (uint8_t*) "a,b;c", {(uint8_t*) ",", (uint8_t*) ";"}, 3, (uint8_t*) "a|b|c"},
+        {"Longest", (uint8_t*) "a\r\nb\nc\rd", {(uint8_t*) "\r", (uint8_t*) "\n", (uint8_t*) "\r\n"}, 4, (uint8_t*) "a|b|c|d"},
+        {"Leftmost", (uint8_t*) "xabcdy", {(uint8_t*) "bcd", (uint8_t*) "ab"}, 2, (uint8_t*) "x|cdy"},
+        {"Leftmost longer", (uint8_t*) "xabcdy", {(uint8_t*) "bc", (uint8_t*) "abcd"}, 2, (uint8_t*) "x|y"},
+        {"Failed extension", (uint8_t*) "1abx2", {(uint8_t*) "abc", (uint8_t*) "b"}, 2, (uint8_t*) "1a|x2"},
+        {"Pending run", (uint8_t*) "aaaa", {(uint8_t*) "a", (uint8_t*) "aaaab"}, 4, (uint8_t*) "|||"},
+        {"Pending pair", (uint8_t*) "xabcz", {(uint8_t*) "b", (uint8_t*) "c", (uint8_t*) "abcd"}, 3, (uint8_t*) "xa||z"},
+        {"Pending replaced", (uint8_t*) "xabcz", {(uint8_t*) "b", (uint8_t*) "c", (uint8_t*) "abc"}, 2, (uint8_t*) "x|z"},
+        {"Empty fields", (uint8_t*) ",a;,b", {(uint8_t*) ",", (uint8_t*) ";"}, 4, (uint8_t*) "|a||b"},
+        {"Multi-byte", (uint8_t*) "a b c", {(uint8_t*) " ", (uint8_t*) " "}, 3, (uint8_t*) "a|b|c"},
+        {"Codepoint boundary", (uint8_t*) "a€b", {(uint8_t*) "\x82\xAC", (uint8_t*) "b"}, 1, (uint8_t*) "a€"},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8ByteSplitAny);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_byte_split_any",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_byte_split_any,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8ByteSplitIntern {
+    const char* label;
+    const uint8_t* src;
+    size_t src_len;
+    const uint8_t* delim;
+    uint64_t expected_count;
+    uint32_t expected_ids[8];
+    size_t expected_symbols;  // Distinct parts
+} TestUTF8ByteSplitIntern;
+
+int test_group_utf8_byte_split_intern(TestUnit* unit) {
+    TestUTF8ByteSplitIntern* data = (TestUTF8ByteSplitIntern*) unit->data;
+    UTF8View src = utf8_view_n(data->src, data->src_len);
+
+    UTF8Interner interner = {0};
+    uint64_t count = 0;
+    uint32_t* ids = utf8_byte_split_delim_intern(src, utf8_view(data->delim), &interner, &count);
+    ASSERT(ids, "[TestUTF8ByteSplitIntern] Failed: unit=%zu, label=%s, got NULL", unit->index, data->label);
+
+    ASSERT_EQ(
+        count,
+        data->expected_count,
+        "[TestUTF8ByteSplitIntern] Failed: unit=%zu, label=%s, expected count=%lu, got=%lu",
+        unit->index,
+        data->label,
+        data->expected_count,
+        count
+    );
+
+    // IDs follow first appearance; every ID maps back to its part, and lookup agrees
+    int result = interner.count != data->expected_symbols;
+    UTF8SpanList list = {0};
+    utf8_byte_split_delim_spans(src, utf8_view(data->delim), &list);
+    for (uint64_t i = 0; i < count && !result; i++) {
+        UTF8View part = utf8_span_view(src, list.spans[i]);
+        UTF8View symbol = utf8_interner_view(&interner, ids[i]);
+        result |= ids[i] != data->expected_ids[i];
+        result |= symbol.len != part.len || memcmp(symbol.ptr, part.ptr, part.len) != 0;
+        result |= utf8_interner_str(&interner, ids[i])[part.len] != '\0';
+        result |= utf8_interner_find(&interner, part) != ids[i];
+    }
+    result |= utf8_interner_find(&interner, utf8_view((const uint8_t*) "missing")) != UTF8_SYMBOL_NONE;
+
+    utf8_span_list_free(&list);
+    utf8_interner_free(&interner);
+    free(ids);
+
+    ASSERT_EQ(
+        result,
+        0,
+        "[TestUTF8ByteSplitIntern] Failed: unit=%zu, label=%s, symbol mismatch",
+        unit->index,
+        data->label
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_byte_split_intern(void) {
+    TestUTF8ByteSplitIntern data[] = {
+        {"Empty", (uint8_t*) "", 0, (uint8_t*) ",", 0, {0}, 0},
+        {"Distinct", (uint8_t*) "a,b,c", 5, (uint8_t*) ",", 3, {0, 1, 2}, 3},
+        {"Repeated", (uint8_t*) "GET,PUT,GET,GET,PUT", 19, (uint8_t*) ",", 5, {0, 1, 0, 0, 1}, 2},
+        {"Empty fields", (uint8_t*) "x,,x,", 5, (uint8_t*) ",", 3, {0, 1, 0}, 2},
+        {"Embedded NUL", (uint8_t*) "a\0b a\0b a\0", 10, (uint8_t*) " ", 3, {0, 0, 1}, 2},
+        {"Multi-byte", (uint8_t*) "é é e", 11, (uint8_t*) " ", 3, {0, 0, 1}, 2},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8ByteSplitIntern);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_byte_split_delim_intern",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_byte_split_intern,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8ByteFind {
+    const char* label;
+    const uint8_t* haystack;
+    const uint8_t* needle;
+    int64_t expected_offset;
+    int64_t expected_count;
+} TestUTF8ByteFind;
+
+int test_group_utf8_byte_find(TestUnit* unit) {
+    TestUTF8ByteFind* data = (TestUTF8ByteFind*) unit->data;
+    UTF8View haystack = utf8_view(data->haystack);
+    UTF8View needle = utf8_view(data->needle);
+
+    int64_t offset = utf8_byte_find(haystack, needle);
+    ASSERT_EQ(
+        offset,
+        data->expected_offset,
+        "[TestUTF8ByteFind] Failed: unit=%zu, label=%s, expected offset=%ld, got=%ld",
+        unit->index,
+        data->label,
+        data->expected_offset,
+        offset
+    );
+
+    int64_t count = utf8_byte_find_count(haystack, needle);
+    ASSERT_EQ(
+        count,
+        data->expected_count,
+        "[TestUTF8ByteFind] Failed: unit=%zu, label=%s, expected count=%ld, got=%ld",
+        unit->index,
+        data->label,
+        data->expected_count,
+        count
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_byte_find(void) {
+    TestUTF8ByteFind data[] = {
+        {"Empty haystack", (uint8_t*) "", (uint8_t*) "a", -1, 0},
+        {"Single byte", (uint8_t*) "abcabc", (uint8_t*) "c", 2, 2},
+        {"Short", (uint8_t*) "xx\u20ACyy\u20AC", (uint8_t*) "\u20AC", 2, 2},
+        {"Non-overlapping", (uint8_t*) "aaaaa", (uint8_t*) "aa", 0, 2},
+        {"Absent", (uint8_t*) "hello world", (uint8_t*) "worlds", -1, 0},
+        {"Needle longer", (uint8_t*) "ab", (uint8_t*) "abc", -1, 0},
+        {"Long aperiodic",
+         (uint8_t*) "0123456789 the quick brown fox jumps over the lazy dog!",
+         (uint8_t*) "the quick brown fox jumps over the lazy dog",
+         11,
+         1},
+        {"Long periodic",
+         (uint8_t*) "abababababababababababababababababababababac abababababababababababababababababac",
+         (uint8_t*) "abababababababababababababababababac",
+         8,
+         2},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8ByteFind);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_byte_find",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_byte_find,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8ByteReplace {
+    const char* label;
+    const uint8_t* src;
+    const uint8_t* from;
+    const uint8_t* to;
+    const uint8_t* expected;
+} TestUTF8ByteReplace;
+
+int test_group_utf8_byte_replace(TestUnit* unit) {
+    TestUTF8ByteReplace* data = (TestUTF8ByteReplace*) unit->data;
+    uint8_t* actual = utf8_byte_replace(data->src, data->from, data->to);
+
+    int result = (actual && data->expected) ? strcmp((char*) actual, (char*) data->expected)
+                                            : actual != (uint8_t*) data->expected;
+    ASSERT_EQ(
+        result,
+        0,
+        "[TestUTF8ByteReplace] Failed: unit=%zu, label=%s, expected='%s', got='%s'",
+        unit->index,
+        data->label,
+        data->expected ? (char*) data->expected : "NULL",
+        actual ? (char*) actual : "NULL"
+    );
+
+    free(actual);
+    return 0;
+}
+
+int test_suite_utf8_byte_replace(void) {
+    TestUTF8ByteReplace data[] = {
+        {"NULL", NULL, (uint8_t*) "a", (uint8_t*) "b", NULL},
+        {"Empty from", (uint8_t*) "abc", (uint8_t*) "", (uint8_t*) "b", NULL},
+        {"None", (uint8_t*) "abc", (uint8_t*) "x", (uint8_t*) "y", (uint8_t*) "abc"},
+        {"Grow", (uint8_t*) "a,b,c", (uint8_t*) ",", (uint8_t*) ", ", (uint8_t*) "a, b, c"},
+        {"Shrink", (uint8_t*) "a\r\nb\r\n", (uint8_t*) "\r\n", (uint8_t*) "\n", (uint8_t*) "a\nb\n"},
+        {"Delete", (uint8_t*) "\u20AC1\u20AC2", (uint8_t*) "\u20AC", (uint8_t*) "", (uint8_t*) "12"},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8ByteReplace);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_byte_replace",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_byte_replace,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8ByteArena {
+    const char* label;
+    const uint8_t* src;
+    const uint8_t* delim;
+    size_t block_size;
+    const uint8_t* expected;  // Parts re-joined with '|'
+} TestUTF8ByteArena;
+
+int test_group_utf8_byte_arena(TestUnit* unit) {
+    TestUTF8ByteArena* data = (TestUTF8ByteArena*) unit->data;
+
+    UTF8Arena arena;
+    utf8_arena_init(&arena, data->block_size);
+
+    // Work done after the mark is released without touching earlier allocations
+    uint8_t* copy = utf8_byte_copy_arena(utf8_view(data->src), &arena);
+    UTF8ArenaMark mark = utf8_arena_mark(&arena);
+    size_t used = utf8_arena_used(&arena);
+
+    uint64_t count = 0;
+    uint8_t** parts = utf8_byte_split_delim_arena(utf8_view(data->src), utf8_view(data->delim), &count, &arena);
+    int result = copy && parts ? 0 : 1;
+
+    UTF8View views[8];
+    for (uint64_t i = 0; i < count && i < 8 && !result; i++) {
+        views[i] = utf8_view(parts[i]);
+    }
+    uint8_t* joined = count ? utf8_byte_join_arena(views, count, utf8_view((uint8_t*) "|"), &arena)
+                            : utf8_byte_copy_arena(utf8_view((uint8_t*) ""), &arena);
+    uint8_t* wrapped = utf8_byte_cat_arena(utf8_view(joined), utf8_view((uint8_t*) "|"), &arena);
+
+    result |= !joined || !wrapped;
+    result |= !result && utf8_byte_cmp(joined, data->expected) != UTF8_COMPARE_EQUAL;
+    result |= !result && wrapped[utf8_byte_count(joined)] != '|';
+
+    utf8_arena_reset(&arena, mark);
+    result |= utf8_arena_used(&arena) != used;
+    result |= !copy || utf8_byte_cmp(copy, data->src) != UTF8_COMPARE_EQUAL;
+
+    utf8_arena_clear(&arena);
+    result |= utf8_arena_used(&arena) != 0;
+    utf8_arena_free(&arena);
+
+    ASSERT_EQ(
+        result,
+        0,
+        "[TestUTF8ByteArena] Failed: unit=%zu, label=%s, expected=%s",
+        unit->index,
+        data->label,
+        (const char*) data->expected
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_byte_arena(void) {
+    TestUTF8ByteArena data[] = {
+        {"Empty", (uint8_t*) "", (uint8_t*) ",", 0, (uint8_t*) ""},
+        {"Single block", (uint8_t*) "a,b,c", (uint8_t*) ",", 0, (uint8_t*) "a|b|c"},
+        {"Empty fields", (uint8_t*) ",a,,b", (uint8_t*) ",", 0, (uint8_t*) "|a||b"},
+        {"Tiny blocks", (uint8_t*) "alpha,beta,gamma", (uint8_t*) ",", 16, (uint8_t*) "alpha|beta|gamma"},
+        {"Oversized", (uint8_t*) "\u20AC\u20AC\u20AC\u20AC::x", (uint8_t*) "::", 8, (uint8_t*) "\u20AC\u20AC\u20AC\u20AC|x"},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8ByteArena);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_byte_arena",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_byte_arena,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8Builder {
+    const char* label;
+    const uint8_t* prefix;
+    size_t repeat;  // Times the prefix is appended
+    uint32_t cps[3];
+    size_t cp_count;
+    int number;  // Appended as "#%d"
+    bool valid;  // Whether every codepoint is encodable
+    const uint8_t* expected;  // Checked when repeat <= 1
+    size_t expected_len;
+} TestUTF8Builder;
+
+int test_group_utf8_builder(TestUnit* unit) {
+    TestUTF8Builder* data = (TestUTF8Builder*) unit->data;
+
+    UTF8Builder builder = {0};
+    bool ok = true;
+    for (size_t i = 0; i < data->repeat; i++) {
+        ok &= utf8_builder_append_view(&builder, utf8_view(data->prefix));
+    }
+    for (size_t i = 0; i < data->cp_count; i++) {
+        ok &= utf8_builder_append_cp(&builder, data->cps[i]);
+    }
+    ok &= utf8_builder_append_fmt(&builder, "#%d", data->number);
+
+    size_t len = 0;
+    uint8_t* out = utf8_builder_finish(&builder, &len);
+
+    int result = out && ok == data->valid && builder.data == NULL ? 0 : 1;
+    result |= !result && len != data->expected_len;
+    result |= !result && out[len] != '\0';
+    if (!result && data->repeat <= 1) {
+        result |= memcmp(out, data->expected, len) != 0;
+    }
+    free(out);
+
+    ASSERT_EQ(
+        result,
+        0,
+        "[TestUTF8Builder] Failed: unit=%zu, label=%s, expected_len=%zu, got=%zu",
+        unit->index,
+        data->label,
+        data->expected_len,
+        len
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_builder(void) {
+    TestUTF8Builder data[] = {
+        {"Empty", (uint8_t*) "", 0, {0}, 0, 0, true, (uint8_t*) "#0", 2},
+        {"ASCII", (uint8_t*) "abc", 1, {'d'}, 1, 7, true, (uint8_t*) "abcd#7", 6},
+        {"Encode widths", (uint8_t*) "", 1, {0xE9, 0x20AC, 0x1F600}, 3, 1, true, (uint8_t*) "\u00E9\u20AC\U0001F600#1", 11},
+        {"Surrogate", (uint8_t*) "x", 1, {0xD800}, 1, 2, false, (uint8_t*) "x#2", 3},
+        {"Out of range", (uint8_t*) "x", 1, {0x110000}, 1, 3, false, (uint8_t*) "x#3", 3},
+        {"Fmt grows buffer", (uint8_t*) "0123456789abcdef", 4, {0}, 0, 123456789, true, NULL, 74},
+        {"Many appends", (uint8_t*) "\u20AC", 100000, {0}, 0, 5, true, NULL, 300002},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8Builder);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_builder",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_builder,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8StreamSplit {
+    const char* label;
+    const uint8_t* src;
+    const uint8_t* delim;
+    size_t chunk_size;
+    const uint8_t* expected;  // Fields joined with '|'
+} TestUTF8StreamSplit;
+
+typedef struct TestUTF8StreamSink {
+    UTF8Builder out;  // Reassembled fields joined with '|'
+    bool split_codepoint;  // A fragment boundary fell inside a codepoint
+    bool in_field;  // The previous fragment was partial
+} TestUTF8StreamSink;
+
+static bool test_utf8_stream_sink(UTF8View field, bool partial, void* ctx) {
+    TestUTF8StreamSink* sink = (TestUTF8StreamSink*) ctx;
+    if (sink->in_field && field.len > 0 && (field.ptr[0] & 0xC0) == 0x80) {
+        sink->split_codepoint = true;
+    }
+
+    utf8_builder_append_view(&sink->out, field);
+    if (!partial) {
+        utf8_builder_append_bytes(&sink->out, (const uint8_t*) "|", 1);
+    }
+    sink->in_field = partial;
+    return true;
+}
+
+// Runs one source through feed (5-byte pushes), read_fd and read_file.
+int test_group_utf8_stream_split(TestUnit* unit) {
+    TestUTF8StreamSplit* data = (TestUTF8StreamSplit*) unit->data;
+    UTF8View src = utf8_view(data->src);
+
+    FILE* file = tmpfile();
+    if (!file) {
+        return 1;
+    }
+    fwrite(src.ptr, 1, src.len, file);
+
+    int result = 0;
+    for (int mode = 0; mode < 3 && !result; mode++) {
+        TestUTF8StreamSink sink = {0};
+        UTF8StreamSplit split;
+        bool ok = utf8_stream_split_init(&split, utf8_view(data->delim), data->chunk_size, test_utf8_stream_sink, &sink);
+
+        rewind(file);
+        if (mode == 0) {
+            for (size_t i = 0; ok && i < src.len; i += 5) {
+                ok = utf8_stream_split_feed(&split, utf8_view_slice(src, i, 5));
+            }
+            ok = ok && utf8_stream_split_finish(&split);
+        } else if (mode == 1) {
+            ok = ok && utf8_stream_split_read_fd(&split, fileno(file));
+        } else {
+            ok = ok && utf8_stream_split_read_file(&split, file);
+        }
+        utf8_stream_split_free(&split);
+
+        UTF8View actual = utf8_builder_view(&sink.out);
+        UTF8View expected = utf8_view(data->expected);
+        result |= !ok || sink.split_codepoint || utf8_byte_cmp_view(actual, expected) != UTF8_COMPARE_EQUAL;
+        if (result) {
+            fprintf(
+                stderr,
+                "[TestUTF8StreamSplit] Failed: unit=%zu, label=%s, mode=%d, expected=%s, got=%s\n",
+                unit->index,
+                data->label,
+                mode,
+                (const char*) data->expected,
+                (const char*) actual.ptr
+            );
+        }
+        utf8_builder_free(&sink.out);
+    }
+
+    fclose(file);
+    return result;
+}
+
+int test_suite_utf8_stream_split(void) {
+    TestUTF8StreamSplit data[] = {
+        {"Empty", (uint8_t*) "", (uint8_t*) ",", 4, (uint8_t*) ""},
+        {"Simple", (uint8_t*) "a,b,c", (uint8_t*) ",", 2, (uint8_t*) "a|b|c|"},
+        {"Empty fields", (uint8_t*) ",a,,b,", (uint8_t*) ",", 1, (uint8_t*) "|a||b|"},
+        {"Straddling delim", (uint8_t*) "abc||def||g", (uint8_t*) "||", 4, (uint8_t*) "abc|def|g|"},
+        {"Long delim", (uint8_t*) "xx<sep>yy<sep>", (uint8_t*) "<sep>", 3, (uint8_t*) "xx|yy|"},
+        {"Multi-byte delim", (uint8_t*) "a\u241Eb\u241Ec", (uint8_t*) "\u241E", 2, (uint8_t*) "a|b|c|"},
+        {"Codepoints across chunks", (uint8_t*) "\u20AC\u20AC\U0001F600\u00E9,\U0001F600", (uint8_t*) ",", 1, (uint8_t*) "\u20AC\u20AC\U0001F600\u00E9|\U0001F600|"},
+        {"Large chunk", (uint8_t*) "one;two;three", (uint8_t*) ";", 0, (uint8_t*) "one|two|three|"},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8StreamSplit);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_stream_split",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_stream_split,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8Parallel {
+    const char* label;
+    const uint8_t* pattern;  // Repeated to build the source
+    size_t repeat;
+    const uint8_t* delim;
+    int threads;
+} TestUTF8Parallel;
+
+static bool test_utf8_spans_equal(const UTF8SpanList* a, const UTF8SpanList* b) {
+    if (a->count != b->count) {
+        return false;
+    }
+    return a->count == 0 || memcmp(a->spans, b->spans, a->count * sizeof(UTF8Span)) == 0;
+}
+
+// Every parallel routine must reproduce its sequential counterpart exactly.
+int test_group_utf8_parallel(TestUnit* unit) {
+    TestUTF8Parallel* data = (TestUTF8Parallel*) unit->data;
+
+    UTF8Builder builder = {0};
+    for (size_t i = 0; i < data->repeat; i++) {
+        utf8_builder_append_view(&builder, utf8_view(data->pattern));
+    }
+    size_t len = 0;
+    uint8_t* buffer = utf8_builder_finish(&builder, &len);
+    UTF8View src = utf8_view_n(buffer, len);
+    UTF8View delim = utf8_view(data->delim);
+
+    UTF8SpanList expected = {0};
+    UTF8SpanList actual = {0};
+    bool expected_ok = utf8_byte_split_delim_spans(src, delim, &expected);
+    bool actual_ok = utf8_byte_split_delim_spans_parallel(src, delim, &actual, data->threads);
+    int result = expected_ok != actual_ok || !test_utf8_spans_equal(&expected, &actual);
+
+    expected_ok = utf8_cp_split_spans(src, &expected);
+    actual_ok = utf8_cp_split_spans_parallel(src, &actual, data->threads);
+    result |= (expected_ok != actual_ok || (expected_ok && !test_utf8_spans_equal(&expected, &actual))) << 1;
+
+    // Join the delimiter split back together: it must reproduce the source
+    utf8_byte_split_delim_spans(src, delim, &expected);
+    UTF8View* views = malloc((expected.count + 1) * sizeof(UTF8View));
+    for (size_t i = 0; i < expected.count; i++) {
+        views[i] = utf8_span_view(src, expected.spans[i]);
+    }
+    if (expected.count > 0) {
+        uint8_t* sequential = utf8_byte_join_view(views, expected.count, delim);
+        uint8_t* parallel = utf8_byte_join_view_parallel(views, expected.count, delim, data->threads);
+        result |= (!parallel || utf8_byte_cmp(sequential, parallel) != UTF8_COMPARE_EQUAL) << 2;
+        free(sequential);
+        free(parallel);
+    }
+
+    free(views);
+    free(buffer);
+    utf8_span_list_free(&expected);
+    utf8_span_list_free(&actual);
+
+    ASSERT_EQ(
+        result,
+        0,
+        "[TestUTF8Parallel] Failed: unit=%zu, label=%s, threads=%d, mask=%d",
+        unit->index,
+        data->label,
+        data->threads,
+        result
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_parallel(void) {
+    TestUTF8Parallel data[] = {
+        {"Empty", (uint8_t*) "", 1, (uint8_t*) ",", 4},
+        {"Sequential", (uint8_t*) "ab,cd,", 100, (uint8_t*) ",", 1},
+        {"CSV", (uint8_t*) "ab,\u20ACd,,e", 997, (uint8_t*) ",", 4},
+        {"Multi-byte delim", (uint8_t*) "x\u241Eyz\U0001F600\u241E", 501, (uint8_t*) "\u241E", 3},
+        {"Self-overlapping", (uint8_t*) "aaaaab", 333, (uint8_t*) "aa", 7},
+        {"No delimiter", (uint8_t*) "\u00E9\u20AC\U0001F600", 1000, (uint8_t*) "|", 5},
+        {"Malformed", (uint8_t*) "ab\x80\x80\x80\x80" "cd,", 211, (uint8_t*) ",", 4},
+        {"More workers than bytes", (uint8_t*) "a,b", 1, (uint8_t*) ",", 8},
+        {"Auto", (uint8_t*) "key=value;", 5000, (uint8_t*) ";", 0},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8Parallel);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_parallel",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_parallel,
+    };
+
+    return test_group_run(&group);
+}
+
 int main(void) {
     TestSuite suites[] = {
         {"utf8_byte_count", test_suite_utf8_byte_count},
+        {"utf8_byte_count_simd", test_suite_utf8_byte_count_simd},
         {"utf8_byte_diff", test_suite_utf8_byte_diff},
         {"utf8_byte_copy", test_suite_utf8_byte_copy},
         {"utf8_byte_copy_n", test_suite_utf8_byte_copy_n},
         {"utf8_byte_copy_slice", test_suite_utf8_byte_copy_slice},
         {"utf8_byte_cat", test_suite_utf8_byte_cat},
         {"utf8_byte_cmp", test_suite_utf8_byte_cmp},
+        {"utf8_byte_cmp_view", test_suite_utf8_byte_cmp_view},
+        {"utf8_byte_cmp_simd", test_suite_utf8_byte_cmp_simd},
+        {"utf8_byte_append", test_suite_utf8_byte_append},
+        {"utf8_byte_split_delim_view", test_suite_utf8_byte_split_view},
+        {"utf8_byte_split_delim_spans", test_suite_utf8_byte_split_spans},
+        {"utf8_byte_split_any", test_suite_utf8_byte_split_any},
+        {"utf8_byte_split_delim_intern", test_suite_utf8_byte_split_intern},
+        {"utf8_byte_find", test_suite_utf8_byte_find},
+        {"utf8_byte_replace", test_suite_utf8_byte_replace},
+        {"utf8_byte_arena", test_suite_utf8_byte_arena},
+        {"utf8_builder", test_suite_utf8_builder},
+        {"utf8_stream_split", test_suite_utf8_stream_split},
+        {"utf8_parallel", test_suite_utf8_parallel},
     };
     size_t count = sizeof(suites) / sizeof(TestSuite);
 
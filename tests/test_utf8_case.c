@@ -0,0 +1,132 @@
+/**
+ * @file utf8/tests/test_utf8_case.c
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "simd.h"
+#include "validate.h"
+#include "case.h"
+#include "test.h"
+
+typedef struct TestUTF8Case {
+    const char* label;
+    const char* input;
+    UTF8CaseMode mode;
+    const char* expected;  // Conversion of the bytes before the error
+    UTF8Error expected_error;
+    size_t expected_offset;  // Byte offset of the error in input; ignored if valid
+} TestUTF8Case;
+
+// Each case runs at every SIMD level into an exact-size buffer, so any overrun
+// past utf8_case_length() shows up under the sanitizers.
+int test_group_utf8_case(TestUnit* unit) {
+    TestUTF8Case* data = (TestUTF8Case*) unit->data;
+
+    UTF8View view = utf8_view_n((const uint8_t*) data->input, strlen(data->input));
+    size_t expected_len = strlen(data->expected);
+    bool valid = data->expected_error == UTF8_ERROR_NONE;
+    size_t expected_offset = valid ? view.len : data->expected_offset;
+
+    int result = 0;
+    for (int level = UTF8_SIMD_NONE; level <= (int) utf8_simd_detect() && !result; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+
+        size_t written = 0;
+        uint8_t* dst = malloc(expected_len + 1);
+        UTF8Validation convert = utf8_case_convert(view, data->mode, dst, &written);
+        int64_t length = utf8_case_length(view, data->mode);
+
+        if (convert.error != data->expected_error || convert.offset != expected_offset
+            || written != expected_len || memcmp(dst, data->expected, expected_len) != 0
+            || length != (valid ? (int64_t) expected_len : -1)) {
+            fprintf(
+                stderr,
+                "[TestUTF8Case] Failed: unit=%zu, label=%s, level=%s, expected=%s (%s@%zu), "
+                "got=%.*s (%s@%zu)\n",
+                unit->index,
+                data->label,
+                utf8_simd_name((UTF8SimdLevel) level),
+                data->expected,
+                utf8_error_name(data->expected_error),
+                expected_offset,
+                (int) written,
+                (const char*) dst,
+                utf8_error_name(convert.error),
+                convert.offset
+            );
+            result = 1;
+        }
+
+        free(dst);
+    }
+
+    utf8_simd_set_level(utf8_simd_detect());
+    return result;
+}
+
+int test_suite_utf8_case(void) {
+    TestUTF8Case data[] = {
+        {"Empty", "", UTF8_CASE_LOWER, "", UTF8_ERROR_NONE, 0},
+        {"ASCII lower", "Hello, World! [@`{]", UTF8_CASE_LOWER, "hello, world! [@`{]", UTF8_ERROR_NONE, 0},
+        {"ASCII upper", "Hello, World! [@`{]", UTF8_CASE_UPPER, "HELLO, WORLD! [@`{]", UTF8_ERROR_NONE, 0},
+        {"ASCII blocks",
+         "The Quick Brown Fox Jumps Over The Lazy Dog 0123456789 THE QUICK BROWN FOX",
+         UTF8_CASE_LOWER,
+         "the quick brown fox jumps over the lazy dog 0123456789 the quick brown fox",
+         UTF8_ERROR_NONE,
+         0},
+        {"Mixed block",
+         "ABCDEFGHIJKLMNOPQRSTUVWXYZ ÀÉÎÕÜ abcdefghijklmnopqrstuvwxyz",
+         UTF8_CASE_UPPER,
+         "ABCDEFGHIJKLMNOPQRSTUVWXYZ ÀÉÎÕÜ ABCDEFGHIJKLMNOPQRSTUVWXYZ",
+         UTF8_ERROR_NONE,
+         0},
+        {"Cyrillic", "Съешь ЖЕ", UTF8_CASE_LOWER, "съешь же", UTF8_ERROR_NONE, 0},
+        {"Sharp s upper", "straße", UTF8_CASE_UPPER, "STRASSE", UTF8_ERROR_NONE, 0},
+        {"Sharp s fold", "Straße", UTF8_CASE_FOLD, "strasse", UTF8_ERROR_NONE, 0},
+        {"Ligature upper", "ﬃ", UTF8_CASE_UPPER, "FFI", UTF8_ERROR_NONE, 0},
+        {"Expands 3x", "ΐ", UTF8_CASE_UPPER, "\xCE\x99\xCC\x88\xCC\x81", UTF8_ERROR_NONE, 0},
+        {"Shrinks", "Ω", UTF8_CASE_LOWER, "ω", UTF8_ERROR_NONE, 0},  // U+2126 OHM SIGN
+        {"Dotted I lower", "İ", UTF8_CASE_LOWER, "i\xCC\x87", UTF8_ERROR_NONE, 0},
+        {"Final sigma", "ΟΔΟΣ ΟΔΟΣ.", UTF8_CASE_LOWER, "οδος οδος.", UTF8_ERROR_NONE, 0},
+        {"Medial sigma", "ΑΣΑ", UTF8_CASE_LOWER, "ασα", UTF8_ERROR_NONE, 0},
+        {"Lone sigma", "Σ", UTF8_CASE_LOWER, "σ", UTF8_ERROR_NONE, 0},
+        {"Sigma before ignorable", "ΑΣ'Α ΑΣ'", UTF8_CASE_LOWER, "ασ'α ας'", UTF8_ERROR_NONE, 0},
+        {"Sigma fold", "ΟΔΟΣ", UTF8_CASE_FOLD, "οδοσ", UTF8_ERROR_NONE, 0},
+        {"Cherokee fold", "Ꭰꭰ", UTF8_CASE_FOLD, "ᎠᎠ", UTF8_ERROR_NONE, 0},
+        {"Uncased", "日本語 😀", UTF8_CASE_UPPER, "日本語 😀", UTF8_ERROR_NONE, 0},
+        {"Invalid", "ABC\xC3(DEF", UTF8_CASE_LOWER, "abc", UTF8_ERROR_TRUNCATED, 3},
+        {"Surrogate", "Éa\xED\xA0\x80", UTF8_CASE_LOWER, "éa", UTF8_ERROR_SURROGATE, 3},
+        {"Truncated at end", "xyz\xE2\x82", UTF8_CASE_UPPER, "XYZ", UTF8_ERROR_TRUNCATED, 3},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8Case);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_case",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_case,
+    };
+
+    return test_group_run(&group);
+}
+
+int main(void) {
+    TestSuite suites[] = {
+        {"utf8_case", test_suite_utf8_case},
+    };
+    size_t count = sizeof(suites) / sizeof(TestSuite);
+
+    int result = 0;
+    for (size_t i = 0; i < count; i++) {
+        result |= test_suite_run(&suites[i]);
+    }
+    return result;
+}
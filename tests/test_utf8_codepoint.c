@@ -0,0 +1,517 @@
+/**
+ * @file utf8/tests/test_utf8_codepoint.c
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "simd.h"
+#include "codepoint.h"
+#include "test.h"
+
+typedef struct TestUTF8CpIndexLookup {
+    size_t n;
+    int64_t offset;  // -1 if n is out of range
+    int32_t cp;
+} TestUTF8CpIndexLookup;
+
+typedef struct TestUTF8CpIndex {
+    const char* label;
+    const char* pattern;
+    size_t repeat;  // The text is pattern repeated this many times
+    size_t stride;
+    bool ok;
+    TestUTF8CpIndexLookup lookups[4];
+    size_t lookup_count;
+} TestUTF8CpIndex;
+
+int test_group_utf8_cp_index(TestUnit* unit) {
+    TestUTF8CpIndex* data = (TestUTF8CpIndex*) unit->data;
+
+    size_t pattern_len = strlen(data->pattern);
+    size_t len = pattern_len * data->repeat;
+    uint8_t* text = malloc(len + 1);
+    for (size_t i = 0; i < data->repeat; i++) {
+        memcpy(text + i * pattern_len, data->pattern, pattern_len);
+    }
+    UTF8View view = utf8_view_n(text, len);
+
+    int result = 0;
+    for (int level = UTF8_SIMD_NONE; level <= (int) utf8_simd_detect() && !result; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+
+        UTF8CpIndex index = {0};
+        bool ok = utf8_cp_index_init(&index, view, data->stride);
+        if (ok != data->ok) {
+            fprintf(
+                stderr,
+                "[TestUTF8CpIndex] Failed: unit=%zu, label=%s, level=%s, init=%d\n",
+                unit->index,
+                data->label,
+                utf8_simd_name((UTF8SimdLevel) level),
+                ok
+            );
+            result = 1;
+        }
+
+        for (size_t i = 0; ok && i < data->lookup_count && !result; i++) {
+            const TestUTF8CpIndexLookup* lookup = &data->lookups[i];
+            UTF8CpRef ref = {0};
+            bool found = utf8_cp_index_at(&index, lookup->n, &ref);
+            int64_t offset = utf8_cp_index_offset(&index, lookup->n);
+            bool expected_found = lookup->offset >= 0 && lookup->n < index.length;
+
+            if (found != expected_found || offset != lookup->offset
+                || (found
+                    && (ref.ptr != text + lookup->offset || ref.cp != lookup->cp
+                        || ref.width != utf8_cp_width(ref.ptr)))) {
+                fprintf(
+                    stderr,
+                    "[TestUTF8CpIndex] Failed: unit=%zu, label=%s, level=%s, n=%zu, "
+                    "expected=%lld (U+%04X), got=%lld (U+%04X)\n",
+                    unit->index,
+                    data->label,
+                    utf8_simd_name((UTF8SimdLevel) level),
+                    lookup->n,
+                    (long long) lookup->offset,
+                    (unsigned) lookup->cp,
+                    (long long) offset,
+                    (unsigned) ref.cp
+                );
+                result = 1;
+            }
+        }
+
+        utf8_cp_index_free(&index);
+    }
+
+    utf8_simd_set_level(utf8_simd_detect());
+    free(text);
+    return result;
+}
+
+int test_suite_utf8_cp_index(void) {
+    // "日本語 " is 4 codepoints in 10 bytes, so codepoint n sits at n / 4 * 10 + {0, 3, 6, 9}
+    TestUTF8CpIndex data[] = {
+        {"Empty", "", 1, 0, true, {{0, 0, 0}, {1, -1, 0}}, 2},
+        {"ASCII", "hello", 1, 2, true, {{0, 0, 'h'}, {4, 4, 'o'}, {5, 5, 0}, {6, -1, 0}}, 4},
+        {"Mixed widths",
+         "aé€😀z",
+         1,
+         1,
+         true,
+         {{1, 1, 0xE9}, {2, 3, 0x20AC}, {3, 6, 0x1F600}, {4, 10, 'z'}},
+         4},
+        {"Default stride",
+         "日本語 ",
+         200,
+         0,
+         true,
+         {{0, 0, 0x65E5}, {511, 1279, ' '}, {512, 1280, 0x65E5}, {799, 1999, ' '}},
+         4},
+        {"Sample at block edge",
+         "日本語 ",
+         40,
+         7,
+         true,
+         {{21, 53, 0x672C}, {22, 56, 0x8A9E}, {63, 159, ' '}, {160, 400, 0}},
+         4},
+        {"Stride past length", "é", 100, 1000, true, {{99, 198, 0xE9}, {100, 200, 0}}, 2},
+        {"Invalid", "ab\xC3", 1, 0, false, {{0}}, 0},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8CpIndex);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_cp_index",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_cp_index,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8CpDecodeNext {
+    const char* label;
+    const char* input;
+    size_t len;  // Bytes visible to the decoder; 0 decodes up to the terminator
+    int8_t width;  // -1 if the sequence is rejected
+    int32_t cp;
+} TestUTF8CpDecodeNext;
+
+int test_group_utf8_cp_decode_next(TestUnit* unit) {
+    TestUTF8CpDecodeNext* data = (TestUTF8CpDecodeNext*) unit->data;
+
+    const uint8_t* start = (const uint8_t*) data->input;
+    const uint8_t* end = data->len ? start + data->len : NULL;
+    int32_t cp = 0;
+    int8_t width = utf8_cp_decode_next(start, end, &cp);
+
+    if (width != data->width || (width > 0 && cp != data->cp)) {
+        fprintf(
+            stderr,
+            "[TestUTF8CpDecodeNext] Failed: unit=%zu, label=%s, expected=%d (U+%04X), "
+            "got=%d (U+%04X)\n",
+            unit->index,
+            data->label,
+            data->width,
+            (unsigned) data->cp,
+            width,
+            (unsigned) cp
+        );
+        return 1;
+    }
+
+    return 0;
+}
+
+int test_suite_utf8_cp_decode_next(void) {
+    TestUTF8CpDecodeNext data[] = {
+        {"ASCII", "a", 0, 1, 'a'},
+        {"2-byte", "é", 0, 2, 0xE9},
+        {"3-byte", "€", 0, 3, 0x20AC},
+        {"4-byte", "😀", 0, 4, 0x1F600},
+        {"Lowest 3-byte", "\xE0\xA0\x80", 0, 3, 0x800},
+        {"Highest scalar", "\xF4\x8F\xBF\xBF", 0, 4, 0x10FFFF},
+        {"Bounded", "€x", 3, 3, 0x20AC},
+        {"Lone continuation", "\x80", 0, -1, 0},
+        {"Overlong 2-byte", "\xC0\xAF", 0, -1, 0},
+        {"Overlong 3-byte", "\xE0\x80\xAF", 0, -1, 0},
+        {"Overlong 4-byte", "\xF0\x80\x80\xAF", 0, -1, 0},
+        {"Surrogate", "\xED\xA0\x80", 0, -1, 0},
+        {"Too large", "\xF4\x90\x80\x80", 0, -1, 0},
+        {"Invalid lead", "\xF5\x80\x80\x80", 0, -1, 0},
+        {"Truncated by terminator", "\xE2\x82", 0, -1, 0},
+        {"Truncated by end", "€", 2, -1, 0},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8CpDecodeNext);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_cp_decode_next",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_cp_decode_next,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8CpCursor {
+    const char* label;
+    const char* input;
+    size_t len;  // Bytes visible to the cursor; 0 walks up to the terminator
+    int32_t cps[8];  // Codepoints yielded by next, in order
+    size_t count;
+    int8_t stop;  // Width next returns after the last codepoint: 0 at the end, -1 if invalid
+    int8_t back;  // Width of the first prev from the end (-1 if no valid sequence ends there)
+} TestUTF8CpCursor;
+
+// Walks forward to where next stops, then (for valid input) all the way back again,
+// checking each ref against the bytes it points to.
+int test_group_utf8_cp_cursor(TestUnit* unit) {
+    TestUTF8CpCursor* data = (TestUTF8CpCursor*) unit->data;
+
+    const uint8_t* start = (const uint8_t*) data->input;
+    size_t len = data->len ? data->len : strlen(data->input);
+    UTF8CpCursor cursor = data->len ? utf8_cp_cursor_view(utf8_view_n(start, len))
+                                    : utf8_cp_cursor(start);
+
+    int result = 0;
+    const uint8_t* expected_ptr = start;
+    size_t i = 0;
+    UTF8CpRef ref;
+    while ((ref = utf8_cp_cursor_next(&cursor)).width > 0 && !result) {
+        result = i >= data->count || ref.cp != data->cps[i] || ref.ptr != expected_ptr
+                 || cursor.current != expected_ptr + ref.width;
+        expected_ptr += ref.width;
+        i++;
+    }
+    result = result || i != data->count || ref.width != data->stop || ref.ptr != expected_ptr
+             || cursor.current != expected_ptr;
+
+    UTF8CpCursor back = utf8_cp_cursor(start);
+    if (data->len) {
+        back = utf8_cp_cursor_view_end(utf8_view_n(start, len));
+    } else {
+        back.current = start + len;
+    }
+    ref = utf8_cp_cursor_prev(&back);
+    result = result || ref.width != data->back;
+    if (!result && data->stop == 0) {
+        // Valid input: prev yields the same codepoints in reverse, then stops at start
+        for (i = data->count; i > 0 && !result; i--) {
+            result = ref.width < 1 || ref.cp != data->cps[i - 1] || back.current != ref.ptr
+                     || utf8_cp_decode(ref.ptr) != ref.cp;
+            ref = utf8_cp_cursor_prev(&back);
+        }
+        result = result || ref.width != 0 || back.current != start;
+    }
+
+    if (result) {
+        fprintf(
+            stderr,
+            "[TestUTF8CpCursor] Failed: unit=%zu, label=%s, codepoints=%zu of %zu, "
+            "width=%d\n",
+            unit->index,
+            data->label,
+            i,
+            data->count,
+            ref.width
+        );
+    }
+
+    return result;
+}
+
+int test_suite_utf8_cp_cursor(void) {
+    TestUTF8CpCursor data[] = {
+        {"Empty", "", 0, {0}, 0, 0, 0},
+        {"ASCII", "abc", 0, {'a', 'b', 'c'}, 3, 0, 1},
+        {"Mixed widths", "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80", 0, {'a', 0xE9, 0x20AC, 0x1F600}, 4, 0, 4},
+        {"Bounded", "\xE2\x82\xAC" "ab", 4, {0x20AC, 'a'}, 2, 0, 1},
+        {"Embedded null", "a\0b", 3, {'a', 0, 'b'}, 3, 0, 1},
+        {"Invalid middle", "ab\xFF" "cd", 0, {'a', 'b'}, 2, -1, 1},
+        {"Lone continuation at end", "ab\x80", 0, {'a', 'b'}, 2, -1, -1},
+        {"Truncated by end", "a\xE2\x82\xAC", 3, {'a'}, 1, -1, -1},
+        {"Surrogate", "\xED\xA0\x80", 0, {0}, 0, -1, -1},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8CpCursor);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_cp_cursor",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_cp_cursor,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8CpRetreat {
+    const char* label;
+    const char* input;
+    size_t from;  // Byte offset to step back from
+    size_t n;  // Codepoints to step back
+    int64_t expected;  // Byte offset landed on; -1 if fewer than n codepoints precede from
+} TestUTF8CpRetreat;
+
+// Each case runs at every SIMD level and must agree with n steps of the cursor.
+int test_group_utf8_cp_retreat(TestUnit* unit) {
+    TestUTF8CpRetreat* data = (TestUTF8CpRetreat*) unit->data;
+
+    const uint8_t* start = (const uint8_t*) data->input;
+    UTF8CpCursor cursor = utf8_cp_cursor_view(utf8_view_n(start, strlen(data->input)));
+    cursor.current = start + data->from;
+    int64_t stepped = (int64_t) data->from;
+    for (size_t i = 0; i < data->n && stepped >= 0; i++) {
+        stepped = utf8_cp_cursor_prev(&cursor).width > 0 ? cursor.current - start : -1;
+    }
+
+    int result = stepped != data->expected;
+    for (int level = UTF8_SIMD_NONE; level <= (int) utf8_simd_detect() && !result; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+
+        const uint8_t* p = utf8_cp_retreat(start, start + data->from, data->n);
+        int64_t got = p ? p - start : -1;
+        if (got != data->expected) {
+            fprintf(
+                stderr,
+                "[TestUTF8CpRetreat] Failed: unit=%zu, label=%s, level=%s, expected=%lld, "
+                "got=%lld\n",
+                unit->index,
+                data->label,
+                utf8_simd_name((UTF8SimdLevel) level),
+                (long long) data->expected,
+                (long long) got
+            );
+            result = 1;
+        }
+    }
+
+    utf8_simd_set_level(utf8_simd_detect());
+    return result;
+}
+
+int test_suite_utf8_cp_retreat(void) {
+    // 26 ASCII bytes, then 26 two-byte, 26 three-byte and 26 four-byte codepoints
+    const char* mixed = "abcdefghijklmnopqrstuvwxyz"
+                        "\xC3\xA0\xC3\xA1\xC3\xA2\xC3\xA3\xC3\xA4\xC3\xA5\xC3\xA6\xC3\xA7\xC3\xA8"
+                        "\xC3\xA9\xC3\xAA\xC3\xAB\xC3\xAC\xC3\xAD\xC3\xAE\xC3\xAF\xC3\xB0\xC3\xB1"
+                        "\xC3\xB2\xC3\xB3\xC3\xB4\xC3\xB5\xC3\xB6\xC3\xB8\xC3\xB9\xC3\xBA"
+                        "\xE2\x82\xA0\xE2\x82\xA1\xE2\x82\xA2\xE2\x82\xA3\xE2\x82\xA4\xE2\x82\xA5"
+                        "\xE2\x82\xA6\xE2\x82\xA7\xE2\x82\xA8\xE2\x82\xA9\xE2\x82\xAA\xE2\x82\xAB"
+                        "\xE2\x82\xAC\xE2\x82\xAD\xE2\x82\xAE\xE2\x82\xAF\xE2\x82\xB0\xE2\x82\xB1"
+                        "\xE2\x82\xB2\xE2\x82\xB3\xE2\x82\xB4\xE2\x82\xB5\xE2\x82\xB6\xE2\x82\xB7"
+                        "\xE2\x82\xB8\xE2\x82\xB9"
+                        "\xF0\x9F\x98\x80\xF0\x9F\x98\x81\xF0\x9F\x98\x82\xF0\x9F\x98\x83"
+                        "\xF0\x9F\x98\x84\xF0\x9F\x98\x85\xF0\x9F\x98\x86\xF0\x9F\x98\x87"
+                        "\xF0\x9F\x98\x88\xF0\x9F\x98\x89\xF0\x9F\x98\x8A\xF0\x9F\x98\x8B"
+                        "\xF0\x9F\x98\x8C\xF0\x9F\x98\x8D\xF0\x9F\x98\x8E\xF0\x9F\x98\x8F"
+                        "\xF0\x9F\x98\x90\xF0\x9F\x98\x91\xF0\x9F\x98\x92\xF0\x9F\x98\x93"
+                        "\xF0\x9F\x98\x94\xF0\x9F\x98\x95\xF0\x9F\x98\x96\xF0\x9F\x98\x97"
+                        "\xF0\x9F\x98\x98\xF0\x9F\x98\x99";
+    TestUTF8CpRetreat data[] = {
+        {"Zero steps", "abc", 2, 0, 2},
+        {"Empty", "", 0, 1, -1},
+        {"ASCII", "abcdef", 6, 4, 2},
+        {"To start", "abcdef", 6, 6, 0},
+        {"Past start", "abcdef", 6, 7, -1},
+        {"Short mixed", "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80", 10, 3, 1},
+        {"Mixed, one step", mixed, 260, 1, 256},
+        {"Mixed, across widths", mixed, 260, 30, 144},
+        {"Mixed, into ASCII", mixed, 260, 90, 14},
+        {"Mixed, all", mixed, 260, 104, 0},
+        {"Mixed, too many", mixed, 260, 105, -1},
+        {"Mixed, from middle", mixed, 156, 40, 50},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8CpRetreat);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_cp_retreat",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_cp_retreat,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8CpClass {
+    const char* label;
+    const char* input;
+    UTF8GeneralCategory category;
+    // Expected results of char, digit, alpha, alnum, upper, lower, space, punct
+    bool expected[8];
+} TestUTF8CpClass;
+
+int test_group_utf8_cp_class(TestUnit* unit) {
+    TestUTF8CpClass* data = (TestUTF8CpClass*) unit->data;
+    static const char* names[8] = {
+        "char", "digit", "alpha", "alnum", "upper", "lower", "space", "punct"
+    };
+
+    const uint8_t* input = (const uint8_t*) data->input;
+    bool actual[8] = {
+        utf8_cp_is_char(input),
+        utf8_cp_is_digit(input),
+        utf8_cp_is_alpha(input),
+        utf8_cp_is_alnum(input),
+        utf8_cp_is_upper(input),
+        utf8_cp_is_lower(input),
+        utf8_cp_is_space(input),
+        utf8_cp_is_punct(input),
+    };
+
+    int32_t cp = 0;
+    UTF8GeneralCategory category = utf8_cp_decode_next(input, NULL, &cp) > 0
+                                       ? utf8_cp_category((uint32_t) cp)
+                                       : UTF8_GC_CN;
+    int result = 0;
+    if (category != data->category) {
+        fprintf(
+            stderr,
+            "[TestUTF8CpClass] Failed: unit=%zu, label=%s, expected category=%d, got=%d\n",
+            unit->index,
+            data->label,
+            data->category,
+            category
+        );
+        result = 1;
+    }
+
+    for (size_t i = 0; i < 8; i++) {
+        if (actual[i] != data->expected[i]) {
+            fprintf(
+                stderr,
+                "[TestUTF8CpClass] Failed: unit=%zu, label=%s, is_%s expected=%d, got=%d\n",
+                unit->index,
+                data->label,
+                names[i],
+                data->expected[i],
+                actual[i]
+            );
+            result = 1;
+        }
+    }
+
+    return result;
+}
+
+int test_suite_utf8_cp_class(void) {
+    TestUTF8CpClass data[] = {
+        {"ASCII upper", "A", UTF8_GC_LU, {true, false, true, true, true, false, false, false}},
+        {"ASCII lower", "z", UTF8_GC_LL, {true, false, true, true, false, true, false, false}},
+        {"ASCII digit", "7", UTF8_GC_ND, {true, true, false, true, false, false, false, false}},
+        {"ASCII space", " ", UTF8_GC_ZS, {true, false, false, false, false, false, true, false}},
+        {"Tab", "\t", UTF8_GC_CC, {false, false, false, false, false, false, true, false}},
+        {"ASCII punct", "!", UTF8_GC_PO, {true, false, false, false, false, false, false, true}},
+        {"ASCII symbol", "+", UTF8_GC_SM, {true, false, false, false, false, false, false, true}},
+        {"Latin-1 lower", "é", UTF8_GC_LL, {true, false, true, true, false, true, false, false}},
+        {"No-break space", "\xC2\xA0", UTF8_GC_ZS, {true, false, false, false, false, false, true, false}},
+        {"Next line", "\xC2\x85", UTF8_GC_CC, {false, false, false, false, false, false, true, false}},
+        {"Greek upper", "Ω", UTF8_GC_LU, {true, false, true, true, true, false, false, false}},
+        {"Titlecase", "ǅ", UTF8_GC_LT, {true, false, true, true, true, false, false, false}},
+        {"CJK ideograph", "日", UTF8_GC_LO, {true, false, true, true, false, false, false, false}},
+        {"Arabic-Indic digit", "٣", UTF8_GC_ND, {true, true, false, true, false, false, false, false}},
+        {"Ideographic space", "\xE3\x80\x80", UTF8_GC_ZS, {true, false, false, false, false, false, true, false}},
+        {"CJK full stop", "。", UTF8_GC_PO, {true, false, false, false, false, false, false, true}},
+        {"Combining acute", "\xCC\x81", UTF8_GC_MN, {true, false, false, false, false, false, false, false}},
+        {"Emoji", "😀", UTF8_GC_SO, {true, false, false, false, false, false, false, true}},
+        {"Math bold capital", "𝐀", UTF8_GC_LU, {true, false, true, true, true, false, false, false}},
+        {"Private use", "\xF3\xB0\x80\x80", UTF8_GC_CO, {true, false, false, false, false, false, false, false}},
+        {"Noncharacter", "\xEF\xBF\xBF", UTF8_GC_CN, {false, false, false, false, false, false, false, false}},
+        {"Invalid", "\xC3", UTF8_GC_CN, {false, false, false, false, false, false, false, false}},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8CpClass);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_cp_class",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_cp_class,
+    };
+
+    return test_group_run(&group);
+}
+
+int main(void) {
+    TestSuite suites[] = {
+        {"utf8_cp_index", test_suite_utf8_cp_index},
+        {"utf8_cp_decode_next", test_suite_utf8_cp_decode_next},
+        {"utf8_cp_cursor", test_suite_utf8_cp_cursor},
+        {"utf8_cp_retreat", test_suite_utf8_cp_retreat},
+        {"utf8_cp_class", test_suite_utf8_cp_class},
+    };
+    size_t count = sizeof(suites) / sizeof(TestSuite);
+
+    int result = 0;
+    for (size_t i = 0; i < count; i++) {
+        result |= test_suite_run(&suites[i]);
+    }
+    return result;
+}
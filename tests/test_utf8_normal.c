@@ -0,0 +1,171 @@
+/**
+ * @file utf8/tests/test_utf8_normal.c
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "simd.h"
+#include "validate.h"
+#include "normal.h"
+#include "test.h"
+
+typedef struct TestUTF8Normal {
+    const char* label;
+    const char* input;
+    UTF8NormalForm form;
+    UTF8NormalCheck expected_check;
+    const char* expected;  // Normalization of the bytes before the error
+    UTF8Error expected_error;
+    size_t expected_offset;  // Byte offset of the error in input; ignored if valid
+} TestUTF8Normal;
+
+typedef struct TestUTF8NormalSink {
+    uint8_t* bytes;
+    size_t len;
+} TestUTF8NormalSink;
+
+static bool test_utf8_normal_sink(UTF8View normalized, void* ctx) {
+    TestUTF8NormalSink* sink = (TestUTF8NormalSink*) ctx;
+    memcpy(sink->bytes + sink->len, normalized.ptr, normalized.len);
+    sink->len += normalized.len;
+    return true;
+}
+
+// Each case runs at every SIMD level, one-shot into an exact-size buffer and then
+// streamed in chunks of every size from 1 to the input length.
+int test_group_utf8_normal(TestUnit* unit) {
+    TestUTF8Normal* data = (TestUTF8Normal*) unit->data;
+
+    UTF8View view = utf8_view_n((const uint8_t*) data->input, strlen(data->input));
+    size_t expected_len = strlen(data->expected);
+    bool valid = data->expected_error == UTF8_ERROR_NONE;
+    size_t expected_offset = valid ? view.len : data->expected_offset;
+
+    int result = 0;
+    for (int level = UTF8_SIMD_NONE; level <= (int) utf8_simd_detect() && !result; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+
+        size_t written = 0;
+        uint8_t* dst = malloc(expected_len + 1);
+        UTF8Validation normalize = utf8_normalize(view, data->form, dst, &written);
+        int64_t length = utf8_normalize_length(view, data->form);
+        UTF8NormalCheck check = utf8_normal_quick_check(view, data->form);
+
+        bool streamed = true;
+        for (size_t chunk = 1; chunk <= view.len && streamed; chunk++) {
+            TestUTF8NormalSink sink = {dst, 0};
+            UTF8Normalizer normalizer;
+            utf8_normalizer_init(&normalizer, data->form, test_utf8_normal_sink, &sink);
+
+            bool ok = true;
+            for (size_t i = 0; i < view.len && ok; i += chunk) {
+                size_t n = view.len - i < chunk ? view.len - i : chunk;
+                ok = utf8_normalizer_feed(&normalizer, utf8_view_n(view.ptr + i, n));
+            }
+            ok = ok && utf8_normalizer_finish(&normalizer);
+
+            streamed = ok == valid && sink.len == expected_len
+                       && memcmp(dst, data->expected, expected_len) == 0
+                       && (valid || normalizer.status.offset == expected_offset);
+            utf8_normalizer_free(&normalizer);
+        }
+
+        if (normalize.error != data->expected_error || normalize.offset != expected_offset
+            || written != expected_len || memcmp(dst, data->expected, expected_len) != 0
+            || length != (valid ? (int64_t) expected_len : -1) || check != data->expected_check
+            || !streamed) {
+            fprintf(
+                stderr,
+                "[TestUTF8Normal] Failed: unit=%zu, label=%s, level=%s, expected=%s (%s@%zu), "
+                "got=%.*s (%s@%zu), check=%d, streamed=%d\n",
+                unit->index,
+                data->label,
+                utf8_simd_name((UTF8SimdLevel) level),
+                data->expected,
+                utf8_error_name(data->expected_error),
+                expected_offset,
+                (int) written,
+                (const char*) dst,
+                utf8_error_name(normalize.error),
+                normalize.offset,
+                (int) check,
+                (int) streamed
+            );
+            result = 1;
+        }
+
+        free(dst);
+    }
+
+    utf8_simd_set_level(utf8_simd_detect());
+    return result;
+}
+
+int test_suite_utf8_normal(void) {
+    // Inputs and outputs are spelled as escapes so no editor can normalize them
+    TestUTF8Normal data[] = {
+        {"Empty", "", UTF8_NFC, UTF8_NORMAL_YES, "", UTF8_ERROR_NONE, 0},
+        {"ASCII", "The quick brown fox jumps over the lazy dog", UTF8_NFKD, UTF8_NORMAL_YES, "The quick brown fox jumps over the lazy dog", UTF8_ERROR_NONE, 0},
+        {"Composed NFC", "caf\xC3\xA9 na\xC3\xAFve", UTF8_NFC, UTF8_NORMAL_YES, "caf\xC3\xA9 na\xC3\xAFve", UTF8_ERROR_NONE, 0},
+        {"Compose", "cafe\xCC\x81", UTF8_NFC, UTF8_NORMAL_MAYBE, "caf\xC3\xA9", UTF8_ERROR_NONE, 0},
+        {"Decompose", "caf\xC3\xA9", UTF8_NFD, UTF8_NORMAL_NO, "cafe\xCC\x81", UTF8_ERROR_NONE, 0},
+        {"Reorder", "a\xCC\x81\xCC\xA3", UTF8_NFD, UTF8_NORMAL_NO, "a\xCC\xA3\xCC\x81", UTF8_ERROR_NONE, 0},
+        {"Compose past blocked", "a\xCC\x81\xCC\xA3", UTF8_NFC, UTF8_NORMAL_NO, "\xE1\xBA\xA1\xCC\x81", UTF8_ERROR_NONE, 0},
+        {"Blocked by same class", "a\xCC\x88\xCC\x81", UTF8_NFC, UTF8_NORMAL_MAYBE, "\xC3\xA4\xCC\x81", UTF8_ERROR_NONE, 0},
+        {"Singleton", "\xE2\x84\xAB", UTF8_NFC, UTF8_NORMAL_NO, "\xC3\x85", UTF8_ERROR_NONE, 0},  // U+212B ANGSTROM SIGN
+        {"Composition exclusion", "\xE0\xA5\x98", UTF8_NFC, UTF8_NORMAL_NO, "\xE0\xA4\x95\xE0\xA4\xBC", UTF8_ERROR_NONE, 0},
+        {"Hangul compose", "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8", UTF8_NFC, UTF8_NORMAL_MAYBE, "\xEA\xB0\x81", UTF8_ERROR_NONE, 0},
+        {"Hangul decompose", "\xEA\xB0\x81\xEA\xB0\x80", UTF8_NFD, UTF8_NORMAL_NO, "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8\xE1\x84\x80\xE1\x85\xA1", UTF8_ERROR_NONE, 0},
+        {"Hangul LV + T", "\xEA\xB0\x80\xE1\x86\xA8", UTF8_NFC, UTF8_NORMAL_MAYBE, "\xEA\xB0\x81", UTF8_ERROR_NONE, 0},
+        {"Ligature NFKC", "\xEF\xAC\x81nd", UTF8_NFKC, UTF8_NORMAL_NO, "find", UTF8_ERROR_NONE, 0},
+        {"Ligature NFC", "\xEF\xAC\x81nd", UTF8_NFC, UTF8_NORMAL_YES, "\xEF\xAC\x81nd", UTF8_ERROR_NONE, 0},
+        {"Compat then compose", "\xE1\xBA\x9B\xCC\xA3", UTF8_NFKC, UTF8_NORMAL_NO, "\xE1\xB9\xA9", UTF8_ERROR_NONE, 0},
+        {"Compat decompose", "\xE1\xBA\x9B\xCC\xA3", UTF8_NFKD, UTF8_NORMAL_NO, "s\xCC\xA3\xCC\x87", UTF8_ERROR_NONE, 0},
+        {"Expands 3x", "\xEF\xAD\x8C", UTF8_NFD, UTF8_NORMAL_NO, "\xD7\x91\xD6\xBF", UTF8_ERROR_NONE, 0},
+        {"Long run",
+         "x\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81"
+         "\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81"
+         "\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81"
+         "\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\xA3 ok",
+         UTF8_NFD,
+         UTF8_NORMAL_NO,
+         "x\xCC\xA3\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81"
+         "\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81"
+         "\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81"
+         "\xCC\x81\xCC\x81\xCC\x81\xCC\x81\xCC\x81 ok",
+         UTF8_ERROR_NONE,
+         0},
+        {"Invalid", "e\xCC\x81\xFF" "e\xCC\x81", UTF8_NFC, UTF8_NORMAL_NO, "\xC3\xA9", UTF8_ERROR_TOO_LARGE, 3},
+        {"Surrogate", "\xC3\xA9\xED\xA0\x80", UTF8_NFD, UTF8_NORMAL_NO, "e\xCC\x81", UTF8_ERROR_SURROGATE, 2},
+        {"Truncated at end", "e\xCC\x81\xCC", UTF8_NFC, UTF8_NORMAL_NO, "\xC3\xA9", UTF8_ERROR_TRUNCATED, 3},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8Normal);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_normal",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_normal,
+    };
+
+    return test_group_run(&group);
+}
+
+int main(void) {
+    TestSuite suites[] = {
+        {"utf8_normal", test_suite_utf8_normal},
+    };
+    size_t count = sizeof(suites) / sizeof(TestSuite);
+
+    int result = 0;
+    for (size_t i = 0; i < count; i++) {
+        result |= test_suite_run(&suites[i]);
+    }
+    return result;
+}
@@ -0,0 +1,218 @@
+/**
+ * @file utf8/tests/test_utf8_regex.c
+ */
+
+#include <string.h>
+
+#include "byte.h"
+#include "builder.h"
+#include "regex.h"
+#include "parallel.h"
+#include "test.h"
+
+typedef struct TestUTF8RegexIter {
+    const char* label;
+    const uint8_t* pattern;
+    const uint8_t* src;
+    size_t expected_count;
+    size_t expected[6][2];  // (start, end) per match
+} TestUTF8RegexIter;
+
+int test_group_utf8_regex_iter(TestUnit* unit) {
+    TestUTF8RegexIter* data = (TestUTF8RegexIter*) unit->data;
+    UTF8View src = utf8_view(data->src);
+
+    pcre2_code* code = NULL;
+    pcre2_match_data* match = NULL;
+    bool ok = utf8_regex_compile(data->pattern, &code, &match);
+    ASSERT(ok, "[TestUTF8RegexIter] Failed: unit=%zu, label=%s, bad pattern", unit->index, data->label);
+
+    UTF8RegexIter iter;
+    utf8_regex_iter_init(&iter, code, src);
+
+    size_t count = 0;
+    size_t nonempty = 0;
+    size_t start;
+    size_t end;
+    int result = 0;
+    while (utf8_regex_iter_next(&iter, &start, &end)) {
+        if (count < 6) {
+            result |= start != data->expected[count][0] || end != data->expected[count][1];
+        }
+        nonempty += end > start;
+        count++;
+    }
+    result |= iter.error != 0;
+
+    // The split keeps exactly the non-empty matches
+    UTF8SpanList list = {0};
+    result |= !utf8_byte_split_regex_spans(src, data->pattern, &list) || list.count != nonempty;
+
+    utf8_span_list_free(&list);
+    utf8_regex_iter_free(&iter);
+    utf8_regex_free(code, match);
+
+    ASSERT_EQ(
+        count,
+        data->expected_count,
+        "[TestUTF8RegexIter] Failed: unit=%zu, label=%s, expected count=%zu, got=%zu",
+        unit->index,
+        data->label,
+        data->expected_count,
+        count
+    );
+    ASSERT_EQ(
+        result,
+        0,
+        "[TestUTF8RegexIter] Failed: unit=%zu, label=%s, offset mismatch",
+        unit->index,
+        data->label
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_regex_iter(void) {
+    TestUTF8RegexIter data[] = {
+        {"No match", (uint8_t*) "x", (uint8_t*) "abc", 0, {{0}}},
+        {"Words", (uint8_t*) "\\w+", (uint8_t*) "ab cd", 2, {{0, 2}, {3, 5}}},
+        {"Empty subject", (uint8_t*) "x*", (uint8_t*) "", 1, {{0, 0}}},
+        {"Empty matches", (uint8_t*) "x*", (uint8_t*) "axb", 4, {{0, 0}, {1, 2}, {2, 2}, {3, 3}}},
+        {"Empty multi-byte", (uint8_t*) "x*", (uint8_t*) "é", 2, {{0, 0}, {2, 2}}},
+        {"Lookbehind", (uint8_t*) "(?<=a)b", (uint8_t*) "abab", 2, {{1, 2}, {3, 4}}},
+        {"Word boundary", (uint8_t*) "\\b", (uint8_t*) "ab cd", 4, {{0, 0}, {2, 2}, {3, 3}, {5, 5}}},
+        {"Anchor", (uint8_t*) "^a", (uint8_t*) "aaa", 1, {{0, 1}}},
+        {"Unicode", (uint8_t*) "\\p{L}+", (uint8_t*) "日本 go", 2, {{0, 6}, {7, 9}}},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8RegexIter);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_regex_iter",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_regex_iter,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8RegexFindall {
+    const char* label;
+    const uint8_t* pattern;
+    const uint8_t* docs[3];  // NULL-terminated
+    size_t capacity;
+    int threads;
+    size_t expected_total;
+    const char* expected;  // "doc.index:start-end,..." per row, "-" for unset groups
+} TestUTF8RegexFindall;
+
+int test_group_utf8_regex_findall(TestUnit* unit) {
+    TestUTF8RegexFindall* data = (TestUTF8RegexFindall*) unit->data;
+
+    UTF8View docs[3];
+    size_t n = 0;
+    while (n < 3 && data->docs[n]) {
+        docs[n] = utf8_view(data->docs[n]);
+        n++;
+    }
+
+    pcre2_code* code = NULL;
+    pcre2_match_data* match = NULL;
+    utf8_regex_compile(data->pattern, &code, &match);
+
+    UTF8RegexMatches out;
+    bool ok = utf8_regex_matches_init(&out, code, data->capacity);
+    size_t total = 0;
+    ok = ok && utf8_regex_findall_parallel(code, docs, n, &out, &total, data->threads);
+    ASSERT(ok, "[TestUTF8RegexFindall] Failed: unit=%zu, label=%s, returned false", unit->index, data->label);
+
+    // Render the rows column by column
+    UTF8Builder rows = {0};
+    for (size_t i = 0; i < out.count; i++) {
+        utf8_builder_append_fmt(&rows, "%s%zu.%zu:", i ? ";" : "", out.doc[i], out.index[i]);
+        for (size_t g = 0; g < out.groups; g++) {
+            size_t start = out.starts[g * out.capacity + i];
+            size_t end = out.ends[g * out.capacity + i];
+            if (start == UTF8_REGEX_UNSET) {
+                utf8_builder_append_fmt(&rows, "%s-", g ? "," : "");
+            } else {
+                utf8_builder_append_fmt(&rows, "%s%zu-%zu", g ? "," : "", start, end);
+            }
+        }
+    }
+    int result = strcmp((char*) utf8_builder_view(&rows).ptr, data->expected);
+
+    utf8_builder_free(&rows);
+    utf8_regex_matches_free(&out);
+    utf8_regex_free(code, match);
+
+    ASSERT_EQ(
+        total,
+        data->expected_total,
+        "[TestUTF8RegexFindall] Failed: unit=%zu, label=%s, expected total=%zu, got=%zu",
+        unit->index,
+        data->label,
+        data->expected_total,
+        total
+    );
+    ASSERT_EQ(
+        result,
+        0,
+        "[TestUTF8RegexFindall] Failed: unit=%zu, label=%s, expected rows '%s'",
+        unit->index,
+        data->label,
+        data->expected
+    );
+
+    return 0;
+}
+
+int test_suite_utf8_regex_findall(void) {
+    const uint8_t* pattern = (const uint8_t*) "(\\w+)=(\\d+)?";
+    TestUTF8RegexFindall data[] = {
+        {"No docs", pattern, {NULL}, 4, 1, 0, ""},
+        {"Groups", pattern, {(uint8_t*) "a=1 b=", (uint8_t*) "cc=22"}, 4, 1, 3,
+         "0.0:0-3,0-1,2-3;0.1:4-6,4-5,-;1.0:0-5,0-2,3-5"},
+        {"Truncated", pattern, {(uint8_t*) "a=1 b=", (uint8_t*) "cc=22"}, 2, 1, 3,
+         "0.0:0-3,0-1,2-3;0.1:4-6,4-5,-"},
+        {"Threads", pattern, {(uint8_t*) "a=1 b=", (uint8_t*) "", (uint8_t*) "cc=22"}, 4, 3, 3,
+         "0.0:0-3,0-1,2-3;0.1:4-6,4-5,-;2.0:0-5,0-2,3-5"},
+        {"Threads truncated", pattern, {(uint8_t*) "x=1", (uint8_t*) "y=2", (uint8_t*) "z=3"}, 2, 3, 3,
+         "0.0:0-3,0-1,2-3;1.0:0-3,0-1,2-3"},
+        {"Unicode", (uint8_t*) "\\p{L}+", {(uint8_t*) "日本 go"}, 4, 2, 2, "0.0:0-6;0.1:7-9"},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8RegexFindall);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_regex_findall",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_regex_findall,
+    };
+
+    return test_group_run(&group);
+}
+
+int main(void) {
+    TestSuite suites[] = {
+        {"utf8_regex_iter", test_suite_utf8_regex_iter},
+        {"utf8_regex_findall", test_suite_utf8_regex_findall},
+    };
+    size_t count = sizeof(suites) / sizeof(TestSuite);
+
+    int result = 0;
+    for (size_t i = 0; i < count; i++) {
+        result |= test_suite_run(&suites[i]);
+    }
+    return result;
+}
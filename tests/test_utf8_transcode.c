@@ -0,0 +1,328 @@
+/**
+ * @file utf8/tests/test_utf8_transcode.c
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "simd.h"
+#include "validate.h"
+#include "transcode.h"
+#include "test.h"
+
+typedef struct TestUTF8Transcode {
+    const char* label;
+    const uint32_t* src;
+    size_t len;
+    const uint8_t* expected;  // UTF-8 for the codepoints before the error
+    size_t expected_len;
+    UTF8Error expected_error;
+    size_t expected_offset;  // Index into src of the first invalid codepoint
+} TestUTF8Transcode;
+
+// Each case runs at every SIMD level behind ASCII prefixes; valid cases are also
+// repeated so runs fill whole vector blocks. Both directions use exact-size buffers.
+int test_group_utf8_transcode(TestUnit* unit) {
+    TestUTF8Transcode* data = (TestUTF8Transcode*) unit->data;
+    const size_t prefixes[] = {0, 1, 7, 8, 15};
+    const size_t repeats = data->expected_error == UTF8_ERROR_NONE ? 9 : 1;
+
+    uint32_t cps[256];
+    uint8_t bytes[1024];
+    int result = 0;
+    for (int level = UTF8_SIMD_NONE; level <= (int) utf8_simd_detect() && !result; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+        for (size_t p = 0; p < sizeof(prefixes) / sizeof(size_t) && !result; p++) {
+            size_t prefix = prefixes[p];
+            size_t len = prefix;
+            size_t expected_len = prefix;
+            for (size_t i = 0; i < prefix; i++) {
+                cps[i] = 'a';
+                bytes[i] = 'a';
+            }
+            for (size_t r = 0; r < repeats; r++) {
+                memcpy(cps + len, data->src, data->len * sizeof(uint32_t));
+                memcpy(bytes + expected_len, data->expected, data->expected_len);
+                len += data->len;
+                expected_len += data->expected_len;
+            }
+            bool valid = data->expected_error == UTF8_ERROR_NONE;
+            size_t expected_offset = valid ? len : prefix + data->expected_offset;
+
+            // UTF-32 to UTF-8
+            size_t written = 0;
+            uint8_t* encoded = malloc(expected_len + 1);
+            UTF8Validation encode = utf32_to_utf8(cps, len, encoded, &written);
+            int64_t encoded_len = utf32_to_utf8_length(cps, len);
+
+            // And back, decoding the bytes produced before the error
+            size_t decoded_len = 0;
+            uint32_t* decoded = malloc((expected_offset + 1) * sizeof(uint32_t));
+            UTF8View view = utf8_view_n(bytes, expected_len);
+            UTF8Validation decode = utf8_to_utf32(view, decoded, &decoded_len);
+
+            if (encode.error != data->expected_error || encode.offset != expected_offset
+                || written != expected_len || memcmp(encoded, bytes, expected_len) != 0
+                || encoded_len != (valid ? (int64_t) expected_len : -1)
+                || decode.error != UTF8_ERROR_NONE || decoded_len != expected_offset
+                || memcmp(decoded, cps, expected_offset * sizeof(uint32_t)) != 0
+                || utf8_to_utf32_length(view) != (int64_t) expected_offset) {
+                fprintf(
+                    stderr,
+                    "[TestUTF8Transcode] Failed: unit=%zu, label=%s, level=%s, prefix=%zu, "
+                    "expected=%s@%zu (%zu bytes), got=%s@%zu (%zu bytes, %zu decoded)\n",
+                    unit->index,
+                    data->label,
+                    utf8_simd_name((UTF8SimdLevel) level),
+                    prefix,
+                    utf8_error_name(data->expected_error),
+                    expected_offset,
+                    expected_len,
+                    utf8_error_name(encode.error),
+                    encode.offset,
+                    written,
+                    decoded_len
+                );
+                result = 1;
+            }
+
+            free(encoded);
+            free(decoded);
+        }
+    }
+
+    // Invalid UTF-8 converts up to the first error
+    uint32_t partial[4];
+    size_t partial_len = 0;
+    UTF8View surrogate = utf8_view_n((uint8_t*) "é\xED\xA0\x80", 5);
+    UTF8Validation invalid = utf8_to_utf32(surrogate, partial, &partial_len);
+    if (invalid.error != UTF8_ERROR_SURROGATE || invalid.offset != 2 || partial_len != 1
+        || partial[0] != 0xE9) {
+        fprintf(stderr, "[TestUTF8Transcode] Failed: unit=%zu, invalid UTF-8\n", unit->index);
+        result = 1;
+    }
+
+    utf8_simd_set_level(utf8_simd_detect());
+    return result;
+}
+
+int test_suite_utf8_transcode(void) {
+    const uint32_t ascii[] = {'h', 'e', 'l', 'l', 'o'};
+    const uint32_t edges[] = {0x7F, 0x80, 0x7FF, 0x800, 0xFFFF, 0x10000, 0x10FFFF};
+    const uint32_t latin[] = {0xE9, 0xF1, 0x3B1, 0x430};
+    const uint32_t cjk[] = {0x65E5, 0x672C, 0x8A9E};
+    const uint32_t mixed[] = {'a', 0xE9, 0x20AC, 0x1F600, 'z'};
+    const uint32_t around[] = {0xD7FF, 0xE000, 0xFFFD};
+    const uint32_t surrogate[] = {0x20AC, 0x20AC, 0x20AC, 0xD800, 0x20AC};
+    const uint32_t low[] = {0xE9, 0xDFFF};
+    const uint32_t large[] = {'a', 'b', 0x110000};
+    const uint32_t huge[] = {0xFFFFFFFF};
+
+    TestUTF8Transcode data[] = {
+        {"Empty", ascii, 0, (uint8_t*) "", 0, UTF8_ERROR_NONE, 0},
+        {"ASCII", ascii, 5, (uint8_t*) "hello", 5, UTF8_ERROR_NONE, 5},
+        {"Width edges",
+         edges,
+         7,
+         (uint8_t*) "\x7F\xC2\x80\xDF\xBF\xE0\xA0\x80\xEF\xBF\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF",
+         19,
+         UTF8_ERROR_NONE,
+         7},
+        {"2-byte run", latin, 4, (uint8_t*) "éñαа", 8, UTF8_ERROR_NONE, 4},
+        {"3-byte run", cjk, 3, (uint8_t*) "日本語", 9, UTF8_ERROR_NONE, 3},
+        {"Mixed", mixed, 5, (uint8_t*) "aé€😀z", 11, UTF8_ERROR_NONE, 5},
+        {"Around surrogates",
+         around,
+         3,
+         (uint8_t*) "\xED\x9F\xBF\xEE\x80\x80\xEF\xBF\xBD",
+         9,
+         UTF8_ERROR_NONE,
+         3},
+        {"High surrogate", surrogate, 5, (uint8_t*) "€€€", 9, UTF8_ERROR_SURROGATE, 3},
+        {"Low surrogate", low, 2, (uint8_t*) "é", 2, UTF8_ERROR_SURROGATE, 1},
+        {"Above U+10FFFF", large, 3, (uint8_t*) "ab", 2, UTF8_ERROR_TOO_LARGE, 2},
+        {"Above INT32_MAX", huge, 1, (uint8_t*) "", 0, UTF8_ERROR_TOO_LARGE, 0},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8Transcode);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_transcode",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_transcode,
+    };
+
+    return test_group_run(&group);
+}
+
+typedef struct TestUTF8TranscodeUTF16 {
+    const char* label;
+    const uint16_t* src;  // Unit values; each run stores them in both byte orders
+    size_t len;
+    const uint8_t* expected;  // UTF-8 for the units before the error
+    size_t expected_len;
+    UTF8Error expected_error;
+    size_t expected_offset;  // Index into src of the offending surrogate
+} TestUTF8TranscodeUTF16;
+
+int test_group_utf8_transcode_utf16(TestUnit* unit) {
+    TestUTF8TranscodeUTF16* data = (TestUTF8TranscodeUTF16*) unit->data;
+    const size_t prefixes[] = {0, 1, 7, 8, 15};
+    const size_t repeats = data->expected_error == UTF8_ERROR_NONE ? 9 : 1;
+
+    uint16_t units[256];
+    uint16_t input[256];
+    uint8_t bytes[1024];
+    int result = 0;
+    for (int level = UTF8_SIMD_NONE; level <= (int) utf8_simd_detect() && !result; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+        for (size_t p = 0; p < sizeof(prefixes) / sizeof(size_t) && !result; p++) {
+            size_t prefix = prefixes[p];
+            size_t len = prefix;
+            size_t expected_len = prefix;
+            for (size_t i = 0; i < prefix; i++) {
+                units[i] = 'a';
+                bytes[i] = 'a';
+            }
+            for (size_t r = 0; r < repeats; r++) {
+                memcpy(units + len, data->src, data->len * sizeof(uint16_t));
+                memcpy(bytes + expected_len, data->expected, data->expected_len);
+                len += data->len;
+                expected_len += data->expected_len;
+            }
+            bool valid = data->expected_error == UTF8_ERROR_NONE;
+            size_t expected_offset = valid ? len : prefix + data->expected_offset;
+
+            for (int big = 0; big < 2 && !result; big++) {
+                // Lay the units out in the byte order under test
+                for (size_t i = 0; i < len; i++) {
+                    uint8_t* out = (uint8_t*) &input[i];
+                    out[big ? 1 : 0] = (uint8_t) units[i];
+                    out[big ? 0 : 1] = (uint8_t) (units[i] >> 8);
+                }
+
+                size_t written = 0;
+                uint8_t* decoded = malloc(expected_len + 1);
+                UTF8Validation decode = big ? utf16be_to_utf8(input, len, decoded, &written)
+                                            : utf16le_to_utf8(input, len, decoded, &written);
+                int64_t decoded_len = big ? utf16be_to_utf8_length(input, len)
+                                          : utf16le_to_utf8_length(input, len);
+
+                // And back, encoding the bytes produced before the error
+                size_t encoded_len = 0;
+                uint16_t* encoded = malloc((expected_offset + 1) * sizeof(uint16_t));
+                UTF8View view = utf8_view_n(bytes, expected_len);
+                UTF8Validation encode = big ? utf8_to_utf16be(view, encoded, &encoded_len)
+                                            : utf8_to_utf16le(view, encoded, &encoded_len);
+
+                if (decode.error != data->expected_error || decode.offset != expected_offset
+                    || written != expected_len || memcmp(decoded, bytes, expected_len) != 0
+                    || decoded_len != (valid ? (int64_t) expected_len : -1)
+                    || encode.error != UTF8_ERROR_NONE || encoded_len != expected_offset
+                    || memcmp(encoded, input, expected_offset * sizeof(uint16_t)) != 0
+                    || utf8_to_utf16_length(view) != (int64_t) expected_offset) {
+                    fprintf(
+                        stderr,
+                        "[TestUTF8TranscodeUTF16] Failed: unit=%zu, label=%s, level=%s, "
+                        "prefix=%zu, order=%s, expected=%s@%zu (%zu bytes), "
+                        "got=%s@%zu (%zu bytes, %zu encoded)\n",
+                        unit->index,
+                        data->label,
+                        utf8_simd_name((UTF8SimdLevel) level),
+                        prefix,
+                        big ? "be" : "le",
+                        utf8_error_name(data->expected_error),
+                        expected_offset,
+                        expected_len,
+                        utf8_error_name(decode.error),
+                        decode.offset,
+                        written,
+                        encoded_len
+                    );
+                    result = 1;
+                }
+
+                free(decoded);
+                free(encoded);
+            }
+        }
+    }
+
+    utf8_simd_set_level(utf8_simd_detect());
+    return result;
+}
+
+int test_suite_utf8_transcode_utf16(void) {
+    const uint16_t ascii[] = {'h', 'e', 'l', 'l', 'o'};
+    const uint16_t edges[] = {0x7F, 0x80, 0x7FF, 0x800, 0xD7FF, 0xE000, 0xFFFF};
+    const uint16_t latin[] = {0xE9, 0xF1, 0x3B1, 0x430};
+    const uint16_t words[] = {0x43C, 0x438, 0x440, ' ', 0x434, 0x430};
+    const uint16_t cjk[] = {0x65E5, 0x672C, 0x8A9E};
+    const uint16_t pairs[] = {0xD83D, 0xDE00, 0xD800, 0xDC00, 0xDBFF, 0xDFFF};
+    const uint16_t mixed[] = {'a', 0xE9, 0x20AC, 0xD83D, 0xDE00, 'z'};
+    const uint16_t lone_low[] = {0x65E5, 0x672C, 0x8A9E, 0x65E5, 0xDC00, 'a'};
+    const uint16_t lone_high[] = {'a', 0xD800, 'b'};
+    const uint16_t reversed[] = {0xDE00, 0xD83D};
+    const uint16_t trailing[] = {0xE9, 0xD83D};
+
+    TestUTF8TranscodeUTF16 data[] = {
+        {"Empty", ascii, 0, (uint8_t*) "", 0, UTF8_ERROR_NONE, 0},
+        {"ASCII", ascii, 5, (uint8_t*) "hello", 5, UTF8_ERROR_NONE, 5},
+        {"Width edges",
+         edges,
+         7,
+         (uint8_t*) "\x7F\xC2\x80\xDF\xBF\xE0\xA0\x80\xED\x9F\xBF\xEE\x80\x80\xEF\xBF\xBF",
+         17,
+         UTF8_ERROR_NONE,
+         7},
+        {"2-byte run", latin, 4, (uint8_t*) "éñαа", 8, UTF8_ERROR_NONE, 4},
+        {"Short words", words, 6, (uint8_t*) "мир да", 11, UTF8_ERROR_NONE, 6},
+        {"3-byte run", cjk, 3, (uint8_t*) "日本語", 9, UTF8_ERROR_NONE, 3},
+        {"Surrogate pairs",
+         pairs,
+         6,
+         (uint8_t*) "😀\xF0\x90\x80\x80\xF4\x8F\xBF\xBF",
+         12,
+         UTF8_ERROR_NONE,
+         6},
+        {"Mixed", mixed, 6, (uint8_t*) "aé€😀z", 11, UTF8_ERROR_NONE, 6},
+        {"Lone low surrogate", lone_low, 6, (uint8_t*) "日本語日", 12, UTF8_ERROR_SURROGATE, 4},
+        {"Lone high surrogate", lone_high, 3, (uint8_t*) "a", 1, UTF8_ERROR_SURROGATE, 1},
+        {"Reversed pair", reversed, 2, (uint8_t*) "", 0, UTF8_ERROR_SURROGATE, 0},
+        {"High surrogate at end", trailing, 2, (uint8_t*) "é", 2, UTF8_ERROR_TRUNCATED, 1},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8TranscodeUTF16);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_transcode_utf16",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_transcode_utf16,
+    };
+
+    return test_group_run(&group);
+}
+
+int main(void) {
+    TestSuite suites[] = {
+        {"utf8_transcode", test_suite_utf8_transcode},
+        {"utf8_transcode_utf16", test_suite_utf8_transcode_utf16},
+    };
+    size_t count = sizeof(suites) / sizeof(TestSuite);
+
+    int result = 0;
+    for (size_t i = 0; i < count; i++) {
+        result |= test_suite_run(&suites[i]);
+    }
+    return result;
+}
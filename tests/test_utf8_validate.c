@@ -0,0 +1,122 @@
+/**
+ * @file utf8/tests/test_utf8_validate.c
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "simd.h"
+#include "validate.h"
+#include "codepoint.h"
+#include "test.h"
+
+typedef struct TestUTF8Validate {
+    const char* label;
+    const uint8_t* src;
+    size_t len;
+    UTF8Error expected_error;
+    size_t expected_offset;  // Relative to src
+    size_t expected_count;  // Codepoints in src before expected_offset
+} TestUTF8Validate;
+
+// Each case runs at every SIMD level, shifted across the 64-byte block edges.
+int test_group_utf8_validate(TestUnit* unit) {
+    TestUTF8Validate* data = (TestUTF8Validate*) unit->data;
+    const size_t prefixes[] = {0, 1, 60, 61, 62, 63, 64, 127};
+
+    uint8_t buffer[256];
+    int result = 0;
+    for (int level = UTF8_SIMD_NONE; level <= (int) utf8_simd_detect() && !result; level++) {
+        utf8_simd_set_level((UTF8SimdLevel) level);
+        for (size_t p = 0; p < sizeof(prefixes) / sizeof(size_t) && !result; p++) {
+            size_t prefix = prefixes[p];
+            memset(buffer, 'a', prefix);
+            memcpy(buffer + prefix, data->src, data->len);
+            UTF8View view = utf8_view_n(buffer, prefix + data->len);
+
+            UTF8Validation actual = utf8_validate(view);
+            size_t expected_offset = prefix + data->expected_offset;
+            size_t expected_count = prefix + data->expected_count;
+            bool valid = data->expected_error == UTF8_ERROR_NONE;
+
+            // The fused pass agrees, and counts exactly up to the error
+            size_t count = 0;
+            UTF8Validation counted = utf8_validate_count(view, &count);
+            if (actual.error != data->expected_error || actual.offset != expected_offset
+                || utf8_is_valid(view) != valid || counted.error != actual.error
+                || counted.offset != actual.offset || count != expected_count
+                || (valid && utf8_cp_count_fast(view) != (int64_t) expected_count)
+                || utf8_cp_count_view(view) != (valid ? (int64_t) expected_count : -1)) {
+                fprintf(
+                    stderr,
+                    "[TestUTF8Validate] Failed: unit=%zu, label=%s, level=%s, prefix=%zu, "
+                    "expected=%s@%zu (%zu codepoints), got=%s@%zu (%zu codepoints)\n",
+                    unit->index,
+                    data->label,
+                    utf8_simd_name((UTF8SimdLevel) level),
+                    prefix,
+                    utf8_error_name(data->expected_error),
+                    expected_offset,
+                    expected_count,
+                    utf8_error_name(actual.error),
+                    actual.offset,
+                    count
+                );
+                result = 1;
+            }
+        }
+    }
+
+    utf8_simd_set_level(utf8_simd_detect());
+    return result;
+}
+
+int test_suite_utf8_validate(void) {
+    TestUTF8Validate data[] = {
+        {"Empty", (uint8_t*) "", 0, UTF8_ERROR_NONE, 0, 0},
+        {"ASCII", (uint8_t*) "hello", 5, UTF8_ERROR_NONE, 5, 5},
+        {"Embedded NUL", (uint8_t*) "a\0b", 3, UTF8_ERROR_NONE, 3, 3},
+        {"Mixed", (uint8_t*) "é€😀\xEF\xBF\xBF\xF4\x8F\xBF\xBF", 16, UTF8_ERROR_NONE, 16, 5},
+        {"Stray continuation", (uint8_t*) "ab\x80", 3, UTF8_ERROR_CONTINUATION, 2, 2},
+        {"Extra continuation", (uint8_t*) "\xC3\xA9\xA9", 3, UTF8_ERROR_CONTINUATION, 2, 1},
+        {"Overlong C0", (uint8_t*) "\xC0\xAF", 2, UTF8_ERROR_OVERLONG, 0, 0},
+        {"Overlong 3-byte", (uint8_t*) "x\xE0\x80\xAF", 4, UTF8_ERROR_OVERLONG, 1, 1},
+        {"Overlong 4-byte", (uint8_t*) "\xF0\x8F\xBF\xBF", 4, UTF8_ERROR_OVERLONG, 0, 0},
+        {"Surrogate", (uint8_t*) "ok\xED\xA0\x80", 5, UTF8_ERROR_SURROGATE, 2, 2},
+        {"Too large F4", (uint8_t*) "\xF4\x90\x80\x80", 4, UTF8_ERROR_TOO_LARGE, 0, 0},
+        {"Too large F5", (uint8_t*) "\xF5\x80\x80\x80", 4, UTF8_ERROR_TOO_LARGE, 0, 0},
+        {"Invalid FF", (uint8_t*) "a\xFF", 2, UTF8_ERROR_TOO_LARGE, 1, 1},
+        {"Truncated at end", (uint8_t*) "a\xE2\x82", 3, UTF8_ERROR_TRUNCATED, 1, 1},
+        {"Truncated by ASCII", (uint8_t*) "\xF0\x9F\x98z", 4, UTF8_ERROR_TRUNCATED, 0, 0},
+        {"Truncated by lead", (uint8_t*) "\xC3\xC3\xA9", 3, UTF8_ERROR_TRUNCATED, 0, 0},
+        {"First error wins", (uint8_t*) "\xC3\xA9\xED\xBF\xBF\x80", 6, UTF8_ERROR_SURROGATE, 2, 1},
+    };
+    size_t count = sizeof(data) / sizeof(TestUTF8Validate);
+
+    TestUnit units[count];
+    for (size_t i = 0; i < count; i++) {
+        units[i].data = &data[i];
+    }
+
+    TestGroup group = {
+        .name = "utf8_validate",
+        .count = count,
+        .units = units,
+        .run = test_group_utf8_validate,
+    };
+
+    return test_group_run(&group);
+}
+
+int main(void) {
+    TestSuite suites[] = {
+        {"utf8_validate", test_suite_utf8_validate},
+    };
+    size_t count = sizeof(suites) / sizeof(TestSuite);
+
+    int result = 0;
+    for (size_t i = 0; i < count; i++) {
+        result |= test_suite_run(&suites[i]);
+    }
+    return result;
+}
@@ -0,0 +1,300 @@
+"""
+unicode.case — Unicode Case Mapping Data Generator
+==================================================
+
+Auto-generates C header/source files containing full Unicode case mappings
+(lowercase, uppercase and case folding) as a two-stage lookup table, for use
+by utf8_to_lower(), utf8_to_upper() and utf8_casefold().
+
+Features
+--------
+- Downloads and caches the Unicode case data files:
+    - UnicodeData.txt           (simple mappings)
+    - SpecialCasing.txt         (one-to-many and conditional mappings)
+    - CaseFolding.txt           (C, F and S statuses; T is Turkic-only)
+    - DerivedCoreProperties.txt (Cased, Case_Ignorable for Final_Sigma)
+- Stores each codepoint's mappings as a deduplicated record: a delta per
+  mode, or an index into a table of UTF-8 strings when the full mapping is
+  more than one codepoint (e.g., U+00DF -> "ss").
+- Records whose only condition is Final_Sigma are flagged so the converter
+  can resolve the context; language-specific conditions (tr, lt, az) are
+  not applied.
+
+Output
+------
+- include/case-data.h    # Record + special string types, table declarations
+- src/case-data.c        # Stage 1, stage 2, records and special strings
+
+Usage
+-----
+Run directly as a module (no arguments):
+
+    python -m unicode.case
+
+On success, generates/updates the above files in-place.
+Exit status 0 = success; 1 = failure. No output is emitted on success.
+
+Notes
+-----
+- Files are cached to `data/` on first run; only re-fetched if absent.
+- Record 0 is the identity mapping, shared by every uncased codepoint.
+- UTF8_CASE_EXPANSION is the largest ratio of output to input bytes over
+  all codepoints and modes, so dst buffers of len * UTF8_CASE_EXPANSION
+  bytes never need a length pass.
+
+References
+----------
+- The Unicode Standard, Section 3.13: Default Case Algorithms
+- https://www.unicode.org/Public/UCD/latest/ucd/SpecialCasing.txt
+- https://www.unicode.org/Public/UCD/latest/ucd/CaseFolding.txt
+"""
+
+import os
+from datetime import date
+
+from unicode.grapheme import unicode_data_fetch
+
+MODES = ["LOWER", "UPPER", "FOLD"]
+
+CODEPOINT_MAX = 0x110000
+BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+FLAG_CASED = 0x01
+FLAG_CASE_IGNORABLE = 0x02
+FLAG_FINAL_SIGMA = 0x04
+
+
+def unicode_data_cache() -> dict[str, list[str]]:
+    base_dir = "data"
+    base_url = "https://www.unicode.org/Public/UCD/latest/ucd"
+    os.makedirs(base_dir, exist_ok=True)
+    files = {
+        "data": (f"{base_url}/UnicodeData.txt", f"{base_dir}/UnicodeData.txt"),
+        "special": (f"{base_url}/SpecialCasing.txt", f"{base_dir}/SpecialCasing.txt"),
+        "folding": (f"{base_url}/CaseFolding.txt", f"{base_dir}/CaseFolding.txt"),
+        "core": (
+            f"{base_url}/DerivedCoreProperties.txt",
+            f"{base_dir}/DerivedCoreProperties.txt",
+        ),
+    }
+    return {key: unicode_data_fetch(url, path) for key, (url, path) in files.items()}
+
+
+# Yields the ";"-separated fields of each data line, with comments removed
+def unicode_data_fields(lines: list[str]):
+    for line in lines:
+        line = line.split("#")[0].strip()
+        if line:
+            yield [field.strip() for field in line.split(";")]
+
+
+def unicode_data_codepoints(field: str) -> tuple[int, ...]:
+    return tuple(int(x, 16) for x in field.split())
+
+
+def unicode_data_parse(cache: dict[str, list[str]]):
+    # mappings[mode][cp] = tuple of codepoints, only where it differs from cp
+    mappings = [{} for _ in MODES]
+    flags = {}
+
+    for fields in unicode_data_fields(cache["data"]):
+        cp = int(fields[0], 16)
+        upper, lower = fields[12], fields[13]
+        if lower:
+            mappings[0][cp] = unicode_data_codepoints(lower)
+        if upper:
+            mappings[1][cp] = unicode_data_codepoints(upper)
+
+    # Unconditional full mappings replace the simple ones
+    for fields in unicode_data_fields(cache["special"]):
+        cp = int(fields[0], 16)
+        lower, upper = unicode_data_codepoints(fields[1]), unicode_data_codepoints(fields[3])
+        condition = fields[4] if len(fields) > 4 else ""
+        if condition == "Final_Sigma":
+            flags[cp] = flags.get(cp, 0) | FLAG_FINAL_SIGMA
+            continue
+        if condition:
+            continue  # Language-specific
+        for mode, mapped in ((0, lower), (1, upper)):
+            if mapped == (cp,):
+                mappings[mode].pop(cp, None)
+            else:
+                mappings[mode][cp] = mapped
+
+    # Full folding: C and F; S only matters for simple folding
+    for fields in unicode_data_fields(cache["folding"]):
+        cp, status = int(fields[0], 16), fields[1]
+        if status in ("C", "F"):
+            mappings[2][cp] = unicode_data_codepoints(fields[2])
+
+    for fields in unicode_data_fields(cache["core"]):
+        prop = fields[1]
+        if prop not in ("Cased", "Case_Ignorable"):
+            continue
+        if ".." in fields[0]:
+            lo, hi = (int(x, 16) for x in fields[0].split(".."))
+        else:
+            lo = hi = int(fields[0], 16)
+        flag = FLAG_CASED if prop == "Cased" else FLAG_CASE_IGNORABLE
+        for cp in range(lo, hi + 1):
+            flags[cp] = flags.get(cp, 0) | flag
+
+    return mappings, flags
+
+
+def unicode_data_utf8(codepoints: tuple[int, ...]) -> bytes:
+    return "".join(chr(cp) for cp in codepoints).encode("utf-8")
+
+
+def unicode_data_records(mappings, flags):
+    records = {(0, 0, 0, 0, 0, 0, 0): 0}  # Identity
+    specials = {b"": 0}  # Index 0 means no special mapping
+    values = [0] * CODEPOINT_MAX
+    expansion = 1
+
+    for cp in sorted(set().union(*mappings, flags)):
+        deltas, indices = [], []
+        for mapping in mappings:
+            mapped = mapping.get(cp, (cp,))
+            if len(mapped) == 1:
+                deltas.append(mapped[0] - cp)
+                indices.append(0)
+            else:
+                string = unicode_data_utf8(mapped)
+                indices.append(specials.setdefault(string, len(specials)))
+                deltas.append(0)
+            width = len(chr(cp).encode("utf-8"))
+            expansion = max(expansion, -(-len(unicode_data_utf8(mapped)) // width))
+        record = (*deltas, *indices, flags.get(cp, 0))
+        values[cp] = records.setdefault(record, len(records))
+
+    if len(specials) > 256:
+        raise ValueError(f"{len(specials)} special mappings do not fit a uint8_t index")
+    return values, list(records), list(specials), expansion
+
+
+def unicode_data_stages(values: list[int]) -> tuple[list[int], list[int]]:
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for base in range(0, CODEPOINT_MAX, BLOCK_SIZE):
+        block = tuple(values[base : base + BLOCK_SIZE])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    if len(blocks) > 256:
+        raise ValueError(f"{len(blocks)} unique blocks do not fit a uint8_t stage 1")
+    return stage1, stage2
+
+
+def unicode_data_comments() -> list[str]:
+    version = 1
+    lines = []
+    lines.append("/**")
+    lines.append(" * @warning This file is auto-generated. Do not edit directly.")
+    lines.append(" * @brief Full case mapping and case folding data.")
+    lines.append(" * @ref Unicode UCD - Generated by unicode.case.py")
+    lines.append(f" * @version {version}")
+    lines.append(f" * @date {date.today()}")
+    lines.append(" */\n")
+    return lines
+
+
+def unicode_data_include(stage1, stage2, records, specials, expansion) -> str:
+    special_max = max(len(s) for s in specials)
+    lines = unicode_data_comments()
+
+    lines.append("#ifndef UTF8_CASE_DATA_H")
+    lines.append("#define UTF8_CASE_DATA_H\n")
+
+    lines.append("#include <stddef.h>")
+    lines.append("#include <stdint.h>\n")
+
+    lines.append("typedef enum UTF8CaseMode {")
+    for i, mode in enumerate(MODES):
+        lines.append(f"    UTF8_CASE_{mode} = {i},")
+    lines.append("} UTF8CaseMode;\n")
+
+    lines.append(f"#define UTF8_CASE_CASED 0x{FLAG_CASED:02X}")
+    lines.append(f"#define UTF8_CASE_IGNORABLE 0x{FLAG_CASE_IGNORABLE:02X}")
+    lines.append(f"#define UTF8_CASE_FINAL_SIGMA 0x{FLAG_FINAL_SIGMA:02X}")
+    lines.append(f"#define UTF8_CASE_SHIFT {BLOCK_SHIFT}")
+    lines.append(f"#define UTF8_CASE_SPECIAL_MAX {special_max}")
+    lines.append(f"#define UTF8_CASE_EXPANSION {expansion}\n")
+
+    lines.append("// delta[mode] is added to the codepoint unless special[mode] names a string")
+    lines.append("typedef struct UTF8CaseRecord {")
+    lines.append("    int32_t delta[3];")
+    lines.append("    uint8_t special[3];")
+    lines.append("    uint8_t flags;")
+    lines.append("} UTF8CaseRecord;\n")
+
+    lines.append("typedef struct UTF8CaseSpecial {")
+    lines.append("    uint8_t len;")
+    lines.append(f"    uint8_t bytes[UTF8_CASE_SPECIAL_MAX];")
+    lines.append("} UTF8CaseSpecial;\n")
+
+    lines.append(f"extern const uint8_t utf8_case_stage1[{len(stage1)}];")
+    lines.append(f"extern const uint16_t utf8_case_stage2[{len(stage2)}];")
+    lines.append(f"extern const UTF8CaseRecord utf8_case_records[{len(records)}];")
+    lines.append(f"extern const UTF8CaseSpecial utf8_case_special[{len(specials)}];\n")
+
+    lines.append("#endif // UTF8_CASE_DATA_H\n")
+
+    return "\n".join(lines)
+
+
+def unicode_data_table(ctype: str, name: str, values: list[int], columns: int) -> list[str]:
+    width = 2 if ctype == "uint8_t" else 4
+    lines = [f"const {ctype} {name}[{len(values)}] = {{"]
+    for i in range(0, len(values), columns):
+        row = ", ".join(f"0x{v:0{width}X}" for v in values[i : i + columns])
+        lines.append(f"    {row},")
+    lines.append("};\n")
+    return lines
+
+
+def unicode_data_source(stage1, stage2, records, specials) -> str:
+    lines = unicode_data_comments()
+
+    lines.append('#include "case-data.h"\n')
+
+    lines.extend(unicode_data_table("uint8_t", "utf8_case_stage1", stage1, 16))
+    lines.extend(unicode_data_table("uint16_t", "utf8_case_stage2", stage2, 12))
+
+    lines.append(f"const UTF8CaseRecord utf8_case_records[{len(records)}] = {{")
+    for lower, upper, fold, s_lower, s_upper, s_fold, flags in records:
+        lines.append(
+            f"    {{{{{lower}, {upper}, {fold}}}, {{{s_lower}, {s_upper}, {s_fold}}}, 0x{flags:02X}}},"
+        )
+    lines.append("};\n")
+
+    lines.append(f"const UTF8CaseSpecial utf8_case_special[{len(specials)}] = {{")
+    for string in specials:
+        data = ", ".join(f"0x{b:02X}" for b in string) or "0"
+        text = string.decode("utf-8") if string else "none"
+        lines.append(f"    {{{len(string)}, {{{data}}}}}, // {text}")
+    lines.append("};\n")
+
+    return "\n".join(lines)
+
+
+def main():
+    cache = unicode_data_cache()
+    mappings, flags = unicode_data_parse(cache)
+    values, records, specials, expansion = unicode_data_records(mappings, flags)
+    stage1, stage2 = unicode_data_stages(values)
+
+    header = unicode_data_include(stage1, stage2, records, specials, expansion)
+    with open("include/case-data.h", "w") as file:
+        file.write(header)
+
+    source = unicode_data_source(stage1, stage2, records, specials)
+    with open("src/case-data.c", "w") as file:
+        file.write(source)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,311 @@
+"""
+unicode.normal — Unicode Normalization Data Generator
+=====================================================
+
+Auto-generates C header/source files containing the data behind the four
+Unicode normalization forms (NFC, NFD, NFKC, NFKD): canonical combining
+classes, quick-check values, full decompositions and primary composites.
+
+Features
+--------
+- Downloads and caches the Unicode normalization data files:
+    - UnicodeData.txt               (ccc, decomposition mappings)
+    - DerivedNormalizationProps.txt (*_QC, Full_Composition_Exclusion)
+- Expands every decomposition recursively, so one lookup yields the full
+  canonical or compatibility decomposition of a codepoint.
+- Stores per-codepoint records (ccc, quick-check flags, decomposition
+  offsets) behind a two-stage table, and the primary composites as a
+  sorted pair list for binary search.
+- Hangul syllables are left to the algorithmic (de)composition in C.
+
+Output
+------
+- include/normal-data.h    # Record + pair types, flag masks, table declarations
+- src/normal-data.c        # Stage tables, records, decompositions, composites
+
+Usage
+-----
+Run directly as a module (no arguments):
+
+    python -m unicode.normal
+
+On success, generates/updates the above files in-place.
+Exit status 0 = success; 1 = failure. No output is emitted on success.
+
+Notes
+-----
+- Files are cached to `data/` on first run; only re-fetched if absent.
+- UTF8_NORMAL_*_MIN is the lowest codepoint that is not both quick-check
+  Yes and ccc 0 for that form; text below it is already normalized.
+- UTF8_NORMAL_*_EXPANSION bounds output bytes per input byte.
+
+References
+----------
+- Unicode Standard Annex #15: Unicode Normalization Forms
+- https://www.unicode.org/reports/tr15/
+- https://www.unicode.org/Public/UCD/latest/ucd/
+"""
+
+import os
+from datetime import date
+
+from unicode.grapheme import unicode_data_fetch
+
+CODEPOINT_MAX = 0x110000
+BLOCK_SHIFT = 7
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+
+# Quick-check flags; the absence of both bits of a form means Yes
+FLAGS = {
+    ("NFD_QC", "N"): 0x01,
+    ("NFKD_QC", "N"): 0x02,
+    ("NFC_QC", "N"): 0x04,
+    ("NFC_QC", "M"): 0x08,
+    ("NFKC_QC", "N"): 0x10,
+    ("NFKC_QC", "M"): 0x20,
+}
+FORMS = {"NFC": 0x0C, "NFD": 0x01, "NFKC": 0x30, "NFKD": 0x02}
+
+HANGUL_FIRST, HANGUL_LAST = 0xAC00, 0xD7A3
+
+
+def unicode_data_cache() -> dict[str, list[str]]:
+    base_dir = "data"
+    base_url = "https://www.unicode.org/Public/UCD/latest/ucd"
+    os.makedirs(base_dir, exist_ok=True)
+    files = {
+        "data": (f"{base_url}/UnicodeData.txt", f"{base_dir}/UnicodeData.txt"),
+        "props": (
+            f"{base_url}/DerivedNormalizationProps.txt",
+            f"{base_dir}/DerivedNormalizationProps.txt",
+        ),
+    }
+    return {key: unicode_data_fetch(url, path) for key, (url, path) in files.items()}
+
+
+def unicode_data_fields(lines: list[str]):
+    for line in lines:
+        line = line.split("#")[0].strip()
+        if line:
+            yield [field.strip() for field in line.split(";")]
+
+
+def unicode_data_range(field: str) -> range:
+    if ".." in field:
+        lo, hi = (int(x, 16) for x in field.split(".."))
+        return range(lo, hi + 1)
+    return range(int(field, 16), int(field, 16) + 1)
+
+
+def unicode_data_parse(cache: dict[str, list[str]]):
+    ccc = {}
+    mappings = {}  # cp -> (compat, codepoints)
+    for fields in unicode_data_fields(cache["data"]):
+        cp = int(fields[0], 16)
+        if int(fields[3]):
+            ccc[cp] = int(fields[3])
+        if fields[5]:
+            parts = fields[5].split()
+            compat = parts[0].startswith("<")
+            mappings[cp] = (compat, tuple(int(x, 16) for x in parts[compat:]))
+
+    flags = {}
+    exclusions = set()
+    for fields in unicode_data_fields(cache["props"]):
+        if fields[1] == "Full_Composition_Exclusion":
+            exclusions.update(unicode_data_range(fields[0]))
+        elif len(fields) > 2 and (fields[1], fields[2]) in FLAGS:
+            for cp in unicode_data_range(fields[0]):
+                flags[cp] = flags.get(cp, 0) | FLAGS[(fields[1], fields[2])]
+
+    return ccc, mappings, flags, exclusions
+
+
+def unicode_data_decompose(cp: int, mappings, compat: bool) -> tuple[int, ...]:
+    mapping = mappings.get(cp)
+    if not mapping or (mapping[0] and not compat):
+        return (cp,)
+    return tuple(d for part in mapping[1] for d in unicode_data_decompose(part, mappings, compat))
+
+
+def unicode_data_utf8(codepoints) -> bytes:
+    return "".join(chr(cp) for cp in codepoints).encode("utf-8")
+
+
+def unicode_data_records(ccc, mappings, flags):
+    pool = []
+    pool_index = {}
+    records = {(0, 0, 0, 0, 0, 0): 0}
+    values = [0] * CODEPOINT_MAX
+    expansion = {False: 1, True: 1}
+
+    def intern(decomposition: tuple[int, ...]) -> int:
+        if decomposition not in pool_index:
+            pool_index[decomposition] = len(pool)
+            pool.extend(decomposition)
+        return pool_index[decomposition]
+
+    for cp in sorted(set(ccc) | set(mappings) | set(flags)):
+        fields = []
+        for compat in (False, True):
+            decomposition = unicode_data_decompose(cp, mappings, compat)
+            if decomposition == (cp,):
+                fields.extend((0, 0))
+                continue
+            fields.extend((intern(decomposition), len(decomposition)))
+            ratio = -(-len(unicode_data_utf8(decomposition)) // len(chr(cp).encode("utf-8")))
+            expansion[compat] = max(expansion[compat], ratio)
+        record = (*fields, ccc.get(cp, 0), flags.get(cp, 0))
+        values[cp] = records.setdefault(record, len(records))
+
+    # Hangul syllables decompose algorithmically, up to 3 jamo of 3 bytes each
+    expansion = {k: max(v, 3) for k, v in expansion.items()}
+    if len(pool) > 0xFFFF:
+        raise ValueError(f"{len(pool)} decomposition codepoints do not fit a uint16_t offset")
+    return values, list(records), pool, expansion
+
+
+def unicode_data_pairs(mappings, exclusions) -> list[tuple[int, int, int]]:
+    pairs = []
+    for cp, (compat, parts) in mappings.items():
+        if not compat and len(parts) == 2 and cp not in exclusions:
+            pairs.append((parts[0], parts[1], cp))
+    return sorted(pairs)
+
+
+def unicode_data_minimums(ccc, flags) -> dict[str, int]:
+    minimums = {}
+    for form, mask in FORMS.items():
+        minimums[form] = min(
+            cp for cp in range(CODEPOINT_MAX) if ccc.get(cp, 0) or flags.get(cp, 0) & mask
+        )
+    return minimums
+
+
+def unicode_data_stages(values: list[int]) -> tuple[list[int], list[int]]:
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for base in range(0, CODEPOINT_MAX, BLOCK_SIZE):
+        block = tuple(values[base : base + BLOCK_SIZE])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    if len(blocks) > 256:
+        raise ValueError(f"{len(blocks)} unique blocks do not fit a uint8_t stage 1")
+    return stage1, stage2
+
+
+def unicode_data_comments() -> list[str]:
+    version = 1
+    lines = []
+    lines.append("/**")
+    lines.append(" * @warning This file is auto-generated. Do not edit directly.")
+    lines.append(" * @brief Normalization (NFC, NFD, NFKC, NFKD) property data.")
+    lines.append(" * @ref Unicode UCD - Generated by unicode.normal.py")
+    lines.append(f" * @version {version}")
+    lines.append(f" * @date {date.today()}")
+    lines.append(" */\n")
+    return lines
+
+
+def unicode_data_include(stage1, stage2, records, pool, pairs, minimums, expansion) -> str:
+    lines = unicode_data_comments()
+
+    lines.append("#ifndef UTF8_NORMAL_DATA_H")
+    lines.append("#define UTF8_NORMAL_DATA_H\n")
+
+    lines.append("#include <stddef.h>")
+    lines.append("#include <stdint.h>\n")
+
+    for (prop, value), flag in FLAGS.items():
+        name = prop.split("_")[0]
+        kind = "NO" if value == "N" else "MAYBE"
+        lines.append(f"#define UTF8_NORMAL_{name}_{kind} 0x{flag:02X}")
+    lines.append("")
+
+    for form, cp in minimums.items():
+        lines.append(f"#define UTF8_NORMAL_{form}_MIN 0x{cp:04X}")
+    lines.append(f"#define UTF8_NORMAL_CANONICAL_EXPANSION {expansion[False]}")
+    lines.append(f"#define UTF8_NORMAL_COMPAT_EXPANSION {expansion[True]}")
+    lines.append(f"#define UTF8_NORMAL_SHIFT {BLOCK_SHIFT}\n")
+
+    lines.append("// Offsets and lengths of the full decompositions in utf8_normal_decomp; 0 if none")
+    lines.append("typedef struct UTF8NormalRecord {")
+    lines.append("    uint16_t canonical;")
+    lines.append("    uint8_t canonical_len;")
+    lines.append("    uint8_t ccc;")
+    lines.append("    uint16_t compat;")
+    lines.append("    uint8_t compat_len;")
+    lines.append("    uint8_t flags;")
+    lines.append("} UTF8NormalRecord;\n")
+
+    lines.append("typedef struct UTF8NormalPair {")
+    lines.append("    uint32_t first, second, composite;")
+    lines.append("} UTF8NormalPair;\n")
+
+    lines.append(f"extern const uint8_t utf8_normal_stage1[{len(stage1)}];")
+    lines.append(f"extern const uint16_t utf8_normal_stage2[{len(stage2)}];")
+    lines.append(f"extern const UTF8NormalRecord utf8_normal_records[{len(records)}];")
+    lines.append(f"extern const uint32_t utf8_normal_decomp[{len(pool)}];")
+    lines.append(f"extern const UTF8NormalPair utf8_normal_pairs[{len(pairs)}];\n")
+
+    lines.append("#endif // UTF8_NORMAL_DATA_H\n")
+
+    return "\n".join(lines)
+
+
+def unicode_data_table(ctype: str, name: str, values: list[int], width: int, columns: int):
+    lines = [f"const {ctype} {name}[{len(values)}] = {{"]
+    for i in range(0, len(values), columns):
+        row = ", ".join(f"0x{v:0{width}X}" for v in values[i : i + columns])
+        lines.append(f"    {row},")
+    lines.append("};\n")
+    return lines
+
+
+def unicode_data_source(stage1, stage2, records, pool, pairs) -> str:
+    lines = unicode_data_comments()
+
+    lines.append('#include "normal-data.h"\n')
+
+    lines.extend(unicode_data_table("uint8_t", "utf8_normal_stage1", stage1, 2, 16))
+    lines.extend(unicode_data_table("uint16_t", "utf8_normal_stage2", stage2, 4, 12))
+
+    lines.append(f"const UTF8NormalRecord utf8_normal_records[{len(records)}] = {{")
+    for canonical, canonical_len, compat, compat_len, ccc, flags in records:
+        lines.append(
+            f"    {{{canonical}, {canonical_len}, {ccc}, {compat}, {compat_len}, 0x{flags:02X}}},"
+        )
+    lines.append("};\n")
+
+    lines.extend(unicode_data_table("uint32_t", "utf8_normal_decomp", pool, 5, 8))
+
+    lines.append(f"const UTF8NormalPair utf8_normal_pairs[{len(pairs)}] = {{")
+    for first, second, composite in pairs:
+        lines.append(f"    {{0x{first:05X}, 0x{second:05X}, 0x{composite:05X}}},")
+    lines.append("};\n")
+
+    return "\n".join(lines)
+
+
+def main():
+    cache = unicode_data_cache()
+    ccc, mappings, flags, exclusions = unicode_data_parse(cache)
+    values, records, pool, expansion = unicode_data_records(ccc, mappings, flags)
+    pairs = unicode_data_pairs(mappings, exclusions)
+    minimums = unicode_data_minimums(ccc, flags)
+    stage1, stage2 = unicode_data_stages(values)
+
+    header = unicode_data_include(stage1, stage2, records, pool, pairs, minimums, expansion)
+    with open("include/normal-data.h", "w") as file:
+        file.write(header)
+
+    source = unicode_data_source(stage1, stage2, records, pool, pairs)
+    with open("src/normal-data.c", "w") as file:
+        file.write(source)
+
+
+if __name__ == "__main__":
+    main()
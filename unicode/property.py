@@ -0,0 +1,243 @@
+"""
+unicode.property — Unicode Character Property Data Generator
+============================================================
+
+Auto-generates C header/source files containing the General_Category and
+White_Space properties of every codepoint as a two-stage lookup table, for
+use by the codepoint classifiers (alpha, digit, space, punct, ...).
+
+Features
+--------
+- Downloads and caches the Unicode property data files:
+    - extracted/DerivedGeneralCategory.txt
+    - PropList.txt
+- Packs each codepoint into one byte: the category in the low 5 bits and
+  White_Space in the high bit.
+- Splits the codepoint space into 256-codepoint blocks and deduplicates
+  them, so a lookup is two loads: stage1[cp >> 8] picks the block and
+  stage2[block << 8 | (cp & 0xFF)] holds the byte.
+
+Output
+------
+- include/property-data.h    # Category enum, flag masks + table declarations
+- src/property-data.c        # Stage 1 and stage 2 tables
+
+Usage
+-----
+Run directly as a module (no arguments):
+
+    python -m unicode.property
+
+On success, generates/updates the above files in-place.
+Exit status 0 = success; 1 = failure. No output is emitted on success.
+
+Notes
+-----
+- Files are cached to `data/` on first run; only re-fetched if absent.
+- Block 0 is always emitted first, so stage2[0..255] doubles as a direct
+  table for U+0000..U+00FF.
+- Codepoints absent from DerivedGeneralCategory.txt are unassigned (Cn).
+
+References
+----------
+- Unicode Standard Annex #44: Unicode Character Database
+- https://www.unicode.org/reports/tr44/#General_Category_Values
+- https://www.unicode.org/Public/UCD/latest/ucd/
+"""
+
+import os
+from datetime import date
+
+from unicode.grapheme import unicode_data_fetch
+
+# Enum order; Cn is 0 so that zero-filled entries read as unassigned.
+CATEGORIES = [
+    "Cn",  # Unassigned
+    "Lu",  # Uppercase_Letter
+    "Ll",  # Lowercase_Letter
+    "Lt",  # Titlecase_Letter
+    "Lm",  # Modifier_Letter
+    "Lo",  # Other_Letter
+    "Mn",  # Nonspacing_Mark
+    "Mc",  # Spacing_Mark
+    "Me",  # Enclosing_Mark
+    "Nd",  # Decimal_Number
+    "Nl",  # Letter_Number
+    "No",  # Other_Number
+    "Pc",  # Connector_Punctuation
+    "Pd",  # Dash_Punctuation
+    "Ps",  # Open_Punctuation
+    "Pe",  # Close_Punctuation
+    "Pi",  # Initial_Punctuation
+    "Pf",  # Final_Punctuation
+    "Po",  # Other_Punctuation
+    "Sm",  # Math_Symbol
+    "Sc",  # Currency_Symbol
+    "Sk",  # Modifier_Symbol
+    "So",  # Other_Symbol
+    "Zs",  # Space_Separator
+    "Zl",  # Line_Separator
+    "Zp",  # Paragraph_Separator
+    "Cc",  # Control
+    "Cf",  # Format
+    "Cs",  # Surrogate
+    "Co",  # Private_Use
+]
+
+# Major classes as bit sets over the category enum, for (1 << gc) & mask tests
+GROUPS = {
+    "LETTER": ("Lu", "Ll", "Lt", "Lm", "Lo"),
+    "MARK": ("Mn", "Mc", "Me"),
+    "NUMBER": ("Nd", "Nl", "No"),
+    "PUNCT": ("Pc", "Pd", "Ps", "Pe", "Pi", "Pf", "Po"),
+    "SYMBOL": ("Sm", "Sc", "Sk", "So"),
+    "SEPARATOR": ("Zs", "Zl", "Zp"),
+    "OTHER": ("Cn", "Cc", "Cf", "Cs", "Co"),
+}
+
+CODEPOINT_MAX = 0x110000
+BLOCK_SHIFT = 8
+BLOCK_SIZE = 1 << BLOCK_SHIFT
+CATEGORY_MASK = 0x1F
+WHITE_SPACE = 0x80
+
+
+def unicode_data_cache() -> dict[str, list[str]]:
+    base_dir = "data"
+    base_url = "https://www.unicode.org/Public/UCD/latest/ucd"
+    os.makedirs(base_dir, exist_ok=True)
+    files = {
+        "category": (
+            f"{base_url}/extracted/DerivedGeneralCategory.txt",
+            f"{base_dir}/DerivedGeneralCategory.txt",
+        ),
+        "prop": (
+            f"{base_url}/PropList.txt",
+            f"{base_dir}/PropList.txt",
+        ),
+    }
+    return {key: unicode_data_fetch(url, path) for key, (url, path) in files.items()}
+
+
+# Yields (lo, hi, value) for each "XXXX" or "XXXX..YYYY ; value" line
+def unicode_data_ranges(lines: list[str]):
+    for line in lines:
+        line = line.split("#")[0].strip()
+        if not line or ";" not in line:
+            continue
+
+        lvalue, rvalue = list(value.strip() for value in line.split(";")[:2])
+        if ".." in lvalue:  # range
+            lo, hi = list(int(x, 16) for x in lvalue.split(".."))
+        else:  # singleton
+            lo = hi = int(lvalue, 16)
+        yield lo, hi, rvalue
+
+
+def unicode_data_parse(cache: dict[str, list[str]]) -> list[int]:
+    values = [0] * CODEPOINT_MAX
+    for lo, hi, category in unicode_data_ranges(cache["category"]):
+        for cp in range(lo, hi + 1):
+            values[cp] = CATEGORIES.index(category)
+    for lo, hi, prop in unicode_data_ranges(cache["prop"]):
+        if prop == "White_Space":
+            for cp in range(lo, hi + 1):
+                values[cp] |= WHITE_SPACE
+    return values
+
+
+def unicode_data_stages(values: list[int]) -> tuple[list[int], list[int]]:
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for base in range(0, CODEPOINT_MAX, BLOCK_SIZE):
+        block = tuple(values[base : base + BLOCK_SIZE])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    if len(blocks) > 256:
+        raise ValueError(f"{len(blocks)} unique blocks do not fit a uint8_t stage 1")
+    return stage1, stage2
+
+
+def unicode_data_comments() -> list[str]:
+    version = 1
+    lines = []
+    lines.append("/**")
+    lines.append(" * @warning This file is auto-generated. Do not edit directly.")
+    lines.append(" * @brief General_Category and White_Space property data.")
+    lines.append(" * @ref Unicode UCD - Generated by unicode.property.py")
+    lines.append(f" * @version {version}")
+    lines.append(f" * @date {date.today()}")
+    lines.append(" */\n")
+    return lines
+
+
+def unicode_data_include(stage1: list[int], stage2: list[int]) -> str:
+    lines = unicode_data_comments()
+
+    lines.append("#ifndef UTF8_PROPERTY_DATA_H")
+    lines.append("#define UTF8_PROPERTY_DATA_H\n")
+
+    lines.append("#include <stddef.h>")
+    lines.append("#include <stdint.h>\n")
+
+    lines.append("typedef enum UTF8GeneralCategory {")
+    for i, category in enumerate(CATEGORIES):
+        lines.append(f"    UTF8_GC_{category.upper()} = {i},")
+    lines.append("} UTF8GeneralCategory;\n")
+
+    for group, members in GROUPS.items():
+        mask = " | ".join(f"(1u << UTF8_GC_{m.upper()})" for m in members)
+        lines.append(f"#define UTF8_GC_MASK_{group} ({mask})")
+    lines.append("")
+
+    lines.append(f"#define UTF8_PROPERTY_CATEGORY 0x{CATEGORY_MASK:02X}")
+    lines.append(f"#define UTF8_PROPERTY_WHITE_SPACE 0x{WHITE_SPACE:02X}")
+    lines.append(f"#define UTF8_PROPERTY_SHIFT {BLOCK_SHIFT}\n")
+
+    lines.append(f"extern const uint8_t utf8_property_stage1[{len(stage1)}];")
+    lines.append(f"extern const uint8_t utf8_property_stage2[{len(stage2)}];\n")
+
+    lines.append("#endif // UTF8_PROPERTY_DATA_H\n")
+
+    return "\n".join(lines)
+
+
+def unicode_data_table(name: str, values: list[int], columns: int = 16) -> list[str]:
+    lines = [f"const uint8_t {name}[{len(values)}] = {{"]
+    for i in range(0, len(values), columns):
+        row = ", ".join(f"0x{v:02X}" for v in values[i : i + columns])
+        lines.append(f"    {row},")
+    lines.append("};\n")
+    return lines
+
+
+def unicode_data_source(stage1: list[int], stage2: list[int]) -> str:
+    lines = unicode_data_comments()
+
+    lines.append('#include "property-data.h"\n')
+
+    lines.extend(unicode_data_table("utf8_property_stage1", stage1))
+    lines.extend(unicode_data_table("utf8_property_stage2", stage2))
+
+    return "\n".join(lines)
+
+
+def main():
+    cache = unicode_data_cache()
+    values = unicode_data_parse(cache)
+    stage1, stage2 = unicode_data_stages(values)
+
+    header = unicode_data_include(stage1, stage2)
+    with open("include/property-data.h", "w") as file:
+        file.write(header)
+
+    source = unicode_data_source(stage1, stage2)
+    with open("src/property-data.c", "w") as file:
+        file.write(source)
+
+
+if __name__ == "__main__":
+    main()